@@ -28,5 +28,7 @@ find_package(BerkeleyDB REQUIRED)
 find_package(METIS REQUIRED)
 find_package(TCL REQUIRED)
 find_package(MED REQUIRED)
+find_package(HDF5 REQUIRED COMPONENTS C)
+find_package(ZLIB REQUIRED)
 find_package(ORACLE)
 find_package(PythonLibs REQUIRED)
@@ -8,6 +8,7 @@ __email__= "l.pereztato@gmail.com, ana.Ortega.Ort@gmail.com"
 
 
 import math
+import xc
 
 
 
@@ -23,3 +24,19 @@ def exportDisplacements(combNm, nodSet, fDesc):
     strDisp= str(n.getDisp).rstrip().replace(' ',', ') #displacement vector [ux,uy,uz,rotx,roty,rotz]
     fDesc.write(combNm+", "+str(n.tag)+", " + strDisp+'\n')
     #fDesc.write(combNm+", "+str(n.tag)+", " + str(vDisp[0])+", "+str(vDisp[1])+", "+str(vDisp[2])+", "+str(vDisp[3])+", "+str(vDisp[4])+", "+str(vDisp[5])+'\n')
+
+def storeDisplacements(combNm, nodSet, store, fieldName= 'displacements'):
+  '''Appends the displacements of the nodes for the combination
+     to a field of a HDF5 results store (xc.HDF5ResultsStore).
+
+  :param combNM: name of the combination (step label).
+  :param nodSet: nodes of a set (DqPtrsNode).
+  :param store: results store.
+  :param fieldName: name of the field.
+  '''
+  extractor= xc.FieldExtractor(['disp'],[])
+  extractor.compile(nodSet)
+  if(not store.hasField(fieldName)):
+    componentNames= ['u'+str(i) for i in range(0,extractor.numColumns)]
+    store.newField(fieldName,extractor.tags,componentNames)
+  extractor.appendTo(store,fieldName,combNm)
@@ -7,6 +7,7 @@ __version__= "3.0"
 __email__= "l.pereztato@gmail.com"
 
 import math
+import xc
 from materials import ShellInternalForces as sif
 from materials import CrossSectionInternalForces as csif
 from miscUtils import LogMessages as lmsg
@@ -80,3 +81,36 @@ def exportBeamInternalForces(nmbComb, elems, fName):
     fName.write(nmbComb+", "+str(e.tag*10+1)+","+internalForces.getCSVString())
     internalForces= csif.CrossSectionInternalForces(e.getN2,e.getVy2,e.getVz2,e.getT2,e.getMy2,e.getMz2) # Internal forces at the end of the bar.
     fName.write(nmbComb+", "+str(e.tag*10+2)+","+internalForces.getCSVString())
+
+def storeInternalForces(nmbComb, elems, store, fieldName= 'internal_forces'):
+  '''Appends the internal forces at both ends of the beam elements
+     for the combination to a field of a HDF5 results store
+     (xc.HDF5ResultsStore).
+
+  :param nmbComb: combination name (step label).
+  :param elems: element set.
+  :param store: results store.
+  :param fieldName: name of the field.'''
+  tags= list()
+  rows= list()
+  for e in elems:
+    elementType= e.type()
+    if('Beam2d' in elementType):
+      e.getResistingForce()
+      iForces1= csif.CrossSectionInternalForces(e.getN1,e.getV1,0.0,0.0,0.0,e.getM1)
+      iForces2= csif.CrossSectionInternalForces(e.getN2,e.getV2,0.0,0.0,0.0,e.getM2)
+    elif('Beam' in elementType):
+      e.getResistingForce()
+      iForces1= csif.CrossSectionInternalForces(e.getN1,e.getVy1,e.getVz1,e.getT1,e.getMy1,e.getMz1)
+      iForces2= csif.CrossSectionInternalForces(e.getN2,e.getVy2,e.getVz2,e.getT2,e.getMy2,e.getMz2)
+    else:
+      lmsg.warning("storeInternalForces for element type: '"+elementType+"' not implemented.")
+      continue
+    tags.append(e.tag)
+    rows.append(iForces1.getComponents()+iForces2.getComponents())
+  if(not store.hasField(fieldName)):
+    componentNames= list()
+    for end in ['1','2']:
+      componentNames+= [c+end for c in ['N','Vy','Vz','T','My','Mz']]
+    store.newField(fieldName,xc.ID(tags),componentNames)
+  store.appendStep(fieldName,nmbComb,xc.Matrix(rows))
@@ -6,6 +6,10 @@ def salvaCombinacion(prb,nmbComb, tagComb, pth,db):
   db.save(tagSaveFase0)
 
 class DatabaseHelperSolve:
+  ''' Restores the state of the previous combination before solving
+      each combination and saves the resulting state. The database
+      can be a memory datastore (prb.newDatabase("Memory","")), so the
+      states are kept in memory instead of being written to disk.'''
   nombrePrevia= ""
   tagPrevia= -1
   db= None
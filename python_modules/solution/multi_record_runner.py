@@ -0,0 +1,175 @@
+# -*- coding: utf-8 -*-
+''' Runs the same model under a set of ground motion records and/or
+intensity levels (incremental dynamic analysis, multiple stripe
+analysis,...) using several worker processes.
+
+The model (nodes, elements, constraints, analysis objects,...) is
+built only once by the caller. Each run is executed on a forked copy
+of the current process, so the domain, the DOF graph and numbering
+are shared copy-on-write with the parent: every run starts from the
+state of the model at the moment run() is called and the runs can't
+interfere with each other (many elements and materials use static
+scratch storage, so threads are not an option here). The results of
+each run (whatever the task returns) are sent back to the parent
+through a pipe, so they must be picklable.
+
+The recorders that write to files (node_recorder, vtk_recorder,...)
+created before run() are inherited by all the children, which would
+write to the same files at the same time. Don't create them before
+calling run(): create them inside the task (i.e. in applyCase) with
+a file name that includes the case tag.'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+import sys
+import select
+import traceback
+import cPickle as pickle
+import xc
+
+class RunCase(object):
+  ''' Record and scale factor for a run.
+
+  :ivar record: object that identifies the record (name, file name,
+                list of values,...); it is interpreted by the task.
+  :ivar scale: scale factor (intensity level) for the record.
+  :ivar tag: identifier of the case (defaults to its index in
+             the list of cases).
+  '''
+  def __init__(self,record,scale= 1.0,tag= None):
+    self.record= record
+    self.scale= scale
+    self.tag= tag
+
+class RunError(object):
+  ''' Result of a run that ended with an exception (or that
+      terminated without returning its results).'''
+  def __init__(self,message):
+    self.message= message
+  def __str__(self):
+    return self.message
+
+class TimeHistoryTask(object):
+  ''' Time history analysis of a run case.
+
+  :ivar analysis: transient analysis object (already built).
+  :ivar numSteps: maximum number of time steps.
+  :ivar dT: time step.
+  :ivar applyCase: function (case) that applies the record to the model
+                   (creates the load pattern, sets the scale factor,...).
+                   File recorders must be created here, with a file
+                   name that depends on case.tag.
+  :ivar recorder: function (case, step) that returns the values to store
+                  at the end of each step.
+  :ivar collapseCriterion: function (case, values) that returns True if
+                           the structure must be considered collapsed
+                           (the run stops as soon as it does).
+  '''
+  def __init__(self,analysis,numSteps,dT,applyCase,recorder,collapseCriterion= None):
+    self.analysis= analysis
+    self.numSteps= numSteps
+    self.dT= dT
+    self.applyCase= applyCase
+    self.recorder= recorder
+    self.collapseCriterion= collapseCriterion
+
+  def __call__(self,case):
+    ''' Runs the analysis and returns a dictionary with the recorded
+        history and the reason why the analysis ended.'''
+    self.applyCase(case)
+    history= list()
+    collapsed= False
+    ok= 0
+    for i in range(0,self.numSteps):
+      ok= self.analysis.analyze(1,self.dT)
+      if(ok!=0):
+        break
+      values= self.recorder(case,i)
+      history.append(values)
+      if(self.collapseCriterion and self.collapseCriterion(case,values)):
+        collapsed= True
+        break
+    return {'history': history, 'collapsed': collapsed, 'converged': (ok==0), 'numSteps': len(history)}
+
+class MultiRecordRunner(object):
+  ''' Executes a task for each run case on its own forked process.
+
+  :ivar numWorkers: maximum number of simultaneous worker processes
+                    (defaults to the number of threads used by XC).
+  '''
+  def __init__(self,numWorkers= None):
+    if(numWorkers):
+      self.numWorkers= numWorkers
+    else:
+      self.numWorkers= max(xc.getNumThreads(),1)
+
+  def executeChild(self,task,case,fd):
+    ''' Runs the task on the child process and writes its results
+        on the pipe.'''
+    try:
+      out= (True,task(case))
+      data= pickle.dumps(out,pickle.HIGHEST_PROTOCOL)
+    except Exception:
+      data= pickle.dumps((False,traceback.format_exc()),pickle.HIGHEST_PROTOCOL)
+    f= os.fdopen(fd,'wb')
+    f.write(data)
+    f.close()
+
+  def run(self,cases,task):
+    ''' Runs task(case) for each one of the cases and returns the list
+        of results in the same order as the cases. The result of a
+        failed run is a RunError object.
+
+    :param cases: list of cases (RunCase objects or any other object
+                  understood by the task).
+    :param task: callable object that performs the analysis for a case.
+    '''
+    results= [None]*len(cases)
+    for idx,case in enumerate(cases):
+      if(isinstance(case,RunCase) and (case.tag is None)):
+        case.tag= idx
+    pending= list(enumerate(cases))
+    running= dict() # read end of the pipe -> [index, pid, chunks]
+    while(pending or running):
+      while(pending and (len(running)<self.numWorkers)):
+        idx,case= pending.pop(0)
+        r,w= os.pipe()
+        sys.stdout.flush()
+        sys.stderr.flush()
+        pid= os.fork()
+        if(pid==0): # child.
+          os.close(r)
+          for fd in running:
+            os.close(fd)
+          try:
+            self.executeChild(task,case,w)
+          finally:
+            # os._exit doesn't flush the Python buffers.
+            sys.stdout.flush()
+            sys.stderr.flush()
+            os._exit(0)
+        os.close(w)
+        running[r]= [idx,pid,list()]
+      ready,_,_= select.select(list(running.keys()),[],[])
+      for fd in ready:
+        chunk= os.read(fd,1<<16)
+        if(chunk):
+          running[fd][2].append(chunk)
+        else: # child finished.
+          idx,pid,chunks= running.pop(fd)
+          os.close(fd)
+          os.waitpid(pid,0)
+          try:
+            ok,value= pickle.loads(''.join(chunks))
+          except Exception:
+            ok,value= False,'run '+str(idx)+' terminated without results.'
+          if(ok):
+            results[idx]= value
+          else:
+            results[idx]= RunError(value)
+    return results
@@ -212,6 +212,26 @@ class SolutionProcedure(object):
     self.analysis= self.solu.newAnalysis("direct_integration_analysis","smt","")
     return self.analysis;
 
+  def explicitDynamics(self,prb):
+    ''' Explicit (central difference) dynamic analysis with lumped mass.
+       The algorithm, integrator and system of equations are not used by
+       the analysis (which works directly on nodes and elements) but the
+       solution method needs them.'''
+    self.solu= prb.getSoluProc
+    self.solCtrl= self.solu.getSoluControl
+    solModels= self.solCtrl.getModelWrapperContainer
+    self.sm= solModels.newModelWrapper("sm")
+    self.cHandler= self.sm.newConstraintHandler("plain_handler")
+    self.numberer= self.sm.newNumberer("default_numberer")
+    self.numberer.useAlgorithm("rcm")
+    solMethods= self.solCtrl.getSoluMethodContainer
+    self.smt= solMethods.newSoluMethod("smt","sm")
+    self.solAlgo= self.smt.newSolutionAlgorithm("linear_soln_algo")
+    self.integ= self.smt.newIntegrator("central_difference_no_damping_integrator",xc.Vector([]))
+    self.soe= self.smt.newSystemOfEqn("diagonal_soe")
+    self.analysis= self.solu.newAnalysis("explicit_dynamics_analysis","smt","")
+    return self.analysis
+
   def frequencyAnalysis(self,prb):
     self.solu= prb.getSoluProc
     self.solCtrl= self.solu.getSoluControl
@@ -253,6 +273,10 @@ def penalty_newton_raphson(prb):
   solution= SolutionProcedure()
   return solution.penaltyNewtonRaphson(prb)
 
+def explicit_dynamics(prb):
+  solution= SolutionProcedure()
+  return solution.explicitDynamics(prb)
+
 def frequency_analysis(prb):
   solution= SolutionProcedure()
   return solution.frequencyAnalysis(prb)
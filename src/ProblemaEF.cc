@@ -42,6 +42,8 @@
 #include "utility/database/MySqlDatastore.h"
 #include "utility/database/BerkeleyDbDatastore.h"
 #include "utility/database/SQLiteDatastore.h"
+#include "utility/database/MappedFileDatastore.h"
+#include "utility/database/MemoryDatastore.h"
 
 #include "domain/mesh/Mesh.h"
 #include "domain/domain/Domain.h"
@@ -57,6 +59,11 @@ XC::Domain *XC::ProblemaEF::theActiveDomain= nullptr;
 XC::ProblemaEF::ProblemaEF(void)
   : preprocessor(this,&output_handlers),proc_solu(this), dataBase(nullptr) {}
 
+//! @brief Returns the broker used to create the objects
+//! restored from a database.
+XC::FEM_ObjectBroker &XC::ProblemaEF::getObjectBroker(void)
+  { return theBroker; }
+
 //! @brief Database definition.
 XC::FE_Datastore *XC::ProblemaEF::defineDatabase(const std::string &tipo, const std::string &nombre)
   {
@@ -73,6 +80,10 @@ XC::FE_Datastore *XC::ProblemaEF::defineDatabase(const std::string &tipo, const
       dataBase= new BerkeleyDbDatastore(nombre, preprocessor, theBroker);
     else if(tipo == "SQLite")
       dataBase= new SQLiteDatastore(nombre, preprocessor, theBroker);
+    else if(tipo == "MappedFile")
+      dataBase= new MappedFileDatastore(nombre, preprocessor, theBroker);
+    else if(tipo == "Memory")
+      dataBase= new MemoryDatastore(preprocessor, theBroker);
     else
       {  
         std::cerr << "WARNING No database type exists ";
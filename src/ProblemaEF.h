@@ -40,6 +40,7 @@
 namespace XC {
 class Domain;
 class FE_Datastore;
+class FEM_ObjectBroker;
 class FEM_ObjectBrokerAllClasses;
 class MEDMesh;
 class MEDMeshing;
@@ -100,6 +101,7 @@ class ProblemaEF: public EntCmd
       { return gVERSION_SHORT; }
     void clearAll(void);
     FE_Datastore *defineDatabase(const std::string &tipo, const std::string &nombre);
+    static FEM_ObjectBroker &getObjectBroker(void);
     inline FE_Datastore *getDataBase(void)
       { return dataBase; }
     inline const Preprocessor &getPreprocessor(void) const
@@ -123,6 +123,7 @@
 #define TSERIES_TAG_TriangleSeries       10
 #define TSERIES_TAG_PeerMotion       11
 #define TSERIES_TAG_PeerNGAMotion       11
+#define TSERIES_TAG_MappedPathSeries       12
 
 #define PARAMETER_TAG_Parameter			1
 #define PARAMETER_TAG_MaterialStageParameter       2
@@ -386,6 +387,7 @@
 #define EquiALGORITHM_TAGS_PeriodicNewton       9
 #define EquiALGORITHM_TAGS_SecantNewton         10
 #define EquiALGORITHM_TAGS_AccelNewton          11
+#define EquiALGORITHM_TAGS_AdaptiveNewton       12
 
 #define ACCELERATOR_TAGS_Krylov		1
 #define ACCELERATOR_TAGS_Secant		2
@@ -495,10 +497,12 @@
 #define RECORDER_TAGS_NodePropRecorder		115
 #define RECORDER_TAGS_ElementPropRecorder	215
 #define RECORDER_TAGS_EnvelopeData              16
+#define RECORDER_TAGS_VtkRecorder               17
 
 #define DATAHANDLER_TAGS_DataOutputStreamHandler		1
 #define DATAHANDLER_TAGS_DataOutputFileHandler		2
 #define DATAHANDLER_TAGS_DataOutputDatabaseHandler		3
+#define DATAHANDLER_TAGS_DataOutputHDF5Handler		4
 
 #define DomDecompALGORITHM_TAGS_DomainDecompAlgo 1
 
@@ -636,6 +636,10 @@ int XC::Domain::revertToLastCommit(void)
     //
     mesh.revertToLastCommit();
 
+    // write buffered results (the rows of the committed steps
+    // must be in the file before the analysis is resumed).
+    ObjWithRecorders::flush();
+
     // set the current time and load factor in the domain to last committed
     setCurrentTime(timeTracker.getCommittedTime());
 
@@ -655,6 +659,8 @@ int XC::Domain::revertToStart(void)
     //
     mesh.revertToStart();
 
+    // write buffered results before restarting.
+    ObjWithRecorders::flush();
 // ADDED BY TERJE //////////////////////////////////
     // invoke 'restart' on all recorders
     ObjWithRecorders::restart();
@@ -85,6 +85,33 @@
 #include <domain/constraints/SFreedom_Constraint.h>
 #include <utility/recorder/Recorder.h>
 #include "domain/mesh/element/utils/NodePtrsWithIDs.h"
+#include <solution/analysis/analysis/DomainDecompositionAnalysis.h>
+#include "utility/threads/parallel_for.h"
+
+namespace XC {
+//! @brief Condenses the tangent of the i-th subdomain.
+class SubdomainTangentCondenser
+  {
+    std::vector<DomainDecompositionAnalysis *> &analyses;
+    std::vector<int> &results;
+  public:
+    SubdomainTangentCondenser(std::vector<DomainDecompositionAnalysis *> &a, std::vector<int> &r)
+      : analyses(a), results(r) {}
+    void operator()(const size_t &i)
+      { results[i]= analyses[i]->condenseTangent(); }
+  };
+
+//! @brief Recovers the internal DOFs of the i-th subdomain.
+class SubdomainInternalSolver
+  {
+    std::vector<DomainDecompositionAnalysis *> &analyses;
+  public:
+    SubdomainInternalSolver(std::vector<DomainDecompositionAnalysis *> &a)
+      : analyses(a) {}
+    void operator()(const size_t &i)
+      { analyses[i]->solveInternalResponse(); }
+  };
+} // end of XC namespace
 
 void XC::PartitionedDomain::libera(void)
   {
@@ -604,6 +631,7 @@ int XC::PartitionedDomain::update(void)
     // do the same for all the subdomains
     if(theSubdomains != 0)
       {
+        compute_subdomains_nodal_response();
         ArrayOfTaggedObjectsIter theSubsIter(*theSubdomains);
         TaggedObject *theObject;
         while((theObject= theSubsIter()) != 0)
@@ -659,6 +687,7 @@ int XC::PartitionedDomain::update(double newTime, double dT)
     // do the same for all the subdomains
     if(theSubdomains != 0)
       {
+        compute_subdomains_nodal_response();
         ArrayOfTaggedObjectsIter theSubsIter(*theSubdomains);
         TaggedObject *theObject;
         while((theObject= theSubsIter()) != 0)
@@ -675,6 +704,101 @@ int XC::PartitionedDomain::update(double newTime, double dT)
   }
 
 
+//! @brief Returns the analyses of the subdomains that make the static
+//! condensation here (shadow subdomains and independent analyses
+//! excluded).
+std::vector<XC::DomainDecompositionAnalysis *> XC::PartitionedDomain::get_condensation_analyses(void)
+  {
+    std::vector<DomainDecompositionAnalysis *> retval;
+    if(theSubdomains != 0)
+      {
+        ArrayOfTaggedObjectsIter theSubsIter(*theSubdomains);
+        TaggedObject *theObject;
+        while((theObject= theSubsIter()) != 0)
+          {
+            Subdomain *theSub= dynamic_cast<Subdomain *>(theObject);
+            DomainDecompositionAnalysis *theAnalysis= theSub->getCondensationAnalysis();
+            if(theAnalysis)
+              retval.push_back(theAnalysis);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Forms and condenses the tangent of all the subdomains.
+//!
+//! The tangents are assembled one subdomain after another (element
+//! code uses static storage) and then the factorization of the
+//! interior and the Schur complement of each subdomain are computed
+//! on its own thread. Subdomains whose assembled tangents are identical
+//! condense only once and copy the result. Invoked by the first
+//! subdomain whose tangent is requested (see Subdomain::computeTang).
+int XC::PartitionedDomain::condenseSubdomainTangents(void)
+  {
+    int retval= 0;
+    const std::vector<DomainDecompositionAnalysis *> all= get_condensation_analyses();
+    std::vector<DomainDecompositionAnalysis *> analyses;
+    for(size_t i= 0;i<all.size();i++)
+      {
+        const int res= all[i]->assembleTangent();
+        if(res==0)
+          analyses.push_back(all[i]);
+        else if(res<0)
+          retval= res;
+      }
+    // search for identical subdomains.
+    const size_t n= analyses.size();
+    std::vector<int> representative(n,-1);
+    std::vector<DomainDecompositionAnalysis *> toCondense;
+    for(size_t i= 0;i<n;i++)
+      {
+        for(size_t j= 0;j<i;j++)
+          if((representative[j]<0) && analyses[i]->hasSameTangent(*analyses[j]))
+            {
+              representative[i]= j;
+              break;
+            }
+        if(representative[i]<0)
+          toCondense.push_back(analyses[i]);
+      }
+    std::vector<int> results(toCondense.size(),0);
+    SubdomainTangentCondenser condenser(toCondense,results);
+    parallel_for(toCondense.size(),condenser);
+    for(size_t i= 0;i<results.size();i++)
+      if(results[i]<0)
+        retval= results[i];
+    for(size_t i= 0;i<n;i++)
+      {
+        const int j= representative[i];
+        if((j>=0) && analyses[j]->isTangentCondensed())
+          {
+            const int res= analyses[i]->copyCondensedTangent(*analyses[j]);
+            if(res<0)
+              retval= res;
+          }
+      }
+    return retval;
+  }
+
+//! @brief Recovers the internal DOFs of the subdomains, each
+//! subdomain on its own thread. The nodes are updated
+//! later (one subdomain after another) by computeNodalResponse.
+//!
+//! Only the subdomains whose external response has changed since
+//! the last call (i.e. after a new solution) are computed here; the
+//! other ones make the whole computation in computeNodalResponse
+//! (as they do without partitioned domain).
+void XC::PartitionedDomain::compute_subdomains_nodal_response(void)
+  {
+    const std::vector<DomainDecompositionAnalysis *> all= get_condensation_analyses();
+    std::vector<DomainDecompositionAnalysis *> analyses;
+    for(size_t i= 0;i<all.size();i++)
+      if(all[i]->setExternalResponse()==0) // new external response.
+        analyses.push_back(all[i]);
+    SubdomainInternalSolver solver(analyses);
+    parallel_for(analyses.size(),solver);
+  }
+
 int XC::PartitionedDomain::newStep(double dT)
   {
     Domain::newStep(dT);
@@ -68,6 +68,7 @@
 
 #include <domain/domain/Domain.h>
 #include "solution/graph/graph/Graph.h"
+#include <vector>
 
 namespace XC {
 class DomainPartitioner;
@@ -77,6 +78,7 @@ class ArrayOfTaggedObjects;
 class PartitionedDomainSubIter;
 class PartitionedDomainEleIter;
 class SingleDomEleIter;
+class DomainDecompositionAnalysis;
 
 //! @brief Partitioned domain.
 class PartitionedDomain: public Domain
@@ -93,6 +95,8 @@ class PartitionedDomain: public Domain
     Graph mySubdomainGraph; //! Grafo de conectividad de subdomains.
     void alloc(void);
     void libera(void);
+    std::vector<DomainDecompositionAnalysis *> get_condensation_analyses(void);
+    void compute_subdomains_nodal_response(void);
   protected:
     int barrierCheck(int result);
     DomainPartitioner *getPartitioner(void) const;
@@ -161,6 +165,7 @@ class PartitionedDomain: public Domain
     virtual SubdomainIter &getSubdomains(void);
     virtual bool removeExternalNode(int tag);        
     virtual Graph &getSubdomainGraph(void);
+    virtual int condenseSubdomainTangents(void);
 
     // nodal methods required in domain interface for parallel interprter
     virtual double getNodeDisp(int nodeTag, int dof, int &errorFlag);
@@ -69,6 +69,7 @@
 #include <domain/constraints/SFreedom_Constraint.h>
 #include <domain/constraints/MFreedom_Constraint.h>
 #include <utility/tagged/storage/ArrayOfTaggedObjects.h>
+#include <domain/domain/partitioned/PartitionedDomain.h>
 #include <solution/analysis/analysis/DomainDecompositionAnalysis.h>
 #include <solution/analysis/model/fe_ele/FE_Element.h>
 #include <domain/domain/single/SingleDomNodIter.h>
@@ -579,6 +580,12 @@ int XC::Subdomain::computeTang(void)
       {
         theTimer.start();
 
+        // if the subdomain belongs to a partitioned domain, the
+        // tangents of all its subdomains are condensed at once.
+        PartitionedDomain *thePartitionedDomain= dynamic_cast<PartitionedDomain *>(getDomain());
+        if(thePartitionedDomain && !theAnalysis->isTangentCondensed())
+          thePartitionedDomain->condenseSubdomainTangents();
+
         int res =0;
         res = theAnalysis->formTangent();
         return res;
@@ -615,6 +622,16 @@ int XC::Subdomain::computeResidual(void)
       }
   }
 
+//! @brief Returns the analysis used to condense the subdomain (nullptr
+//! if there is no analysis or the analysis is independent).
+XC::DomainDecompositionAnalysis *XC::Subdomain::getCondensationAnalysis(void)
+  {
+    DomainDecompositionAnalysis *retval= nullptr;
+    if(theAnalysis && !theAnalysis->doesIndependentAnalysis())
+      retval= theAnalysis;
+    return retval;
+  }
+
 const XC::Matrix &XC::Subdomain::getTang(void)
   {
     if(!theAnalysis)
@@ -188,6 +188,7 @@ class Subdomain: public Element, public Domain
     // Element type methods unique to a subdomain
     virtual int computeTang(void);
     virtual int computeResidual(void);
+    DomainDecompositionAnalysis *getCondensationAnalysis(void);
     virtual const Matrix &getTang(void);
 
     void setFE_ElementPtr(FE_Element *theFE_Ele);
@@ -33,6 +33,7 @@
 #include <domain/load/pattern/time_series_integrator/TrapezoidalTimeSeriesIntegrator.h>
 #include <domain/load/pattern/time_series/PathSeries.h>
 #include <domain/load/pattern/time_series/PathTimeSeries.h>
+#include <domain/load/pattern/time_series/MappedPathSeries.h>
 #include <utility/matrix/Vector.h>
 
 
@@ -117,6 +118,10 @@ void XC::MotionHistory::setIntegrator(TimeSeriesIntegrator *integrator)
 XC::TimeSeries *XC::MotionHistory::integrate(TimeSeries *theSeries) const
   {
     TimeSeries *retval= nullptr;
+    // the integrals of the mapped series are already on the file.
+    const MappedPathSeries *mapped= dynamic_cast<const MappedPathSeries *>(theSeries);
+    if(mapped && mapped->hasIntegral())
+      return mapped->getIntegral();
     // check that an integrator & accel series exist
     if(!theIntegrator)
       {
@@ -152,6 +157,9 @@ size_t XC::MotionHistory::getNumDataPoints(void) const
     const PathSeriesBase *tmp= dynamic_cast<const PathSeriesBase *>(theAccelSeries);
     if(tmp)
       return tmp->getNumDataPoints();
+    const MappedPathSeries *mapped= dynamic_cast<const MappedPathSeries *>(theAccelSeries);
+    if(mapped)
+      return mapped->getNumDataPoints();
     else
       return 0;
   }
@@ -36,6 +36,7 @@
 #include "domain/load/pattern/time_series/DiscretizedRandomProcessSeries.h"
 #include "domain/load/pattern/time_series/PathSeries.h"
 #include "domain/load/pattern/time_series/PathTimeSeries.h"
+#include "domain/load/pattern/time_series/MappedPathSeries.h"
 #include "domain/load/pattern/time_series/PulseSeries.h"
 #include "domain/load/pattern/time_series/RectangularSeries.h"
 #include "domain/load/pattern/time_series/SimulatedRandomProcessSeries.h"
@@ -217,6 +218,7 @@ void XC::MapLoadPatterns::removeAllFromDomain(void)
 //! - constant_ts: Defines a constant time series (ConstantSeries).
 //! - linear_ts: Defines a linear time series (LinearSeries).
 //! - path_ts: Defines a path time series (PathSeries).
+//! - mapped_path_ts: Defines a path time series read from a binary file mapped in memory (MappedPathSeries).
 //! - pulse_ts: Defines a pulse time series (PulseSeries).
 //! - rectangular_ts: Defines a rectangular time series (RectangularSeries).
 //! - triangular_ts: Defines a triangular time series (TriangleSeries).
@@ -232,6 +234,8 @@ XC::TimeSeries *XC::MapLoadPatterns::newTimeSeries(const std::string &tipo, cons
       ts= create_time_series<PathSeries>(cod_ts);
     else if(tipo == "path_time_ts")
       ts= create_time_series<PathTimeSeries>(cod_ts);
+    else if(tipo == "mapped_path_ts")
+      ts= create_time_series<MappedPathSeries>(cod_ts);
     else if(tipo == "pulse_ts")
       ts= create_time_series<PulseSeries>(cod_ts);
     else if(tipo == "rectangular_ts")
@@ -0,0 +1,467 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MappedPathSeries.cc
+
+#include "MappedPathSeries.h"
+#include <utility/matrix/Vector.h>
+#include "utility/actor/actor/CommMetaData.h"
+#include "utility/matrix/ID.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <fstream>
+#include <algorithm>
+#include <stdint.h>
+
+namespace XC {
+//! @brief File signature.
+static const char time_series_magic[8]= {'X','C','T','S','E','R','0','1'};
+//! @brief Size of the file header.
+static const size_t time_series_header_size= 64;
+
+//! @brief Header of the binary time series file.
+struct TimeSeriesFileHeader
+  {
+    char magic[8];
+    uint64_t numPoints;
+    double dt;
+    double startTime;
+    double peak[3];
+    char padding[8];
+  };
+} // end of XC namespace
+
+//! @brief Returns the files mapped in memory.
+XC::MappedTimeSeriesFile::file_map &XC::MappedTimeSeriesFile::get_files(void)
+  {
+    static file_map files;
+    return files;
+  }
+
+//! @brief Constructor.
+XC::MappedTimeSeriesFile::MappedTimeSeriesFile(const std::string &fName)
+  : fileName(fName), mappedData(nullptr), mappedSize(0), numPoints(0),
+    dt(0.0), startTime(0.0), times(nullptr), refCount(0)
+  {
+    peak[0]= peak[1]= peak[2]= 0.0;
+    columns[0]= columns[1]= columns[2]= nullptr;
+    fileId[0]= fileId[1]= fileId[2]= 0;
+  }
+
+//! @brief Destructor.
+XC::MappedTimeSeriesFile::~MappedTimeSeriesFile(void)
+  {
+    if(mappedData)
+      munmap(mappedData,mappedSize);
+  }
+
+//! @brief Maps the file in memory and checks its contents.
+bool XC::MappedTimeSeriesFile::open(void)
+  {
+    const int fd= ::open(fileName.c_str(),O_RDONLY);
+    if(fd<0)
+      {
+        std::cerr << "MappedTimeSeriesFile::" << __FUNCTION__
+                  << "; could not open file: " << fileName << std::endl;
+        return false;
+      }
+    struct stat st;
+    bool retval= false;
+    if((fstat(fd,&st)==0) && (size_t(st.st_size)>=time_series_header_size))
+      {
+        mappedSize= st.st_size;
+        void *ptr= mmap(nullptr,mappedSize,PROT_READ,MAP_SHARED,fd,0);
+        if(ptr!=MAP_FAILED)
+          {
+            mappedData= ptr;
+            fileId[0]= st.st_dev;
+            fileId[1]= st.st_ino;
+            fileId[2]= st.st_mtime;
+            TimeSeriesFileHeader hdr;
+            memcpy(&hdr,mappedData,sizeof(hdr));
+            numPoints= hdr.numPoints;
+            dt= hdr.dt;
+            startTime= hdr.startTime;
+            std::copy(hdr.peak,hdr.peak+3,peak);
+            const size_t numColumns= (dt>0.0 ? 3 : 4);
+            retval= (memcmp(hdr.magic,time_series_magic,sizeof(hdr.magic))==0) && (mappedSize==time_series_header_size+numColumns*numPoints*sizeof(double));
+            if(retval)
+              {
+                const double *values= reinterpret_cast<const double *>(static_cast<const char *>(mappedData)+time_series_header_size);
+                if(dt<=0.0)
+                  {
+                    times= values;
+                    values+= numPoints;
+                  }
+                for(size_t i= 0;i<3;i++)
+                  columns[i]= values+i*numPoints;
+              }
+          }
+      }
+    ::close(fd);
+    if(!retval)
+      std::cerr << "MappedTimeSeriesFile::" << __FUNCTION__
+                << "; file: " << fileName
+                << " is not a binary time series file." << std::endl;
+    return retval;
+  }
+
+//! @brief Returns the contents of the file (mapping it if not
+//! already done). The caller must call release when done.
+XC::MappedTimeSeriesFile *XC::MappedTimeSeriesFile::acquire(const std::string &fName)
+  {
+    file_map &files= get_files();
+    file_map::iterator i= files.find(fName);
+    if(i!=files.end())
+      {
+        struct stat st;
+        MappedTimeSeriesFile *f= i->second;
+        if((stat(fName.c_str(),&st)==0) && (f->fileId[0]==long(st.st_dev)) && (f->fileId[1]==long(st.st_ino)) && (f->fileId[2]==long(st.st_mtime)))
+          {
+            f->addRef();
+            return f;
+          }
+        files.erase(i); // file rewritten; the old mapping remains for its users.
+      }
+    MappedTimeSeriesFile *retval= new MappedTimeSeriesFile(fName);
+    if(retval->open())
+      {
+        retval->addRef();
+        files[fName]= retval;
+      }
+    else
+      {
+        delete retval;
+        retval= nullptr;
+      }
+    return retval;
+  }
+
+//! @brief Releases the contents of the file (the file is unmapped
+//! when it is not used anymore).
+void XC::MappedTimeSeriesFile::release(MappedTimeSeriesFile *f)
+  {
+    if(f)
+      {
+        f->refCount--;
+        if(f->refCount==0)
+          {
+            file_map &files= get_files();
+            file_map::iterator i= files.find(f->fileName);
+            if((i!=files.end()) && (i->second==f))
+              files.erase(i);
+            delete f;
+          }
+      }
+  }
+
+//! @brief Writes a binary time series file.
+//!
+//! @param fName: file name.
+//! @param values: values of the series.
+//! @param times: times of the points (ignored if dt>0).
+//! @param dt: time increment (if zero the times vector is used).
+//! @param t0: time of the first point (if dt>0).
+int XC::MappedTimeSeriesFile::write(const std::string &fName,const Vector &values,const Vector &times,const double &dt,const double &t0)
+  {
+    const size_t n= values.Size();
+    if((dt<=0.0) && (size_t(times.Size())!=n))
+      {
+        std::cerr << "MappedTimeSeriesFile::" << __FUNCTION__
+                  << "; the number of times: " << times.Size()
+                  << " is not equal to the number of values: "
+                  << n << std::endl;
+        return -1;
+      }
+    std::vector<double> vel(n,0.0), disp(n,0.0);
+    TimeSeriesFileHeader hdr;
+    memset(&hdr,0,sizeof(hdr));
+    memcpy(hdr.magic,time_series_magic,sizeof(hdr.magic));
+    hdr.numPoints= n;
+    hdr.dt= std::max(dt,0.0);
+    hdr.startTime= (dt>0.0 ? t0 : (n>0 ? times(0) : 0.0));
+    for(size_t i= 0;i<n;i++)
+      {
+        if(i>0) // trapezoidal rule.
+          {
+            const double h= (dt>0.0 ? dt : times(i)-times(i-1));
+            vel[i]= vel[i-1]+0.5*h*(values(i)+values(i-1));
+            disp[i]= disp[i-1]+0.5*h*(vel[i]+vel[i-1]);
+          }
+        hdr.peak[0]= std::max(hdr.peak[0],fabs(values(i)));
+        hdr.peak[1]= std::max(hdr.peak[1],fabs(vel[i]));
+        hdr.peak[2]= std::max(hdr.peak[2],fabs(disp[i]));
+      }
+    // Written with a temporary name so the processes that have the
+    // old file mapped keep seeing its contents.
+    const std::string tmpName= fName+".tmp";
+    std::ofstream out(tmpName.c_str(),std::ios::binary|std::ios::trunc);
+    out.write(reinterpret_cast<const char *>(&hdr),sizeof(hdr));
+    if(dt<=0.0)
+      out.write(reinterpret_cast<const char *>(times.getDataPtr()),n*sizeof(double));
+    out.write(reinterpret_cast<const char *>(values.getDataPtr()),n*sizeof(double));
+    if(n>0)
+      {
+        out.write(reinterpret_cast<const char *>(&vel[0]),n*sizeof(double));
+        out.write(reinterpret_cast<const char *>(&disp[0]),n*sizeof(double));
+      }
+    out.close();
+    if(!out || (rename(tmpName.c_str(),fName.c_str())!=0))
+      {
+        std::cerr << "MappedTimeSeriesFile::" << __FUNCTION__
+                  << "; can't write file: " << fName << std::endl;
+        return -1;
+      }
+    return 0;
+  }
+
+//! @brief Returns the index i of the interval [t_i,t_i+1] that
+//! contains the time (that must be between the first and the last
+//! times).
+//!
+//! @param t: time.
+//! @param hint: interval to check first.
+size_t XC::MappedTimeSeriesFile::findInterval(const double &t,const size_t &hint) const
+  {
+    const size_t last= numPoints-2;
+    size_t retval= 0;
+    if(!times)
+      retval= std::min(size_t((t-startTime)/dt),last);
+    else if((hint<=last) && (times[hint]<=t) && (t<=times[hint+1]))
+      retval= hint;
+    else if((hint<last) && (times[hint+1]<=t) && (t<=times[hint+2]))
+      retval= hint+1;
+    else
+      {
+        const double *pos= std::upper_bound(times,times+numPoints,t);
+        retval= (pos>times ? std::min(size_t(pos-times)-1,last) : 0);
+      }
+    return retval;
+  }
+
+//! @brief Default constructor.
+XC::MappedPathSeries::MappedPathSeries(void)
+  :CFactorSeries(TSERIES_TAG_MappedPathSeries), data(nullptr), column(0), currentLoc(0) {}
+
+//! @brief Constructor.
+//!
+//! @param fileName: name of the binary time series file.
+//! @param theFactor: factor that multiplies the values.
+XC::MappedPathSeries::MappedPathSeries(const std::string &fileName,const double &theFactor)
+  :CFactorSeries(TSERIES_TAG_MappedPathSeries,theFactor), data(nullptr), column(0), currentLoc(0)
+  { readFromFile(fileName); }
+
+//! @brief Copy constructor (the file contents are shared).
+XC::MappedPathSeries::MappedPathSeries(const MappedPathSeries &other)
+  :CFactorSeries(other), data(other.data), column(other.column), currentLoc(other.currentLoc)
+  {
+    if(data)
+      data->addRef();
+  }
+
+//! @brief Assignment operator (the file contents are shared).
+XC::MappedPathSeries &XC::MappedPathSeries::operator=(const MappedPathSeries &other)
+  {
+    if(other.data)
+      other.data->addRef();
+    MappedTimeSeriesFile::release(data);
+    CFactorSeries::operator=(other);
+    data= other.data;
+    column= other.column;
+    currentLoc= other.currentLoc;
+    return *this;
+  }
+
+//! @brief Destructor.
+XC::MappedPathSeries::~MappedPathSeries(void)
+  { MappedTimeSeriesFile::release(data); }
+
+//! @brief Maps the binary file being passed as parameter.
+void XC::MappedPathSeries::readFromFile(const std::string &fileName)
+  {
+    MappedTimeSeriesFile::release(data);
+    data= MappedTimeSeriesFile::acquire(fileName);
+    currentLoc= 0;
+  }
+
+//! @brief Returns the name of the file.
+std::string XC::MappedPathSeries::getFileName(void) const
+  { return (data ? data->getFileName() : std::string()); }
+
+//! @brief Returns the number of data points.
+size_t XC::MappedPathSeries::getNumDataPoints(void) const
+  { return (data ? data->getNumPoints() : 0); }
+
+//! @brief Returns true if the time increment is constant.
+bool XC::MappedPathSeries::isUniform(void) const
+  { return (data ? data->isUniform() : true); }
+
+//! @brief Returns true if the integral of the series is stored on the file.
+bool XC::MappedPathSeries::hasIntegral(void) const
+  { return (data && (column<2)); }
+
+//! @brief Returns a new series with the integral of this one
+//! (nullptr if not available). The caller must delete it.
+XC::MappedPathSeries *XC::MappedPathSeries::getIntegral(void) const
+  {
+    MappedPathSeries *retval= nullptr;
+    if(hasIntegral())
+      {
+        retval= new MappedPathSeries(*this);
+        retval->column++;
+      }
+    return retval;
+  }
+
+//! @brief Returns the value interpolated at the time being passed
+//! as parameter (zero outside the series).
+double XC::MappedPathSeries::getFactor(double pseudoTime) const
+  {
+    const size_t n= getNumDataPoints();
+    if(n<1)
+      return 0.0;
+    const double *values= data->getColumn(column);
+    const double t0= data->getTime(0);
+    if(n==1)
+      return (pseudoTime==t0 ? cFactor*values[0] : 0.0);
+    if((pseudoTime<t0) || (pseudoTime>data->getTime(n-1)))
+      return 0.0;
+    currentLoc= data->findInterval(pseudoTime,currentLoc);
+    const double time1= data->getTime(currentLoc);
+    const double time2= data->getTime(currentLoc+1);
+    const double value1= values[currentLoc];
+    const double value2= values[currentLoc+1];
+    return cFactor*(value1 + (value2-value1)*(pseudoTime-time1)/(time2 - time1));
+  }
+
+//! @brief Returns series duration.
+double XC::MappedPathSeries::getDuration(void) const
+  {
+    const size_t n= getNumDataPoints();
+    return (n>0 ? data->getTime(n-1) : 0.0);
+  }
+
+//! @brief Returns the peak value of the factor.
+double XC::MappedPathSeries::getPeakFactor(void) const
+  { return (data ? data->getPeak(column)*cFactor : 0.0); }
+
+//! @brief Returns the time increment of the interval that contains
+//! the time being passed as parameter.
+double XC::MappedPathSeries::getTimeIncr(double pseudoTime) const
+  {
+    double retval= 1.0;
+    const size_t n= getNumDataPoints();
+    if(n>1)
+      {
+        if(data->isUniform())
+          retval= data->getTimeIncr();
+        else
+          {
+            const double t= std::max(data->getTime(0),std::min(pseudoTime,data->getTime(n-1)));
+            const size_t i= data->findInterval(t,currentLoc);
+            retval= data->getTime(i+1)-data->getTime(i);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Writes a binary time series file with a constant time increment.
+int XC::MappedPathSeries::writeFile(const std::string &fileName,const Vector &values,const double &dt)
+  {
+    if(dt<=0.0)
+      {
+        std::cerr << "MappedPathSeries::" << __FUNCTION__
+                  << "; time increment must be greater than zero."
+                  << std::endl;
+        return -1;
+      }
+    return MappedTimeSeriesFile::write(fileName,values,Vector(),dt,0.0);
+  }
+
+//! @brief Writes a binary time series file with the times of each value.
+int XC::MappedPathSeries::writeFileWithTimes(const std::string &fileName,const Vector &values,const Vector &times)
+  { return MappedTimeSeriesFile::write(fileName,values,times,0.0,0.0); }
+
+//! @brief Send members through the channel being passed as parameter.
+int XC::MappedPathSeries::sendData(CommParameters &cp)
+  {
+    int res= CFactorSeries::sendData(cp);
+    res+= cp.sendString(getFileName(),getDbTagData(),CommMetaData(1));
+    res+= cp.sendInt(column,getDbTagData(),CommMetaData(2));
+    return res;
+  }
+
+//! @brief Receives members through the channel being passed as parameter.
+int XC::MappedPathSeries::recvData(const CommParameters &cp)
+  {
+    int res= CFactorSeries::recvData(cp);
+    std::string fileName;
+    res+= cp.receiveString(fileName,getDbTagData(),CommMetaData(1));
+    res+= cp.receiveInt(column,getDbTagData(),CommMetaData(2));
+    if(fileName!=getFileName())
+      readFromFile(fileName);
+    return res;
+  }
+
+//! @brief Sends object through the channel being passed as parameter.
+int XC::MappedPathSeries::sendSelf(CommParameters &cp)
+  {
+    inicComm(3);
+    int result= sendData(cp);
+
+    const int dataTag= getDbTag(cp);
+    result+= cp.sendIdData(getDbTagData(),dataTag);
+    if(result < 0)
+      std::cerr << "MappedPathSeries::sendSelf() - ch failed to send data\n";
+    return result;
+  }
+
+//! @brief Receives object through the channel being passed as parameter.
+int XC::MappedPathSeries::recvSelf(const CommParameters &cp)
+  {
+    inicComm(3);
+
+    const int dataTag = this->getDbTag();  
+    int result = cp.receiveIdData(getDbTagData(),dataTag);
+    if(result<0)
+      std::cerr << "MappedPathSeries::recvSelf() - ch failed to receive data\n";
+    else
+      result+= recvData(cp);
+    return result;    
+  }
+
+//! @brief Imprime el objeto.
+void XC::MappedPathSeries::Print(std::ostream &s, int flag) const
+  {
+    s << "MappedPathSeries file: " << getFileName()
+      << " number of points: " << getNumDataPoints()
+      << " column: " << column << std::endl;
+  }
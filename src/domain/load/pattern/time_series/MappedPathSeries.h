@@ -0,0 +1,149 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MappedPathSeries.h
+
+#ifndef MappedPathSeries_h
+#define MappedPathSeries_h
+
+#include "domain/load/pattern/time_series/CFactorSeries.h"
+#include <string>
+#include <map>
+
+namespace XC {
+class Vector;
+
+//! @ingroup TSeries
+//
+//! @brief Contents of a binary time series file mapped in memory.
+//!
+//! The file contains a 64 byte header (signature, number of points,
+//! time increment, start time and peak values) followed by the
+//! times (only if the time increment is not constant), the values
+//! and their first and second integrals (trapezoidal rule). The
+//! files are mapped read-only and shared by all the series that
+//! use them (and by the processes forked from the one that opened
+//! them).
+class MappedTimeSeriesFile
+  {
+  private:
+    std::string fileName; //!< Name of the file.
+    void *mappedData; //!< Pointer to the mapped file.
+    size_t mappedSize; //!< Size of the mapping.
+    size_t numPoints; //!< Number of data points.
+    double dt; //!< Time increment (0 if not constant).
+    double startTime; //!< Time of the first point.
+    double peak[3]; //!< Peak value of each column.
+    const double *times; //!< Time values (nullptr if dt is constant).
+    const double *columns[3]; //!< Values and their integrals.
+    size_t refCount; //!< Number of series that use the file.
+    long fileId[3]; //!< device, inode and modification time of the file.
+
+    typedef std::map<std::string,MappedTimeSeriesFile *> file_map;
+    static file_map &get_files(void);
+
+    MappedTimeSeriesFile(const std::string &);
+    ~MappedTimeSeriesFile(void);
+    MappedTimeSeriesFile(const MappedTimeSeriesFile &);
+    MappedTimeSeriesFile &operator=(const MappedTimeSeriesFile &);
+    bool open(void);
+  public:
+    static MappedTimeSeriesFile *acquire(const std::string &);
+    static void release(MappedTimeSeriesFile *);
+    inline void addRef(void)
+      { refCount++; }
+    static int write(const std::string &,const Vector &,const Vector &,const double &,const double &);
+
+    inline const std::string &getFileName(void) const
+      { return fileName; }
+    inline size_t getNumPoints(void) const
+      { return numPoints; }
+    inline double getTimeIncr(void) const
+      { return dt; }
+    inline bool isUniform(void) const
+      { return (times==nullptr); }
+    inline double getTime(const size_t &i) const
+      { return (times ? times[i] : startTime+i*dt); }
+    inline double getPeak(const int &col) const
+      { return peak[col]; }
+    inline const double *getColumn(const int &col) const
+      { return columns[col]; }
+    size_t findInterval(const double &,const size_t &) const;
+  };
+
+//! @ingroup TSeries
+//
+//! @brief Time series that interpolates linearly the values
+//! read from a binary file mapped in memory (see MappedTimeSeriesFile).
+//!
+//! The interval that contains the time is obtained directly if the
+//! time increment is constant; otherwise the last interval is checked
+//! first and then a binary search is made. The first and second
+//! integrals of the series (velocities and displacements of a ground
+//! motion) are stored on the file, so they don't need to be computed
+//! when the series is used as an acceleration record.
+class MappedPathSeries: public CFactorSeries
+  {
+  private:
+    MappedTimeSeriesFile *data; //!< Shared file contents.
+    int column; //!< 0: values, 1: first integral, 2: second integral.
+    mutable size_t currentLoc; //!< last interval (search hint).
+  protected:
+    int sendData(CommParameters &cp);
+    int recvData(const CommParameters &cp);
+  public:
+    MappedPathSeries(void);
+    MappedPathSeries(const std::string &fileName,const double &cfactor= 1.0);
+    MappedPathSeries(const MappedPathSeries &);
+    MappedPathSeries &operator=(const MappedPathSeries &);
+    ~MappedPathSeries(void);
+    TimeSeries *getCopy(void) const
+      { return new MappedPathSeries(*this); }
+
+    void readFromFile(const std::string &fileName);
+    std::string getFileName(void) const;
+    size_t getNumDataPoints(void) const;
+    bool isUniform(void) const;
+    inline int getColumn(void) const
+      { return column; }
+    bool hasIntegral(void) const;
+    MappedPathSeries *getIntegral(void) const;
+
+    double getFactor(double pseudoTime) const;
+    double getDuration(void) const;
+    double getPeakFactor(void) const;
+    double getTimeIncr(double pseudoTime) const;
+
+    static int writeFile(const std::string &,const Vector &,const double &);
+    static int writeFileWithTimes(const std::string &,const Vector &,const Vector &);
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+    void Print(std::ostream &s, int flag =0) const;
+  };
+} // end of XC namespace
+
+#endif
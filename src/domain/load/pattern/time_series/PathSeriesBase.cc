@@ -110,7 +110,7 @@ void XC::PathSeriesBase::Print(std::ostream &s, int flag) const
 //! @brief Send members through the channel being passed as parameter.
 int XC::PathSeriesBase::sendData(CommParameters &cp)
   {
-    int res= sendData(cp);
+    int res= CFactorSeries::sendData(cp);
     res+= cp.sendVector(thePath,getDbTagData(),CommMetaData(1));
     res+= cp.sendInt(lastSendCommitTag,getDbTagData(),CommMetaData(2));
     return res;
@@ -119,7 +119,7 @@ int XC::PathSeriesBase::sendData(CommParameters &cp)
 //! @brief Receives members through the channel being passed as parameter.
 int XC::PathSeriesBase::recvData(const CommParameters &cp)
   {
-    int res= recvData(cp);
+    int res= CFactorSeries::recvData(cp);
     res+= cp.receiveVector(thePath,getDbTagData(),CommMetaData(1));
     res+= cp.receiveInt(lastSendCommitTag,getDbTagData(),CommMetaData(2));
     return res;
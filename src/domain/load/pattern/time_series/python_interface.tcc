@@ -63,6 +63,17 @@ class_<XC::PathTimeSeries, bases<XC::PathSeriesBase>, boost::noncopyable >("Path
   .def("readFromFiles",&XC::PathTimeSeries::readFromFiles,"Read motion data from files.")
   ;
 
+class_<XC::MappedPathSeries, bases<XC::CFactorSeries>, boost::noncopyable >("MappedPathSeries", no_init)
+  .def("readFromFile",&XC::MappedPathSeries::readFromFile,"Maps the binary file in memory.")
+  .add_property("fileName", &XC::MappedPathSeries::getFileName)
+  .add_property("numDataPoints", &XC::MappedPathSeries::getNumDataPoints)
+  .add_property("isUniform", &XC::MappedPathSeries::isUniform)
+  .def("writeFile",&XC::MappedPathSeries::writeFile,"Writes a binary time series file (values,time increment).")
+  .staticmethod("writeFile")
+  .def("writeFileWithTimes",&XC::MappedPathSeries::writeFileWithTimes,"Writes a binary time series file (values,times).")
+  .staticmethod("writeFileWithTimes")
+  ;
+
 class_<XC::DiscretizedRandomProcessSeries, bases<XC::TimeSeries>, boost::noncopyable >("DiscretizedRandomProcessSeries", no_init)
   ;
 
@@ -113,7 +113,7 @@ void XC::Mesh::init_bounds(void)
 //! @brief Constructor.
 XC::Mesh::Mesh(EntCmd *owr)
   :MeshComponentContainer(owr,DOMAIN_TAG_Mesh), eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false),
-   theBounds(6), lockers(this)
+   theBounds(6), numFailedElements(0), lockers(this)
   {
     alloc_contenedores();
     alloc_iters();
@@ -125,7 +125,7 @@ XC::Mesh::Mesh(EntCmd *owr)
 //! @brief Constructor.
 XC::Mesh::Mesh(EntCmd *owr,TaggedObjectStorage &theNodesStorage,TaggedObjectStorage &theElementsStorage)
   : MeshComponentContainer(owr,DOMAIN_TAG_Mesh), eleGraphBuiltFlag(false),
-    nodeGraphBuiltFlag(false), theNodes(&theNodesStorage), theElements(&theElementsStorage), theBounds(6), lockers(this)
+    nodeGraphBuiltFlag(false), theNodes(&theNodesStorage), theElements(&theElementsStorage), theBounds(6), numFailedElements(0), lockers(this)
   {
     // init the iters
     alloc_iters();
@@ -144,7 +144,7 @@ XC::Mesh::Mesh(EntCmd *owr,TaggedObjectStorage &theNodesStorage,TaggedObjectStor
 XC::Mesh::Mesh(EntCmd *owr,TaggedObjectStorage &theStorage)
   : MeshComponentContainer(owr,DOMAIN_TAG_Mesh),
     eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false),
-    theBounds(6), lockers(this)
+    theBounds(6), numFailedElements(0), lockers(this)
   {
     // init the arrays for storing the mesh components
     theStorage.clearAll(); // clear the storage just in case populated
@@ -419,6 +419,22 @@ const XC::Element *XC::Mesh::getNearestElement(const Pos3d &p) const
     return this_no_const->getNearestElement(p);
   }
 
+//! @brief Returns a pointer to the element that contains the point
+//! being passed as parameter (nullptr if there is no such element).
+XC::Element *XC::Mesh::getElementContaining(const Pos3d &p,const double &tol)
+  {
+    Element *retval= const_cast<Element *>(kdtreeElements.getElementContaining(p,tol));
+    return retval;
+  }
+
+//! @brief Returns a pointer to the element that contains the point
+//! being passed as parameter (nullptr if there is no such element).
+const XC::Element *XC::Mesh::getElementContaining(const Pos3d &p,const double &tol) const
+  {
+    Mesh *this_no_const= const_cast<Mesh *>(this);
+    return this_no_const->getElementContaining(p,tol);
+  }
+
 //! @brief Returns true if the mesh has a node with the tag being passed as parameter.
 bool XC::Mesh::existNode(int tag)
  { return theNodes->existComponent(tag); }
@@ -761,18 +777,30 @@ int XC::Mesh::revertToStart(void)
 int XC::Mesh::update(void)
   {
     int ok = 0;
+    numFailedElements= 0;
 
     // invoke update on all the ele's
     ElementIter &theEles = this->getElements();
     Element *theEle;
     while((theEle = theEles()) != 0)
-      { ok += theEle->update(); }
+      {
+        const int res= theEle->update();
+        if(res != 0)
+          {
+            ok+= res;
+            numFailedElements++;
+          }
+      }
 
     if(ok != 0)
       std::cerr << "XC::Mesh::update - mesh failed in update\n";
     return ok;
   }
 
+//! @brief Returns the number of elements that failed in the last update.
+int XC::Mesh::getNumFailedElements(void) const
+  { return numFailedElements; }
+
 
 
 //! @brief Returns true if the modelo ha cambiado.
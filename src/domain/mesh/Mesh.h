@@ -82,6 +82,7 @@ class Mesh: public MeshComponentContainer
 
     Vector theBounds;
     int tagNodeCheckReactionException;//!< Exception for checking reactions (see Domain::checkNodalReactions).
+    int numFailedElements; //!< Number of elements that failed in the last update.
 
     NodeLockers lockers; //!< To block deactivated (dead) nodes.
 
@@ -148,6 +149,8 @@ class Mesh: public MeshComponentContainer
     virtual const Element *getElement(int tag) const;
     Element *getNearestElement(const Pos3d &p);
     const Element *getNearestElement(const Pos3d &p) const;
+    Element *getElementContaining(const Pos3d &p,const double &tol= 0.0);
+    const Element *getElementContaining(const Pos3d &p,const double &tol= 0.0) const;
     bool existNode(int tag);
     virtual Node *getNode(int tag);
     virtual const Node *getNode(int tag) const;
@@ -181,6 +184,7 @@ class Mesh: public MeshComponentContainer
     virtual int revertToLastCommit(void);
     virtual int revertToStart(void);
     int update(void);
+    int getNumFailedElements(void) const;
 
     void freeze_dead_nodes(const std::string &nmbLocker);
     void melt_alive_nodes(const std::string &nmbLocker);
@@ -60,6 +60,8 @@
 //
 
 #include <cstdlib>
+#include <cmath>
+#include <algorithm>
 
 #include "Element.h"
 #include "domain/mesh/element/utils/NodePtrsWithIDs.h"
@@ -85,6 +87,7 @@
 #include "utility/med_xc/MEDGaussModel.h"
 #include "utility/actor/actor/CommMetaData.h"
 #include "vtkCellType.h"
+#include "domain/mesh/element/utils/ParticlePos3d.h"
 
 std::deque<XC::Matrix> XC::Element::theMatrices;
 std::deque<XC::Vector> XC::Element::theVectors1;
@@ -902,6 +905,119 @@ double XC::Element::getDist(const Pos3d &p,bool initialGeometry) const
     return 0.0;
   }
 
+//! @brief Computes the position and the jacobian of the trilinear
+//! mapping of an hexahedron at the natural coordinates being passed
+//! as parameter (nodes ordered as in shp3d).
+static void hexa8_mapping(const double xl[3][8],const double ss[3],double x[3],double J[3][3])
+  {
+    static const double sgn[8][3]= {{-1,-1,-1},{1,-1,-1},{1,1,-1},{-1,1,-1},
+                                     {-1,-1,1},{1,-1,1},{1,1,1},{-1,1,1}};
+    for(size_t i= 0;i<3;i++)
+      {
+        x[i]= 0.0;
+        J[i][0]= J[i][1]= J[i][2]= 0.0;
+      }
+    for(size_t a= 0;a<8;a++)
+      {
+        const double f0= 1.0+ss[0]*sgn[a][0];
+        const double f1= 1.0+ss[1]*sgn[a][1];
+        const double f2= 1.0+ss[2]*sgn[a][2];
+        const double N= 0.125*f0*f1*f2;
+        const double dN[3]= {0.125*sgn[a][0]*f1*f2,0.125*sgn[a][1]*f0*f2,0.125*sgn[a][2]*f0*f1};
+        for(size_t i= 0;i<3;i++)
+          {
+            x[i]+= N*xl[i][a];
+            for(size_t j= 0;j<3;j++)
+              J[i][j]+= dN[j]*xl[i][a];
+          }
+      }
+  }
+
+//! @brief Returns the natural coordinates of the point in the
+//! hexahedron defined by the first eight nodes of the element
+//! (the trilinear mapping is inverted using Newton-Raphson).
+XC::ParticlePos3d XC::Element::get_hexa8_natural_coordinates(const Pos3d &p,bool initialGeometry) const
+  {
+    const NodePtrsWithIDs &nodes= getNodePtrs();
+    double xl[3][8];
+    for(size_t a= 0;a<8;a++)
+      {
+        const Pos3d pa= nodes.getPosNodo(a,initialGeometry);
+        xl[0][a]= pa.x(); xl[1][a]= pa.y(); xl[2][a]= pa.z();
+      }
+    const double pt[3]= {p.x(),p.y(),p.z()};
+    double ss[3]= {0.0,0.0,0.0};
+    double x[3], J[3][3];
+    for(size_t iter= 0;iter<25;iter++)
+      {
+        hexa8_mapping(xl,ss,x,J);
+        const double r[3]= {pt[0]-x[0],pt[1]-x[1],pt[2]-x[2]};
+        const double c00= J[1][1]*J[2][2]-J[1][2]*J[2][1];
+        const double c01= J[1][2]*J[2][0]-J[1][0]*J[2][2];
+        const double c02= J[1][0]*J[2][1]-J[1][1]*J[2][0];
+        const double det= J[0][0]*c00+J[0][1]*c01+J[0][2]*c02;
+        if(fabs(det)<1e-300)
+          break;
+        //Cramer's rule.
+        const double d0= (r[0]*c00+J[0][1]*(r[2]*J[1][2]-r[1]*J[2][2])+J[0][2]*(r[1]*J[2][1]-r[2]*J[1][1]))/det;
+        const double d1= (J[0][0]*(r[1]*J[2][2]-r[2]*J[1][2])+r[0]*c01+J[0][2]*(r[2]*J[1][0]-r[1]*J[2][0]))/det;
+        const double d2= (J[0][0]*(r[2]*J[1][1]-r[1]*J[2][1])+J[0][1]*(r[1]*J[2][0]-r[2]*J[1][0])+r[0]*c02)/det;
+        ss[0]+= d0; ss[1]+= d1; ss[2]+= d2;
+        for(size_t i= 0;i<3;i++) //Points far away from the element.
+          ss[i]= std::max(-10.0,std::min(ss[i],10.0));
+        if(std::max(fabs(d0),std::max(fabs(d1),fabs(d2)))<1e-12)
+          break;
+      }
+    return ParticlePos3d(ss[0],ss[1],ss[2]);
+  }
+
+//! @brief Returns true if the point is inside the element (or if
+//! its distance to the element is not greater than tol).
+//!
+//! For one and two-dimensional elements the distance to the element
+//! is used (see getDist). For three-dimensional elements the point is
+//! mapped to the natural coordinates of the hexahedron defined by its
+//! first eight nodes; the point with the nearest natural coordinates
+//! inside the element is mapped back and its distance to the point
+//! is compared with the tolerance.
+bool XC::Element::In(const Pos3d &p,const double &tol,bool initialGeometry) const
+  {
+    bool retval= false;
+    const size_t dim= getDimension();
+    if((dim==1) || (dim==2))
+      retval= (getDist(p,initialGeometry)<=tol);
+    else if((dim==3) && (getNumExternalNodes()>=8))
+      {
+        const ParticlePos3d nc= get_hexa8_natural_coordinates(p,initialGeometry);
+        double ss[3]= {nc.r_coordinate(),nc.s_coordinate(),nc.t_coordinate()};
+        bool inside= true;
+        for(size_t i= 0;i<3;i++)
+          if(fabs(ss[i])>1.0)
+            {
+              inside= false;
+              ss[i]= (ss[i]>0.0 ? 1.0 : -1.0);
+            }
+        if(inside)
+          retval= true;
+        else if(tol>0.0)
+          {
+            const NodePtrsWithIDs &nodes= getNodePtrs();
+            double xl[3][8], x[3], J[3][3];
+            for(size_t a= 0;a<8;a++)
+              {
+                const Pos3d pa= nodes.getPosNodo(a,initialGeometry);
+                xl[0][a]= pa.x(); xl[1][a]= pa.y(); xl[2][a]= pa.z();
+              }
+            hexa8_mapping(xl,ss,x,J);
+            retval= (dist(Pos3d(x[0],x[1],x[2]),p)<=tol);
+          }
+      }
+    else
+      std::cerr << nombre_clase() << "::" << __FUNCTION__
+                << "; not implemented for this type of element." << std::endl;
+    return retval;
+  }
+
 //! @brief Returns the coordinates del centro de gravedad of the element.
 Pos3d XC::Element::getPosCdg(bool initialGeometry) const
   {
@@ -123,6 +123,7 @@ class Element: public MeshComponent
     friend class Preprocessor;
     virtual TritrizPtrElem put_on_mesh(const TritrizPtrNod &,meshing_dir) const;
     virtual TritrizPtrElem cose(const SetEstruct &f1,const SetEstruct &f2) const;
+    ParticlePos3d get_hexa8_natural_coordinates(const Pos3d &,bool initialGeometry= true) const;
 
     const Vector &getRayleighDampingForces(void) const;
 
@@ -172,6 +173,9 @@ class Element: public MeshComponent
     virtual int addInertiaLoadToUnbalance(const Vector &accel)=0;
 
     virtual int setRayleighDampingFactors(const RayleighDampingFactors &rF) const;
+    //! @brief Returns the Rayleigh damping factors of the element.
+    inline const RayleighDampingFactors &getRayleighDampingFactors(void) const
+      { return rayFactors; }
 
     // methods for obtaining resisting force (force includes elemental loads)
     virtual const Vector &getResistingForce(void) const= 0;
@@ -217,6 +221,7 @@ class Element: public MeshComponent
     virtual double getDist(const Pos2d &p,bool initialGeometry= true) const;
     virtual double getDist2(const Pos3d &p,bool initialGeometry= true) const;
     virtual double getDist(const Pos3d &p,bool initialGeometry= true) const;
+    virtual bool In(const Pos3d &p,const double &tol= 0.0,bool initialGeometry= true) const;
 
     void resetTributarias(void) const;
     void vuelcaTributarias(const std::vector<double> &) const;
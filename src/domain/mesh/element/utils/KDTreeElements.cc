@@ -28,7 +28,14 @@
 
 #include "KDTreeElements.h"
 #include "domain/mesh/element/Element.h"
+#include "domain/mesh/node/Node.h"
+#include "domain/mesh/element/utils/NodePtrsWithIDs.h"
 #include "xc_utils/src/geom/pos_vec/Pos3d.h"
+#include "utility/threads/parallel_for.h"
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <cmath>
 
 //! @brief Constructor.
 XC::ElemPos::ElemPos(const Element &e)
@@ -40,16 +47,98 @@ XC::ElemPos::ElemPos(const Pos3d &p)
   
 //! @brief Constructor.
 XC::KDTreeElements::KDTreeElements(void)
-  : tree_type(std::ptr_fun(ElemPos::tac)), pend_optimizar(0) {}
+  : tree_type(std::ptr_fun(ElemPos::tac)), pend_optimizar(0),
+    version(Node::getGeomVersion()), maxRadius(0.0) {}
 
+//! @brief Returns the maximum distance from the element centroid
+//! to its nodes.
+double element_radius(const XC::Element &e)
+  {
+    double retval= 0.0;
+    const Pos3d cdg= e.getPosCdg();
+    const std::list<Pos3d> posNodes= e.getPosNodos();
+    for(std::list<Pos3d>::const_iterator i= posNodes.begin();i!=posNodes.end();i++)
+      retval= std::max(retval,dist2(*i,cdg));
+    return sqrt(retval);
+  }
+
+//! @brief Rebuilds the tree with the current positions of its elements.
+void XC::KDTreeElements::rebuild(void)
+  {
+    std::vector<const Element *> elements;
+    elements.reserve(size());
+    for(tree_type::const_iterator i= begin();i!=end();i++)
+      elements.push_back(i->getElementPtr());
+    clear();
+    for(std::vector<const Element *>::const_iterator i= elements.begin();i!=elements.end();i++)
+      insert(**i);
+    tree_type::optimise();
+    pend_optimizar= 0;
+  }
+
+//! @brief Returns true if some node of the element has been moved
+//! after the geometry version being passed as parameter.
+bool element_moved(const XC::Element &e,const size_t &version)
+  {
+    bool retval= false;
+    const XC::NodePtrsWithIDs &nodes= e.getNodePtrs();
+    const size_t numNodes= nodes.size();
+    for(size_t i= 0;i<numNodes;i++)
+      {
+        const XC::Node *n= nodes[i];
+        if(n && (n->getPosVersion()>version))
+          {
+            retval= true;
+            break;
+          }
+      }
+    return retval;
+  }
+
+//! @brief Reinserts the elements connected to nodes moved since
+//! the last update (rebuilds the tree if most of them have moved).
+void XC::KDTreeElements::update_moved(void)
+  {
+    std::vector<ElemPos> moved;
+    for(tree_type::const_iterator i= begin();i!=end();i++)
+      if(element_moved(*i->getElementPtr(),version))
+        moved.push_back(*i);
+    if(2*moved.size()>size())
+      rebuild();
+    else
+      {
+        for(std::vector<ElemPos>::const_iterator i= moved.begin();i!=moved.end();i++)
+          {
+            tree_type::erase(*i); //Stored (old) position.
+            insert(*i->getElementPtr());
+          }
+        pend_optimizar+= moved.size();
+        if(pend_optimizar>=10)
+          {
+            tree_type::optimise();
+            pend_optimizar= 0;
+          }
+      }
+    version= Node::getGeomVersion();
+  }
+
+//! @brief Updates the tree if some node has been moved since
+//! the last time it was updated.
+void XC::KDTreeElements::update(void) const
+  {
+    if(version!=Node::getGeomVersion())
+      const_cast<KDTreeElements *>(this)->update_moved();
+  }
 
 void XC::KDTreeElements::insert(const Element &n)
   {
     tree_type::insert(n);
+    maxRadius= std::max(maxRadius,element_radius(n));
   }
 
 void XC::KDTreeElements::erase(const Element &n)
   {
+    update(); //Stored positions must match the element position.
     tree_type::erase(n);
     pend_optimizar++;
     if(pend_optimizar>=10)
@@ -60,11 +149,16 @@ void XC::KDTreeElements::erase(const Element &n)
   }
 
 void XC::KDTreeElements::clear(void)
-  { tree_type::clear(); }
+  {
+    tree_type::clear();
+    version= Node::getGeomVersion();
+    maxRadius= 0.0;
+  }
 
 //! @brief Returns the node closest to the position being passed as parameter.
 const XC::Element *XC::KDTreeElements::getNearestElement(const Pos3d &pos) const
   {
+    update();
     const Element *retval= nullptr;
     ElemPos target(pos);
     std::pair<tree_type::const_iterator,double> found = find_nearest(target);
@@ -77,6 +171,7 @@ const XC::Element *XC::KDTreeElements::getNearestElement(const Pos3d &pos) const
 //! being passed as parameter.
 const XC::Element *XC::KDTreeElements::getNearestElement(const Pos3d &pos, const double &r) const
   {
+    update();
     const Element *retval= nullptr;
     ElemPos target(pos);
     std::pair<tree_type::const_iterator,double> found = find_nearest(target,r);
@@ -84,3 +179,123 @@ const XC::Element *XC::KDTreeElements::getNearestElement(const Pos3d &pos, const
       retval= found.first->getElementPtr();
     return retval;
   }
+
+//! @brief Returns the elements whose centroid distance to the
+//! position being passed as parameter is less or equal than r.
+XC::KDTreeElements::elem_ptr_list XC::KDTreeElements::getElementsWithinRadius(const Pos3d &pos,const double &r) const
+  {
+    update();
+    elem_ptr_list retval;
+    std::vector<ElemPos> candidates;
+    find_within_range(ElemPos(pos),r,std::back_inserter(candidates));
+    const double r2= r*r;
+    for(std::vector<ElemPos>::const_iterator i= candidates.begin();i!=candidates.end();i++)
+      {
+        const Pos3d cdg((*i)[0],(*i)[1],(*i)[2]);
+        if(dist2(cdg,pos)<=r2)
+          retval.push_back(i->getElementPtr());
+      }
+    return retval;
+  }
+
+//! @brief Return true if the point is inside the bounding
+//! box of the element nodes.
+bool in_element_box(const XC::Element &e,const Pos3d &pos,const double &tol)
+  {
+    const std::list<Pos3d> posNodes= e.getPosNodos();
+    if(posNodes.empty())
+      return false;
+    std::list<Pos3d>::const_iterator i= posNodes.begin();
+    double xmin= i->x(), xmax= xmin, ymin= i->y(), ymax= ymin, zmin= i->z(), zmax= zmin;
+    for(;i!=posNodes.end();i++)
+      {
+        xmin= std::min(xmin,i->x()); xmax= std::max(xmax,i->x());
+        ymin= std::min(ymin,i->y()); ymax= std::max(ymax,i->y());
+        zmin= std::min(zmin,i->z()); zmax= std::max(zmax,i->z());
+      }
+    return ((pos.x()>=xmin-tol) && (pos.x()<=xmax+tol) &&
+            (pos.y()>=ymin-tol) && (pos.y()<=ymax+tol) &&
+            (pos.z()>=zmin-tol) && (pos.z()<=zmax+tol));
+  }
+
+//! @brief Returns the element that contains the position being
+//! passed as parameter (nullptr if none).
+//!
+//! The candidates are the elements whose centroids are closer to
+//! the point than the biggest element "radius" and whose node
+//! bounding box contains the point. For 1D and 2D elements the nearest
+//! one (see getDist) is returned; for 3D elements the natural
+//! coordinates of the point are checked (see Element::In).
+//! @param pos: position to look for.
+//! @param tol: tolerance.
+const XC::Element *XC::KDTreeElements::getElementContaining(const Pos3d &pos,const double &tol) const
+  {
+    update(); //maxRadius must be up to date.
+    const Element *retval= nullptr;
+    double dMin= tol;
+    const elem_ptr_list candidates= getElementsWithinRadius(pos,maxRadius+tol);
+    for(elem_ptr_list::const_iterator i= candidates.begin();i!=candidates.end();i++)
+      {
+        const Element *e= *i;
+        if(in_element_box(*e,pos,tol))
+          {
+            const size_t dim= e->getDimension();
+            if((dim==1) || (dim==2))
+              {
+                const double d= e->getDist(pos);
+                if(d<=dMin)
+                  {
+                    dMin= d;
+                    retval= e;
+                  }
+              }
+            else if(e->In(pos,tol))
+              {
+                retval= e;
+                break;
+              }
+          }
+      }
+    return retval;
+  }
+
+//! @brief Looks for the elements near the positions (see getNearestElements).
+class ElementSearch
+  {
+    const XC::KDTreeElements &tree;
+    const std::vector<Pos3d> &positions;
+    std::vector<const XC::Element *> &elements;
+    double tol; //!< Tolerance (negative: nearest element).
+  public:
+    ElementSearch(const XC::KDTreeElements &t,const std::vector<Pos3d> &p,std::vector<const XC::Element *> &e,const double &tl)
+      : tree(t), positions(p), elements(e), tol(tl) {}
+    void operator()(const size_t &i)
+      {
+        if(tol<0.0)
+          elements[i]= tree.getNearestElement(positions[i]);
+        else
+          elements[i]= tree.getElementContaining(positions[i],tol);
+      }
+  };
+
+//! @brief Returns the element closest to each of the positions
+//! being passed as parameter (queries run in parallel).
+std::vector<const XC::Element *> XC::KDTreeElements::getNearestElements(const std::vector<Pos3d> &positions) const
+  {
+    update(); //Before spawning threads.
+    std::vector<const Element *> retval(positions.size(),nullptr);
+    ElementSearch search(*this,positions,retval,-1.0);
+    parallel_for(positions.size(),search,64);
+    return retval;
+  }
+
+//! @brief Returns the element that contains each of the positions
+//! being passed as parameter (queries run in parallel).
+std::vector<const XC::Element *> XC::KDTreeElements::getElementsContaining(const std::vector<Pos3d> &positions,const double &tol) const
+  {
+    update(); //Before spawning threads.
+    std::vector<const Element *> retval(positions.size(),nullptr);
+    ElementSearch search(*this,positions,retval,std::max(tol,0.0));
+    parallel_for(positions.size(),search,64);
+    return retval;
+  }
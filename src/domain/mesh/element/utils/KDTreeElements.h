@@ -30,6 +30,8 @@
 
 #include "xc_utils/src/geom/pos_vec/KDTreePos.h"
 #include "xc_basic/src/kdtree++/kdtree.hpp"
+#include <deque>
+#include <vector>
 
 class Pos3d;
 
@@ -56,11 +58,26 @@ inline bool operator==(const ElemPos &A,const ElemPos &B)
   { return ((A.getElementPtr()== B.getElementPtr()) && (A[0] == B[0]) && (A[1] == B[1]) && (A[2] == B[2])); }
 
 
+//! \ingroup FEMisc
+//
+//! @brief Space-partitioning data structure for element searching
+//! (elements are represented by its centroids).
+//!
+//! As in KDTreeNodes, the tree is updated lazily when
+//! the position of some node changes: only the elements
+//! connected to the moved nodes are reinserted (the tree
+//! is rebuilt if most of them have moved).
 class KDTreeElements: protected kd_tree::KDTree<3, ElemPos, std::pointer_to_binary_function<ElemPos,size_t,double> >
   {
     size_t pend_optimizar;
+    mutable size_t version; //!< Node geometry version when the tree was updated.
+    double maxRadius; //!< Maximum distance from a centroid to the nodes of its element.
+    void rebuild(void);
+    void update_moved(void);
+    void update(void) const;
   public:
     typedef kd_tree::KDTree<3, ElemPos, std::pointer_to_binary_function<ElemPos,size_t,double> > tree_type;
+    typedef std::deque<const Element *> elem_ptr_list;
     KDTreeElements(void);
 
     void insert(const Element &);
@@ -69,6 +86,10 @@ class KDTreeElements: protected kd_tree::KDTree<3, ElemPos, std::pointer_to_bina
 
     const Element *getNearestElement(const Pos3d &pos) const;
     const Element *getNearestElement(const Pos3d &pos, const double &r) const;
+    elem_ptr_list getElementsWithinRadius(const Pos3d &pos,const double &r) const;
+    const Element *getElementContaining(const Pos3d &pos,const double &tol= 0.0) const;
+    std::vector<const Element *> getNearestElements(const std::vector<Pos3d> &) const;
+    std::vector<const Element *> getElementsContaining(const std::vector<Pos3d> &,const double &tol= 0.0) const;
   };
 
 } // end of XC namespace 
@@ -30,6 +30,8 @@
 #include "preprocessor/cad/matrices/TritrizPtrNod.h"
 #include "preprocessor/cad/matrices/TritrizPtrElem.h"
 #include "domain/mesh/node/Node.h"
+#include "vtkCellType.h"
+#include "domain/mesh/element/utils/ParticlePos3d.h"
 
 //! @brief Constructor
 XC::BrickBase::BrickBase(int classTag)
@@ -53,6 +55,10 @@ XC::BrickBase::BrickBase(int tag, int classTag, int node1, int node2, int node3,
 size_t XC::BrickBase::getDimension(void) const
   { return 3; }
 
+//! @brief Interfaz con VTK.
+int XC::BrickBase::getVtkCellType(void) const
+  { return VTK_HEXAHEDRON; }
+
 //Put the element on the mesh being passed as parameter.
 XC::TritrizPtrElem XC::BrickBase::put_on_mesh(const XC::TritrizPtrNod &nodos,meshing_dir dm) const
   {
@@ -85,3 +91,6 @@ XC::TritrizPtrElem XC::BrickBase::put_on_mesh(const XC::TritrizPtrNod &nodos,mes
     return retval;
   }
 
+//! @brief Returns the natural coordinates of the point.
+XC::ParticlePos3d XC::BrickBase::getNaturalCoordinates(const Pos3d &p,bool initialGeometry) const
+  { return get_hexa8_natural_coordinates(p,initialGeometry); }
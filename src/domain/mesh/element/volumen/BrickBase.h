@@ -34,6 +34,7 @@
 
 namespace XC {
 class NDMaterial;
+class ParticlePos3d;
 
 //! \ingroup Elem
 //
@@ -50,6 +51,8 @@ class BrickBase : public ElemWithMaterial<8,NDMaterialPhysicalProperties>
     BrickBase(int tag,int classTag,const NDMaterialPhysicalProperties &);
     BrickBase(int tag, int classTag,int nd1, int nd2, int nd3, int nd4,int nd5,int nd6,int nd7,int nd8, const NDMaterialPhysicalProperties &);
     size_t getDimension(void) const;
+    int getVtkCellType(void) const;
+    ParticlePos3d getNaturalCoordinates(const Pos3d &,bool initialGeometry= true) const;
   };
 
 } // end of XC namespace
@@ -29,6 +29,10 @@
 #include "KDTreeNodes.h"
 #include "Node.h"
 #include "xc_utils/src/geom/pos_vec/Pos3d.h"
+#include "utility/threads/parallel_for.h"
+#include <algorithm>
+#include <iterator>
+#include <cmath>
 
 //! @brief Constructor.
 XC::NodePos::NodePos(const Node &n)
@@ -40,8 +44,57 @@ XC::NodePos::NodePos(const Pos3d &p)
   
 //! @brief Constructor.
 XC::KDTreeNodes::KDTreeNodes(void)
-  : tree_type(std::ptr_fun(NodePos::tac)), pend_optimizar(0) {}
+  : tree_type(std::ptr_fun(NodePos::tac)), pend_optimizar(0), version(Node::getGeomVersion()) {}
 
+//! @brief Rebuilds the tree with the current positions of its nodes.
+void XC::KDTreeNodes::rebuild(void)
+  {
+    std::vector<const Node *> nodes;
+    nodes.reserve(size());
+    for(tree_type::const_iterator i= begin();i!=end();i++)
+      nodes.push_back(i->getNodePtr());
+    tree_type::clear();
+    for(std::vector<const Node *>::const_iterator i= nodes.begin();i!=nodes.end();i++)
+      tree_type::insert(**i);
+    tree_type::optimise();
+    pend_optimizar= 0;
+    version= Node::getGeomVersion();
+  }
+
+//! @brief Reinserts the nodes moved since the last update
+//! (rebuilds the tree if most of them have moved).
+void XC::KDTreeNodes::update_moved(void)
+  {
+    std::vector<NodePos> moved;
+    for(tree_type::const_iterator i= begin();i!=end();i++)
+      if(i->getNodePtr()->getPosVersion()>version)
+        moved.push_back(*i);
+    if(2*moved.size()>size())
+      rebuild();
+    else
+      {
+        for(std::vector<NodePos>::const_iterator i= moved.begin();i!=moved.end();i++)
+          {
+            tree_type::erase(*i); //Stored (old) position.
+            tree_type::insert(*i->getNodePtr());
+          }
+        pend_optimizar+= moved.size();
+        if(pend_optimizar>=10)
+          {
+            tree_type::optimise();
+            pend_optimizar= 0;
+          }
+        version= Node::getGeomVersion();
+      }
+  }
+
+//! @brief Updates the tree if some node has been moved since
+//! the last time it was updated.
+void XC::KDTreeNodes::update(void) const
+  {
+    if(version!=Node::getGeomVersion())
+      const_cast<KDTreeNodes *>(this)->update_moved();
+  }
 
 void XC::KDTreeNodes::insert(const Node &n)
   {
@@ -50,6 +103,7 @@ void XC::KDTreeNodes::insert(const Node &n)
 
 void XC::KDTreeNodes::erase(const Node &n)
   {
+    update(); //Stored positions must match the node position.
     tree_type::erase(n);
     pend_optimizar++;
     if(pend_optimizar>=10)
@@ -60,11 +114,15 @@ void XC::KDTreeNodes::erase(const Node &n)
   }
 
 void XC::KDTreeNodes::clear(void)
-  { tree_type::clear(); }
+  {
+    tree_type::clear();
+    version= Node::getGeomVersion();
+  }
   
 //! @brief Returns the node closest to the position being passed as parameter.
 const XC::Node *XC::KDTreeNodes::getNearestNode(const Pos3d &pos) const
   {
+    update();
     const Node *retval= nullptr;
     NodePos target(pos);
     std::pair<tree_type::const_iterator,double> found = find_nearest(target);
@@ -76,6 +134,7 @@ const XC::Node *XC::KDTreeNodes::getNearestNode(const Pos3d &pos) const
 //! @brief Returns the node closest to the position being passed as parameter.
 const XC::Node *XC::KDTreeNodes::getNearestNode(const Pos3d &pos, const double &r) const
   {
+    update();
     const Node *retval= nullptr;
     NodePos target(pos);
     std::pair<tree_type::const_iterator,double> found = find_nearest(target,r);
@@ -83,3 +142,110 @@ const XC::Node *XC::KDTreeNodes::getNearestNode(const Pos3d &pos, const double &
       retval= found.first->getNodePtr();
     return retval;
   }
+
+//! @brief Returns the nodes whose distance to the position
+//! being passed as parameter is less or equal than r.
+XC::KDTreeNodes::node_ptr_list XC::KDTreeNodes::getNodesWithinRadius(const Pos3d &pos,const double &r) const
+  {
+    update();
+    node_ptr_list retval;
+    std::vector<NodePos> candidates;
+    find_within_range(NodePos(pos),r,std::back_inserter(candidates));
+    const double r2= r*r;
+    for(std::vector<NodePos>::const_iterator i= candidates.begin();i!=candidates.end();i++)
+      {
+        const Node *n= i->getNodePtr();
+        if(dist2(n->getPosInicial3d(),pos)<=r2)
+          retval.push_back(n);
+      }
+    return retval;
+  }
+
+//! @brief Returns the nodes inside the box defined by the
+//! points being passed as parameter.
+XC::KDTreeNodes::node_ptr_list XC::KDTreeNodes::getNodesInBox(const Pos3d &pMin,const Pos3d &pMax) const
+  {
+    update();
+    node_ptr_list retval;
+    const Pos3d center(0.5*(pMin.x()+pMax.x()),0.5*(pMin.y()+pMax.y()),0.5*(pMin.z()+pMax.z()));
+    const double r= 0.5*std::max(std::max(fabs(pMax.x()-pMin.x()),fabs(pMax.y()-pMin.y())),fabs(pMax.z()-pMin.z()));
+    std::vector<NodePos> candidates;
+    find_within_range(NodePos(center),r,std::back_inserter(candidates));
+    for(std::vector<NodePos>::const_iterator i= candidates.begin();i!=candidates.end();i++)
+      {
+        const Node *n= i->getNodePtr();
+        const Pos3d p= n->getPosInicial3d();
+        if((p.x()>=pMin.x()) && (p.x()<=pMax.x()) &&
+           (p.y()>=pMin.y()) && (p.y()<=pMax.y()) &&
+           (p.z()>=pMin.z()) && (p.z()<=pMax.z()))
+          retval.push_back(n);
+      }
+    return retval;
+  }
+
+//! @brief Compares node distances to a point.
+class NodeDistanceLess
+  {
+    Pos3d pos;
+  public:
+    NodeDistanceLess(const Pos3d &p)
+      : pos(p) {}
+    bool operator()(const XC::Node *a,const XC::Node *b) const
+      { return dist2(a->getPosInicial3d(),pos)<dist2(b->getPosInicial3d(),pos); }
+  };
+
+//! @brief Returns the k nodes closest to the position being
+//! passed as parameter (sorted by distance).
+XC::KDTreeNodes::node_ptr_list XC::KDTreeNodes::getKNearestNodes(const Pos3d &pos,const size_t &k) const
+  {
+    node_ptr_list retval;
+    const size_t sz= size();
+    if((k==0) || (sz==0))
+      return retval;
+    const Node *nearest= getNearestNode(pos);
+    //Search radius is enlarged until k nodes are found.
+    double r= std::max(nearest->getDist(pos),1e-6);
+    if(k>=sz)
+      {
+        for(tree_type::const_iterator i= begin();i!=end();i++)
+          retval.push_back(i->getNodePtr());
+      }
+    else
+      {
+        retval= getNodesWithinRadius(pos,r);
+        while(retval.size()<k)
+          {
+            r*= 2.0;
+            retval= getNodesWithinRadius(pos,r);
+          }
+      }
+    const size_t n= std::min(k,retval.size());
+    const NodeDistanceLess comp(pos);
+    std::partial_sort(retval.begin(),retval.begin()+n,retval.end(),comp);
+    retval.resize(n);
+    return retval;
+  }
+
+//! @brief Looks for the nearest node of each position (see getNearestNodes).
+class NearestNodeSearch
+  {
+    const XC::KDTreeNodes &tree;
+    const std::vector<Pos3d> &positions;
+    std::vector<const XC::Node *> &nodes;
+  public:
+    NearestNodeSearch(const XC::KDTreeNodes &t,const std::vector<Pos3d> &p,std::vector<const XC::Node *> &n)
+      : tree(t), positions(p), nodes(n) {}
+    void operator()(const size_t &i)
+      { nodes[i]= tree.getNearestNode(positions[i]); }
+  };
+
+//! @brief Returns the node closest to each of the positions
+//! being passed as parameter (queries run in parallel).
+std::vector<const XC::Node *> XC::KDTreeNodes::getNearestNodes(const std::vector<Pos3d> &positions) const
+  {
+    update(); //Before spawning threads.
+    std::vector<const Node *> retval(positions.size(),nullptr);
+    NearestNodeSearch search(*this,positions,retval);
+    parallel_for(positions.size(),search,64);
+    return retval;
+  }
@@ -30,6 +30,8 @@
 
 #include "xc_utils/src/geom/pos_vec/KDTreePos.h"
 #include "xc_basic/src/kdtree++/kdtree.hpp"
+#include <deque>
+#include <vector>
 
 class Pos3d;
 
@@ -55,11 +57,24 @@ inline bool operator==(const NodePos &A,const NodePos &B)
   { return ((A.getNodePtr()== B.getNodePtr()) && (A[0] == B[0]) && (A[1] == B[1]) && (A[2] == B[2])); }
 
 
+//! \ingroup Nod
+//
+//! @brief Space-partitioning data structure for node searching.
+//!
+//! The tree is updated lazily: when the position of some node
+//! changes (see Node::getGeomVersion) the moved nodes (see
+//! Node::getPosVersion) are reinserted before the next query (the
+//! tree is rebuilt if most of them have moved).
 class KDTreeNodes: protected kd_tree::KDTree<3, NodePos, std::pointer_to_binary_function<NodePos,size_t,double> >
   {
     size_t pend_optimizar;
+    mutable size_t version; //!< Node geometry version when the tree was updated.
+    void rebuild(void);
+    void update_moved(void);
+    void update(void) const;
   public:
     typedef kd_tree::KDTree<3, NodePos, std::pointer_to_binary_function<NodePos,size_t,double> > tree_type;
+    typedef std::deque<const Node *> node_ptr_list;
     KDTreeNodes(void);
 
     void insert(const Node &);
@@ -68,6 +83,10 @@ class KDTreeNodes: protected kd_tree::KDTree<3, NodePos, std::pointer_to_binary_
 
     const Node *getNearestNode(const Pos3d &pos) const;
     const Node *getNearestNode(const Pos3d &pos, const double &r) const;
+    node_ptr_list getKNearestNodes(const Pos3d &pos,const size_t &k) const;
+    node_ptr_list getNodesWithinRadius(const Pos3d &pos,const double &r) const;
+    node_ptr_list getNodesInBox(const Pos3d &pMin,const Pos3d &pMax) const;
+    std::vector<const Node *> getNearestNodes(const std::vector<Pos3d> &) const;
   };
 
 } // end of XC namespace 
@@ -96,13 +96,14 @@
 
 std::deque<XC::Matrix> XC::Node::theMatrices;
 XC::DefaultTag XC::Node::defaultTag;
+size_t XC::Node::geomVersion= 0;
 
 //! @brief Default constructor.
 //! @param theClassTag: tag of the class.
 XC::Node::Node(int theClassTag)
  :MeshComponent(defaultTag++,theClassTag),numberDOF(0), theDOF_GroupPtr(nullptr), 
   disp(), vel(), accel(), unbalLoad(numberDOF), unbalLoadWithInertia(numberDOF), reaction(numberDOF),
-  alphaM(0.0), tributaria(0.0)
+  alphaM(0.0), tributaria(0.0), posVersion(0)
   {
     // for FEM_ObjectBroker, recvSelf() must be invoked on object
     parameterID = 0;
@@ -117,7 +118,7 @@ XC::Node::Node(int tag, int theClassTag)
    numberDOF(0), theDOF_GroupPtr(nullptr),
    disp(), vel(), accel(), 
    unbalLoad(numberDOF), unbalLoadWithInertia(numberDOF), reaction(numberDOF),
-   alphaM(0.0), tributaria(0.0)
+   alphaM(0.0), tributaria(0.0), posVersion(0)
   {
     defaultTag= tag+1;
     // AddingSensitivity:BEGIN /////////////////////////////////////////
@@ -134,7 +135,7 @@ XC::Node::Node(int tag, int ndof, double Crd1)
    numberDOF(ndof), theDOF_GroupPtr(nullptr),
    Crd(1), disp(), vel(), accel(),
    mass(ndof,ndof), unbalLoad(numberDOF), unbalLoadWithInertia(numberDOF), reaction(numberDOF),
-   alphaM(0.0), tributaria(0.0)
+   alphaM(0.0), tributaria(0.0), posVersion(0)
   {
     defaultTag= tag+1;
     // AddingSensitivity:BEGIN /////////////////////////////////////////
@@ -157,7 +158,7 @@ XC::Node::Node(int tag, int ndof, double Crd1, double Crd2)
   :MeshComponent(tag,NOD_TAG_Node),numberDOF(ndof), theDOF_GroupPtr(nullptr),
    Crd(2), disp(), vel(), accel(),
    mass(ndof,ndof), unbalLoad(numberDOF), unbalLoadWithInertia(numberDOF), reaction(numberDOF),
-   alphaM(0.0), tributaria(0.0)
+   alphaM(0.0), tributaria(0.0), posVersion(0)
   {
     defaultTag= tag+1;
     // AddingSensitivity:BEGIN /////////////////////////////////////////
@@ -182,7 +183,7 @@ XC::Node::Node(int tag, int ndof, double Crd1, double Crd2, double Crd3)
   :MeshComponent(tag,NOD_TAG_Node), numberDOF(ndof), theDOF_GroupPtr(nullptr),
    Crd(3), disp(), vel(), accel(),
    mass(ndof,ndof), unbalLoad(numberDOF), unbalLoadWithInertia(numberDOF), reaction(numberDOF),
-   alphaM(0.0), tributaria(0.0)
+   alphaM(0.0), tributaria(0.0), posVersion(0)
   {
     defaultTag= tag+1;
     // AddingSensitivity:BEGIN /////////////////////////////////////////
@@ -206,7 +207,7 @@ XC::Node::Node(int tag, int ndof, const Vector &crds)
    numberDOF(ndof), theDOF_GroupPtr(nullptr),
    Crd(crds), disp(), vel(), accel(),
    mass(ndof,ndof), unbalLoad(numberDOF), unbalLoadWithInertia(numberDOF), reaction(numberDOF),
-    alphaM(0.0), tributaria(0.0)
+    alphaM(0.0), tributaria(0.0), posVersion(0)
   {
     defaultTag= tag+1;
     // AddingSensitivity:BEGIN /////////////////////////////////////////
@@ -225,7 +226,7 @@ XC::Node::Node(const Node &otherNode, bool copyMass)
    Crd(otherNode.Crd), disp(otherNode.disp), vel(otherNode.vel), accel(otherNode.accel),
    R(otherNode.R), unbalLoad(otherNode.unbalLoad),
    unbalLoadWithInertia(otherNode.unbalLoadWithInertia), reaction(otherNode.reaction),
-   alphaM(otherNode.alphaM), tributaria(otherNode.tributaria), theEigenvectors(otherNode.theEigenvectors),
+   alphaM(otherNode.alphaM), tributaria(otherNode.tributaria), posVersion(0), theEigenvectors(otherNode.theEigenvectors),
    connected(otherNode.connected), coacciones_freeze(otherNode.coacciones_freeze)
   {
     // AddingSensitivity:BEGIN /////////////////////////////////////////
@@ -369,6 +370,19 @@ XC::Node::~Node(void)
 XC::DefaultTag &XC::Node::getDefaultTag(void)
   { return defaultTag; }
 
+//! @brief Return the node geometry version. It changes each time
+//! the position of any node is modified so the spatial search
+//! structures (KDTreeNodes, KDTreeElements) know when they must be
+//! updated.
+const size_t &XC::Node::getGeomVersion(void)
+  { return geomVersion; }
+
+//! @brief Return the value of the geometry version when the node
+//! was moved for the last time (zero if it has not been moved), so
+//! the search structures can update only the moved nodes.
+const size_t &XC::Node::getPosVersion(void) const
+  { return posVersion; }
+
 //! @brief Introduce en el nodo una constraint
 //! como la being passed as parameter.
 XC::SFreedom_Constraint *XC::Node::fix(const SFreedom_Constraint &semilla)
@@ -638,6 +652,7 @@ double XC::Node::getDist(const Pos3d &p,bool initialGeometry) const
 //! @brief Sets the node position.
 void XC::Node::setPos(const Pos3d &p)
   {
+    posVersion= ++geomVersion;
     const size_t sz= getDim();
     if(sz==1)
       Crd[0]= p.x();
@@ -1750,6 +1765,7 @@ int XC::Node::resetReactionForce(bool inclInertia)
 //! @brief Moves the node (intended only for its use from XC::Set).
 void XC::Node::Mueve(const Vector3d &desplaz)
   {
+    posVersion= ++geomVersion;
     Crd(0)+= desplaz.x();
     Crd(1)+= desplaz.y();
     Crd(2)+= desplaz.z();
@@ -115,6 +115,7 @@ class Node: public MeshComponent
     mutable Vector reaction;
     double alphaM; //!< rayleigh damping factor
     mutable double tributaria; //!< Tributary length, area or volume.
+    size_t posVersion; //!< Geometry version when the node was moved for the last time.
     
     Matrix theEigenvectors; //Eigenvectors matrix.
 
@@ -134,6 +135,7 @@ class Node: public MeshComponent
     void set_id_coacciones(const ID &);
 
     static DefaultTag defaultTag; //<! tag for next new node.
+    static size_t geomVersion; //!< Incremented each time the position of a node changes (see KDTreeNodes).
   protected:
 
     DbTagData &getDbTagData(void) const;
@@ -158,6 +160,8 @@ class Node: public MeshComponent
     virtual ~Node(void);
 
     static DefaultTag &getDefaultTag(void);
+    static const size_t &getGeomVersion(void);
+    const size_t &getPosVersion(void) const;
 
     // public methods dealing with the DOF at the node
     virtual int getNumberDOF(void) const;    
@@ -44,6 +44,7 @@ class_<XC::Node, XC::Node *, bases<XC::MeshComponent>, boost::noncopyable >("Nod
   .add_property("getInitialPos3d", &XC::Node::getPosInicial3d,"Returns 3D initial position of node.")
   .add_property("getCurrentPos2d", &XC::Node::getPosFinal2d,"Returns 2D current position of node.")
   .add_property("getCurrentPos3d", &XC::Node::getPosFinal3d,"Returns 3D current position of node.")
+  .def("setPos", &XC::Node::setPos,"Set the (initial) position of the node.")
   .add_property("getReaction", make_function( &XC::Node::getReaction, return_internal_reference<>() ))
   .add_property("getDisp", make_function( &XC::Node::getDisp, return_internal_reference<>() ))
   .add_property("getDispXYZ", &XC::Node::getDispXYZ)
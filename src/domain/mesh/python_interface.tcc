@@ -34,6 +34,7 @@ XC::Node *(XC::Mesh::*getNodePtr)(int tag)= &XC::Mesh::getNode;
 XC::Node *(XC::Mesh::*getNearestNodePtrMesh)(const Pos3d &)= &XC::Mesh::getNearestNode;
 XC::Element *(XC::Mesh::*getNearestElementPtrMesh)(const Pos3d &)= &XC::Mesh::getNearestElement;
 XC::Element *(XC::Mesh::*getElementPtr)(int tag)= &XC::Mesh::getElement;
+XC::Element *(XC::Mesh::*getElementContainingPtrMesh)(const Pos3d &,const double &)= &XC::Mesh::getElementContaining;
 class_<XC::Mesh, bases<XC::MeshComponentContainer>, boost::noncopyable >("Mesh", no_init)
   .add_property("getNodeIter", make_function( &XC::Mesh::getNodes, return_internal_reference<>() ))
   .def("getNumNodes", &XC::Mesh::getNumNodes,"Returns the number of nodes.")
@@ -51,6 +52,7 @@ class_<XC::Mesh, bases<XC::MeshComponentContainer>, boost::noncopyable >("Mesh",
   .def("getNumLiveElements", &XC::Mesh::getNumLiveElements,"Returns the number of live elements.")
   .def("getNumDeadElements", &XC::Mesh::getNumDeadElements,"Returns the number of dead elements.")
   .def("getNearestElement",make_function(getNearestElementPtrMesh, return_internal_reference<>() ),"Returns nearest node.")
+  .def("getElementContaining",make_function(getElementContainingPtrMesh, return_internal_reference<>() ),"getElementContaining(pos,tol): returns the element that contains the position (None if not found).")
   .def("setDeadSRF",XC::Mesh::setDeadSRF,"Assigns Stress Reduction Factor for element deactivation.")
   .staticmethod("setDeadSRF")
   ;
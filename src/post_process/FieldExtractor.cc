@@ -0,0 +1,409 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FieldExtractor.cc
+
+#include "FieldExtractor.h"
+#include "domain/mesh/node/Node.h"
+#include "domain/mesh/element/Element.h"
+#include "domain/mesh/element/utils/Information.h"
+#include "utility/recorder/response/Response.h"
+#include "preprocessor/set_mgmt/Set.h"
+#include "utility/handler/HDF5ResultsStore.h"
+#include "utility/threads/parallel_for.h"
+#include "utility/xc_python_utils.h"
+#include <boost/lexical_cast.hpp>
+#include <algorithm>
+
+namespace XC {
+//! @brief Copies the selected components of the vector (all of them
+//! if components is empty, zero padded) to the n values starting at
+//! first and separated by stride (a row of a matrix stored by columns).
+//! The component indices are counted from offset.
+static void put_components(const Vector &v,const ID &components,double *first,const size_t &stride,const size_t &n,const size_t &offset= 0)
+  {
+    const size_t sz= v.Size();
+    const size_t nc= components.Size();
+    for(size_t j= 0;j<n;j++)
+      {
+        const size_t k= offset+(nc ? size_t(components(j)) : j);
+        first[j*stride]= (k<sz ? v(k) : 0.0);
+      }
+  }
+
+//! @brief Returns the requested vector of the node.
+static const Vector &get_nodal_vector(const Node &n,const FieldExtractor::NodalQuantity &q)
+  {
+    switch(q)
+      {
+      case FieldExtractor::VEL:
+        return n.getVel();
+      case FieldExtractor::ACCEL:
+        return n.getAccel();
+      case FieldExtractor::REACTION:
+        return n.getReaction();
+      case FieldExtractor::INCR_DISP:
+        return n.getIncrDisp();
+      default:
+        return n.getDisp();
+      }
+  }
+
+//! @brief Copies the requested values of the i-th node to the
+//! i-th row of the matrix.
+class NodalFieldGatherer
+  {
+    const std::vector<const Node *> &nodes;
+    const FieldExtractor::NodalQuantity q;
+    const ID &components;
+    Matrix &m;
+  public:
+    NodalFieldGatherer(const std::vector<const Node *> &n,const FieldExtractor::NodalQuantity &nq,const ID &c,Matrix &mt)
+      : nodes(n), q(nq), components(c), m(mt) {}
+    void operator()(const size_t &i)
+      {
+        const Node &n= *nodes[i];
+        const size_t offset= (q==FieldExtractor::ROT ? n.getDim() : 0); //rotations after translations.
+        put_components(get_nodal_vector(n,q),components,m.getDataPtr()+i,m.noRows(),m.noCols(),offset);
+      }
+  };
+} // end of XC namespace
+
+//! @brief Returns the accessors defined by name (the predefined
+//! ones are created on the first call).
+XC::FieldExtractor::map_accessors &XC::FieldExtractor::get_accessors(void)
+  {
+    static map_accessors accessors;
+    if(accessors.empty())
+      {
+        const char *nodal[]= {"disp","rot","vel","accel","reaction","incrDisp"};
+        for(size_t i= 0;i<6;i++)
+          accessors[nodal[i]]= std::vector<std::string>(1,nodal[i]);
+        std::vector<std::string> args(3);
+        args[0]= "section"; args[1]= "*"; args[2]= "forces";
+        accessors["sectionForces"]= args;
+        args[2]= "deformations";
+        accessors["sectionDeformations"]= args;
+        args[0]= "material"; args[2]= "stress";
+        accessors["stress"]= args;
+        args[2]= "strain";
+        accessors["strain"]= args;
+        args[2]= "damage";
+        accessors["damage"]= args;
+        accessors["force"]= std::vector<std::string>(1,"force");
+      }
+    return accessors;
+  }
+
+//! @brief Defines (or redefines) the accessor with the name being
+//! passed as parameter as the quantity args (see setResponse).
+void XC::FieldExtractor::defineAccessor(const std::string &name,const std::vector<std::string> &args)
+  {
+    if(args.empty())
+      std::cerr << "FieldExtractor::" << __FUNCTION__
+                << "; empty argument list for accessor: '"
+                << name << "'." << std::endl;
+    else
+      get_accessors()[name]= args;
+  }
+
+//! @brief Defines an accessor (Python interface).
+void XC::FieldExtractor::defineAccessorPy(const std::string &name,const boost::python::list &l)
+  {
+    std::vector<std::string> args;
+    const size_t sz= len(l);
+    for(size_t i= 0;i<sz;i++)
+      args.push_back(boost::python::extract<std::string>(l[i]));
+    defineAccessor(name,args);
+  }
+
+//! @brief Returns true if there is an accessor with the name being
+//! passed as parameter.
+bool XC::FieldExtractor::isAccessor(const std::string &name)
+  {
+    const map_accessors &accessors= get_accessors();
+    return (accessors.find(name)!=accessors.end());
+  }
+
+//! @brief Returns true if there is an accessor with the name being
+//! passed as parameter whose values are given for each integration
+//! point (its arguments contain "*").
+bool XC::FieldExtractor::isPerPointAccessor(const std::string &name)
+  {
+    const map_accessors &accessors= get_accessors();
+    map_accessors::const_iterator i= accessors.find(name);
+    return ((i!=accessors.end()) && (std::find(i->second.begin(),i->second.end(),"*")!=i->second.end()));
+  }
+
+//! @brief Returns the names of the defined accessors.
+boost::python::list XC::FieldExtractor::getAccessorNamesPy(void)
+  {
+    boost::python::list retval;
+    const map_accessors &accessors= get_accessors();
+    for(map_accessors::const_iterator i= accessors.begin();i!=accessors.end();i++)
+      retval.append(i->first);
+    return retval;
+  }
+
+//! @brief Constructor.
+//!
+//! @param q: requested quantity.
+//! @param cmps: indices of the components to extract (all if empty).
+//! @param nPoints: number of integration points (replaces "*" in the quantity).
+XC::FieldExtractor::FieldExtractor(const std::vector<std::string> &q,const ID &cmps,const size_t &nPoints)
+  : EntCmd(), quantity(q), components(cmps), numPoints(nPoints), parallel(true),
+    nodalQuantity(NOT_NODAL), numColumns(0)
+  { clear(); }
+
+//! @brief Constructor (Python interface).
+XC::FieldExtractor::FieldExtractor(const boost::python::list &q,const boost::python::list &cmps,const size_t &nPoints)
+  : EntCmd(), quantity(), components(vector_int_from_py_object(cmps)), numPoints(nPoints), parallel(true),
+    nodalQuantity(NOT_NODAL), numColumns(0)
+  {
+    const size_t sz= len(q);
+    for(size_t i= 0;i<sz;i++)
+      quantity.push_back(boost::python::extract<std::string>(q[i]));
+    clear();
+  }
+
+//! @brief Destructor.
+XC::FieldExtractor::~FieldExtractor(void)
+  { free_responses(); }
+
+//! @brief Deletes the element response objects.
+void XC::FieldExtractor::free_responses(void)
+  {
+    for(std::vector<std::vector<Response *> >::iterator i= responses.begin();i!=responses.end();i++)
+      for(std::vector<Response *>::iterator j= i->begin();j!=i->end();j++)
+        if(*j) delete *j;
+    responses.clear();
+  }
+
+//! @brief Forgets the compiled members and parses the quantity
+//! (replacing the name of an accessor by its arguments).
+void XC::FieldExtractor::clear(void)
+  {
+    free_responses();
+    nodes.clear();
+    elements.clear();
+    tags= ID();
+    numColumns= 0;
+    nodalQuantity= NOT_NODAL;
+    if(quantity.size()==1)
+      {
+        const map_accessors &accessors= get_accessors();
+        map_accessors::const_iterator i= accessors.find(quantity[0]);
+        if(i!=accessors.end())
+          quantity= i->second;
+      }
+    if(quantity.size()==1)
+      {
+        const std::string &q= quantity[0];
+        if(q=="disp")
+          nodalQuantity= DISP;
+        else if(q=="rot")
+          nodalQuantity= ROT;
+        else if(q=="vel")
+          nodalQuantity= VEL;
+        else if(q=="accel")
+          nodalQuantity= ACCEL;
+        else if(q=="reaction")
+          nodalQuantity= REACTION;
+        else if(q=="incrDisp")
+          nodalQuantity= INCR_DISP;
+      }
+  }
+
+//! @brief Prepares the extraction of a nodal quantity from the nodes
+//! of the container.
+int XC::FieldExtractor::compile(const DqPtrsNode &nds)
+  {
+    clear();
+    if(!isNodal())
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; quantity: '" << (quantity.empty() ? std::string() : quantity[0])
+                  << "' is not a nodal quantity." << std::endl;
+        return -1;
+      }
+    size_t maxNumDOF= 0;
+    for(DqPtrsNode::const_iterator i= nds.begin();i!=nds.end();i++)
+      {
+        const Node *n= *i;
+        nodes.push_back(n);
+        size_t numDOF= n->getNumberDOF();
+        if(nodalQuantity==ROT) //rotations only.
+          numDOF= (numDOF>n->getDim() ? numDOF-n->getDim() : 0);
+        maxNumDOF= std::max(maxNumDOF,numDOF);
+      }
+    tags.resize(nodes.size());
+    for(size_t i= 0;i<nodes.size();i++)
+      tags[i]= nodes[i]->getTag();
+    numColumns= (components.Size() ? components.Size() : maxNumDOF);
+    return 0;
+  }
+
+//! @brief Prepares the extraction of an element quantity from the
+//! elements of the container (creates the response objects).
+int XC::FieldExtractor::compile(const DqPtrsElem &elems)
+  {
+    clear();
+    if(isNodal())
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; quantity: '" << quantity[0]
+                  << "' is a nodal quantity." << std::endl;
+        return -1;
+      }
+    // argument lists for each integration point.
+    std::vector<std::vector<std::string> > argLists;
+    const bool perPoint= (std::find(quantity.begin(),quantity.end(),"*")!=quantity.end());
+    if(perPoint)
+      {
+        if(numPoints==0)
+          {
+            std::cerr << nombre_clase() << "::" << __FUNCTION__
+                      << "; number of integration points not set." << std::endl;
+            return -1;
+          }
+        for(size_t p= 1;p<=numPoints;p++)
+          {
+            std::vector<std::string> args(quantity);
+            std::replace(args.begin(),args.end(),std::string("*"),boost::lexical_cast<std::string>(p));
+            argLists.push_back(args);
+          }
+      }
+    else
+      argLists.push_back(quantity);
+
+    int retval= 0;
+    Information eleInfo(1.0);
+    size_t maxSize= 0; // maximum number of values per point.
+    for(DqPtrsElem::const_iterator i= elems.begin();i!=elems.end();i++)
+      {
+        Element *e= *i;
+        std::vector<Response *> eResponses(argLists.size(),static_cast<Response *>(nullptr));
+        for(size_t p= 0;p<argLists.size();p++)
+          {
+            eResponses[p]= e->setResponse(argLists[p],eleInfo);
+            if(eResponses[p])
+              maxSize= std::max(maxSize,size_t(eResponses[p]->getInformation().getData().Size()));
+            else
+              {
+                std::cerr << nombre_clase() << "::" << __FUNCTION__
+                          << "; element: " << e->getTag()
+                          << " can't return the requested quantity"
+                          << " at point: " << p+1 << std::endl;
+                retval= -1;
+              }
+          }
+        elements.push_back(e);
+        responses.push_back(eResponses);
+      }
+    tags.resize(elements.size());
+    for(size_t i= 0;i<elements.size();i++)
+      tags[i]= elements[i]->getTag();
+    const size_t valuesPerPoint= (components.Size() ? components.Size() : maxSize);
+    numColumns= valuesPerPoint*argLists.size();
+    return retval;
+  }
+
+//! @brief Prepares the extraction from the nodes (nodal quantities) or
+//! the elements (other quantities) of the set.
+int XC::FieldExtractor::compile(const Set &s)
+  {
+    if(isNodal())
+      return compile(s.GetNodos());
+    else
+      return compile(s.getElements());
+  }
+
+//! @brief Gathers the values of the compiled nodes or elements
+//! in the matrix being passed as parameter (one row for each member),
+//! without intermediate copies. The matrix is resized only if its
+//! dimensions don't match, so a NumPy view of it remains valid.
+int XC::FieldExtractor::extract(Matrix &m) const
+  {
+    const size_t numRows= getNumRows();
+    if((size_t(m.noRows())!=numRows) || (size_t(m.noCols())!=numColumns))
+      m= Matrix(numRows,numColumns);
+    if(numRows*numColumns==0)
+      return 0;
+    int retval= 0;
+    if(isNodal())
+      {
+        NodalFieldGatherer gatherer(nodes,nodalQuantity,components,m);
+        if(parallel)
+          parallel_for(numRows,gatherer,256);
+        else
+          for(size_t i= 0;i<numRows;i++)
+            gatherer(i);
+      }
+    else // element code uses static storage: no threads here.
+      {
+        const size_t numPts= responses[0].size();
+        const size_t valuesPerPoint= numColumns/numPts;
+        for(size_t i= 0;i<numRows;i++)
+          for(size_t p= 0;p<numPts;p++)
+            {
+              double *first= m.getDataPtr()+i+p*valuesPerPoint*numRows;
+              Response *r= responses[i][p];
+              if(r && (r->getResponse()>=0))
+                put_components(r->getInformation().getData(),components,first,numRows,valuesPerPoint);
+              else
+                retval= -1;
+            }
+      }
+    return retval;
+  }
+
+//! @brief Returns the values of the compiled nodes or elements
+//! (one row for each member).
+XC::Matrix XC::FieldExtractor::extract(void) const
+  {
+    Matrix retval;
+    extract(retval);
+    return retval;
+  }
+
+//! @brief Appends the current values as a new step of the field
+//! of the HDF5 file (the field is created if it doesn't exist).
+int XC::FieldExtractor::appendTo(HDF5ResultsStore &store,const std::string &fieldName,const std::string &label) const
+  {
+    if(!store.hasField(fieldName))
+      {
+        std::vector<std::string> componentNames(numColumns);
+        for(size_t j= 0;j<numColumns;j++)
+          componentNames[j]= "c"+boost::lexical_cast<std::string>(j);
+        if(store.newField(fieldName,tags,componentNames)<0)
+          return -1;
+      }
+    Matrix values;
+    int retval= extract(values);
+    if(store.appendStep(fieldName,label,values)<0)
+      retval= -1;
+    return retval;
+  }
@@ -0,0 +1,130 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FieldExtractor.h
+
+#ifndef FieldExtractor_h
+#define FieldExtractor_h
+
+#include "xc_utils/src/nucleo/EntCmd.h"
+#include "utility/matrix/ID.h"
+#include "utility/matrix/Matrix.h"
+#include <vector>
+#include <string>
+#include <map>
+#include <boost/python/list.hpp>
+
+namespace XC {
+class Node;
+class Element;
+class Response;
+class DqPtrsNode;
+class DqPtrsElem;
+class Set;
+class HDF5ResultsStore;
+
+//! @ingroup POST_PROCESS
+//
+//! @brief Compiled extractor of a result (displacements, reactions,
+//! section forces, stresses at Gauss points,...) for all the nodes
+//! or elements of a set.
+//!
+//! The quantity is parsed and the element response objects are
+//! created once (compile); after that, each call to extract gathers
+//! the values of all the members in a contiguous matrix (one row
+//! for each node or element), that can be seen from NumPy
+//! without copying it or appended to an HDF5 results file.
+//!
+//! Nodal quantities: "disp", "rot" (rotational DOFs of the
+//! displacement vector), "vel", "accel", "reaction" and
+//! "incrDisp". Any other quantity is passed to Element::setResponse
+//! (i.e. ["force"], ["section","*","forces"], ["material","*","stress"],...);
+//! the "*" arguments are replaced by the integration point numbers
+//! (1..numPoints) and the values of all the points are put in the
+//! same row.
+//!
+//! A quantity made of a single word can be the name of an
+//! accessor (see defineAccessor) like "sectionForces" or "stress";
+//! in that case it's replaced by the arguments registered for
+//! that name. The MED writer uses these accessors to avoid the
+//! evaluation of a Python expression for each node or element.
+class FieldExtractor: public EntCmd
+  {
+  public:
+    enum NodalQuantity {NOT_NODAL, DISP, ROT, VEL, ACCEL, REACTION, INCR_DISP};
+    typedef std::map<std::string,std::vector<std::string> > map_accessors;
+  private:
+    std::vector<std::string> quantity; //!< Requested quantity.
+    ID components; //!< Components to extract (all if empty).
+    size_t numPoints; //!< Number of integration points (see "*" in quantity).
+    bool parallel; //!< If true gather nodal values on several threads.
+    NodalQuantity nodalQuantity;
+    std::vector<const Node *> nodes; //!< Compiled nodes.
+    std::vector<Element *> elements; //!< Compiled elements.
+    std::vector<std::vector<Response *> > responses; //!< Response objects for each element and integration point.
+    ID tags; //!< Tags of the nodes or elements (one for each row).
+    size_t numColumns; //!< Number of values for each row.
+
+    static map_accessors &get_accessors(void);
+    void free_responses(void);
+    void clear(void);
+
+    FieldExtractor(const FieldExtractor &);
+    FieldExtractor &operator=(const FieldExtractor &);
+  public:
+    FieldExtractor(const std::vector<std::string> &,const ID &cmps= ID(),const size_t &nPoints= 0);
+    FieldExtractor(const boost::python::list &,const boost::python::list &,const size_t &nPoints= 0);
+    ~FieldExtractor(void);
+
+    inline bool isNodal(void) const
+      { return (nodalQuantity!=NOT_NODAL); }
+    inline bool getParallel(void) const
+      { return parallel; }
+    inline void setParallel(const bool &b)
+      { parallel= b; }
+    inline const ID &getTags(void) const
+      { return tags; }
+    inline size_t getNumRows(void) const
+      { return tags.Size(); }
+    inline size_t getNumColumns(void) const
+      { return numColumns; }
+
+    int compile(const DqPtrsNode &);
+    int compile(const DqPtrsElem &);
+    int compile(const Set &);
+    int extract(Matrix &) const;
+    Matrix extract(void) const;
+    int appendTo(HDF5ResultsStore &,const std::string &,const std::string &) const;
+
+    static void defineAccessor(const std::string &,const std::vector<std::string> &);
+    static void defineAccessorPy(const std::string &,const boost::python::list &);
+    static bool isAccessor(const std::string &);
+    static bool isPerPointAccessor(const std::string &);
+    static boost::python::list getAccessorNamesPy(void);
+  };
+} // end of XC namespace
+
+#endif
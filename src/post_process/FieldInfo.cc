@@ -22,6 +22,7 @@
 //FieldInfo
 
 #include "FieldInfo.h"
+#include "FieldExtractor.h"
 
 
 
@@ -62,3 +63,15 @@ void XC::FieldInfo::setComponentUnits(const boost::python::list &l)
 
 const std::string &XC::FieldInfo::getComponentsProperty(void) const
   { return componentsProperty; }
+
+//! @brief Returns true if the components property is the name
+//! of a compiled accessor (see FieldExtractor) so its values
+//! can be obtained without evaluating a Python expression (the
+//! accessors that give a value for each integration point are
+//! used only on Gauss points).
+bool XC::FieldInfo::hasCompiledAccessor(void) const
+  {
+    if(!FieldExtractor::isAccessor(componentsProperty))
+      return false;
+    return (isDefinedOnGaussPoints() || !FieldExtractor::isPerPointAccessor(componentsProperty));
+  }
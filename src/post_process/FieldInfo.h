@@ -87,6 +87,7 @@ class FieldInfo: public EntConNmb
     inline void setComponentsProperty(const std::string &s)
       { componentsProperty= s; }
     const std::string &getComponentsProperty(void) const;
+    bool hasCompiledAccessor(void) const;
     inline void setIterationNumber(const int &in)
       { iterationNumber= in; }
     inline const int &getIterationNumber(void) const
@@ -31,6 +31,7 @@ class_<XC::FieldInfo, bases<EntConNmb>, boost::noncopyable >("FieldInfo", no_ini
   .add_property("numberOfComponents", &XC::FieldInfo::getNumberOfComponents, "Returns field's number of components.")
   .add_property("componentsType", make_function( &XC::FieldInfo::getComponentsType, return_value_policy<return_by_value>() ), &XC::FieldInfo::setComponentsType, "Set field component's type.")
   .add_property("componentsProperty", make_function( &XC::FieldInfo::getComponentsProperty, return_value_policy<return_by_value>() ), &XC::FieldInfo::setComponentsProperty, "Set name to retrieve property.")
+  .add_property("hasCompiledAccessor", &XC::FieldInfo::hasCompiledAccessor, "True if the components property is the name of a compiled accessor (disp, rot, reaction, sectionForces, stress,...; see FieldExtractor).")
   .add_property("componentNames", make_function( &XC::FieldInfo::getComponentNames, return_value_policy<return_by_value>() ), &XC::FieldInfo::setComponentNames, "Set field component's names.")
   .add_property("componentDescriptions", make_function( &XC::FieldInfo::getComponentDescriptions, return_value_policy<return_by_value>() ), &XC::FieldInfo::setComponentDescriptions, "Set component's descriptions.")
   .add_property("componentUnits", make_function( &XC::FieldInfo::getComponentUnits, return_value_policy<return_by_value>() ), &XC::FieldInfo::setComponentUnits, "Set field component's units.")
@@ -47,3 +48,25 @@ class_<XC::MapFields, bases<EntCmd,dq_fields> >("MapFields")
   .def("newField",make_function( &XC::MapFields::newField, return_internal_reference<>() ),"Defines a new field.")
   ;
 
+XC::Matrix (XC::FieldExtractor::*extractMatrix)(void) const= &XC::FieldExtractor::extract;
+int (XC::FieldExtractor::*extractIntoMatrix)(XC::Matrix &) const= &XC::FieldExtractor::extract;
+int (XC::FieldExtractor::*compileSet)(const XC::Set &)= &XC::FieldExtractor::compile;
+int (XC::FieldExtractor::*compileNodes)(const XC::DqPtrsNode &)= &XC::FieldExtractor::compile;
+int (XC::FieldExtractor::*compileElements)(const XC::DqPtrsElem &)= &XC::FieldExtractor::compile;
+class_<XC::FieldExtractor, bases<EntCmd>, boost::noncopyable >("FieldExtractor", init<boost::python::list, boost::python::list, optional<size_t> >())
+  .def("compile",compileSet,"compile(set): prepares the extraction from the nodes (nodal quantities) or the elements of the set.")
+  .def("compile",compileNodes,"compile(nodes): prepares the extraction from the nodes.")
+  .def("compile",compileElements,"compile(elements): prepares the extraction from the elements.")
+  .def("extract",extractMatrix,"Returns a matrix with the values (one row for each node or element).")
+  .def("extractInto",extractIntoMatrix,"extractInto(m): writes the values in the matrix m (resized only if needed, so a NumPy view of it remains valid).")
+  .def("appendTo",&XC::FieldExtractor::appendTo,"appendTo(hdf5Store,fieldName,stepLabel): appends the values as a new step of the field (created if needed).")
+  .add_property("isNodal",&XC::FieldExtractor::isNodal,"True if the quantity is defined on nodes.")
+  .add_property("parallel",&XC::FieldExtractor::getParallel,&XC::FieldExtractor::setParallel,"If true nodal values are gathered using several threads.")
+  .add_property("tags",make_function(&XC::FieldExtractor::getTags, return_internal_reference<>() ),"Tags of the nodes or elements (one for each row).")
+  .add_property("numRows",&XC::FieldExtractor::getNumRows,"Number of rows (nodes or elements).")
+  .add_property("numColumns",&XC::FieldExtractor::getNumColumns,"Number of values for each node or element.")
+  .def("defineAccessor",&XC::FieldExtractor::defineAccessorPy,"defineAccessor(name,args): defines the name of a quantity (i.e. defineAccessor('axialForce',['section','*','forces'])).").staticmethod("defineAccessor")
+  .def("isAccessor",&XC::FieldExtractor::isAccessor,"isAccessor(name): returns true if the accessor is defined.").staticmethod("isAccessor")
+  .def("isPerPointAccessor",&XC::FieldExtractor::isPerPointAccessor,"isPerPointAccessor(name): returns true if the accessor gives a value for each integration point.").staticmethod("isPerPointAccessor")
+  .def("getAccessorNames",&XC::FieldExtractor::getAccessorNamesPy,"Returns the names of the defined accessors.").staticmethod("getAccessorNames")
+  ;
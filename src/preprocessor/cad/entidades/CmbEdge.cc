@@ -144,6 +144,36 @@ MatrizPos3d XC::CmbEdge::Lado::GetPosNodosInv(void) const
       return edge->GetPosNodosDir();
   }
 
+//! @brief Return the positions in reverse order.
+static MatrizPos3d reverse_positions(const MatrizPos3d &pos)
+  {
+    const size_t nn= pos.size();
+    MatrizPos3d retval(nn);
+    for(size_t i=1;i<=nn;i++)
+      retval(i,1)= pos(nn-i+1);
+    return retval;
+  }
+
+//! @brief Returns the positions of the nodes (existing or not, see
+//! Edge::getNodePositions) in direct order.
+MatrizPos3d XC::CmbEdge::Lado::getNodePositionsDir(void) const
+  {
+    if(directo)
+      return edge->getNodePositions();
+    else
+      return reverse_positions(edge->getNodePositions());
+  }
+
+//! @brief Returns the positions of the nodes (existing or not, see
+//! Edge::getNodePositions) in reverse order.
+MatrizPos3d XC::CmbEdge::Lado::getNodePositionsInv(void) const
+  {
+    if(directo)
+      return reverse_positions(edge->getNodePositions());
+    else
+      return edge->getNodePositions();
+  }
+
 //! @brief Returns the nodo which index is being passed as parameter empezando por el principio.
 XC::Node *XC::CmbEdge::Lado::GetNodoDir(const size_t &i)
   {
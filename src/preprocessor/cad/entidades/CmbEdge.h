@@ -81,6 +81,8 @@ class CmbEdge: public Edge
         std::vector<int> GetTagsNodosInv(void) const;
         MatrizPos3d GetPosNodosDir(void) const;
         MatrizPos3d GetPosNodosInv(void) const;
+        MatrizPos3d getNodePositionsDir(void) const;
+        MatrizPos3d getNodePositionsInv(void) const;
         double getLongitud(void) const;
         const Vector &getTang(const double &) const;
         Node *GetNodoDir(const size_t &i);
@@ -277,6 +277,31 @@ MatrizPos3d XC::Edge::GetPosNodosInv(void) const
     return retval;
   }
 
+//! @brief Return the positions of the nodes of the edge. If the nodes
+//! don't exist yet, return the positions where create_nodes will place
+//! them, so the node positions of the surfaces can be computed before
+//! meshing its edges (see Set::surface_meshing).
+MatrizPos3d XC::Edge::getNodePositions(void) const
+  {
+    if(TieneNodos())
+      return GetPosNodosDir();
+    const MatrizPos3d tmp= get_pos_nodes();
+    const size_t nn= tmp.size();
+    MatrizPos3d retval(nn);
+    for(size_t i=1;i<=nn;i++)
+      retval(i,1)= tmp(i);
+    if(nn>0) //End points may be already meshed.
+      {
+        const Pnt *p1= P1();
+        if(p1 && p1->TieneNodos())
+          retval(1,1)= pos_node(*p1->GetNodo());
+        const Pnt *p2= P2();
+        if(p2 && p2->TieneNodos())
+          retval(nn,1)= pos_node(*p2->GetNodo());
+      }
+    return retval;
+  }
+
 //! @brief Return the surface names that touch the line (neighbors).
 const std::string &XC::Edge::NombresSupsTocan(void) const
   {
@@ -98,6 +98,7 @@ class Edge: public EntMdlr
 
     virtual MatrizPos3d get_posiciones(void) const= 0;
     virtual MatrizPos3d get_pos_nodes(void) const;
+    virtual MatrizPos3d getNodePositions(void) const;
 
     virtual Node *GetNodo(const size_t &i1,const size_t &j,const size_t &k=1);
     virtual const Node *GetNodo(const size_t &i,const size_t &j,const size_t &k=1) const;
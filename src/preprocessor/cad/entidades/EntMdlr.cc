@@ -268,45 +268,66 @@ void XC::EntMdlr::create_nodes(const TritrizPos3d &posiciones)
         std::clog << "EntMdlr::create_nodes; los nodos de la entidad: '" << GetNombre() << "' ya existen." << std::endl;
   }
 
-//! @brief Creates elements on the nodes created
-//! in create_nodes.
-bool XC::EntMdlr::create_elements(meshing_dir dm)
+//! @brief Returns the elements to place on the nodes created
+//! in create_nodes (copies of the seed element).
+//!
+//! The elements are not added to the model (see create_elements) so
+//! this method doesn't modify anything and can be called concurrently
+//! for different entities (see Set::surface_meshing).
+XC::TritrizPtrElem XC::EntMdlr::put_elements_on_mesh(meshing_dir dm) const
   {
-    bool retval= false;
+    TritrizPtrElem retval;
     if(!ttzNodes.empty())
       {
         if(ttzNodes.HasNull())
           std::cerr << nombre_clase() << "::" << __FUNCTION__
 	            << "; there are null pointers."
                     << " Elements were not created." << std::endl;
+        else if(get_preprocessor())
+          {
+            const Element *smll= get_preprocessor()->getElementLoader().get_seed_element();
+            if(smll)
+              retval= smll->put_on_mesh(ttzNodes,dm);
+            else if(verborrea>0)
+              std::clog << nombre_clase() << "::" << __FUNCTION__
+                        << "; seed element not set." << std::endl;
+          }
         else
-          if(ttzElements.Null())
-            {
-              if(get_preprocessor())
-                {
-                  if(verborrea>4)
-                    std::clog << "Creating elements of entity: '"
-			      << GetNombre() << "'...";   
-                  const Element *smll= get_preprocessor()->getElementLoader().get_seed_element();
-                  if(smll)
-                    {
-                      ttzElements= smll->put_on_mesh(ttzNodes,dm);
-                      add_elements(ttzElements);
-                      retval= true;
-                    }
-                  else if(verborrea>0)
-                    std::clog << nombre_clase() << "::" << __FUNCTION__
-		              << "; seed element not set." << std::endl;
-                  if(verborrea>4)
-                    std::clog << "created." << std::endl;
-                }
-              else
-                std::cerr << "EntMdlr::create_elements; pointer to preprocessor needed." << std::endl;
-            }
+          std::cerr << nombre_clase() << "::" << __FUNCTION__
+                    << "; pointer to preprocessor needed." << std::endl;
       }
     else
-      std::cerr << "EntMdlr::create_elements; there is no nodes for the elements." << std::endl;
+      std::cerr << nombre_clase() << "::" << __FUNCTION__
+                << "; there is no nodes for the elements." << std::endl;
+    return retval;
+  }
 
+//! @brief Adds to the model the elements being passed as parameter
+//! (see put_elements_on_mesh).
+void XC::EntMdlr::create_elements(const TritrizPtrElem &elements)
+  {
+    if(ttzElements.Null())
+      {
+        ttzElements= elements;
+        add_elements(ttzElements);
+      }
+  }
+
+//! @brief Creates elements on the nodes created
+//! in create_nodes.
+bool XC::EntMdlr::create_elements(meshing_dir dm)
+  {
+    bool retval= false;
+    if(ttzElements.Null())
+      {
+        if(verborrea>4)
+          std::clog << "Creating elements of entity: '"
+                    << GetNombre() << "'...";   
+        create_elements(put_elements_on_mesh(dm));
+        retval= !ttzElements.Null();
+        if(verborrea>4)
+          std::clog << "created." << std::endl;
+      }
     return retval;
   }
 
@@ -64,6 +64,7 @@ class EntMdlr: public SetEstruct
     virtual void actualiza_topologia(void)= 0;
     void create_nodes(const TritrizPos3d &);
     Node *create_node(const Pos3d &pos,size_t i=1,size_t j=1, size_t k=1);
+    void create_elements(const TritrizPtrElem &);
     bool create_elements(meshing_dir dm);
     Pnt *create_point(const Pos3d &);
     void create_points(const MatrizPos3d &);
@@ -106,6 +107,7 @@ class EntMdlr: public SetEstruct
     Node *buscaNodo(const int &tag);
     const Node *buscaNodo(const int &tag) const;
     std::vector<int> getTagsNodos(void) const;
+    TritrizPtrElem put_elements_on_mesh(meshing_dir dm) const;
 
     Element *findElement(const int &);
     const Element *findElement(const int &) const;
@@ -351,6 +351,10 @@ void XC::QuadSurface::defGridPoints(const boost::python::list &l)
   }
 
 //! @brief Returns (ndivI+1)*(ndivJ+1) positions to place the nodes.
+//!
+//! The edges don't need to be meshed so this method doesn't
+//! modify anything and can be called concurrently for different
+//! surfaces.
 MatrizPos3d XC::QuadSurface::get_posiciones(void) const
   {
     MatrizPos3d retval;
@@ -362,10 +366,11 @@ MatrizPos3d XC::QuadSurface::get_posiciones(void) const
         return retval;
       }
 
-    MatrizPos3d ptos_l1= lineas[0].GetPosNodosDir();
-    MatrizPos3d ptos_l2= lineas[1].GetPosNodosDir();
-    MatrizPos3d ptos_l3= lineas[2].GetPosNodosInv(); //Ordenados al revés.
-    MatrizPos3d ptos_l4= lineas[3].GetPosNodosInv(); //Ordenados al revés.
+    //Edges may be not meshed yet (see Set::surface_meshing).
+    MatrizPos3d ptos_l1= lineas[0].getNodePositionsDir();
+    MatrizPos3d ptos_l2= lineas[1].getNodePositionsDir();
+    MatrizPos3d ptos_l3= lineas[2].getNodePositionsInv(); //Ordenados al revés.
+    MatrizPos3d ptos_l4= lineas[3].getNodePositionsInv(); //Ordenados al revés.
     retval= MatrizPos3d(ptos_l1,ptos_l2,ptos_l3,ptos_l4);
     retval.Trn();
     return retval;
@@ -398,17 +403,41 @@ Vector3d XC::QuadSurface::getKVector(void) const
     return vI.getCross(vJ);
   }
 
+//! @brief Return the positions of the surface nodes.
+MatrizPos3d XC::QuadSurface::getNodePositions(void) const
+  { return get_posiciones(); }
+
 //! @brief Creates surface nodes.
 void XC::QuadSurface::create_nodes(void)
   {
-
     checkNDivs();
+    if(ttzNodes.Null())
+      create_nodes(get_posiciones());
+    else
+      if(verborrea>2)
+        std::clog << nombre_clase() << "::" << __FUNCTION__
+	          << "; nodes of entity: '" << GetNombre()
+		  << "' already exist." << std::endl;      
+  }
+
+//! @brief Creates surface nodes placing the interior ones at
+//! the positions being passed as parameter (see getNodePositions).
+void XC::QuadSurface::create_nodes(const MatrizPos3d &pos_nodes)
+  {
     if(ttzNodes.Null())
       {
         create_nodes_lineas();
 
         const size_t filas= NDivJ()+1;
         const size_t cols= NDivI()+1;
+        if((pos_nodes.getNumFilas()<filas) || (pos_nodes.getNumCols()<cols))
+          {
+            std::cerr << nombre_clase() << "::" << __FUNCTION__
+	              << "; positions matrix too small: ("
+                      << pos_nodes.getNumFilas() << 'x' << pos_nodes.getNumCols()
+                      << ") instead of (" << filas << 'x' << cols << ")." << std::endl;
+            return;
+          }
         ttzNodes = TritrizPtrNod(1,filas,cols);
 
 
@@ -433,7 +462,6 @@ void XC::QuadSurface::create_nodes(void)
           ttzNodes(1,j,cols)= lineas[1].GetNodo(j);
 
 
-        MatrizPos3d pos_nodes= get_posiciones(); //Posiciones of the nodes.
         for(size_t j= 2;j<filas;j++) //Filas interiores.
           for(size_t k= 2;k<cols;k++) //Columnas interiores.
             create_node(pos_nodes(j,k),1,j,k);
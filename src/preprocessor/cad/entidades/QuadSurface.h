@@ -68,7 +68,9 @@ class QuadSurface: public Face
 
     bool checkNDivs(const size_t &i,const size_t &j) const;
     bool checkNDivs(void) const;
+    MatrizPos3d getNodePositions(void) const;
     void create_nodes(void);
+    void create_nodes(const MatrizPos3d &);
     void genMesh(meshing_dir dm);
   };
 
@@ -104,11 +104,20 @@ void XC::UniformGrid::add_to_sets(std::set<SetBase *> &sets)
       }
   }
 
-//! @brief Creates mesh nodes.
+//! @brief Return the positions of the grid nodes.
+TritrizPos3d XC::UniformGrid::getNodePositions(void) const
+  { return create_uniform_grid(Bnd(),ndiv_x,ndiv_y,ndiv_z); }
+
+//! @brief Creates the nodes of the grid at the positions being
+//! passed as parameter (see getNodePositions).
+void XC::UniformGrid::create_nodes(const TritrizPos3d &ptos)
+  { EntMdlr::create_nodes(ptos); }
+
+//! @brief Creates the nodes of the grid.
 void XC::UniformGrid::create_nodes(void)
   {
-    TritrizPos3d ptos= create_uniform_grid(Bnd(),ndiv_x,ndiv_y,ndiv_z);
-    EntMdlr::create_nodes(ptos);
+    if(ttzNodes.Null())
+      create_nodes(getNodePositions());
   }
 
 //! @brief Triggers mesh creation.
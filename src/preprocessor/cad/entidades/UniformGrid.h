@@ -92,6 +92,9 @@ class UniformGrid: public EntMdlr
     virtual BND3d Bnd(void) const;
     Pos3d GetCentro(void) const;
 
+    TritrizPos3d getNodePositions(void) const;
+    void create_nodes(const TritrizPos3d &);
+
     std::set<SetBase *> get_sets(void) const;
     void add_to_sets(std::set<SetBase *> &);
 
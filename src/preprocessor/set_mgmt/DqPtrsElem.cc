@@ -31,6 +31,9 @@
 #include "xc_utils/src/geom/d1/Polilinea3d.h"
 #include "domain/mesh/node/Node.h"
 #include "domain/mesh/MeshEdges.h"
+#include "xc_utils/src/geom/pos_vec/Pos3d.h"
+#include "utility/xc_python_utils.h"
+#include "post_process/FieldExtractor.h"
 
 void XC::DqPtrsElem::create_arbol(void)
   {
@@ -133,6 +136,33 @@ const XC::Element *XC::DqPtrsElem::getNearestElement(const Pos3d &p) const
     return this_no_const->getNearestElement(p);
   }
 
+//! @brief Returns the element that contains the point (nullptr if none).
+XC::Element *XC::DqPtrsElem::getElementContaining(const Pos3d &p,const double &tol)
+  { return const_cast<Element *>(kdtreeElements.getElementContaining(p,tol)); }
+
+//! @brief Returns the elements whose centroid distance to the point
+//! is less or equal than r.
+boost::python::list XC::DqPtrsElem::getElementsWithinRadius(const Pos3d &p,const double &r) const
+  {
+    const KDTreeElements::elem_ptr_list tmp= kdtreeElements.getElementsWithinRadius(p,r);
+    return ptrs_to_py_list(tmp.begin(),tmp.end());
+  }
+
+//! @brief Returns the element closest to each of the points of the list.
+boost::python::list XC::DqPtrsElem::getNearestElements(const boost::python::list &l) const
+  {
+    const std::vector<const Element *> tmp= kdtreeElements.getNearestElements(vector_pos3d_from_py_list(l));
+    return ptrs_to_py_list(tmp.begin(),tmp.end());
+  }
+
+//! @brief Returns the element that contains each of the points
+//! of the list (None if there is no such element).
+boost::python::list XC::DqPtrsElem::getElementsContaining(const boost::python::list &l,const double &tol) const
+  {
+    const std::vector<const Element *> tmp= kdtreeElements.getElementsContaining(vector_pos3d_from_py_list(l),tol);
+    return ptrs_to_py_list(tmp.begin(),tmp.end());
+  }
+
 //! @brief Returns (if it exists) a pointer to the element
 //! identified by the tag being passed as parameter.
 XC::Element *XC::DqPtrsElem::findElement(const int &tag)
@@ -280,3 +310,15 @@ std::deque<Polilinea3d> XC::DqPtrsElem::getContours(bool undeformedGeometry) con
       }
     return edgesContour.getContours(undeformedGeometry);
   }
+
+//! @brief Returns the values of an element quantity (see
+//! FieldExtractor) for all the elements (one row for each
+//! element). To extract the same quantity repeatedly use a
+//! FieldExtractor.
+XC::Matrix XC::DqPtrsElem::getFieldValues(const boost::python::list &quantity,const boost::python::list &components,const size_t &numPoints)
+  {
+    FieldExtractor extractor(quantity,components,numPoints);
+    extractor.compile(*this);
+    return extractor.extract();
+  }
+
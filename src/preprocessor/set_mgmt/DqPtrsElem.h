@@ -37,6 +37,7 @@ class Polilinea3d;
 
 namespace XC {
 class TrfGeom;
+class Matrix;
 
 //!  \ingroup Set
 //! 
@@ -86,7 +87,12 @@ class DqPtrsElem: public DqPtrs<Element>
     const Element *findElement(const int &) const;
     Element *getNearestElement(const Pos3d &);
     const Element *getNearestElement(const Pos3d &) const;
+    Element *getElementContaining(const Pos3d &,const double &tol= 0.0);
+    boost::python::list getElementsWithinRadius(const Pos3d &,const double &) const;
+    boost::python::list getNearestElements(const boost::python::list &) const;
+    boost::python::list getElementsContaining(const boost::python::list &,const double &tol= 0.0) const;
     std::deque<Polilinea3d> getContours(bool undeformedGeometry= true) const;
+    Matrix getFieldValues(const boost::python::list &,const boost::python::list &,const size_t &numPoints= 0);
 
     void numera(void);
   };
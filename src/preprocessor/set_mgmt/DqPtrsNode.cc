@@ -29,6 +29,9 @@
 #include "domain/mesh/node/Node.h"
 #include "preprocessor/cad/trf/TrfGeom.h"
 #include "xc_basic/src/funciones/algebra/ExprAlgebra.h"
+#include "xc_utils/src/geom/pos_vec/Pos3d.h"
+#include "utility/xc_python_utils.h"
+#include "post_process/FieldExtractor.h"
 
 void XC::DqPtrsNode::create_arbol(void)
   {
@@ -131,21 +134,54 @@ const XC::Node *XC::DqPtrsNode::getNearestNode(const Pos3d &p) const
     return this_no_const->getNearestNode(p);
   }
 
+//! @brief Returns the nodes whose distance to the point
+//! is less or equal than r.
+boost::python::list XC::DqPtrsNode::getNodesWithinRadius(const Pos3d &p,const double &r) const
+  {
+    const KDTreeNodes::node_ptr_list tmp= kdtreeNodos.getNodesWithinRadius(p,r);
+    return ptrs_to_py_list(tmp.begin(),tmp.end());
+  }
+
+//! @brief Returns the nodes inside the box defined by
+//! the points being passed as parameter.
+boost::python::list XC::DqPtrsNode::getNodesInBox(const Pos3d &pMin,const Pos3d &pMax) const
+  {
+    const KDTreeNodes::node_ptr_list tmp= kdtreeNodos.getNodesInBox(pMin,pMax);
+    return ptrs_to_py_list(tmp.begin(),tmp.end());
+  }
+
+//! @brief Returns the k nodes closest to the point (sorted by distance).
+boost::python::list XC::DqPtrsNode::getKNearestNodes(const Pos3d &p,const size_t &k) const
+  {
+    const KDTreeNodes::node_ptr_list tmp= kdtreeNodos.getKNearestNodes(p,k);
+    return ptrs_to_py_list(tmp.begin(),tmp.end());
+  }
+
+//! @brief Returns the node closest to each of the points
+//! of the list (None if the set is empty).
+boost::python::list XC::DqPtrsNode::getNearestNodes(const boost::python::list &l) const
+  {
+    const std::vector<const Node *> tmp= kdtreeNodos.getNearestNodes(vector_pos3d_from_py_list(l));
+    return ptrs_to_py_list(tmp.begin(),tmp.end());
+  }
+
 //! @brief Desplaza los nodes of the set.
+//!
+//! The search tree is updated the next time it is queried.
 void XC::DqPtrsNode::mueve(const Vector3d &desplaz)
   {
     for(iterator i= begin();i!=end();i++)
       (*i)->Mueve(desplaz);
-    create_arbol();
   }
 
 //! @brief Applies the transformation to the elements of the set.
+//!
+//! The search tree is updated the next time it is queried.
 void XC::DqPtrsNode::transforma(const TrfGeom &trf)
   {
     //Transforma 
     for(iterator i= begin();i!=end();i++)
       (*i)->Transforma(trf);
-    create_arbol();
   }
 
 //! @brief Returns (if it exists) a pointer to the node
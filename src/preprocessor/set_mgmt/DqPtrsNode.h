@@ -39,6 +39,7 @@ class ExprAlgebra;
 
 namespace XC {
 class TrfGeom;
+class Matrix;
 
 //!  \ingroup Set
 //! 
@@ -88,6 +89,11 @@ class DqPtrsNode: public DqPtrs<Node>
     const Node *buscaNodo(const int &tag) const;
     Node *getNearestNode(const Pos3d &p);
     const Node *getNearestNode(const Pos3d &p) const;
+    boost::python::list getNodesWithinRadius(const Pos3d &,const double &) const;
+    boost::python::list getNodesInBox(const Pos3d &,const Pos3d &) const;
+    boost::python::list getKNearestNodes(const Pos3d &,const size_t &) const;
+    boost::python::list getNearestNodes(const boost::python::list &) const;
+    Matrix getFieldValues(const std::string &,const boost::python::list &) const;
 
     void numera(void);
   };
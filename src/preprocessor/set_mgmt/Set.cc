@@ -34,15 +34,19 @@
 #include "preprocessor/cad/entidades/Pnt.h"
 #include "preprocessor/cad/entidades/Edge.h"
 #include "preprocessor/cad/entidades/Face.h"
+#include "preprocessor/cad/entidades/QuadSurface.h"
 #include "preprocessor/cad/entidades/Body.h"
 #include "preprocessor/cad/entidades/UniformGrid.h"
 #include "preprocessor/cad/matrices/TritrizPtrElem.h"
 #include "preprocessor/cad/trf/TrfGeom.h"
 #include "utility/matrix/ID.h"
+#include "utility/threads/parallel_for.h"
 
 #include "xc_utils/src/geom/pos_vec/SVD3d.h"
 #include "xc_utils/src/geom/d2/Plano3d.h"
 #include "xc_utils/src/geom/d3/SemiEspacio3d.h"
+#include "xc_utils/src/geom/pos_vec/MatrizPos3d.h"
+#include "xc_utils/src/geom/pos_vec/TritrizPos3d.h"
 
 
 //! @brief Constructor.
@@ -236,13 +240,80 @@ void XC::Set::line_meshing(meshing_dir dm)
       std::clog << "done." << std::endl;
   }
 
+//! @brief Computes the node positions of the surfaces (see surface_meshing).
+class SurfaceNodePositions
+  {
+    const std::vector<XC::QuadSurface *> &surfaces;
+    std::vector<MatrizPos3d> &positions;
+  public:
+    SurfaceNodePositions(const std::vector<XC::QuadSurface *> &s,std::vector<MatrizPos3d> &p)
+      : surfaces(s), positions(p) {}
+    void operator()(const size_t &i)
+      { positions[i]= surfaces[i]->getNodePositions(); }
+  };
+
+//! @brief Places copies of the seed element on the nodes of the
+//! entities (see surface_meshing).
+template <class Ent>
+class EntityElements
+  {
+    const std::vector<Ent *> &entities;
+    std::vector<XC::TritrizPtrElem> &elements;
+    XC::meshing_dir dm;
+  public:
+    EntityElements(const std::vector<Ent *> &e,std::vector<XC::TritrizPtrElem> &elems,XC::meshing_dir d)
+      : entities(e), elements(elems), dm(d) {}
+    void operator()(const size_t &i)
+      { elements[i]= entities[i]->put_elements_on_mesh(dm); }
+  };
+
 //! @brief Create nodes and, where appropriate, elements on surfaces.
+//!
+//! Meshing is done in three phases:
+//! - the positions of the nodes of the quadrilateral surfaces are
+//!   computed in parallel (it's pure geometry, the domain is not modified).
+//! - nodes are created, surface by surface, in the order of the container.
+//! - the elements (copies of the seed element) are built in parallel
+//!   and then added to the model, surface by surface, in the order of
+//!   the container.
+//! This way tag assignment is the same whatever the number of threads is.
 void XC::Set::surface_meshing(meshing_dir dm)
   {
     if(verborrea>2)
       std::clog << "Meshing surfaces...";
+    std::vector<QuadSurface *> quads;
     for(lst_surface_ptrs::iterator i= surfaces.begin();i!=surfaces.end();i++)
-      (*i)->genMesh(dm);
+      {
+        QuadSurface *q= dynamic_cast<QuadSurface *>(*i);
+        if(q && !q->TieneNodos() && q->checkNDivs())
+          quads.push_back(q);
+      }
+    std::vector<MatrizPos3d> positions(quads.size());
+    SurfaceNodePositions posFunc(quads,positions);
+    parallel_for(quads.size(),posFunc);
+    for(size_t i= 0;i<quads.size();i++)
+      quads[i]->create_nodes(positions[i]);
+
+    quads.clear();
+    for(lst_surface_ptrs::iterator i= surfaces.begin();i!=surfaces.end();i++)
+      {
+        QuadSurface *q= dynamic_cast<QuadSurface *>(*i);
+        if(q && q->TieneNodos() && q->getTtzElements().Null())
+          quads.push_back(q);
+      }
+    std::vector<TritrizPtrElem> elements(quads.size());
+    EntityElements<QuadSurface> elemFunc(quads,elements,dm);
+    parallel_for(quads.size(),elemFunc);
+    size_t j= 0;
+    for(lst_surface_ptrs::iterator i= surfaces.begin();i!=surfaces.end();i++)
+      {
+        if((j<quads.size()) && (*i==quads[j]))
+          {
+            quads[j]->create_elements(elements[j]);
+            j++;
+          }
+        (*i)->genMesh(dm); //Nodes and elements already created (if any) are kept.
+      }
     if(verborrea>2)
       std::clog << "done." << std::endl;
   }
@@ -258,11 +329,49 @@ void XC::Set::body_meshing(meshing_dir dm)
       std::clog << "done." << std::endl;
   }
 
-//! @brief Creates nodes and, eventually, elements on the points of the set.
+//! @brief Computes the node positions of the uniform grids (see uniform_grid_meshing).
+class GridNodePositions
+  {
+    const std::vector<XC::UniformGrid *> &grids;
+    std::vector<TritrizPos3d> &positions;
+  public:
+    GridNodePositions(const std::vector<XC::UniformGrid *> &g,std::vector<TritrizPos3d> &p)
+      : grids(g), positions(p) {}
+    void operator()(const size_t &i)
+      { positions[i]= grids[i]->getNodePositions(); }
+  };
+
+//! @brief Creates nodes and, eventually, elements on the uniform grids of the set.
+//!
+//! Node positions and elements are computed in parallel, nodes and
+//! elements are added to the model in the order of the container
+//! (see surface_meshing).
 void XC::Set::uniform_grid_meshing(meshing_dir dm)
   {
     if(verborrea>2)
       std::clog << "Meshing uniform grids...";
+    std::vector<UniformGrid *> grids;
+    for(lst_ptr_uniform_grids::iterator i= uniform_grids.begin();i!=uniform_grids.end();i++)
+      if(!(*i)->TieneNodos())
+        grids.push_back(*i);
+    std::vector<TritrizPos3d> positions(grids.size());
+    GridNodePositions posFunc(grids,positions);
+    parallel_for(grids.size(),posFunc);
+    for(size_t i= 0;i<grids.size();i++)
+      {
+        grids[i]->create_nodes(positions[i]);
+        positions[i]= TritrizPos3d(); //Free memory.
+      }
+
+    grids.clear();
+    for(lst_ptr_uniform_grids::iterator i= uniform_grids.begin();i!=uniform_grids.end();i++)
+      if((*i)->TieneNodos() && (*i)->getTtzElements().Null())
+        grids.push_back(*i);
+    std::vector<TritrizPtrElem> elements(grids.size());
+    EntityElements<UniformGrid> elemFunc(grids,elements,dm);
+    parallel_for(grids.size(),elemFunc);
+    for(size_t i= 0;i<grids.size();i++)
+      grids[i]->create_elements(elements[i]);
     for(lst_ptr_uniform_grids::iterator i= uniform_grids.begin();i!=uniform_grids.end();i++)
       (*i)->genMesh(dm);
     if(verborrea>2)
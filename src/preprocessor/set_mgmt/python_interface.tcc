@@ -38,6 +38,11 @@ class_<XC::DqPtrsNode, bases<dq_ptrs_node>, boost::noncopyable >("DqPtrsNode",no
   .add_property("getNumLiveNodes", &XC::DqPtrsNode::getNumLiveNodes)
   .add_property("getNumDeadNodes", &XC::DqPtrsNode::getNumDeadNodes)
   .def("getNearestNode",make_function(getNearestNodeDqPtrs, return_internal_reference<>() ),"Returns nearest node.")
+  .def("getNodesWithinRadius",&XC::DqPtrsNode::getNodesWithinRadius,"getNodesWithinRadius(pos,r): returns the nodes whose distance to pos is less or equal than r.")
+  .def("getNodesInBox",&XC::DqPtrsNode::getNodesInBox,"getNodesInBox(pMin,pMax): returns the nodes inside the box.")
+  .def("getKNearestNodes",&XC::DqPtrsNode::getKNearestNodes,"getKNearestNodes(pos,k): returns the k nodes closest to pos sorted by distance.")
+  .def("getNearestNodes",&XC::DqPtrsNode::getNearestNodes,"getNearestNodes(positions): returns the nearest node for each position of the list.")
+  .def("getFieldValues",&XC::DqPtrsNode::getFieldValues,"getFieldValues(quantity,components): returns a matrix with the values of the nodal quantity ('disp', 'vel', 'accel', 'reaction' or 'incrDisp') for all the nodes (one row for each node, all the components if the list is empty).")
    ;
 
 typedef XC::DqPtrs<XC::Element> dq_ptrs_element;
@@ -57,7 +62,12 @@ class_<XC::DqPtrsElem, bases<dq_ptrs_element>, boost::noncopyable >("DqPtrsElem"
   .add_property("getNumLiveElements", &XC::DqPtrsElem::getNumLiveElements)
   .add_property("getNumDeadElements", &XC::DqPtrsElem::getNumDeadElements)
   .def("getNearestElement",make_function(getNearestElementDqPtrs, return_internal_reference<>() ),"Returns nearest element.")
+  .def("getElementContaining",make_function(&XC::DqPtrsElem::getElementContaining, return_internal_reference<>() ),"getElementContaining(pos,tol): returns the element that contains the position (None if not found).")
+  .def("getElementsWithinRadius",&XC::DqPtrsElem::getElementsWithinRadius,"getElementsWithinRadius(pos,r): returns the elements whose centroid distance to pos is less or equal than r.")
+  .def("getNearestElements",&XC::DqPtrsElem::getNearestElements,"getNearestElements(positions): returns the nearest element for each position of the list.")
+  .def("getElementsContaining",&XC::DqPtrsElem::getElementsContaining,"getElementsContaining(positions,tol): returns the element that contains each position of the list (None if not found).")
   .def("getContours",&XC::DqPtrsElem::getContours,"Returns contour(s) from the element set in the form of closed 3D polylines.")
+  .def("getFieldValues",&XC::DqPtrsElem::getFieldValues,"getFieldValues(quantity,components,numPoints): returns a matrix with the values of the element response (i.e. ['force'] or ['section','*','forces']) for all the elements (one row for each element, the '*' is replaced by the integration point numbers 1..numPoints).")
    ;
 
 typedef XC::DqPtrs<XC::Constraint> dq_ptrs_constraint;
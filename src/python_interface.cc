@@ -38,6 +38,7 @@ void export_preprocessor_build_model(void);
 void export_preprocessor_sets(void);
 void export_preprocessor_main(void);
 void export_solution(void);
+void export_reliability(void);
 
 BOOST_PYTHON_MODULE(xc)
   {
@@ -65,6 +66,7 @@ BOOST_PYTHON_MODULE(xc)
     export_preprocessor_sets();
     export_preprocessor_main();
     export_solution(); //Solution routines exposition.
+    export_reliability(); //Reliability analysis exposition.
 
 #include "post_process/python_interface.tcc"
 
@@ -74,6 +76,7 @@ BOOST_PYTHON_MODULE(xc)
     class_<XC::ProblemaEF, bases<EntCmd>, boost::noncopyable>("ProblemaEF")
       .def("getXCVersion",  make_function(&XC::ProblemaEF::getXCVersion,return_value_policy<copy_const_reference>()),"Return XC program version string.").staticmethod("getXCVersion")
       .def("getXCVersionShort",  make_function(&XC::ProblemaEF::getXCVersionShort,return_value_policy<copy_const_reference>()),"Return XC program (short) version string.").staticmethod("getXCVersionShort")
+      .def("getObjectBroker", make_function(&XC::ProblemaEF::getObjectBroker,return_value_policy<reference_existing_object>()),"Return the object broker (used to create the objects received through a channel).").staticmethod("getObjectBroker")
       .add_property("getDomain", make_function( getDomainRef, return_internal_reference<>() ),"Return a reference to the domain.")
       .add_property("getPreprocessor", make_function( getPreprocessorRef, return_internal_reference<>() ),"Return a reference to the preprocessor.")
       .add_property("getSoluProc", make_function( getSoluProcRef, return_internal_reference<>() ),"Return a reference to the solver")
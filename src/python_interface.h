@@ -35,6 +35,7 @@
 #include <boost/python/suite/indexing/map_indexing_suite.hpp>
 #include <boost/python/docstring_options.hpp>
 #include <boost/python/implicit.hpp>
+#include <boost/python/make_constructor.hpp>
 #include "utility/actor/objectBroker/all_includes.h"
 #include "xc_utils/src/geom/d1/Recta2d.h"
 #include "xc_utils/src/geom/d2/Semiplano2d.h"
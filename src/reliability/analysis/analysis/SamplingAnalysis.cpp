@@ -66,6 +66,7 @@
 #include <reliability/analysis/gFunction/GFunEvaluator.h>
 #include <reliability/analysis/gFunction/BasicGFunEvaluator.h>
 #include <reliability/analysis/randomNumber/RandomNumberGenerator.h>
+#include <reliability/analysis/randomNumber/PhiloxRandGenerator.h>
 #include <reliability/domain/components/RandomVariable.h>
 #include <reliability/domain/distributions/NormalRV.h>
 #include <utility/matrix/Vector.h>
@@ -110,8 +111,71 @@ XC::SamplingAnalysis::SamplingAnalysis(	ReliabilityDomain *passedReliabilityDoma
 	fileName= passedFileName;
 	startPoint = pStartPoint;
 	analysisTypeTag = passedAnalysisTypeTag;
+	samplingType = MONTE_CARLO;
+	designPointLimitStateFunction = 0;
 }
 
+//! @brief Sets the sampling type (MONTE_CARLO or LATIN_HYPERCUBE).
+void XC::SamplingAnalysis::setSamplingType(const SamplingType &t)
+  { samplingType= t; }
+
+//! @brief Returns the sampling type.
+const XC::SamplingAnalysis::SamplingType &XC::SamplingAnalysis::getSamplingType(void) const
+  { return samplingType; }
+
+//! @brief Centers the sampling density on the FORM design point of
+//! the limit-state function with the tag being passed as parameter
+//! (importance sampling). The FORM analysis must be done before.
+void XC::SamplingAnalysis::setDesignPointLimitStateFunction(int tag)
+  { designPointLimitStateFunction= tag; }
+
+//! @brief Returns the governing coefficient of variation
+//! after each sample of the last analysis.
+const std::vector<double> &XC::SamplingAnalysis::getCOVHistory(void) const
+  { return covHistory; }
+
+//! @brief Computes the random permutation of the strata for each
+//! random variable (latin hypercube).
+void XC::SamplingAnalysis::computeLHSPermutations(const PhiloxRandGenerator &rng, int numRV)
+  {
+    lhsPermutations.resize(numRV);
+    for(int j= 0;j<numRV;j++)
+      lhsPermutations[j]= rng.getLHSPermutation(j,numberOfSimulations);
+  }
+
+//! @brief Computes the standard normal numbers for the k-th sample.
+int XC::SamplingAnalysis::getRandomArray(int k, int seed, bool isFirstSimulation, PhiloxRandGenerator *counterRNG, NormalRV &stdNormRV, Vector &randomArray)
+  {
+    int result= 0;
+    const int i= k-1;
+    if(counterRNG)
+      {
+        if((samplingType==LATIN_HYPERCUBE) && (i<numberOfSimulations))
+          {
+            const int numRV= randomArray.Size();
+            for(int j= 0;j<numRV;j++)
+              {
+                const double p= (lhsPermutations[j][i]+counterRNG->getUniformNumber(i,j))/numberOfSimulations;
+                randomArray(j)= stdNormRV.getInverseCDFvalue(p);
+              }
+          }
+        else
+          counterRNG->fillStdNormalNumbers(i,randomArray);
+      }
+    else
+      {
+        const int numRV= randomArray.Size();
+        if(isFirstSimulation)
+          result= theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV,seed);
+        else
+          result= theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV);
+        if(result>=0)
+          randomArray= theRandomNumberGenerator->getGeneratedNumbers();
+      }
+    return result;
+  }
+
+
 
 
 
@@ -278,6 +342,16 @@ XC::SamplingAnalysis::analyze(void)
 		}
 		startPointY = theProbabilityTransformation->get_u();
 	}
+	if (designPointLimitStateFunction > 0) {
+		// Importance sampling around the FORM design point
+		theLimitStateFunction = theReliabilityDomain->getLimitStateFunctionPtr(designPointLimitStateFunction);
+		if (theLimitStateFunction == 0 || theLimitStateFunction->designPoint_u_inStdNormalSpace.Size() != numRV) {
+			std::cerr << "XC::SamplingAnalysis::analyze() - there is no design point" << std::endl
+				<< " for limit-state function with tag #" << designPointLimitStateFunction << "." << std::endl;
+			return -1;
+		}
+		startPointY = theLimitStateFunction->designPoint_u_inStdNormalSpace;
+	}
 
 
 	// Initial declarations
@@ -304,6 +378,27 @@ XC::SamplingAnalysis::analyze(void)
 	std::ofstream resultsOutputFile(fileName.c_str(), ios::out );
 
 
+	// Counter based generator: the numbers of the k-th sample are
+	// taken from the stream k-1, so they don't depend on the order
+	// in which the samples are generated (nor on restarts).
+	PhiloxRandGenerator *counterRNG = dynamic_cast<PhiloxRandGenerator *>(theRandomNumberGenerator);
+	if (counterRNG) {
+		if (k > 1) {
+			counterRNG->setSeed(seed); // Restart: seed from file.
+		}
+		seed = counterRNG->getSeed();
+	}
+	if (samplingType == LATIN_HYPERCUBE) {
+		if (!counterRNG) {
+			std::cerr << "XC::SamplingAnalysis::analyze() - latin hypercube sampling" << std::endl
+				<< " needs a counter based random number generator." << std::endl;
+			return -1;
+		}
+		computeLHSPermutations(*counterRNG,numRV);
+	}
+
+	covHistory.clear();
+
 	bool isFirstSimulation = true;
 	while( (k<=numberOfSimulations) && (govCov>targetCOV) || (k<=2) )
            {
@@ -315,19 +410,13 @@ XC::SamplingAnalysis::analyze(void)
 
 		
 		// Create array of standard normal random numbers
-		if (isFirstSimulation) {
-			result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV,seed);
-		}
-		else {
-			result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV);
-		}
+		result = getRandomArray(k,seed,isFirstSimulation,counterRNG,*aStdNormRV,randomArray);
 		seed = theRandomNumberGenerator->getSeed();
 		if (result < 0) {
 			std::cerr << "XC::SamplingAnalysis::analyze() - could not generate" << std::endl
 				<< " random numbers for simulation." << std::endl;
 			return -1;
 		}
-		randomArray = theRandomNumberGenerator->getGeneratedNumbers();
 
 		// Compute the point in standard normal space
 		u = startPointY + chol_covariance * randomArray;
@@ -363,12 +452,8 @@ XC::SamplingAnalysis::analyze(void)
 		for (int lsf=0; lsf<numLsf; lsf++ ) {
 
 
-			// Set tag of "active" limit-state function
-			theReliabilityDomain->setTagOfActiveLimitStateFunction(lsf+1);
-
-
 			// Get value of limit-state function
-			result = theGFunEvaluator->evaluateG(x);
+			result = theGFunEvaluator->evaluateG(x,lsf+1);
 			if (result < 0) {
 				std::cerr << "XC::SamplingAnalysis::analyze() - could not " << std::endl
 					<< " tokenize limit-state function. " << std::endl;
@@ -527,6 +612,7 @@ XC::SamplingAnalysis::analyze(void)
 		if (govCov == 0.0) {
 			govCov = 999.0;
 		}
+		covHistory.push_back(govCov);
 
 
 		// Print to the restart file, if requested. 
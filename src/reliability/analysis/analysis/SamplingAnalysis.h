@@ -66,13 +66,28 @@
 #include <reliability/analysis/randomNumber/RandomNumberGenerator.h>
 
 #include <fstream>
+#include <vector>
 using std::ofstream;
 
 namespace XC {
 class GFunEvaluator;
+class PhiloxRandGenerator;
+class NormalRV;
 
+//! @brief Sampling analysis (Monte Carlo, importance sampling
+//! and latin hypercube).
+//!
+//! The samples are evaluated one by one (the finite element analyses
+//! share static element and material buffers and the Tcl interpreter,
+//! so they can't run on several threads) and the analysis stops as
+//! soon as the target coefficient of variation is reached. With a
+//! counter based random number generator the numbers of each sample
+//! depend only on the seed and on the sample number, so a restarted
+//! analysis generates the same samples.
 class SamplingAnalysis : public ReliabilityAnalysis
 {
+public:
+	enum SamplingType {MONTE_CARLO, LATIN_HYPERCUBE};
 private:
 	ReliabilityDomain *theReliabilityDomain;
 	ProbabilityTransformation *theProbabilityTransformation;
@@ -85,6 +100,13 @@ private:
 	std::string fileName;
 	Vector *startPoint;
 	int analysisTypeTag;
+	SamplingType samplingType;
+	int designPointLimitStateFunction; //!< Tag of the limit-state function whose FORM design point is the sampling center (0: none).
+	std::vector<double> covHistory; //!< Governing coefficient of variation after each sample.
+	std::vector<std::vector<int> > lhsPermutations; //!< Strata of each sample for each random variable (latin hypercube).
+
+	void computeLHSPermutations(const PhiloxRandGenerator &, int numRV);
+	int getRandomArray(int k, int seed, bool isFirstSimulation, PhiloxRandGenerator *, NormalRV &, Vector &randomArray);
 
 public:
 	SamplingAnalysis(	ReliabilityDomain *passedReliabilityDomain,
@@ -99,6 +121,11 @@ public:
 						Vector *startPoint,
 						int analysisTypeTag);
 
+	void setSamplingType(const SamplingType &);
+	const SamplingType &getSamplingType(void) const;
+	void setDesignPointLimitStateFunction(int tag);
+	const std::vector<double> &getCOVHistory(void) const;
+
 	int analyze(void);
 };
 } // end of XC namespace
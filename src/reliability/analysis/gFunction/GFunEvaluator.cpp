@@ -89,13 +89,20 @@ int XC::GFunEvaluator::getNumberOfEvaluations()
   { return numberOfEvaluations; }
 
 
+//! @brief Evaluates the active limit-state function.
 int XC::GFunEvaluator::evaluateG(Vector x)
+  { return evaluateG(x,theReliabilityDomain->getTagOfActiveLimitStateFunction()); }
+
+//! @brief Evaluates the limit-state function with the tag being passed
+//! as parameter (doesn't use the active limit-state function of the
+//! reliability domain, so several evaluators can work on the same
+//! reliability domain at the same time).
+int XC::GFunEvaluator::evaluateG(const Vector &x, int lsf)
   {
     numberOfEvaluations++;
 
 
     // "Download" limit-state function from reliability domain
-    int lsf = theReliabilityDomain->getTagOfActiveLimitStateFunction();
     LimitStateFunction *theLimitStateFunction = theReliabilityDomain->getLimitStateFunctionPtr(lsf);
 
 
@@ -126,7 +133,8 @@ int XC::GFunEvaluator::evaluateG(Vector x)
 
     // Set values of basic random variables and file quantities
     // (Other quantities will have to be set by specific implementations of this class)
-    char *tokenPtr = strtok( lsf_forTokenizing, separators);
+    char *savePtr= nullptr;
+    char *tokenPtr = strtok_r( lsf_forTokenizing, separators, &savePtr);
     while ( tokenPtr != nullptr ) {
 
             // Copy the token pointer over to a temporary storage
@@ -175,7 +183,7 @@ int XC::GFunEvaluator::evaluateG(Vector x)
                     Tcl_Eval( theTclInterp, tclAssignment);
             }
             
-            tokenPtr = strtok( nullptr, separators);
+            tokenPtr = strtok_r( nullptr, separators, &savePtr);
     }
 
     // Compute value of g-function
@@ -81,6 +81,7 @@ public:
 
 	// Methods provided by base class
 	int		evaluateG(Vector x);
+	int		evaluateG(const Vector &x, int lsf);
 	double	getG();
 	int     initializeNumberOfEvaluations();
 	int     getNumberOfEvaluations();
@@ -173,7 +173,8 @@ XC::OpenSeesGFunEvaluator::tokenizeSpecials(const std::string &theExpression)
 	strcpy(lsf_forTokenizing,theExpression.c_str());
 	const std::string dollarSign = "$";
 	const std::string underscore = "_";
-	char *tokenPtr = strtok( lsf_forTokenizing, separators);
+	char *savePtr= nullptr;
+	char *tokenPtr = strtok_r( lsf_forTokenizing, separators, &savePtr);
 	while ( tokenPtr != nullptr ) {
 
 		strcpy(tempchar,tokenPtr);
@@ -257,13 +258,13 @@ XC::OpenSeesGFunEvaluator::tokenizeSpecials(const std::string &theExpression)
 
 		}
 
-		tokenPtr = strtok( nullptr, separators);
+		tokenPtr = strtok_r( nullptr, separators, &savePtr);
 	}
 
 	delete [] lsf_forTokenizing;
 
 	// Re-create possible recorders for subsequent analyses
-	createRecorders();
+	createRecorders(theExpression);
 
 	return 0;
 }
@@ -297,8 +298,13 @@ XC::OpenSeesGFunEvaluator::createRecorders()
 	// Download active limit-state function
 	int lsf = theReliabilityDomain->getTagOfActiveLimitStateFunction();
 	LimitStateFunction *theLimitStateFunction = theReliabilityDomain->getLimitStateFunctionPtr(lsf);
-	std::string theExpression = theLimitStateFunction->getExpression();
+	return createRecorders(theLimitStateFunction->getExpression());
+}
 
+//! @brief Creates the recorders that appear in the expression.
+int
+XC::OpenSeesGFunEvaluator::createRecorders(const std::string &theExpression)
+{
 	// Initial declarations
 	char tempchar[100]="";
 	char separators[5] = "}{";
@@ -306,7 +312,8 @@ XC::OpenSeesGFunEvaluator::createRecorders()
 	strcpy(lsf_forTokenizing,theExpression.c_str());
 
 	// Go through the limit-state function
-	char *tokenPtr = strtok( lsf_forTokenizing, separators);
+	char *savePtr= nullptr;
+	char *tokenPtr = strtok_r( lsf_forTokenizing, separators, &savePtr);
 	while ( tokenPtr != nullptr ) {
 
 		strcpy(tempchar,tokenPtr);
@@ -320,7 +327,7 @@ XC::OpenSeesGFunEvaluator::createRecorders()
 			rec_element_occurrence(tempchar, true, dummy1, dummy2);
 		}
 
-		tokenPtr = strtok( nullptr, separators);
+		tokenPtr = strtok_r( nullptr, separators, &savePtr);
 	}
 
 	delete [] lsf_forTokenizing;
@@ -74,6 +74,7 @@ class OpenSeesGFunEvaluator : public GFunEvaluator
 {
 private:
 	int createRecorders();
+	int createRecorders(const std::string &theExpression);
 	int removeRecorders();
 	char *rec_node_occurrence(char tempchar[100], bool createRecorders, int &line, int &column);
 	char *rec_element_occurrence(char tempchar[100], bool createRecorders, int &line, int &column);
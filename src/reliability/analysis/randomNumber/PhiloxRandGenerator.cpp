@@ -0,0 +1,201 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//PhiloxRandGenerator.cpp
+
+#include <reliability/analysis/randomNumber/PhiloxRandGenerator.h>
+#include <cmath>
+#include <algorithm>
+
+namespace {
+//! @brief Returns the high and low words of the product of a and b.
+inline void mulhilo(const uint32_t &a,const uint32_t &b,uint32_t &hi,uint32_t &lo)
+  {
+    const uint64_t p= uint64_t(a)*uint64_t(b);
+    hi= uint32_t(p>>32);
+    lo= uint32_t(p);
+  }
+
+//! @brief Uniform number in the open interval (0,1) with
+//! 53 significant bits built from two words.
+inline double to_uniform(const uint32_t &a,const uint32_t &b)
+  { return ((a>>5)*67108864.0+(b>>6)+0.5)/9007199254740992.0; }
+}
+
+//! @brief Constructor.
+XC::PhiloxRandGenerator::PhiloxRandGenerator(int s)
+  :RandomNumberGenerator(), generatedNumbers(), seed(s), nextStream(0) {}
+
+//! @brief Computes the 128 bits block that corresponds to the
+//! counter (stream, counter) and stores it on out (Philox4x32
+//! with ten rounds).
+void XC::PhiloxRandGenerator::block(const uint64_t &stream,const uint64_t &counter,uint32_t out[4]) const
+  {
+    const uint32_t M0= 0xD2511F53, M1= 0xCD9E8D57;
+    const uint32_t W0= 0x9E3779B9, W1= 0xBB67AE85;
+    uint32_t ctr[4]= {uint32_t(counter), uint32_t(counter>>32), uint32_t(stream), uint32_t(stream>>32)};
+    uint32_t key[2]= {uint32_t(seed), 0xA4093822};
+    for(int r= 0;r<10;r++)
+      {
+        if(r>0)
+          { key[0]+= W0; key[1]+= W1; }
+        uint32_t hi0, lo0, hi1, lo1;
+        mulhilo(M0,ctr[0],hi0,lo0);
+        mulhilo(M1,ctr[2],hi1,lo1);
+        const uint32_t c1= ctr[1], c3= ctr[3];
+        ctr[0]= hi1^c1^key[0];
+        ctr[1]= lo1;
+        ctr[2]= hi0^c3^key[1];
+        ctr[3]= lo0;
+      }
+    for(int i= 0;i<4;i++)
+      out[i]= ctr[i];
+  }
+
+//! @brief Returns the pos-th uniform number in (0,1) of the stream.
+double XC::PhiloxRandGenerator::getUniformNumber(const uint64_t &stream,const uint64_t &pos) const
+  {
+    uint32_t b[4];
+    block(stream,pos/2,b);
+    const size_t j= 2*(pos%2);
+    return to_uniform(b[j],b[j+1]);
+  }
+
+//! @brief Returns the random permutation of the strata 0..n-1 for
+//! the variable (latin hypercube). The permutations are taken from
+//! the streams 2^63+variable, that are not used by the samples.
+std::vector<int> XC::PhiloxRandGenerator::getLHSPermutation(const size_t &variable,const size_t &n) const
+  {
+    const uint64_t stream= (uint64_t(1)<<63)+variable;
+    std::vector<int> retval(n);
+    for(size_t i= 0;i<n;i++)
+      retval[i]= i;
+    //Fisher-Yates shuffle.
+    for(int i= int(n)-1;i>0;i--)
+      {
+        const int r= std::min(int(getUniformNumber(stream,n-1-i)*(i+1)),i);
+        std::swap(retval[i],retval[r]);
+      }
+    return retval;
+  }
+
+//! @brief Returns a latin hypercube sample of uniform numbers in (0,1)
+//! (row: sample, column: variable). Each column has exactly one
+//! value in each of the intervals [k/numSamples, (k+1)/numSamples).
+//! The value of the sample i for the variable j is taken from the
+//! position j of the stream i.
+XC::Matrix XC::PhiloxRandGenerator::getLatinHypercubeSample(const size_t &numSamples,const size_t &numVariables) const
+  {
+    Matrix retval(numSamples,numVariables);
+    for(size_t j= 0;j<numVariables;j++)
+      {
+        const std::vector<int> perm= getLHSPermutation(j,numSamples);
+        for(size_t i= 0;i<numSamples;i++)
+          retval(i,j)= (perm[i]+getUniformNumber(i,j))/numSamples;
+      }
+    return retval;
+  }
+
+//! @brief Fills v with uniform numbers in (lower, upper) taken
+//! from the beginning of the stream.
+void XC::PhiloxRandGenerator::fillUniformNumbers(const uint64_t &stream,Vector &v,const double &lower,const double &upper) const
+  {
+    const int n= v.Size();
+    uint32_t b[4];
+    for(int i= 0;i<n;i+= 2)
+      {
+        block(stream,i/2,b);
+        v(i)= lower+(upper-lower)*to_uniform(b[0],b[1]);
+        if(i+1<n)
+          v(i+1)= lower+(upper-lower)*to_uniform(b[2],b[3]);
+      }
+  }
+
+//! @brief Fills v with independent standard normal numbers taken
+//! from the beginning of the stream (Box-Muller transform).
+void XC::PhiloxRandGenerator::fillStdNormalNumbers(const uint64_t &stream,Vector &v) const
+  {
+    const double twoPi= 2.0*M_PI;
+    const int n= v.Size();
+    uint32_t b[4];
+    for(int i= 0;i<n;i+= 2)
+      {
+        block(stream,i/2,b);
+        const double r= sqrt(-2.0*log(to_uniform(b[0],b[1])));
+        const double theta= twoPi*to_uniform(b[2],b[3]);
+        v(i)= r*cos(theta);
+        if(i+1<n)
+          v(i+1)= r*sin(theta);
+      }
+  }
+
+//! @brief Sets the seed (key of the generator).
+void XC::PhiloxRandGenerator::setSeed(const int &s)
+  { seed= s; }
+
+//! @brief Sets the stream to use in the next call to the
+//! generate_... methods.
+void XC::PhiloxRandGenerator::setStream(const uint64_t &s)
+  { nextStream= s; }
+
+//! @brief Returns the stream to use in the next call to the
+//! generate_... methods.
+const uint64_t &XC::PhiloxRandGenerator::getStream(void) const
+  { return nextStream; }
+
+//! @brief Generates n standard normal numbers from the next stream
+//! (if seedIn is not zero the seed is changed and the stream counter
+//! is reset).
+int XC::PhiloxRandGenerator::generate_nIndependentStdNormalNumbers(int n, int seedIn)
+  {
+    if(seedIn!=0)
+      { seed= seedIn; nextStream= 0; }
+    generatedNumbers.resize(n);
+    fillStdNormalNumbers(nextStream,generatedNumbers);
+    nextStream++;
+    return 0;
+  }
+
+//! @brief Generates n uniform numbers in (lower, upper) from the next
+//! stream (if seedIn is not zero the seed is changed and the stream
+//! counter is reset).
+int XC::PhiloxRandGenerator::generate_nIndependentUniformNumbers(int n, double lower, double upper, int seedIn)
+  {
+    if(seedIn!=0)
+      { seed= seedIn; nextStream= 0; }
+    generatedNumbers.resize(n);
+    fillUniformNumbers(nextStream,generatedNumbers,lower,upper);
+    nextStream++;
+    return 0;
+  }
+
+//! @brief Returns the last generated numbers.
+const XC::Vector &XC::PhiloxRandGenerator::getGeneratedNumbers(void) const
+  { return generatedNumbers; }
+
+//! @brief Returns the seed.
+int XC::PhiloxRandGenerator::getSeed(void)
+  { return seed; }
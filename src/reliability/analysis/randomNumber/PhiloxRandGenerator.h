@@ -0,0 +1,74 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//PhiloxRandGenerator.h
+
+#ifndef PhiloxRandGenerator_h
+#define PhiloxRandGenerator_h
+
+#include <reliability/analysis/randomNumber/RandomNumberGenerator.h>
+#include <utility/matrix/Matrix.h>
+#include <stdint.h>
+#include <vector>
+
+namespace XC {
+//! @brief Counter based random number generator (Philox4x32-10).
+//!
+//! The numbers are a pure function of (seed, stream, position),
+//! so each sample of a simulation can draw its numbers from its
+//! own stream without any shared state. The const methods that
+//! take the stream as argument can be called from several
+//! threads at the same time and their results don't depend
+//! on the order of the calls.
+class PhiloxRandGenerator: public RandomNumberGenerator
+  {
+  private:
+    Vector generatedNumbers;
+    int seed;
+    uint64_t nextStream; //!< Stream used by the next call of the sequential interface.
+
+    void block(const uint64_t &stream,const uint64_t &counter,uint32_t out[4]) const;
+  public:
+    PhiloxRandGenerator(int seed= 1);
+
+    void fillUniformNumbers(const uint64_t &stream,Vector &v,const double &lower= 0.0,const double &upper= 1.0) const;
+    void fillStdNormalNumbers(const uint64_t &stream,Vector &v) const;
+    double getUniformNumber(const uint64_t &stream,const uint64_t &pos) const;
+    std::vector<int> getLHSPermutation(const size_t &variable,const size_t &n) const;
+    Matrix getLatinHypercubeSample(const size_t &numSamples,const size_t &numVariables) const;
+
+    void setSeed(const int &);
+    void setStream(const uint64_t &);
+    const uint64_t &getStream(void) const;
+
+    int generate_nIndependentStdNormalNumbers(int n, int seed=0);
+    int generate_nIndependentUniformNumbers(int n, double lower, double upper, int seed=0);
+    const Vector &getGeneratedNumbers(void) const;
+    int getSeed(void);
+  };
+} // end of XC namespace
+
+#endif
@@ -65,6 +65,8 @@
 #include <reliability/analysis/gFunction/GFunEvaluator.h>
 #include <reliability/domain/components/RandomVariable.h>
 #include <tcl.h>
+#include <cmath>
+#include <algorithm>
 
 #include <fstream>
 #include <iomanip>
@@ -96,6 +98,11 @@ XC::FiniteDifferenceGradGEvaluator::FiniteDifferenceGradGEvaluator(
 
 	DgDdispl = 0;
 	DgDpar = 0;
+
+	differenceScheme = FORWARD_DIFFERENCES;
+	adaptivePerturbation = false;
+	gNoise = 1e-8;
+	gScale = 0.0;
 }
 
 XC::FiniteDifferenceGradGEvaluator::~FiniteDifferenceGradGEvaluator()
@@ -133,23 +140,177 @@ XC::FiniteDifferenceGradGEvaluator::getAllGradG()
 	}
 }
 
+//! @brief Sets the difference scheme (forward: one analysis for each
+//! random variable, central: two analyses for each random variable).
+void XC::FiniteDifferenceGradGEvaluator::setDifferenceScheme(const DifferenceScheme &ds)
+  { differenceScheme= ds; }
+
+//! @brief Activates or deactivates the computation of the perturbation
+//! from the estimated curvature of the limit-state function.
+//! @param noise: relative noise of the limit-state function values
+//! (i.e. tolerance of the finite element analysis).
+void XC::FiniteDifferenceGradGEvaluator::setAdaptivePerturbation(bool b, double noise)
+  {
+    adaptivePerturbation= b;
+    gNoise= noise;
+  }
+
+//! @brief Removes the cached limit-state function values (the cache
+//! must be cleared if the model changes between computations).
+void XC::FiniteDifferenceGradGEvaluator::clearCache(void)
+  {
+    gCache.clear();
+    gScale= 0.0;
+  }
+
+//! @brief Sets the maximum number of cached values.
+void XC::FiniteDifferenceGradGEvaluator::setMaxCacheSize(const size_t &sz)
+  { gCache.setMaxSize(sz); }
+
+//! @brief Returns the number of limit-state function values
+//! taken from the cache.
+size_t XC::FiniteDifferenceGradGEvaluator::getNumCacheHits(void) const
+  { return gCache.getNumHits(); }
+
+//! @brief Returns the cache of limit-state function values.
+XC::GFunValueCache &XC::FiniteDifferenceGradGEvaluator::getCache(void)
+  { return gCache; }
+
+//! @brief Returns the perturbation for the i-th random variable.
+//!
+//! If the adaptive perturbation is active and there is an estimation
+//! of the curvature the perturbation is the one that minimizes
+//! the sum of the truncation and the round-off errors of the forward
+//! difference: h= 2*sqrt(noise*|g|/|g''|) (|g| being the largest magnitude
+//! of the limit-state function values computed so far), bounded
+//! between 1/100 and 100 times the default one (stdv/perturbationFactor).
+double XC::FiniteDifferenceGradGEvaluator::getPerturbation(int i,const double &stdv)
+  {
+    const double h0= stdv/perturbationFactor;
+    double retval= h0;
+    if(adaptivePerturbation && (curvature.Size()>i) && (curvature(i)!=0.0))
+      {
+        retval= 2.0*sqrt(gNoise*std::max(gScale,1e-12)/fabs(curvature(i)));
+        retval= std::max(std::min(retval,100.0*h0),h0/100.0);
+      }
+    return retval;
+  }
+
+//! @brief Computes the gradients of the limit-state functions at x.
+//!
+//! @param x: point.
+//! @param lsfTags: tags of the limit-state functions.
+//! @param gFunValues: values of the limit-state functions at x.
+//! @param gradients: gradients (one column for each limit-state function).
+int XC::FiniteDifferenceGradGEvaluator::computeGradients(const Vector &x,const std::vector<int> &lsfTags,const Vector &gFunValues,Matrix &gradients)
+  {
+    const int nrv= x.Size();
+    const int numLsf= lsfTags.size();
+    const bool central= (differenceScheme==CENTRAL_DIFFERENCES);
+    const int numPoints= (central ? 2*nrv : nrv);
+
+    for(int l= 0;l<numLsf;l++)
+      {
+        gCache.store(x,lsfTags[l],gFunValues(l));
+        gScale= std::max(gScale,fabs(gFunValues(l)));
+      }
+    if(curvature.Size()!=nrv)
+      curvature= Vector(nrv);
+
+    // Perturbed points.
+    Vector h(nrv);
+    std::vector<Vector> points(numPoints,x);
+    for(int i= 0;i<nrv;i++)
+      {
+        RandomVariable *theRandomVariable= theReliabilityDomain->getRandomVariablePtr(i+1);
+        h(i)= getPerturbation(i,theRandomVariable->getStdv());
+        points[i](i)+= h(i);
+        if(central)
+          points[nrv+i](i)-= h(i);
+      }
+
+    // Limit-state function values (from the cache or running the
+    // analyses one after another: the finite element analyses can't
+    // run on several threads).
+    Matrix g(numPoints,numLsf);
+    for(int p= 0;p<numPoints;p++)
+      {
+        bool cached= true;
+        for(int l= 0;(l<numLsf) && cached;l++)
+          cached= gCache.find(points[p],lsfTags[l],g(p,l));
+        if(cached)
+          continue;
+        if(theGFunEvaluator->runGFunAnalysis(points[p])<0)
+          {
+            std::cerr << "XC::FiniteDifferenceGradGEvaluator::" << __FUNCTION__ << " - " << std::endl
+                      << " could not run analysis to evaluate limit-state function. " << std::endl;
+            return -1;
+          }
+        for(int l= 0;l<numLsf;l++)
+          {
+            if(theGFunEvaluator->evaluateG(points[p],lsfTags[l])<0)
+              {
+                std::cerr << "XC::FiniteDifferenceGradGEvaluator::" << __FUNCTION__ << " - " << std::endl
+                          << " could not tokenize limit-state function. " << std::endl;
+                return -1;
+              }
+            g(p,l)= theGFunEvaluator->getG();
+            gCache.store(points[p],lsfTags[l],g(p,l));
+          }
+      }
+
+    // Finite differences.
+    gradients.resize(nrv,numLsf);
+    for(int i= 0;i<nrv;i++)
+      for(int l= 0;l<numLsf;l++)
+        {
+          if(central)
+            gradients(i,l)= (g(i,l)-g(nrv+i,l))/(2.0*h(i));
+          else
+            gradients(i,l)= (g(i,l)-gFunValues(l))/h(i);
+        }
+
+    // Curvature estimation for the adaptive perturbation (from the
+    // central differences or from the change of the gradient).
+    if(adaptivePerturbation)
+      {
+        for(int i= 0;i<nrv;i++)
+          {
+            if(central)
+              curvature(i)= (g(i,0)-2.0*gFunValues(0)+g(nrv+i,0))/(h(i)*h(i));
+            else if(lastPoint.Size()==nrv)
+              {
+                const double dx= x(i)-lastPoint(i);
+                if(dx!=0.0)
+                  curvature(i)= (gradients(i,0)-lastGradient(i))/dx;
+              }
+          }
+        lastPoint= x;
+        lastGradient.resize(nrv);
+        for(int i= 0;i<nrv;i++)
+          lastGradient(i)= gradients(i,0);
+      }
+    return 0;
+  }
+
 int
 XC::FiniteDifferenceGradGEvaluator::computeGradG(double gFunValue, Vector passed_x)
 {
 	// Call base class method
 	computeParameterDerivatives(gFunValue);
 
+	const int lsf = theReliabilityDomain->getTagOfActiveLimitStateFunction();
 
 	// Possibly re-compute limit-state function value
 	int result;
-	if (reComputeG) {
+	if (reComputeG && !gCache.find(passed_x,lsf,gFunValue)) {
 		result = theGFunEvaluator->runGFunAnalysis(passed_x);
 		if (result < 0) {
 			std::cerr << "XC::FiniteDifferenceGradGEvaluator::evaluate_grad_g() - " << std::endl
 				<< " could not run analysis to evaluate limit-state function. " << std::endl;
 			return -1;
 		}
-		result = theGFunEvaluator->evaluateG(passed_x);
+		result = theGFunEvaluator->evaluateG(passed_x,lsf);
 		if (result < 0) {
 			std::cerr << "XC::FiniteDifferenceGradGEvaluator::evaluate_grad_g() - " << std::endl
 				<< " could not tokenize limit-state function. " << std::endl;
@@ -159,54 +320,19 @@ XC::FiniteDifferenceGradGEvaluator::computeGradG(double gFunValue, Vector passed
 	}
 
 
-	// Initial declarations
-	int numberOfRandomVariables = passed_x.Size();
-	Vector perturbed_x(numberOfRandomVariables);
-	RandomVariable *theRandomVariable;
-	int i;
-	double h;
-	double gFunValueAStepAhead;
-	double stdv;
-
-
-	// For each random variable: perturb and run analysis again
-	for ( i=0 ; i<numberOfRandomVariables ; i++ )
-	{
-		// Get random variable from domain
-		theRandomVariable = theReliabilityDomain->getRandomVariablePtr(i+1);
-
-
-		// Get the standard deviation
-		stdv = theRandomVariable->getStdv();
-
-
-		// Compute perturbation
-		h = stdv/perturbationFactor;
-
-
-		// Compute perturbed vector of random variables realization
-		perturbed_x = passed_x;
-		perturbed_x(i) = perturbed_x(i) + h;
-
-
-		// Evaluate limit-state function
-		result = theGFunEvaluator->runGFunAnalysis(perturbed_x);
-		if (result < 0) {
-			std::cerr << "XC::FiniteDifferenceGradGEvaluator::evaluate_grad_g() - " << std::endl
-				<< " could not run analysis to evaluate limit-state function. " << std::endl;
-			return -1;
-		}
-		result = theGFunEvaluator->evaluateG(perturbed_x);
-		if (result < 0) {
-			std::cerr << "XC::FiniteDifferenceGradGEvaluator::evaluate_grad_g() - " << std::endl
-				<< " could not tokenize limit-state function. " << std::endl;
-			return -1;
-		}
-		gFunValueAStepAhead = theGFunEvaluator->getG();
-
-
-		// Compute the derivative by finite difference
-		(*grad_g)(i) = (gFunValueAStepAhead - gFunValue) / h;
+	// Perturb each random variable and run the analyses
+	std::vector<int> lsfTags(1,lsf);
+	Vector gFunValues(1);
+	gFunValues(0) = gFunValue;
+	Matrix gradients;
+	result = computeGradients(passed_x,lsfTags,gFunValues,gradients);
+	if (result < 0) {
+		return -1;
+	}
+	const int numberOfRandomVariables = passed_x.Size();
+	grad_g->resize(numberOfRandomVariables);
+	for (int i=0 ; i<numberOfRandomVariables ; i++ ) {
+		(*grad_g)(i) = gradients(i,0);
 	}
 
 
@@ -249,67 +375,12 @@ XC::FiniteDifferenceGradGEvaluator::computeAllGradG(Vector gFunValues, Vector pa
 	}
 
 
-	// Initial declarations
-	Vector perturbed_x(nrv);
-	RandomVariable *theRandomVariable;
-	double h;
-	double gFunValueAStepAhead;
-	double stdv;
-	int result;
-
-
-	// For each random variable: perturb and run analysis again
-
-	for (int i=1; i<=nrv; i++) {
-
-		// Get random variable from domain
-		theRandomVariable = theReliabilityDomain->getRandomVariablePtr(i);
-
-
-		// Get the standard deviation
-		stdv = theRandomVariable->getStdv();
-
-
-		// Compute perturbation
-		h = stdv/perturbationFactor;
-
-
-		// Compute perturbed vector of random variables realization
-		perturbed_x = passed_x;
-		perturbed_x(i-1) = perturbed_x(i-1) + h;
-
-
-		// Evaluate limit-state function
-		result = theGFunEvaluator->runGFunAnalysis(perturbed_x);
-		if (result < 0) {
-			std::cerr << "XC::FiniteDifferenceGradGEvaluator::evaluate_grad_g() - " << std::endl
-				<< " could not run analysis to evaluate limit-state function. " << std::endl;
-			return -1;
-		}
-
-		
-		// Now loop over limit-state functions
-		for (int j=1; j<=lsf; j++) {
-
-			// Set tag of active limit-state function
-			theReliabilityDomain->setTagOfActiveLimitStateFunction(j);
-
-			// Limit-state function value
-			result = theGFunEvaluator->evaluateG(perturbed_x);
-			if (result < 0) {
-				std::cerr << "XC::FiniteDifferenceGradGEvaluator::evaluate_grad_g() - " << std::endl
-					<< " could not tokenize limit-state function. " << std::endl;
-				return -1;
-			}
-			gFunValueAStepAhead = theGFunEvaluator->getG();
-
-			// Compute the derivative by finite difference
-			(*grad_g_matrix)(i-1,j-1) = (gFunValueAStepAhead - gFunValues(j-1)) / h;
-
-		}
+	// Perturb each random variable and run the analyses
+	std::vector<int> lsfTags(lsf);
+	for (int j=1; j<=lsf; j++) {
+		lsfTags[j-1] = j;
 	}
-
-	return 0;
+	return computeGradients(passed_x,lsfTags,gFunValues,*grad_g_matrix);
 }
 
 
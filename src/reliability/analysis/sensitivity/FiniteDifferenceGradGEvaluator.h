@@ -64,16 +64,29 @@
 #include <utility/matrix/Vector.h>
 #include <utility/matrix/Matrix.h>
 #include <reliability/domain/components/ReliabilityDomain.h>
+#include <reliability/analysis/sensitivity/GFunValueCache.h>
 #include <tcl.h>
 
 #include <fstream>
+#include <vector>
 using std::ofstream;
 
 
 namespace XC {
   class GFunEvaluator;
+
+//! @brief Computes the gradients of the limit-state functions
+//! by finite differences.
+//!
+//! The perturbed analyses are run one after another (they share
+//! the model, the static element and material buffers and the Tcl
+//! interpreter). The limit-state function values are cached by
+//! point, so the points already computed (i.e. by a previous gradient
+//! computation at the same point) are not analyzed again.
 class FiniteDifferenceGradGEvaluator : public GradGEvaluator
 {
+public:
+	enum DifferenceScheme {FORWARD_DIFFERENCES, CENTRAL_DIFFERENCES};
 private:
 //	int computeDgDsomething();
 
@@ -85,6 +98,18 @@ private:
 	double perturbationFactor;
 	bool doGradientCheck;
 	bool reComputeG;
+
+	DifferenceScheme differenceScheme;
+	bool adaptivePerturbation; //!< If true, compute the perturbation from the estimated curvature.
+	double gNoise; //!< Relative noise of the limit-state function values (adaptive perturbation).
+	double gScale; //!< Largest magnitude of the limit-state function values computed (adaptive perturbation).
+	Vector curvature; //!< Estimated second derivatives of g (adaptive perturbation).
+	Vector lastPoint; //!< Point of the last gradient computation.
+	Vector lastGradient; //!< Last computed gradient.
+	GFunValueCache gCache; //!< Limit-state function values already computed.
+
+	double getPerturbation(int i,const double &stdv);
+	int computeGradients(const Vector &x,const std::vector<int> &lsfTags,const Vector &gFunValues,Matrix &gradients);
 public:
 	FiniteDifferenceGradGEvaluator(GFunEvaluator *passedGFunEvaluator,
 				ReliabilityDomain *passedReliabilityDomain,
@@ -101,6 +126,13 @@ public:
 	Matrix	getAllGradG();
 
 	Matrix  getDgDdispl();
+
+	void setDifferenceScheme(const DifferenceScheme &);
+	void setAdaptivePerturbation(bool, double noise= 1e-8);
+	void clearCache(void);
+	void setMaxCacheSize(const size_t &);
+	size_t getNumCacheHits(void) const;
+	GFunValueCache &getCache(void);
 };
 } // end of XC namespace
 
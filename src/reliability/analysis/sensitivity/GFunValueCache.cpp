@@ -0,0 +1,135 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//GFunValueCache.cpp
+
+#include <reliability/analysis/sensitivity/GFunValueCache.h>
+#include <iostream>
+
+//! @brief Constructor.
+//! @param sz: maximum number of values.
+XC::GFunValueCache::GFunValueCache(const size_t &sz)
+  : values(), insertionOrder(), maxSize(sz), numHits(0) {}
+
+//! @brief Returns the key for the point and the limit-state
+//! function being passed as parameters.
+std::vector<double> XC::GFunValueCache::getKey(const Vector &x,const int &lsfTag)
+  {
+    const int sz= x.Size();
+    std::vector<double> retval(sz+1);
+    for(int i= 0;i<sz;i++)
+      retval[i]= x(i);
+    retval[sz]= lsfTag;
+    return retval;
+  }
+
+//! @brief Removes the oldest entries until the cache has
+//! no more than sz values.
+void XC::GFunValueCache::shrink(const size_t &sz)
+  {
+    while(values.size()>sz)
+      {
+        values.erase(insertionOrder.front());
+        insertionOrder.pop_front();
+      }
+  }
+
+//! @brief Searches the value of the limit-state function.
+//! @return true if the value is found (and then it is assigned to g).
+bool XC::GFunValueCache::find(const Vector &x,const int &lsfTag,double &g)
+  {
+    map_values::const_iterator i= values.find(getKey(x,lsfTag));
+    const bool retval= (i!=values.end());
+    if(retval)
+      {
+        g= i->second;
+        numHits++;
+      }
+    return retval;
+  }
+
+//! @brief Returns true if the value of the limit-state function
+//! for the point is stored.
+bool XC::GFunValueCache::exists(const Vector &x,const int &lsfTag) const
+  { return (values.find(getKey(x,lsfTag))!=values.end()); }
+
+//! @brief Returns the stored value of the limit-state function
+//! for the point.
+double XC::GFunValueCache::getValue(const Vector &x,const int &lsfTag)
+  {
+    double retval= 0.0;
+    if(!find(x,lsfTag,retval))
+      std::cerr << "GFunValueCache::" << __FUNCTION__
+                << "; value not found." << std::endl;
+    return retval;
+  }
+
+//! @brief Stores the value of the limit-state function
+//! (if the cache is full the oldest value is removed).
+void XC::GFunValueCache::store(const Vector &x,const int &lsfTag,const double &g)
+  {
+    if(maxSize==0)
+      return;
+    const std::vector<double> key= getKey(x,lsfTag);
+    map_values::iterator i= values.find(key);
+    if(i!=values.end())
+      i->second= g;
+    else
+      {
+        shrink(maxSize-1);
+        insertionOrder.push_back(values.insert(map_values::value_type(key,g)).first);
+      }
+  }
+
+//! @brief Removes the stored values (the cache must be cleared
+//! if the model changes between computations).
+void XC::GFunValueCache::clear(void)
+  {
+    values.clear();
+    insertionOrder.clear();
+    numHits= 0;
+  }
+
+//! @brief Sets the maximum number of values (the oldest ones
+//! are removed if needed).
+void XC::GFunValueCache::setMaxSize(const size_t &sz)
+  {
+    maxSize= sz;
+    shrink(maxSize);
+  }
+
+//! @brief Returns the maximum number of values.
+const size_t &XC::GFunValueCache::getMaxSize(void) const
+  { return maxSize; }
+
+//! @brief Returns the number of stored values.
+size_t XC::GFunValueCache::size(void) const
+  { return values.size(); }
+
+//! @brief Returns the number of values found since the
+//! last call to clear.
+const size_t &XC::GFunValueCache::getNumHits(void) const
+  { return numHits; }
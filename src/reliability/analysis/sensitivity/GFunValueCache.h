@@ -0,0 +1,73 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//GFunValueCache.h
+
+#ifndef GFunValueCache_h
+#define GFunValueCache_h
+
+#include <utility/matrix/Vector.h>
+#include <vector>
+#include <map>
+#include <deque>
+
+namespace XC {
+//! @brief Values of the limit-state functions indexed by point
+//! and limit-state function tag.
+//!
+//! When the cache is full the oldest entry is removed (first in,
+//! first out), so the values of the current gradient computation
+//! are kept.
+class GFunValueCache
+  {
+  private:
+    typedef std::map<std::vector<double>, double> map_values;
+    map_values values; //!< Values (key: point coordinates followed by the limit-state function tag).
+    std::deque<map_values::iterator> insertionOrder; //!< Entries from the oldest to the newest one.
+    size_t maxSize;
+    size_t numHits;
+
+    static std::vector<double> getKey(const Vector &x,const int &lsfTag);
+    void shrink(const size_t &);
+    GFunValueCache(const GFunValueCache &);
+    GFunValueCache &operator=(const GFunValueCache &);
+  public:
+    GFunValueCache(const size_t &sz= 100000);
+
+    bool find(const Vector &x,const int &lsfTag,double &g);
+    bool exists(const Vector &x,const int &lsfTag) const;
+    double getValue(const Vector &x,const int &lsfTag);
+    void store(const Vector &x,const int &lsfTag,const double &g);
+    void clear(void);
+
+    void setMaxSize(const size_t &);
+    const size_t &getMaxSize(void) const;
+    size_t size(void) const;
+    const size_t &getNumHits(void) const;
+  };
+} // end of XC namespace
+
+#endif
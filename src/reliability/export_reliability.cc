@@ -0,0 +1,41 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//export_reliability.cc
+
+#include "python_interface.h"
+#include "reliability/analysis/randomNumber/RandomNumberGenerator.h"
+#include "reliability/analysis/randomNumber/PhiloxRandGenerator.h"
+#include "reliability/analysis/gFunction/GFunEvaluator.h"
+#include "reliability/analysis/analysis/ReliabilityAnalysis.h"
+#include "reliability/analysis/analysis/SamplingAnalysis.h"
+#include "reliability/analysis/sensitivity/GFunValueCache.h"
+#include "reliability/analysis/sensitivity/GradGEvaluator.h"
+#include "reliability/analysis/sensitivity/FiniteDifferenceGradGEvaluator.h"
+
+void export_reliability(void)
+  {
+    using namespace boost::python;
+    docstring_options doc_options;
+
+#include "python_interface.tcc"
+  }
+
@@ -0,0 +1,83 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//python_interface.tcc
+
+class_<XC::RandomNumberGenerator, boost::noncopyable >("RandomNumberGenerator", no_init)
+  .def("generate_nIndependentStdNormalNumbers",&XC::RandomNumberGenerator::generate_nIndependentStdNormalNumbers,"generate_nIndependentStdNormalNumbers(n,seed): generates n standard normal numbers (if seed is not zero the generator is reseeded).")
+  .def("generate_nIndependentUniformNumbers",&XC::RandomNumberGenerator::generate_nIndependentUniformNumbers,"generate_nIndependentUniformNumbers(n,lower,upper,seed): generates n uniform numbers in (lower,upper) (if seed is not zero the generator is reseeded).")
+  .def("getGeneratedNumbers",&XC::RandomNumberGenerator::getGeneratedNumbers,return_internal_reference<>(),"Returns the last generated numbers.")
+  .add_property("seed",&XC::RandomNumberGenerator::getSeed,"Returns the seed.")
+  ;
+
+class_<XC::PhiloxRandGenerator, bases<XC::RandomNumberGenerator> >("PhiloxRandGenerator", "Counter based random number generator (Philox4x32-10); the numbers depend only on (seed, stream, position).", init<int>())
+  .def("getUniformNumber",&XC::PhiloxRandGenerator::getUniformNumber,"getUniformNumber(stream,pos): returns the pos-th uniform number in (0,1) of the stream.")
+  .def("fillUniformNumbers",&XC::PhiloxRandGenerator::fillUniformNumbers,"fillUniformNumbers(stream,v,lower,upper): fills the vector v with uniform numbers in (lower,upper) taken from the beginning of the stream.")
+  .def("fillStdNormalNumbers",&XC::PhiloxRandGenerator::fillStdNormalNumbers,"fillStdNormalNumbers(stream,v): fills the vector v with standard normal numbers taken from the beginning of the stream.")
+  .def("getLatinHypercubeSample",&XC::PhiloxRandGenerator::getLatinHypercubeSample,"getLatinHypercubeSample(numSamples,numVariables): returns a matrix of uniform numbers (row: sample, column: variable) with exactly one value in each stratum of each column.")
+  .def("setSeed",&XC::PhiloxRandGenerator::setSeed,"Sets the seed.")
+  .add_property("stream",make_function(&XC::PhiloxRandGenerator::getStream,return_value_policy<copy_const_reference>()),&XC::PhiloxRandGenerator::setStream,"Stream used by the next call to the generate_... methods.")
+  ;
+
+class_<XC::GFunEvaluator, boost::noncopyable >("GFunEvaluator", no_init)
+  .add_property("numberOfEvaluations",&XC::GFunEvaluator::getNumberOfEvaluations,"Returns the number of evaluations of the limit-state functions.")
+  ;
+
+class_<XC::ReliabilityAnalysis, boost::noncopyable >("ReliabilityAnalysis", no_init)
+  .def("analyze",&XC::ReliabilityAnalysis::analyze,"Runs the analysis.")
+  ;
+
+enum_<XC::SamplingAnalysis::SamplingType>("SamplingType")
+  .value("monte_carlo", XC::SamplingAnalysis::MONTE_CARLO)
+  .value("latin_hypercube", XC::SamplingAnalysis::LATIN_HYPERCUBE)
+  ;
+
+class_<XC::SamplingAnalysis, bases<XC::ReliabilityAnalysis>, boost::noncopyable >("SamplingAnalysis", no_init)
+  .add_property("samplingType",make_function(&XC::SamplingAnalysis::getSamplingType,return_value_policy<copy_const_reference>()),&XC::SamplingAnalysis::setSamplingType,"Sampling type (monte_carlo or latin_hypercube).")
+  .def("setDesignPointLimitStateFunction",&XC::SamplingAnalysis::setDesignPointLimitStateFunction,"setDesignPointLimitStateFunction(tag): centers the sampling density on the FORM design point of the limit-state function (importance sampling).")
+  ;
+
+class_<XC::GFunValueCache, boost::noncopyable >("GFunValueCache", "Values of the limit-state functions indexed by point and limit-state function tag (when full, the oldest value is removed).", init<size_t>())
+  .def("exists",&XC::GFunValueCache::exists,"exists(x,lsfTag): returns true if the value for the point is stored.")
+  .def("getValue",&XC::GFunValueCache::getValue,"getValue(x,lsfTag): returns the stored value for the point.")
+  .def("store",&XC::GFunValueCache::store,"store(x,lsfTag,g): stores the value for the point.")
+  .def("clear",&XC::GFunValueCache::clear,"Removes the stored values.")
+  .add_property("maxSize",make_function(&XC::GFunValueCache::getMaxSize,return_value_policy<copy_const_reference>()),&XC::GFunValueCache::setMaxSize,"Maximum number of values.")
+  .add_property("size",&XC::GFunValueCache::size,"Number of stored values.")
+  .add_property("numHits",make_function(&XC::GFunValueCache::getNumHits,return_value_policy<copy_const_reference>()),"Number of values found since the last call to clear.")
+  ;
+
+class_<XC::GradGEvaluator, boost::noncopyable >("GradGEvaluator", no_init)
+  ;
+
+enum_<XC::FiniteDifferenceGradGEvaluator::DifferenceScheme>("DifferenceScheme")
+  .value("forward_differences", XC::FiniteDifferenceGradGEvaluator::FORWARD_DIFFERENCES)
+  .value("central_differences", XC::FiniteDifferenceGradGEvaluator::CENTRAL_DIFFERENCES)
+  ;
+
+class_<XC::FiniteDifferenceGradGEvaluator, bases<XC::GradGEvaluator>, boost::noncopyable >("FiniteDifferenceGradGEvaluator", no_init)
+  .def("setDifferenceScheme",&XC::FiniteDifferenceGradGEvaluator::setDifferenceScheme,"setDifferenceScheme(scheme): forward_differences or central_differences.")
+  .def("setAdaptivePerturbation",&XC::FiniteDifferenceGradGEvaluator::setAdaptivePerturbation,"setAdaptivePerturbation(b,noise): computes the perturbation from the estimated curvature (noise: relative noise of the limit-state function values).")
+  .def("clearCache",&XC::FiniteDifferenceGradGEvaluator::clearCache,"Removes the cached limit-state function values.")
+  .def("setMaxCacheSize",&XC::FiniteDifferenceGradGEvaluator::setMaxCacheSize,"Sets the maximum number of cached values.")
+  .add_property("numCacheHits",&XC::FiniteDifferenceGradGEvaluator::getNumCacheHits,"Number of limit-state function values taken from the cache.")
+  .add_property("cache",make_function(&XC::FiniteDifferenceGradGEvaluator::getCache,return_internal_reference<>()),"Cache of limit-state function values.")
+  ;
@@ -38,6 +38,8 @@
 #include <solution/analysis/analysis/StaticAnalysis.h>
 #include <solution/analysis/analysis/DirectIntegrationAnalysis.h>
 #include <solution/analysis/analysis/VariableTimeStepDirectIntegrationAnalysis.h>
+#include <solution/analysis/analysis/ExplicitDynamicsAnalysis.h>
+#include <solution/analysis/analysis/AdaptiveTimeStepDirectIntegrationAnalysis.h>
 
 
 #include "solution/analysis/ModelWrapper.h"
@@ -85,6 +87,10 @@ bool XC::ProcSolu::alloc_analysis(const std::string &nmb,const std::string &cod_
               theAnalysis= new StaticAnalysis(metodo);
             else if(nmb=="variable_time_step_direct_integration_analysis")
               theAnalysis= new VariableTimeStepDirectIntegrationAnalysis(metodo);
+            else if(nmb=="explicit_dynamics_analysis")
+              theAnalysis= new ExplicitDynamicsAnalysis(metodo);
+            else if(nmb=="adaptive_time_step_direct_integration_analysis")
+              theAnalysis= new AdaptiveTimeStepDirectIntegrationAnalysis(metodo);
 	  }
       }
     else
@@ -87,6 +87,8 @@ bool XC::SoluMethod::alloc_soln_algo(const std::string &nmb)
       theSolnAlgo=new NewtonLineSearch(this);
     else if(nmb=="periodic_newton_soln_algo")
       theSolnAlgo=new PeriodicNewton(this);
+    else if(nmb=="adaptive_newton_soln_algo")
+      theSolnAlgo=new AdaptiveNewton(this);
     else if(nmb=="frequency_soln_algo")
       theSolnAlgo=new FrequencyAlgo(this);
     else if(nmb=="standard_eigen_soln_algo")
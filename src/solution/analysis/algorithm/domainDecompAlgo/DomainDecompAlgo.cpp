@@ -75,24 +75,27 @@
 XC::DomainDecompAlgo::DomainDecompAlgo(SoluMethod *owr)
   :SolutionAlgorithm(owr,DomDecompALGORITHM_TAGS_DomainDecompAlgo) {}
 
-//! @brief Solve current step.
+//! @brief Returns true if the integrator, the system of equations,
+//! the solver and the subdomain have been set.
+bool XC::DomainDecompAlgo::links_set(void)
+  {
+    return (dynamic_cast<IncrementalIntegrator *>(getIntegratorPtr()) && getLinearSOEPtr()
+            && getDomainSolverPtr() && getSubdomainPtr());
+  }
+
+//! @brief Solve current step: sets the response of the external DOFs,
+//! recovers the response of the internal ones and updates
+//! the subdomain.
+//!
+//! The partitioned domain calls the three steps separately (the second
+//! one concurrently for all the subdomains) in the same order.
 int XC::DomainDecompAlgo::solveCurrentStep(void)
   {
-    IncrementalIntegrator *theIntegrator= dynamic_cast<IncrementalIntegrator *>(getIntegratorPtr());
-    LinearSOE *theLinearSOE= getLinearSOEPtr();
-    DomainSolver *theSolver= getDomainSolverPtr();    
-    Subdomain *theSubdomain= getSubdomainPtr();
-    
-    if(theIntegrator != 0 && theLinearSOE != 0 &&
-	theSolver != 0 && theSubdomain != 0 )
+    if(links_set())
       {
-	const Vector &extResponse= theSubdomain->getLastExternalSysResponse();
-
-	theSolver->setComputedXext(extResponse);
-	theSolver->solveXint();
-
-	theIntegrator->update(theLinearSOE->getX());
-	return 0;
+	setExternalResponse(getSubdomainPtr()->getLastExternalSysResponse());
+	solveInternalResponse();
+	return updateInternalResponse();
       }
     else
       {
@@ -102,6 +105,35 @@ int XC::DomainDecompAlgo::solveCurrentStep(void)
       }
   }
 
+//! @brief Sets the response of the external DOFs
+//! (first step of solveCurrentStep).
+int XC::DomainDecompAlgo::setExternalResponse(const Vector &extResponse)
+  {
+    if(!links_set())
+      {
+	std::cerr << "XC::DomainDecompAlgo::" << __FUNCTION__ << "; ";
+	std::cerr << "no links have been set\n";
+	return -1;
+      }
+    getDomainSolverPtr()->setComputedXext(extResponse);
+    return 0;
+  }
+
+//! @brief Recovers the response of the internal DOFs (second step of
+//! solveCurrentStep). It only touches the system of equations of the
+//! subdomain, so it can run concurrently for different subdomains.
+int XC::DomainDecompAlgo::solveInternalResponse(void)
+  { return getDomainSolverPtr()->solveXint(); }
+
+//! @brief Updates the subdomain with the computed response (third
+//! step of solveCurrentStep).
+int XC::DomainDecompAlgo::updateInternalResponse(void)
+  {
+    IncrementalIntegrator *theIntegrator= dynamic_cast<IncrementalIntegrator *>(getIntegratorPtr());
+    theIntegrator->update(getLinearSOEPtr()->getX());
+    return 0;
+  }
+
 int XC::DomainDecompAlgo::sendSelf(CommParameters &cp)
   { return 0; }
 
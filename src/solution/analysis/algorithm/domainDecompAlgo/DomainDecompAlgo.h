@@ -76,12 +76,15 @@ class LinearSOE;
 class DomainSolver;
 class DomainDecompAnalysis;
 class Subdomain;
+class Vector;
 
 //! @ingroup AnalAlgo
 //
 //! @brief Solution algorithm for domain decomposition.
 class DomainDecompAlgo: public SolutionAlgorithm
   {
+  private:
+    bool links_set(void);
   protected:
     friend class FEM_ObjectBroker;
     friend class SoluMethod;
@@ -90,6 +93,11 @@ class DomainDecompAlgo: public SolutionAlgorithm
   public:
     // public functions defined for subclasses
     int solveCurrentStep(void);
+
+    // steps of solveCurrentStep (in this order).
+    int setExternalResponse(const Vector &);
+    int solveInternalResponse(void);
+    int updateInternalResponse(void);
     int sendSelf(CommParameters &);
     int recvSelf(const CommParameters &);
   };
@@ -0,0 +1,394 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AdaptiveNewton.cc
+
+#include <solution/analysis/algorithm/equiSolnAlgo/AdaptiveNewton.h>
+#include <solution/analysis/algorithm/equiSolnAlgo/lineSearch/LineSearch.h>
+#include <solution/analysis/algorithm/equiSolnAlgo/lineSearch/BisectionLineSearch.h>
+#include <solution/analysis/algorithm/equiSolnAlgo/lineSearch/InitialInterpolatedLineSearch.h>
+#include <solution/analysis/algorithm/equiSolnAlgo/lineSearch/RegulaFalsiLineSearch.h>
+#include <solution/analysis/algorithm/equiSolnAlgo/lineSearch/SecantLineSearch.h>
+#include <solution/analysis/model/AnalysisModel.h>
+#include <solution/analysis/integrator/IncrementalIntegrator.h>
+#include <solution/system_of_eqn/linearSOE/LinearSOE.h>
+#include <solution/analysis/convergenceTest/ConvergenceTest.h>
+#include "solution/SoluMethod.h"
+
+//! @brief Constructor.
+XC::AdaptiveNewton::AdaptiveNewton(SoluMethod *owr,int theTangentToUse)
+  :NewtonBased(owr,EquiALGORITHM_TAGS_AdaptiveNewton,theTangentToUse),
+   contractionThreshold(0.5), divergenceThreshold(1.0), theLineSearch(nullptr),
+   validTangent(false), refactorNextStep(false), numTangentUpdates(0),
+   numLineSearches(0), numFullNewtonSteps(0)
+  { setLineSearch("initial_interpolated_line_search"); }
+
+//! @brief Copy constructor.
+XC::AdaptiveNewton::AdaptiveNewton(const AdaptiveNewton &other)
+  : NewtonBased(other), contractionThreshold(other.contractionThreshold),
+    divergenceThreshold(other.divergenceThreshold), theLineSearch(nullptr),
+    validTangent(false), refactorNextStep(false), numTangentUpdates(0),
+    numLineSearches(0), numFullNewtonSteps(0)
+  { copy_line_search(other.theLineSearch); }
+
+//! @brief Assignment operator.
+XC::AdaptiveNewton &XC::AdaptiveNewton::operator=(const AdaptiveNewton &other)
+  {
+    NewtonBased::operator=(other);
+    contractionThreshold= other.contractionThreshold;
+    divergenceThreshold= other.divergenceThreshold;
+    validTangent= false;
+    refactorNextStep= false;
+    copy_line_search(other.theLineSearch);
+    return *this;
+  }
+
+//! @brief Destructor.
+XC::AdaptiveNewton::~AdaptiveNewton(void)
+  { free_line_search(); }
+
+//! @brief Frees the line search object.
+void XC::AdaptiveNewton::free_line_search(void)
+  {
+    if(theLineSearch)
+      {
+        delete theLineSearch;
+        theLineSearch= nullptr;
+      }
+  }
+
+//! @brief Copies the line search object.
+void XC::AdaptiveNewton::copy_line_search(const LineSearch *ptr)
+  {
+    free_line_search();
+    if(ptr)
+      {
+        theLineSearch= ptr->getCopy();
+        theLineSearch->set_owner(this);
+      }
+  }
+
+//! @brief Sets the line search to use when the iterations diverge
+//! ("bisection_line_search", "initial_interpolated_line_search",
+//! "regula_falsi_line_search", "secant_line_search" or "none").
+bool XC::AdaptiveNewton::setLineSearch(const std::string &nmb)
+  {
+    free_line_search();
+    if(nmb=="bisection_line_search")
+      theLineSearch=new BisectionLineSearch();
+    else if(nmb=="initial_interpolated_line_search")
+      theLineSearch=new InitialInterpolatedLineSearch();
+    else if(nmb=="regula_falsi_line_search")
+      theLineSearch=new RegulaFalsiLineSearch();
+    else if(nmb=="secant_line_search")
+      theLineSearch=new SecantLineSearch();
+    else if(nmb!="none")
+      std::cerr << nombre_clase() << "::" << __FUNCTION__
+                << "; line search: '" << nmb << "' unknown." << std::endl;
+    if(theLineSearch)
+      theLineSearch->set_owner(this);
+    return (theLineSearch!=nullptr);
+  }
+
+//! @brief Returns the maximum contraction rate allowed with an old tangent.
+double XC::AdaptiveNewton::getContractionThreshold(void) const
+  { return contractionThreshold; }
+
+//! @brief Sets the maximum contraction rate allowed with an old tangent.
+void XC::AdaptiveNewton::setContractionThreshold(const double &d)
+  { contractionThreshold= d; }
+
+//! @brief Returns the contraction rate that activates the line search.
+double XC::AdaptiveNewton::getDivergenceThreshold(void) const
+  { return divergenceThreshold; }
+
+//! @brief Sets the contraction rate that activates the line search.
+void XC::AdaptiveNewton::setDivergenceThreshold(const double &d)
+  { divergenceThreshold= d; }
+
+//! @brief Returns the number of times the tangent has been formed.
+int XC::AdaptiveNewton::getNumTangentUpdates(void) const
+  { return numTangentUpdates; }
+
+//! @brief Returns the number of line searches performed.
+int XC::AdaptiveNewton::getNumLineSearches(void) const
+  { return numLineSearches; }
+
+//! @brief Returns the number of steps that needed full Newton-Raphson.
+int XC::AdaptiveNewton::getNumFullNewtonSteps(void) const
+  { return numFullNewtonSteps; }
+
+//! @brief The tangent must be formed again after a domain change.
+int XC::AdaptiveNewton::domainChanged(void)
+  {
+    validTangent= false;
+    return NewtonBased::domainChanged();
+  }
+
+//! @brief Forms the tangent.
+int XC::AdaptiveNewton::form_tangent(void)
+  {
+    const int retval= getIncrementalIntegratorPtr()->formTangent(tangent);
+    if(retval<0)
+      {
+        validTangent= false;
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; the integrator failed in formTangent()\n";
+      }
+    else
+      {
+        validTangent= true;
+        numTangentUpdates++;
+        log_action(ConvergenceTelemetry::TANGENT_FORMED);
+      }
+    return retval;
+  }
+
+//! @brief Returns the ratio between the last two norms computed by
+//! the convergence test (a negative value if not available).
+double XC::AdaptiveNewton::getContractionRate(const ConvergenceTest &theTest) const
+  {
+    double retval= -1.0;
+    const Vector &norms= theTest.getNorms();
+    //test() increments the iteration counter if not converged.
+    const int last= theTest.getCurrentIter()-2;
+    if((last>0) && (last<norms.Size()))
+      {
+        const double prev= norms(last-1);
+        if(prev>0.0)
+          retval= norms(last)/prev;
+      }
+    return retval;
+  }
+
+//! @brief Solves the current step.
+int XC::AdaptiveNewton::solveCurrentStep(void)
+  {
+    AnalysisModel *theAnaModel= getAnalysisModelPtr();
+    IncrementalIntegrator *theIntegrator= getIncrementalIntegratorPtr();
+    LinearSOE *theSOE= getLinearSOEPtr();
+    ConvergenceTest *theTest= getConvergenceTestPtr();
+
+    if((!theAnaModel) || (!theIntegrator) || (!theSOE) || (!theTest))
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; model, integrator or system of equations not assigned.\n";
+        return -5;
+      }
+
+    if(theIntegrator->formUnbalance() < 0)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__ << "; ";
+        std::cerr << "the integrator failed in formUnbalance()\n";
+        return -2;
+      }
+
+    // Reuse the tangent (and its factorization) of the previous steps if possible.
+    bool freshTangent= false;
+    if(!validTangent || refactorNextStep)
+      {
+        if(form_tangent() < 0)
+          return -1;
+        freshTangent= true;
+      }
+    refactorNextStep= false;
+
+    // set itself as the ConvergenceTest objects EquiSolnAlgo
+    theTest->set_owner(getSoluMethod());
+    if(theTest->start() < 0)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__ << "; ";
+        std::cerr << "the convergence test object failed in start()\n";
+        return -3;
+      }
+    if(theLineSearch)
+      theLineSearch->newStep(*theSOE);
+
+    bool fullNewton= false;
+    bool lineSearch= false;
+    int result= -1;
+    int count= 0;
+    Vector resid0;
+    Vector dx0;
+    do
+      {
+        if(fullNewton && !freshTangent)
+          {
+            if(form_tangent() < 0)
+              return -1;
+            freshTangent= true;
+          }
+        if(lineSearch)
+          resid0= theSOE->getB(); //residual before the solve.
+        if(fullNewton)
+          log_action(ConvergenceTelemetry::FULL_NEWTON);
+        else if(!freshTangent)
+          log_action(ConvergenceTelemetry::TANGENT_REUSED);
+
+        if(solve_soe(freshTangent) < 0)
+          {
+            std::cerr << nombre_clase() << "::" << __FUNCTION__ << "; ";
+            std::cerr << "the LinearSysOfEqn failed in solve()\n";
+            return -3;
+          }
+        double s0= 0.0;
+        if(lineSearch)
+          {
+            dx0= theSOE->getX();
+            s0= -(dx0 ^ resid0);
+          }
+
+        if(theIntegrator->update(theSOE->getX()) < 0)
+          {
+            std::cerr << nombre_clase() << "::" << __FUNCTION__ << "; ";
+            std::cerr << "the integrator failed in update()\n";
+            return -4;
+          }
+
+        if(theIntegrator->formUnbalance() < 0)
+          {
+            std::cerr << nombre_clase() << "::" << __FUNCTION__ << "; ";
+            std::cerr << "the integrator failed in formUnbalance()\n";
+            return -2;
+          }
+
+        if(lineSearch)
+          {
+            const double s= -(dx0 ^ theSOE->getB());
+            theLineSearch->search(s0, s, *theSOE, *theIntegrator);
+            theTest->getTelemetry().setLineSearchEta(theLineSearch->getLastEta());
+            numLineSearches++;
+          }
+
+        this->record(count++); //Calls record method for all the recorders.
+        result= theTest->test();
+
+        const bool usedFreshTangent= freshTangent;
+        freshTangent= false;
+        if(result == -1)
+          {
+            const double rate= getContractionRate(*theTest);
+            if(rate>contractionThreshold)
+              {
+                if(!usedFreshTangent && !fullNewton)
+                  {
+                    // Old tangent: update it.
+                    if(form_tangent() < 0)
+                      return -1;
+                    freshTangent= true;
+                  }
+                else
+                  {
+                    // Even a new tangent converges slowly.
+                    if(!fullNewton)
+                      {
+                        fullNewton= true;
+                        numFullNewtonSteps++;
+                      }
+                    if((rate>=divergenceThreshold) && theLineSearch)
+                      lineSearch= true;
+                  }
+              }
+          }
+      }
+    while(result == -1);
+
+    // A step that needed full Newton (or that failed) doesn't
+    // leave a tangent worth reusing in the next one.
+    if(fullNewton || (result == -2))
+      refactorNextStep= true;
+    if(result == -2)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__ << "; ";
+        std::cerr << "the convergence test object failed in test()\n"
+                  << "convergence test message: "
+		  << theTest->getStatusMsg(1) << std::endl;
+        return -3;
+      }
+    // note - if postive result we are returning what the convergence test returned
+    // which should be the number of iterations
+    return result;
+  }
+
+//! @brief Send object members through the channel being passed as parameter.
+int XC::AdaptiveNewton::sendData(CommParameters &cp)
+  {
+    int res= NewtonBased::sendData(cp);
+    res+= cp.sendDoubles(contractionThreshold,divergenceThreshold,getDbTagData(),CommMetaData(3));
+    return res;
+  }
+
+//! @brief Receives object members through the channel being passed as parameter.
+int XC::AdaptiveNewton::recvData(const CommParameters &cp)
+  {
+    int res= NewtonBased::recvData(cp);
+    res+= cp.receiveDoubles(contractionThreshold,divergenceThreshold,getDbTagData(),CommMetaData(3));
+    return res;
+  }
+
+//! @brief Sends object through the channel being passed as parameter.
+int XC::AdaptiveNewton::sendSelf(CommParameters &cp)
+  {
+    setDbTag(cp);
+    const int dataTag= getDbTag();
+    inicComm(4);
+    int res= sendData(cp);
+
+    res+= cp.sendIdData(getDbTagData(),dataTag);
+    if(res < 0)
+      std::cerr << nombre_clase() << "sendSelf() - failed to send data\n";
+    return res;
+  }
+
+//! @brief Receives object through the channel being passed as parameter.
+int XC::AdaptiveNewton::recvSelf(const CommParameters &cp)
+  {
+    inicComm(4);
+    const int dataTag= getDbTag();
+    int res= cp.receiveIdData(getDbTagData(),dataTag);
+
+    if(res<0)
+      std::cerr << nombre_clase() << "::recvSelf - failed to receive ids.\n";
+    else
+      {
+        res+= recvData(cp);
+        if(res<0)
+          std::cerr << nombre_clase() << "::recvSelf - failed to receive data.\n";
+      }
+    return res;
+  }
+
+void XC::AdaptiveNewton::Print(std::ostream &s, int flag)
+  {
+    if(flag == 0)
+      {
+        s << "AdaptiveNewton" << std::endl;
+        s << "Contraction threshold: " << contractionThreshold << std::endl;
+        s << "Divergence threshold: " << divergenceThreshold << std::endl;
+        if(theLineSearch)
+          theLineSearch->Print(s, flag);
+      }
+  }
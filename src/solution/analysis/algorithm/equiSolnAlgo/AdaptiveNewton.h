@@ -0,0 +1,104 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AdaptiveNewton.h
+
+#ifndef AdaptiveNewton_h
+#define AdaptiveNewton_h
+
+#include <solution/analysis/algorithm/equiSolnAlgo/NewtonBased.h>
+
+namespace XC {
+class ConvergenceTest;
+class LineSearch;
+
+//! @ingroup EQSolAlgo
+//
+//! @brief Newton algorithm that updates the tangent only when the
+//! convergence rate degrades.
+//!
+//! The contraction rate of each iteration (ratio between the last
+//! two norms computed by the convergence test) is compared with
+//! a threshold:
+//! - If the iteration used an old tangent and the rate exceeds the
+//!   threshold the tangent is formed (and factored) again.
+//! - If a fresh tangent doesn't reach the required rate the algorithm
+//!   switches to full Newton-Raphson for the rest of the step and,
+//!   if it diverges, to Newton with line search.
+//! The tangent (and its factorization, if the solver keeps it) is
+//! reused across steps unless the previous step needed full Newton
+//! or the domain has changed.
+class AdaptiveNewton: public NewtonBased
+  {
+  private:
+    double contractionThreshold; //!< Maximum contraction rate allowed with an old tangent.
+    double divergenceThreshold; //!< Contraction rate that activates the line search.
+    LineSearch *theLineSearch; //!< Line search used when the iterations diverge.
+    bool validTangent; //!< True if the system of equations holds a tangent.
+    bool refactorNextStep; //!< If true form the tangent at the beginning of the next step.
+    int numTangentUpdates; //!< Number of times the tangent has been formed.
+    int numLineSearches; //!< Number of line searches.
+    int numFullNewtonSteps; //!< Number of steps that needed full Newton-Raphson.
+
+    void free_line_search(void);
+    void copy_line_search(const LineSearch *);
+    int form_tangent(void);
+    double getContractionRate(const ConvergenceTest &) const;
+  protected:
+    int sendData(CommParameters &);
+    int recvData(const CommParameters &);
+
+    friend class SoluMethod;
+    friend class FEM_ObjectBroker;
+    AdaptiveNewton(SoluMethod *,int tangent = CURRENT_TANGENT);
+    AdaptiveNewton(const AdaptiveNewton &);
+    AdaptiveNewton &operator=(const AdaptiveNewton &);
+    virtual SolutionAlgorithm *getCopy(void) const;
+  public:
+    ~AdaptiveNewton(void);
+
+    bool setLineSearch(const std::string &);
+    double getContractionThreshold(void) const;
+    void setContractionThreshold(const double &);
+    double getDivergenceThreshold(void) const;
+    void setDivergenceThreshold(const double &);
+    int getNumTangentUpdates(void) const;
+    int getNumLineSearches(void) const;
+    int getNumFullNewtonSteps(void) const;
+
+    int domainChanged(void);
+    int solveCurrentStep(void);
+
+    virtual int sendSelf(CommParameters &);
+    virtual int recvSelf(const CommParameters &);
+
+    void Print(std::ostream &s, int flag =0);
+  };
+inline SolutionAlgorithm *AdaptiveNewton::getCopy(void) const
+  { return new AdaptiveNewton(*this); }
+} // end of XC namespace
+
+#endif
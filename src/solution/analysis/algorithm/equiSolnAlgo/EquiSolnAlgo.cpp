@@ -69,7 +69,9 @@
 #include <solution/analysis/model/AnalysisModel.h>
 #include <solution/analysis/integrator/IncrementalIntegrator.h>
 #include <solution/system_of_eqn/linearSOE/LinearSOE.h>
+#include <solution/analysis/convergenceTest/ConvergenceTest.h>
 #include "solution/SoluMethod.h"
+#include "utility/Timer.h"
 
 
 XC::EquiSolnAlgo::EquiSolnAlgo(SoluMethod *owr,int clasTag)
@@ -93,3 +95,37 @@ XC::ConvergenceTest *XC::EquiSolnAlgo::getConvergenceTestPtr(void)
 
 XC::IncrementalIntegrator *XC::EquiSolnAlgo::getIncrementalIntegratorPtr(void)
   { return dynamic_cast<IncrementalIntegrator *>(getIntegratorPtr()); }
+
+//! @brief Solves the system of equations. If the convergence test
+//! telemetry is enabled, reports the time spent as factorization time
+//! (new tangent) or as solution time (already factored tangent).
+int XC::EquiSolnAlgo::solve_soe(const bool &newTangent)
+  {
+    int retval= 0;
+    LinearSOE *theSOE= getLinearSOEPtr();
+    ConvergenceTest *theTest= getConvergenceTestPtr();
+    if(theTest && theTest->getTelemetry().isEnabled())
+      {
+        ConvergenceTelemetry &telemetry= theTest->getTelemetry();
+        Timer timer;
+        timer.start();
+        retval= theSOE->solve();
+        timer.pause();
+        if(newTangent)
+          telemetry.addFactorTime(timer.getReal());
+        else
+          telemetry.addSolveTime(timer.getReal());
+      }
+    else
+      retval= theSOE->solve();
+    return retval;
+  }
+
+//! @brief Reports an action (see ConvergenceTelemetry::Action) to the
+//! convergence test telemetry.
+void XC::EquiSolnAlgo::log_action(const int &action)
+  {
+    ConvergenceTest *theTest= getConvergenceTestPtr();
+    if(theTest)
+      theTest->getTelemetry().addAction(action);
+  }
@@ -86,6 +86,8 @@ class EquiSolnAlgo: public SolutionAlgorithm
   {
   protected:
     EquiSolnAlgo(SoluMethod *,int clasTag);
+    int solve_soe(const bool &newTangent);
+    void log_action(const int &);
   public:
     // virtual functions
     virtual int solveCurrentStep(void) =0;
@@ -111,7 +111,7 @@ int XC::ModifiedNewton::solveCurrentStep(void)
                   << "the Integrator failed in formTangent()\n";
         return -1;
       }
-
+    log_action(ConvergenceTelemetry::TANGENT_FORMED);
 
     // set itself as the XC::ConvergenceTest objects XC::EquiSolnAlgo
     theTest->set_owner(getSoluMethod());
@@ -129,7 +129,7 @@ int XC::ModifiedNewton::solveCurrentStep(void)
       {
         //Timer timer2;
         //timer2.start();
-        if(theSOE->solve() < 0)
+        if(solve_soe(count==0) < 0)
           {
             std::cerr << "WARNING XC::ModifiedNewton::solveCurrentStep() -";
             std::cerr << "the LinearSysOfEqn failed in solve()\n";
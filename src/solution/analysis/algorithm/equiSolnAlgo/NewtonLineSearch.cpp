@@ -176,9 +176,10 @@ int XC::NewtonLineSearch::solveCurrentStep(void)
             std::cerr << "the integrator failed in formTangent()\n";
             return -1;
           }
+        log_action(ConvergenceTelemetry::TANGENT_FORMED);
 
         //solve
-        if(theSOE->solve() < 0)
+        if(solve_soe(true) < 0)
           {
             std::cerr << nombre_clase() << "::" << __FUNCTION__ << "; ";
             std::cerr << "the LinearSysOfEqn failed in solve()\n";
@@ -212,7 +213,10 @@ int XC::NewtonLineSearch::solveCurrentStep(void)
         const double s= - ( dx0 ^ Resid );
 
         if(theLineSearch)
-          theLineSearch->search(s0, s, *theSOE, *theIntegrator);
+          {
+            theLineSearch->search(s0, s, *theSOE, *theIntegrator);
+            theTest->getTelemetry().setLineSearchEta(theLineSearch->getLastEta());
+          }
 
         this->record(0); //Calls record method for all the recorders.
         result = theTest->test();
@@ -145,7 +145,8 @@ int XC::NewtonRaphson::solveCurrentStep(void)
                 return -1;
               }
           }
-        if(theSOE->solve() < 0)
+        log_action(ConvergenceTelemetry::TANGENT_FORMED);
+        if(solve_soe(true) < 0)
           {
             std::cerr << "WARNING NewtonRaphson::solveCurrentStep() -";
             std::cerr << "the LinearSysOfEqn failed in solve()\n";
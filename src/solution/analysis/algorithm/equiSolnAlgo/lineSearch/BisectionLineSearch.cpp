@@ -64,6 +64,7 @@ XC::BisectionLineSearch::BisectionLineSearch(void)
 
 int XC::BisectionLineSearch::search(double s0, double s1, LinearSOE &theSOE, IncrementalIntegrator &theIntegrator)
   {
+    lastEta= 1.0;
     double r0 = 0.0;
     if( s0 != 0.0 ) 
       r0 = fabs( s1 / s0 );
@@ -117,7 +118,10 @@ int XC::BisectionLineSearch::search(double s0, double s1, LinearSOE &theSOE, Inc
         // check if we have a solution we are happy with
         r= fabs( sU / s0 ); 
         if(r < tolerance)
-          return 0;
+          {
+            lastEta= etaU;
+            return 0;
+          }
 
         if(printFlag == 0)
           {
@@ -200,6 +204,7 @@ int XC::BisectionLineSearch::search(double s0, double s1, LinearSOE &theSOE, Inc
     // set X in the SOE for the revised dU, needed for convergence tests
     x= dU;
     x*= eta;
+    lastEta= eta;
     theSOE.setX(x);
     return 0;
   }
@@ -66,6 +66,7 @@ int XC::InitialInterpolatedLineSearch::search(double s0,
 				      LinearSOE &theSOE, 
 				      IncrementalIntegrator &theIntegrator)
 {
+  lastEta= 1.0;
   double s = s1;
 
   //intialize r = ratio of residuals 
@@ -154,6 +155,7 @@ int XC::InitialInterpolatedLineSearch::search(double s0,
   // set X in the SOE for the revised dU, needed for convergence tests
   x= dU;
   x*= eta;
+  lastEta= eta;
   theSOE.setX(x);
 
   return 0;
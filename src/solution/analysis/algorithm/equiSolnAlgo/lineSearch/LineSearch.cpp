@@ -63,7 +63,7 @@
 
 
 XC::LineSearch::LineSearch(int clasTag,const double &tol, const int &mi,const double &mneta,const double &mxeta,const int &flag)
-  :MovableObject(clasTag), tolerance(tol), maxIter(mi), minEta(mneta), maxEta(mxeta),printFlag(flag) {}
+  :MovableObject(clasTag), tolerance(tol), maxIter(mi), minEta(mneta), maxEta(mxeta),printFlag(flag), lastEta(1.0) {}
 
 int XC::LineSearch::updateAndUnbalance(IncrementalIntegrator &theIntegrator)
   {
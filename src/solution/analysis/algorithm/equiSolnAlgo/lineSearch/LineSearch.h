@@ -91,9 +91,11 @@ class LineSearch: public MovableObject, public EntCmd
     double minEta;
     double maxEta;
     int    printFlag;
+    double lastEta; //!< line search parameter obtained in the last search.
 
 
     friend class NewtonLineSearch;
+    friend class AdaptiveNewton;
     LineSearch(int classTag,const double &tol= 0.8, const int &mi= 10,const double &mneta= 0.1,const double &mxeta= 10,const int &flag= 1);
     virtual LineSearch *getCopy(void) const= 0;
     int updateAndUnbalance(IncrementalIntegrator &);
@@ -101,6 +103,9 @@ class LineSearch: public MovableObject, public EntCmd
     inline virtual ~LineSearch(void) {}
     // virtual functions
     virtual int newStep(LinearSOE &theSOE);
+    //! @brief Returns the line search parameter obtained in the last search.
+    inline double getLastEta(void) const
+      { return lastEta; }
     virtual int search(double s0, 
 		       double s1, 
 		       LinearSOE &theSOE, 
@@ -64,6 +64,7 @@ XC::RegulaFalsiLineSearch::RegulaFalsiLineSearch(void)
 
 int XC::RegulaFalsiLineSearch::search(double s0, double s1, LinearSOE &theSOE, IncrementalIntegrator &theIntegrator)
 {
+  lastEta= 1.0;
   double r0 = 0.0;
 
   if ( s0 != 0.0 ) 
@@ -164,6 +165,7 @@ int XC::RegulaFalsiLineSearch::search(double s0, double s1, LinearSOE &theSOE, I
   // set X in the SOE for the revised dU, needed for convergence tests
   x= dU;
   x*= eta;
+  lastEta= eta;
   theSOE.setX(x);
   
   return 0;
@@ -64,6 +64,7 @@ XC::SecantLineSearch::SecantLineSearch(void)
 
 int XC::SecantLineSearch::search(double s0, double s1, LinearSOE &theSOE, IncrementalIntegrator &theIntegrator)
   {
+    lastEta= 1.0;
     double r0 = 0.0;
 
     if(s0!=0.0) 
@@ -150,6 +151,7 @@ int XC::SecantLineSearch::search(double s0, double s1, LinearSOE &theSOE, Increm
   // set X in the SOE for the revised dU, needed for convergence tests
   x= dU;
   x*= eta;
+  lastEta= eta;
   theSOE.setX(x);
 
   return 0;
@@ -45,4 +45,13 @@ class_<XC::NewtonRaphson, bases<XC::NewtonBased>, boost::noncopyable >("NewtonRa
 
 class_<XC::PeriodicNewton, bases<XC::NewtonBased>, boost::noncopyable >("PeriodicNewton", no_init);
 
+class_<XC::AdaptiveNewton, bases<XC::NewtonBased>, boost::noncopyable >("AdaptiveNewton", no_init)
+  .add_property("contractionThreshold", &XC::AdaptiveNewton::getContractionThreshold, &XC::AdaptiveNewton::setContractionThreshold,"Maximum contraction rate (ratio between consecutive norms) allowed before updating the tangent.")
+  .add_property("divergenceThreshold", &XC::AdaptiveNewton::getDivergenceThreshold, &XC::AdaptiveNewton::setDivergenceThreshold,"Contraction rate that activates the line search.")
+  .def("setLineSearch", &XC::AdaptiveNewton::setLineSearch,"Set the line search to use when the iterations diverge ('bisection_line_search', 'initial_interpolated_line_search', 'regula_falsi_line_search', 'secant_line_search' or 'none').")
+  .def("getNumTangentUpdates", &XC::AdaptiveNewton::getNumTangentUpdates,"Return the number of times the tangent has been formed.")
+  .def("getNumLineSearches", &XC::AdaptiveNewton::getNumLineSearches,"Return the number of line searches performed.")
+  .def("getNumFullNewtonSteps", &XC::AdaptiveNewton::getNumFullNewtonSteps,"Return the number of steps that needed full Newton-Raphson.")
+  ;
+
 #include "lineSearch/python_interface.tcc"
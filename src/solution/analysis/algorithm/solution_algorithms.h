@@ -36,6 +36,7 @@
 #include <solution/analysis/algorithm/equiSolnAlgo/NewtonLineSearch.h>
 #include <solution/analysis/algorithm/equiSolnAlgo/NewtonRaphson.h>
 #include <solution/analysis/algorithm/equiSolnAlgo/PeriodicNewton.h>
+#include <solution/analysis/algorithm/equiSolnAlgo/AdaptiveNewton.h>
 #include <solution/analysis/algorithm/eigenAlgo/EigenAlgorithm.h>
 #include <solution/analysis/algorithm/eigenAlgo/FrequencyAlgo.h>
 #include <solution/analysis/algorithm/eigenAlgo/StandardEigenAlgo.h>
@@ -0,0 +1,241 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AdaptiveTimeStepDirectIntegrationAnalysis.cc
+
+#include "AdaptiveTimeStepDirectIntegrationAnalysis.h"
+#include <solution/analysis/algorithm/equiSolnAlgo/EquiSolnAlgo.h>
+#include <solution/analysis/integrator/TransientIntegrator.h>
+#include <solution/analysis/integrator/transient/newmark/NewmarkBase2.h>
+#include <solution/analysis/integrator/transient/HHT1.h>
+#include <solution/analysis/model/dof_grp/DOF_Group.h>
+#include <domain/domain/Domain.h>
+#include <domain/mesh/Mesh.h>
+#include <domain/mesh/node/Node.h>
+#include <domain/mesh/node/NodeIter.h>
+#include "solution/SoluMethod.h"
+#include <cmath>
+
+//! @brief Constructor.
+XC::AdaptiveTimeStepDirectIntegrationAnalysis::AdaptiveTimeStepDirectIntegrationAnalysis(SoluMethod *metodo)
+  :DirectIntegrationAnalysis(metodo), relTol(1e-3), absTol(1e-8),
+   safetyFactor(0.9), minFactor(0.2), maxFactor(2.0), excitationDt(0.0),
+   prevEta(1.0), uMax(0.0), numAccepted(0), numRejected(0), lastDt(0.0) {}
+
+//! @brief Returns the beta factor of the integrator (negative if the
+//! integrator isn't of the Newmark family).
+double XC::AdaptiveTimeStepDirectIntegrationAnalysis::get_beta(void)
+  {
+    double retval= -1.0;
+    TransientIntegrator *theIntegrator= getTransientIntegratorPtr();
+    const NewmarkBase2 *newmark= dynamic_cast<const NewmarkBase2 *>(theIntegrator);
+    if(newmark)
+      retval= newmark->getBeta();
+    else
+      {
+        const HHT1 *hht= dynamic_cast<const HHT1 *>(theIntegrator);
+        if(hht)
+          retval= hht->getBeta();
+      }
+    return retval;
+  }
+
+//! @brief Returns the normalized estimation of the local error
+//! of the current (not committed yet) step.
+//!
+//! @param dt: time step.
+//! @param beta: beta factor of the integrator.
+//! @param uNorm: maximum displacement of the free DOFs (output).
+double XC::AdaptiveTimeStepDirectIntegrationAnalysis::get_error_norm(const double &dt,const double &beta,double &uNorm)
+  {
+    const double c= fabs(beta-1.0/6.0)*dt*dt;
+    double eMax= 0.0;
+    uNorm= 0.0;
+    NodeIter &theNodes= getDomainPtr()->getMesh().getNodes();
+    Node *nodePtr= nullptr;
+    while((nodePtr= theNodes()) != nullptr)
+      {
+        const DOF_Group *dofGroup= nodePtr->getDOF_GroupPtr();
+        if(dofGroup)
+          {
+            const ID &eqs= dofGroup->getID();
+            const Vector &a0= nodePtr->getAccel();
+            const Vector &a1= nodePtr->getTrialAccel();
+            const Vector &u1= nodePtr->getTrialDisp();
+            const int sz= std::min(eqs.Size(),a1.Size());
+            for(int j= 0;j<sz;j++)
+              if(eqs(j)>=0) // only free DOFs.
+                {
+                  eMax= std::max(eMax,c*fabs(a1(j)-a0(j)));
+                  uNorm= std::max(uNorm,fabs(u1(j)));
+                }
+          }
+      }
+    return eMax/(absTol+relTol*std::max(uMax,uNorm));
+  }
+
+//! @brief Limits the time step so it doesn't go beyond the end
+//! of the analysis or the next sampling instant of the excitation.
+//!
+//! @param dt: proposed time step.
+//! @param t: current time.
+//! @param tEnd: end of the analysis.
+double XC::AdaptiveTimeStepDirectIntegrationAnalysis::limit_dt(const double &dt,const double &t,const double &tEnd) const
+  {
+    const double tol= 1e-9*std::max(dt,1e-12);
+    double retval= std::min(dt,tEnd-t);
+    if(excitationDt>0.0)
+      {
+        retval= std::min(retval,excitationDt);
+        // next sampling instant of the excitation.
+        const double tNext= (floor((t+tol)/excitationDt)+1.0)*excitationDt;
+        if(t+retval>tNext-tol)
+          retval= tNext-t;
+      }
+    return retval;
+  }
+
+//! @brief Performs the analysis.
+//! 
+//! @param numSteps: number of steps (the analysis ends at time numSteps*dT).
+//! @param dT: initial time increment.
+//! @param dtMin: minimum value for the time increment.
+//! @param dtMax: maximum value for the time increment.
+int XC::AdaptiveTimeStepDirectIntegrationAnalysis::analyze(int numSteps, double dT, double dtMin, double dtMax)
+  {
+    const double beta= get_beta();
+    if(beta<0.0)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; the error estimator needs an integrator of"
+                  << " the Newmark family (Newmark, Newmark1 or HHT1).\n";
+        return -1;
+      }
+    if(fabs(beta-1.0/6.0)<1e-6)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; the error estimator is null for beta= 1/6"
+                  << " (linear acceleration method), use another"
+                  << " value of beta.\n";
+        return -1;
+      }
+    assert(metodo_solu);
+    EntCmd *old= metodo_solu->Owner();
+    metodo_solu->set_owner(this);
+
+    Domain *theDom= getDomainPtr();
+    EquiSolnAlgo *theAlgo= getEquiSolutionAlgorithmPtr();
+    TransientIntegrator *theIntegratr= getTransientIntegratorPtr();
+
+    // the controller history and the displacement scale
+    // of previous calls don't apply to this one.
+    prevEta= 1.0;
+    uMax= 0.0;
+
+    const double tStart= theDom->getTimeTracker().getCurrentTime();
+    const double tEnd= tStart+numSteps*dT;
+    double t= tStart;
+    double currentDt= std::min(dT,dtMax);
+    const double endTol= 1e-9*dT;
+    int result= 0;
+    while(tEnd-t>endTol)
+      {
+        if(checkDomainChange() != 0)
+          {
+            std::cerr << nombre_clase() << "::" << __FUNCTION__
+		      << "; failed checkDomainChange\n";
+            metodo_solu->set_owner(old);
+            return -1;
+          }
+        const double dt= limit_dt(currentDt,t,tEnd);
+
+        result= 0;
+        if(theIntegratr->newStep(dt) < 0)
+          result= -2;
+        if(result >= 0)
+          {
+            result= theAlgo->solveCurrentStep();
+            if(result < 0) 
+	      result= -3;
+          }
+        double eta= 0.0;
+        double uNorm= 0.0;
+        bool accepted= (result>=0);
+        if(accepted)
+          {
+            eta= get_error_norm(dt,beta,uNorm);
+            if((eta>1.0) && (dt>dtMin))
+              accepted= false;
+          }
+        double factor= minFactor;
+        if(accepted)
+          {
+            result= theIntegratr->commit();
+            if(result < 0)
+              {
+	        std::cerr << nombre_clase() << "::" << __FUNCTION__
+			  << "; failed to commit at time "
+			  << theDom->getTimeTracker().getCurrentTime()
+			  << std::endl;
+                metodo_solu->set_owner(old);
+                return -4;
+              }
+            t+= dt;
+            numAccepted++;
+            lastDt= dt;
+            checkpoint_step();
+            uMax= std::max(uMax,uNorm);
+            // PI controller.
+            const double etaN= std::max(eta,1e-6);
+            factor= safetyFactor*pow(etaN,-0.7/3.0)*pow(prevEta,0.4/3.0);
+            prevEta= etaN;
+          }
+        else
+          {
+            theDom->revertToLastCommit();
+            theIntegratr->revertToLastStep();
+            numRejected++;
+            if(dt<=dtMin)
+              {
+	        std::cerr << nombre_clase() << "::" << __FUNCTION__
+			  << "; failed at time "
+			  << theDom->getTimeTracker().getCurrentTime()
+			  << std::endl;
+                metodo_solu->set_owner(old);
+                return result;
+              }
+            if(result>=0) // error too big.
+              factor= safetyFactor*pow(eta,-1.0/3.0);
+          }
+        factor= std::max(minFactor,std::min(maxFactor,factor));
+        // if the step was shortened to reach a sampling instant
+        // the proposed time step is kept as reference.
+        const double base= (accepted ? std::max(dt,currentDt) : dt);
+        currentDt= std::max(dtMin,std::min(dtMax,base*factor));
+      }
+    metodo_solu->set_owner(old);
+    return 0;
+  }
@@ -0,0 +1,119 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AdaptiveTimeStepDirectIntegrationAnalysis.h
+
+#ifndef AdaptiveTimeStepDirectIntegrationAnalysis_h
+#define AdaptiveTimeStepDirectIntegrationAnalysis_h
+
+#include "DirectIntegrationAnalysis.h"
+
+namespace XC {
+
+//! @ingroup AnalysisType
+//
+//! @brief Direct integration analysis with the time step controlled
+//! by an estimate of the local truncation error.
+//!
+//! After each converged step the local error of the Newmark family
+//! integrators (Newmark, Newmark1 and HHT1) is estimated as
+//! (Zienkiewicz-Xie):
+//! \f[ e= (\beta-\frac{1}{6}) \Delta t^2 (\ddot{u}_{n+1}-\ddot{u}_n) \f]
+//! (the estimator vanishes for \f$\beta= 1/6\f$ so the linear
+//! acceleration method is rejected) and normalized with the tolerance:
+//! \f[ \eta= \frac{\|e\|_\infty}{tol_{abs}+tol_{rel} \max\|u\|_\infty} \f]
+//! If \f$\eta > 1\f$ the step is rejected (the domain is reverted to the
+//! last committed state) and repeated with a smaller time step. The
+//! next time step is computed with a PI controller:
+//! \f[ \Delta t_{n+1}= \Delta t_n s \eta_n^{-0.7/3} \eta_{n-1}^{0.4/3} \f]
+//! The time step is also limited so that the steps end at the
+//! sampling instants of the ground motion records (excitationDt)
+//! and the analysis ends exactly at the requested time.
+//! Each accepted step counts as a committed step for the
+//! checkpoints (see DirectIntegrationAnalysis::setCheckpoint).
+class AdaptiveTimeStepDirectIntegrationAnalysis: public DirectIntegrationAnalysis
+  {
+  private:
+    double relTol; //!< relative tolerance for the local error.
+    double absTol; //!< absolute tolerance for the local error.
+    double safetyFactor; //!< safety factor of the step size controller.
+    double minFactor; //!< minimum ratio between consecutive time steps.
+    double maxFactor; //!< maximum ratio between consecutive time steps.
+    double excitationDt; //!< sampling interval of the excitation (zero if none).
+    double prevEta; //!< normalized error of the previous accepted step.
+    double uMax; //!< maximum displacement norm of the accepted steps.
+    int numAccepted; //!< number of accepted steps.
+    int numRejected; //!< number of rejected steps.
+    double lastDt; //!< last accepted time step.
+
+    double get_beta(void);
+    double get_error_norm(const double &,const double &,double &);
+    double limit_dt(const double &,const double &,const double &) const;
+  protected:
+    friend class ProcSolu;
+    AdaptiveTimeStepDirectIntegrationAnalysis(SoluMethod *metodo);
+    Analysis *getCopy(void) const;
+  public:
+    int analyze(int numSteps, double dT, double dtMin, double dtMax);
+
+    inline const double &getRelTol(void) const
+      { return relTol; }
+    inline void setRelTol(const double &d)
+      { relTol= d; }
+    inline const double &getAbsTol(void) const
+      { return absTol; }
+    inline void setAbsTol(const double &d)
+      { absTol= d; }
+    inline const double &getSafetyFactor(void) const
+      { return safetyFactor; }
+    inline void setSafetyFactor(const double &d)
+      { safetyFactor= d; }
+    inline const double &getMinFactor(void) const
+      { return minFactor; }
+    inline void setMinFactor(const double &d)
+      { minFactor= d; }
+    inline const double &getMaxFactor(void) const
+      { return maxFactor; }
+    inline void setMaxFactor(const double &d)
+      { maxFactor= d; }
+    inline const double &getExcitationDt(void) const
+      { return excitationDt; }
+    inline void setExcitationDt(const double &d)
+      { excitationDt= d; }
+    inline int getNumAcceptedSteps(void) const
+      { return numAccepted; }
+    inline int getNumRejectedSteps(void) const
+      { return numRejected; }
+    inline const double &getLastTimeStep(void) const
+      { return lastDt; }
+  };
+
+//! @brief Virtual constructor.
+inline Analysis *AdaptiveTimeStepDirectIntegrationAnalysis::getCopy(void) const
+  { return new AdaptiveTimeStepDirectIntegrationAnalysis(*this); }
+} // end of XC namespace
+
+#endif
@@ -70,6 +70,8 @@
 #include <solution/analysis/convergenceTest/ConvergenceTest.h>
 #include <solution/analysis/integrator/TransientIntegrator.h>
 #include <domain/domain/Domain.h>
+#include "utility/database/CheckpointDatastore.h"
+#include "ProblemaEF.h"
 
 // AddingSensitivity:BEGIN //////////////////////////////////
 #ifdef _RELIABILITY
@@ -79,7 +81,8 @@
 
 //! @brief Constructor.
 XC::DirectIntegrationAnalysis::DirectIntegrationAnalysis(SoluMethod *metodo_solu)
-  :TransientAnalysis(metodo_solu), domainStamp(0)
+  :TransientAnalysis(metodo_solu), domainStamp(0), checkpointPeriod(0),
+   numCommittedSteps(0), checkpoint(nullptr)
   {
 // AddingSensitivity:BEGIN ////////////////////////////////////
 #ifdef _RELIABILITY
@@ -88,12 +91,128 @@ XC::DirectIntegrationAnalysis::DirectIntegrationAnalysis(SoluMethod *metodo_solu
 // AddingSensitivity:END //////////////////////////////////////
   }
 
+//! @brief Copy constructor (the copy doesn't share the checkpoint writer).
+XC::DirectIntegrationAnalysis::DirectIntegrationAnalysis(const DirectIntegrationAnalysis &other)
+  :TransientAnalysis(other), domainStamp(other.domainStamp),
+   checkpointFile(other.checkpointFile), checkpointPeriod(other.checkpointPeriod),
+   numCommittedSteps(other.numCommittedSteps), checkpoint(nullptr)
+  {
+// AddingSensitivity:BEGIN ////////////////////////////////////
+#ifdef _RELIABILITY
+	theSensitivityAlgorithm= other.theSensitivityAlgorithm;
+#endif
+// AddingSensitivity:END //////////////////////////////////////
+  }
+
+//! @brief Assignment operator (the checkpoint writer is not copied).
+XC::DirectIntegrationAnalysis &XC::DirectIntegrationAnalysis::operator=(const DirectIntegrationAnalysis &other)
+  {
+    TransientAnalysis::operator=(other);
+    domainStamp= other.domainStamp;
+    setCheckpoint(other.checkpointFile,other.checkpointPeriod);
+    numCommittedSteps= other.numCommittedSteps;
+// AddingSensitivity:BEGIN ////////////////////////////////////
+#ifdef _RELIABILITY
+    theSensitivityAlgorithm= other.theSensitivityAlgorithm;
+#endif
+// AddingSensitivity:END //////////////////////////////////////
+    return *this;
+  }
+
 //! @brief Destructor.
 XC::DirectIntegrationAnalysis::~DirectIntegrationAnalysis(void)
   {
     // we don't invoke the destructors in case user switching
     // from a static to a direct integration analysis 
     // clearAll() must be invoked if user wishes to invoke destructor
+    if(checkpoint)
+      delete checkpoint; // waits until the last checkpoint is written.
+  }
+
+//! @brief Writes a checkpoint (compressed state of the domain and the
+//! integrator) each period committed steps.
+//!
+//! @param fileName: name of the checkpoint file (overwritten on each checkpoint).
+//! @param period: number of steps between checkpoints (0: no checkpoints).
+void XC::DirectIntegrationAnalysis::setCheckpoint(const std::string &fileName,const int &period)
+  {
+    if(checkpoint && (fileName!=checkpointFile))
+      {
+        delete checkpoint;
+        checkpoint= nullptr;
+      }
+    checkpointFile= fileName;
+    checkpointPeriod= period;
+  }
+
+//! @brief Returns the checkpoint writer (creating it if needed).
+XC::CheckpointDatastore *XC::DirectIntegrationAnalysis::get_checkpoint(void)
+  {
+    if(!checkpoint && !checkpointFile.empty())
+      {
+        Preprocessor *preprocessor= getDomainPtr()->GetPreprocessor();
+        if(preprocessor)
+          checkpoint= new CheckpointDatastore(checkpointFile,*preprocessor,ProblemaEF::getObjectBroker());
+        else
+          std::cerr << nombre_clase() << "::" << __FUNCTION__
+                    << "; preprocessor not found." << std::endl;
+      }
+    return checkpoint;
+  }
+
+//! @brief Writes the checkpoint now (the file is written on a
+//! background thread). The checkpoint tag is the number of committed
+//! steps plus one (the commit tags must be greater than zero).
+int XC::DirectIntegrationAnalysis::writeCheckpoint(void)
+  {
+    int retval= -1;
+    CheckpointDatastore *ckpt= get_checkpoint();
+    if(ckpt)
+      retval= ckpt->saveCheckpoint(numCommittedSteps+1,getTransientIntegratorPtr());
+    return retval;
+  }
+
+//! @brief Counts the committed step and writes a checkpoint
+//! if needed.
+int XC::DirectIntegrationAnalysis::checkpoint_step(void)
+  {
+    int retval= 0;
+    numCommittedSteps++;
+    if((checkpointPeriod>0) && (numCommittedSteps%checkpointPeriod==0))
+      {
+        retval= writeCheckpoint();
+        if(retval<0)
+          std::cerr << nombre_clase() << "::" << __FUNCTION__
+                    << "; can't write the checkpoint at step: "
+                    << numCommittedSteps << std::endl;
+      }
+    return retval;
+  }
+
+//! @brief Brings the domain and the integrator back to the state
+//! stored in the checkpoint file. Returns the number of committed
+//! steps at the checkpoint or a negative number in case of error.
+int XC::DirectIntegrationAnalysis::restart(void)
+  {
+    CheckpointDatastore *ckpt= get_checkpoint();
+    if(!ckpt)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; checkpoint file not defined." << std::endl;
+        return -1;
+      }
+    int retval= ckpt->loadCheckpoint(getTransientIntegratorPtr());
+    if(retval>0)
+      {
+        numCommittedSteps= retval-1;
+        // Rebuild the analysis model with the restored domain.
+        domainStamp= getDomainPtr()->hasDomainChanged();
+        if(domainChanged()<0)
+          retval= -1;
+        else
+          retval= numCommittedSteps;
+      }
+    return retval;
   }
 
 //! @brief Clears all object members (constraint handler, analysis model,...).
@@ -226,6 +345,7 @@ int XC::DirectIntegrationAnalysis::analyze(int numSteps, double dT)
 	    metodo_solu->getTransientIntegratorPtr()->revertToLastStep();
 	    return -4;
           }
+        checkpoint_step();
       }    
     metodo_solu->set_owner(old);
     return result;
@@ -64,9 +64,11 @@
 // What: "@(#) DirectIntegrationAnalysis.h, revA"
 
 #include <solution/analysis/analysis/TransientAnalysis.h>
+#include <string>
 
 namespace XC {
 class ConvergenceTest;
+class CheckpointDatastore;
 
 // AddingSensitivity:BEGIN ///////////////////////////////
 #ifdef _RELIABILITY
@@ -81,6 +83,12 @@ class DirectIntegrationAnalysis: public TransientAnalysis
   {
   private:
     int domainStamp;
+    std::string checkpointFile; //!< Name of the checkpoint file.
+    int checkpointPeriod; //!< Number of steps between checkpoints (0: no checkpoints).
+    int numCommittedSteps; //!< Number of steps committed by the analysis.
+    CheckpointDatastore *checkpoint; //!< Writes the checkpoints.
+
+    CheckpointDatastore *get_checkpoint(void);
     // AddingSensitivity:BEGIN ///////////////////////////////
 #ifdef _RELIABILITY
     SensitivityAlgorithm *theSensitivityAlgorithm;
@@ -89,7 +97,10 @@ class DirectIntegrationAnalysis: public TransientAnalysis
   protected:
     friend class ProcSolu;
     DirectIntegrationAnalysis(SoluMethod *metodo);
+    DirectIntegrationAnalysis(const DirectIntegrationAnalysis &);
+    DirectIntegrationAnalysis &operator=(const DirectIntegrationAnalysis &);
     Analysis *getCopy(void) const;
+    int checkpoint_step(void);
   public:
     virtual ~DirectIntegrationAnalysis(void);
 
@@ -108,6 +119,16 @@ class DirectIntegrationAnalysis: public TransientAnalysis
     
     int checkDomainChange(void);
 
+    void setCheckpoint(const std::string &,const int &);
+    inline const std::string &getCheckpointFile(void) const
+      { return checkpointFile; }
+    inline int getCheckpointPeriod(void) const
+      { return checkpointPeriod; }
+    inline int getNumCommittedSteps(void) const
+      { return numCommittedSteps; }
+    int writeCheckpoint(void);
+    int restart(void);
+
     // AddingSensitivity:BEGIN ///////////////////////////////
 #ifdef _RELIABILITY
     int setSensitivityAlgorithm(SensitivityAlgorithm *theSensitivityAlgorithm);
@@ -94,6 +94,7 @@ XC::DomainDecompositionAnalysis::DomainDecompositionAnalysis(Subdomain &the_Doma
     theSubdomain(&the_Domain),
     theSolver(nullptr),
     numEqn(0),numExtEqn(0),tangFormed(false),tangFormedCount(0),
+    tangCondensed(false), xIntSolved(false),
     domainStamp(0)
   {
     theSubdomain->setDomainDecompAnalysis(*this);
@@ -106,6 +107,7 @@ XC::DomainDecompositionAnalysis::DomainDecompositionAnalysis(Subdomain &the_Doma
     theSubdomain(&the_Domain),
     theSolver(&theSlvr),
     numEqn(0),numExtEqn(0),tangFormed(false),tangFormedCount(0),
+    tangCondensed(false), xIntSolved(false),
     domainStamp(0)
   {
     theSubdomain->setDomainDecompAnalysis(*this);
@@ -117,7 +119,7 @@ XC::DomainDecompositionAnalysis::DomainDecompositionAnalysis(int clsTag, Subdoma
     MovableObject(clsTag),
     theSubdomain(&the_Domain),
     theSolver(nullptr), numEqn(0),numExtEqn(0),tangFormed(false),tangFormedCount(0),
-    domainStamp(0) {}
+    tangCondensed(false), xIntSolved(false), domainStamp(0) {}
 
 //! @brief Constructor.
 XC::DomainDecompositionAnalysis::DomainDecompositionAnalysis(int clsTag, Subdomain &theDomain,DomainSolver &theSolver,SoluMethod *s)
@@ -125,7 +127,7 @@ XC::DomainDecompositionAnalysis::DomainDecompositionAnalysis(int clsTag, Subdoma
     MovableObject(clsTag),
     theSubdomain(&theDomain),
     theSolver(&theSolver), numEqn(0),numExtEqn(0),tangFormed(false),tangFormedCount(0),
-    domainStamp(0) {}
+    tangCondensed(false), xIntSolved(false), domainStamp(0) {}
 
 
 //! @brief Clears all object members (constraint handler, analysis model,...).
@@ -224,6 +226,9 @@ int XC::DomainDecompositionAnalysis::domainChanged(void)
 
     tangFormed = false;
     tangFormedCount = 0;
+    tangCondensed= false;
+    xIntSolved= false;
+    lastExtResponse.resize(0);
     
     return 0;
   }
@@ -243,7 +248,27 @@ int XC::DomainDecompositionAnalysis::newStep(double dT)
 
 
 int XC::DomainDecompositionAnalysis::computeInternalResponse(void)
-  {  return getDomainDecompSolutionAlgorithmPtr()->solveCurrentStep(); }
+  {
+    if(xIntSolved) // already computed by solveInternalResponse.
+      {
+        xIntSolved= false;
+        return getDomainDecompSolutionAlgorithmPtr()->updateInternalResponse();
+      }
+    return getDomainDecompSolutionAlgorithmPtr()->solveCurrentStep();
+  }
+
+//! @brief Calls domainChanged if the domain has changed since the last
+//! call.
+void XC::DomainDecompositionAnalysis::check_domain_changed(void)
+  {
+    Domain *the_Domain = this->getDomainPtr();
+    const int stamp = the_Domain->hasDomainChanged();
+    if(stamp != domainStamp)
+      {
+	domainStamp = stamp;
+	this->domainChanged();
+      }
+  }
 
 
 
@@ -266,7 +291,9 @@ int XC::DomainDecompositionAnalysis::formTangent(void)
     // called for this state by formResidual() or formTangVectProduct()
     // so we won't be doing it again.
 
-    if(tangFormedCount != -1)
+    if(tangCondensed) // already done by the partitioned domain.
+      tangCondensed= false;
+    else if(tangFormedCount != -1)
       {
 	result = getIncrementalIntegratorPtr()->formTangent();
 	if(result < 0)
@@ -283,6 +310,88 @@ int XC::DomainDecompositionAnalysis::formTangent(void)
   }
 
 
+//! @brief Assembles the tangent stiffness matrix without condensing it
+//! (the condensation is made by condenseTangent or
+//! copyCondensedTangent). Returns 1 if the tangent has already been
+//! formed and condensed for the current state (see formResidual), so
+//! there is nothing to do.
+int XC::DomainDecompositionAnalysis::assembleTangent(void)
+  {
+    check_domain_changed();
+    tangCondensed= (tangFormedCount == -1);
+    if(tangCondensed)
+      return 1;
+    return getIncrementalIntegratorPtr()->formTangent();
+  }
+
+//! @brief Returns true if the assembled (not condensed) tangent is
+//! equal to the one of the analysis being passed as parameter
+//! (identical subdomains).
+bool XC::DomainDecompositionAnalysis::hasSameTangent(const DomainDecompositionAnalysis &other) const
+  {
+    if((numEqn!=other.numEqn) || (numExtEqn!=other.numExtEqn))
+      return false;
+    if(!theSolver || !other.theSolver)
+      return false;
+    return theSolver->hasSameA(*other.theSolver);
+  }
+
+//! @brief Condenses the tangent assembled by assembleTangent. It only
+//! touches the system of equations of this subdomain, so it can be
+//! called concurrently for different subdomains.
+int XC::DomainDecompositionAnalysis::condenseTangent(void)
+  {
+    const int result= theSolver->condenseA(numEqn-numExtEqn);
+    tangCondensed= (result>=0);
+    return result;
+  }
+
+//! @brief Takes the condensed tangent from the analysis being passed as
+//! parameter (see hasSameTangent) instead of computing it again.
+int XC::DomainDecompositionAnalysis::copyCondensedTangent(const DomainDecompositionAnalysis &other)
+  {
+    const int result= theSolver->copyCondensedA(*other.theSolver,numEqn-numExtEqn);
+    tangCondensed= (result>=0);
+    return result;
+  }
+
+//! @brief Returns true if the tangent has been condensed and not
+//! used yet.
+bool XC::DomainDecompositionAnalysis::isTangentCondensed(void) const
+  { return tangCondensed; }
+
+//! @brief Sets the response of the external DOFs from the
+//! last response of the subdomain (first step of
+//! computeInternalResponse).
+//!
+//! Returns 1 (and does nothing) if the response is the same used
+//! in the last call, i.e. there has been no new solution since then;
+//! in that case computeInternalResponse makes all the steps itself.
+int XC::DomainDecompositionAnalysis::setExternalResponse(void)
+  {
+    xIntSolved= false;
+    const Vector &extResponse= theSubdomain->getLastExternalSysResponse();
+    const int sz= extResponse.Size();
+    bool same= (lastExtResponse.Size()==sz);
+    for(int i= 0;same && (i<sz);i++)
+      same= (lastExtResponse(i)==extResponse(i));
+    if(same)
+      return 1;
+    lastExtResponse= extResponse;
+    return getDomainDecompSolutionAlgorithmPtr()->setExternalResponse(extResponse);
+  }
+
+//! @brief Recovers the response of the internal DOFs (back
+//! substitution). It only touches the system of equations of this
+//! subdomain, so it can be called concurrently for different subdomains;
+//! the state of the nodes is updated later by computeInternalResponse.
+int XC::DomainDecompositionAnalysis::solveInternalResponse(void)
+  {
+    const int result= getDomainDecompSolutionAlgorithmPtr()->solveInternalResponse();
+    xIntSolved= (result>=0);
+    return result;
+  }
+
 //! @brief Forma el vector residuo.
 int XC::DomainDecompositionAnalysis::formResidual(void)
   {
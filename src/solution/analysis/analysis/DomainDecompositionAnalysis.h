@@ -93,6 +93,10 @@ class DomainDecompositionAnalysis: public Analysis, public MovableObject
     // before being asked to form Residual(). 
     bool tangFormed; //!< True if the tangent stiffness matrix is already formed.
     int tangFormedCount; //!< saves the expense of computing formTangent() for same state of Subdomain.
+    bool tangCondensed; //!< True if the tangent has been already condensed by the partitioned domain (see condenseTangent).
+    bool xIntSolved; //!< True if the internal DOFs have been already recovered by the partitioned domain (see solveInternalResponse).
+    Vector lastExtResponse; //!< Response of the external DOFs used in the last call to setExternalResponse.
+    void check_domain_changed(void);
   protected:
     int domainStamp;
     //! @brief Returns a pointer to the subdomain.
@@ -127,6 +131,16 @@ class DomainDecompositionAnalysis: public Analysis, public MovableObject
     virtual int  formTangent(void);
     virtual int  formResidual(void);
     virtual int  formTangVectProduct(Vector &force);
+
+    // methods used by the partitioned domain to condense the
+    // subdomains concurrently.
+    int assembleTangent(void);
+    bool hasSameTangent(const DomainDecompositionAnalysis &) const;
+    int condenseTangent(void);
+    int copyCondensedTangent(const DomainDecompositionAnalysis &);
+    bool isTangentCondensed(void) const;
+    int setExternalResponse(void);
+    int solveInternalResponse(void);
     virtual const Matrix &getTangent(void);
     virtual const Vector &getResidual(void);
     virtual const Vector &getTangVectProduct(void);
@@ -0,0 +1,505 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ExplicitDynamicsAnalysis.cc
+
+#include "ExplicitDynamicsAnalysis.h"
+#include "solution/analysis/ModelWrapper.h"
+#include "solution/SoluMethod.h"
+#include <solution/analysis/model/AnalysisModel.h>
+#include <solution/analysis/model/dof_grp/DOF_Group.h>
+#include <solution/analysis/numberer/DOF_Numberer.h>
+#include <solution/analysis/handler/ConstraintHandler.h>
+#include <domain/domain/Domain.h>
+#include <domain/mesh/Mesh.h>
+#include <domain/mesh/node/Node.h>
+#include <domain/mesh/node/NodeIter.h>
+#include <domain/mesh/element/Element.h>
+#include <domain/mesh/element/ElementIter.h>
+#include <domain/mesh/element/utils/NodePtrsWithIDs.h>
+#include <domain/constraints/SFreedom_Constraint.h>
+#include <domain/constraints/SFreedom_ConstraintIter.h>
+#include <domain/load/pattern/load_patterns/EQBasePattern.h>
+#include "utility/matrix/Matrix.h"
+#include <cmath>
+#include <limits>
+
+//! @brief Constructor.
+XC::ExplicitDynamicsAnalysis::NodeDOFs::NodeDOFs(Node *n,const ID &id)
+  : node(n), eqs(id), disp(id.Size()), vel(id.Size()), accel(id.Size()) {}
+
+//! @brief Constructor.
+XC::ExplicitDynamicsAnalysis::ElementDOFs::ElementDOFs(Element *e,const ID &id)
+  : element(e), eqs(id), force(id.Size()) {}
+
+//! @brief Constructor.
+XC::ExplicitDynamicsAnalysis::ExplicitDynamicsAnalysis(SoluMethod *metodo)
+  :TransientAnalysis(metodo), domainStamp(0), alphaM(0.0), safetyFactor(0.9),
+   dtStable(0.0), numSubsteps(0) {}
+
+//! @brief Sets the factor applied to the stable time step
+//! (must be in the interval (0,1]).
+void XC::ExplicitDynamicsAnalysis::setSafetyFactor(const double &f)
+  {
+    if((f>0.0) && (f<=1.0))
+      safetyFactor= f;
+    else
+      std::cerr << nombre_clase() << "::" << __FUNCTION__
+		<< "; safety factor must be in (0,1], got: "
+                << f << std::endl;
+  }
+
+//! @brief Checks that the constraints can be handled by
+//! the analysis (constrained DOFs not numbered and no
+//! multi-freedom constraints).
+int XC::ExplicitDynamicsAnalysis::check_constraints(void)
+  {
+    Domain *the_Domain= metodo_solu->getDomainPtr();
+    ConstrContainer &constraints= the_Domain->getConstraints();
+    if((constraints.getNumMPs()+constraints.getNumMRMPs())>0)
+      {
+	std::cerr << nombre_clase() << "::" << __FUNCTION__
+		  << "; multi-freedom constraints are not supported.\n";
+	return -1;
+      }
+    SFreedom_ConstraintIter &theSPs= constraints.getDomainAndLoadPatternSPs();
+    SFreedom_Constraint *theSP= nullptr;
+    while((theSP= theSPs()) != nullptr)
+      {
+        Node *theNode= the_Domain->getNode(theSP->getNodeTag());
+        if(theNode && theNode->getDOF_GroupPtr())
+          {
+            const ID &id= theNode->getDOF_GroupPtr()->getID();
+            if(id(theSP->getDOF_Number())>=0)
+              {
+	        std::cerr << nombre_clase() << "::" << __FUNCTION__
+		          << "; constrained DOF: " << theSP->getDOF_Number()
+                          << " of node: " << theSP->getNodeTag()
+                          << " has an equation number, use the plain"
+                          << " constraint handler.\n";
+	        return -2;
+              }
+          }
+      }
+    return 0;
+  }
+
+//! @brief Checks that the elements have no Rayleigh damping
+//! (only the mass proportional damping of the analysis is
+//! taken into account).
+int XC::ExplicitDynamicsAnalysis::check_damping(void)
+  {
+    for(std::vector<ElementDOFs>::const_iterator i= elementDOFs.begin();i!=elementDOFs.end();i++)
+      if(!i->element->getRayleighDampingFactors().Nulos())
+        {
+	  std::cerr << nombre_clase() << "::" << __FUNCTION__
+		    << "; element: " << i->element->getTag()
+                    << " has Rayleigh damping factors, which are not"
+                    << " supported; use alphaM instead.\n";
+	  return -1;
+        }
+    return 0;
+  }
+
+//! @brief Checks that there are no ground motion load patterns
+//! (their inertia loads are not computed by the analysis).
+int XC::ExplicitDynamicsAnalysis::check_load_patterns(void)
+  {
+    Domain *the_Domain= metodo_solu->getDomainPtr();
+    const std::map<int,LoadPattern *> &patterns= the_Domain->getConstraints().getLoadPatterns();
+    for(std::map<int,LoadPattern *>::const_iterator i= patterns.begin();i!=patterns.end();i++)
+      if(dynamic_cast<const EQBasePattern *>(i->second))
+        {
+	  std::cerr << nombre_clase() << "::" << __FUNCTION__
+		    << "; load pattern: " << i->first
+                    << " is a ground motion pattern, which is not"
+                    << " supported.\n";
+	  return -1;
+        }
+    return 0;
+  }
+
+//! @brief Computes the inverse of the lumped mass. The mass
+//! matrices of nodes and elements are lumped by rows (the
+//! diagonal term is used if the sum of the row is not positive).
+int XC::ExplicitDynamicsAnalysis::compute_mass(void)
+  {
+    const int numEqn= invMass.Size();
+    Vector mass(numEqn);
+    for(std::vector<NodeDOFs>::iterator i= nodeDOFs.begin();i!=nodeDOFs.end();i++)
+      {
+        const Matrix &m= i->node->getMass();
+        const int sz= std::min(m.noRows(),i->eqs.Size());
+        for(int j= 0;j<sz;j++)
+          {
+            const int eq= i->eqs(j);
+            if(eq>=0)
+              {
+                double mj= 0.0;
+                for(int k= 0;k<m.noCols();k++)
+                  mj+= m(j,k);
+                if(mj<=0.0) mj= std::abs(m(j,j));
+                mass(eq)+= mj;
+              }
+          }
+      }
+    for(std::vector<ElementDOFs>::iterator i= elementDOFs.begin();i!=elementDOFs.end();i++)
+      {
+        const Matrix &m= i->element->getMass();
+        const int sz= std::min(m.noRows(),i->eqs.Size());
+        for(int j= 0;j<sz;j++)
+          {
+            const int eq= i->eqs(j);
+            if(eq>=0)
+              {
+                double mj= 0.0;
+                for(int k= 0;k<m.noCols();k++)
+                  mj+= m(j,k);
+                if(mj<=0.0) mj= std::abs(m(j,j));
+                mass(eq)+= mj;
+              }
+          }
+      }
+    int numMassless= 0;
+    for(int i= 0;i<numEqn;i++)
+      {
+        if(mass(i)>0.0)
+          invMass(i)= 1.0/mass(i);
+        else
+          {
+            invMass(i)= 0.0;
+            numMassless++;
+          }
+      }
+    if(numMassless>0)
+      {
+	std::cerr << nombre_clase() << "::" << __FUNCTION__
+		  << "; there are " << numMassless
+                  << " free DOFs without mass.\n";
+        return -1;
+      }
+    return 0;
+  }
+
+//! @brief Returns an estimation of the stable time step:
+//! \f$2/\omega_{max}\f$ where the highest frequency is bounded
+//! using the Gershgorin theorem with the element tangent
+//! stiffness and the lumped mass.
+double XC::ExplicitDynamicsAnalysis::computeStableTimeStep(void)
+  {
+    const int numEqn= invMass.Size();
+    Vector rowAbsSum(numEqn);
+    for(std::vector<ElementDOFs>::iterator i= elementDOFs.begin();i!=elementDOFs.end();i++)
+      {
+        const Matrix &k= i->element->getTangentStiff();
+        const int sz= std::min(k.noRows(),i->eqs.Size());
+        for(int j= 0;j<sz;j++)
+          {
+            const int eq= i->eqs(j);
+            if(eq>=0)
+              for(int l= 0;l<k.noCols();l++)
+                rowAbsSum(eq)+= std::abs(k(j,l));
+          }
+      }
+    double omega2Max= 0.0;
+    for(int i= 0;i<numEqn;i++)
+      omega2Max= std::max(omega2Max,rowAbsSum(i)*invMass(i));
+    if(omega2Max>0.0)
+      dtStable= 2.0/sqrt(omega2Max);
+    else
+      dtStable= std::numeric_limits<double>::max();
+    return dtStable;
+  }
+
+//! @brief Computes the unbalanced force (external loads minus
+//! element resisting forces) at the current time.
+int XC::ExplicitDynamicsAnalysis::form_unbalance(void)
+  {
+    R.Zero();
+    for(std::vector<NodeDOFs>::iterator i= nodeDOFs.begin();i!=nodeDOFs.end();i++)
+      {
+        const Vector &p= i->node->getUnbalancedLoad();
+        const int sz= i->eqs.Size();
+        for(int j= 0;j<sz;j++)
+          {
+            const int eq= i->eqs(j);
+            if(eq>=0)
+              R(eq)+= p(j);
+          }
+      }
+    for(std::vector<ElementDOFs>::iterator i= elementDOFs.begin();i!=elementDOFs.end();i++)
+      {
+        i->force= i->element->getResistingForce();
+        const int sz= i->eqs.Size();
+        for(int j= 0;j<sz;j++)
+          {
+            const int eq= i->eqs(j);
+            if(eq>=0)
+              R(eq)-= i->force(j);
+          }
+      }
+    return 0;
+  }
+
+//! @brief Updates the state of the elements.
+int XC::ExplicitDynamicsAnalysis::update_elements(void)
+  {
+    int retval= 0;
+    for(std::vector<ElementDOFs>::iterator i= elementDOFs.begin();i!=elementDOFs.end();i++)
+      retval+= i->element->update();
+    return retval;
+  }
+
+//! @brief Copies the response vectors into the nodes
+//! (the values of the constrained DOFs are not modified).
+void XC::ExplicitDynamicsAnalysis::set_node_response(void)
+  {
+    for(std::vector<NodeDOFs>::iterator i= nodeDOFs.begin();i!=nodeDOFs.end();i++)
+      {
+        i->disp= i->node->getTrialDisp();
+        i->vel= i->node->getTrialVel();
+        i->accel= i->node->getTrialAccel();
+        const int sz= i->eqs.Size();
+        for(int j= 0;j<sz;j++)
+          {
+            const int eq= i->eqs(j);
+            if(eq>=0)
+              {
+                i->disp(j)= U(eq);
+                i->vel(j)= Udot(eq);
+                i->accel(j)= Udotdot(eq);
+              }
+          }
+        i->node->setTrialDisp(i->disp);
+        i->node->setTrialVel(i->vel);
+        i->node->setTrialAccel(i->accel);
+      }
+  }
+
+//! @brief Advances the solution from t to t+dt.
+int XC::ExplicitDynamicsAnalysis::explicit_step(const double &dt)
+  {
+    Domain *the_Domain= metodo_solu->getDomainPtr();
+    const double t= the_Domain->getTimeTracker().getCurrentTime();
+    the_Domain->applyLoad(t);
+    form_unbalance();
+
+    const int numEqn= U.Size();
+    const double c= 0.5*alphaM*dt;
+    const double f1= (1.0-c)/(1.0+c);
+    const double f2= dt/(1.0+c);
+    double *u= U.getDataPtr();
+    double *v= Udot.getDataPtr();
+    double *a= Udotdot.getDataPtr();
+    const double *r= R.getDataPtr();
+    const double *im= invMass.getDataPtr();
+    for(int i= 0;i<numEqn;i++)
+      {
+        const double vNew= f1*v[i]+f2*im[i]*r[i];
+        a[i]= (vNew-v[i])/dt;
+        v[i]= vNew;
+        u[i]+= dt*vNew;
+      }
+    set_node_response();
+    the_Domain->setCurrentTime(t+dt);
+    const int ok= update_elements();
+    if(ok!=0)
+      std::cerr << nombre_clase() << "::" << __FUNCTION__
+		<< "; failed to update elements at time: "
+                << t+dt << std::endl;
+    return ok;
+  }
+
+//! @brief Performs the analysis.
+//!
+//! @param numSteps: number of steps in the analysis.
+//! @param dT: time increment.
+int XC::ExplicitDynamicsAnalysis::analyze(int numSteps, double dT)
+  {
+    int result= 0;
+    assert(metodo_solu);
+    if(dT <= 0.0)
+      {
+	std::cerr << nombre_clase() << "::" << __FUNCTION__
+		  << "; wrong time increment: " << dT << std::endl;
+        return -2;
+      }
+    EntCmd *old= metodo_solu->Owner();
+    metodo_solu->set_owner(this);
+    Domain *the_Domain= metodo_solu->getDomainPtr();
+    for(int i=0; i<numSteps; i++)
+      {
+        if(check_load_patterns()<0)
+          {
+	    result= -1;
+            break;
+          }
+        if(newStepDomain(metodo_solu->getModelWrapperPtr()->getAnalysisModelPtr(),dT) < 0)
+          {
+	    std::cerr << nombre_clase() << "::" << __FUNCTION__
+		      << "; the AnalysisModel failed"
+		      << " at time "
+		      << the_Domain->getTimeTracker().getCurrentTime()
+		      << std::endl;
+	    the_Domain->revertToLastCommit();
+	    result= -2;
+            break;
+          }
+        // check if domain has undergone change
+        int stamp = the_Domain->hasDomainChanged();
+        if(stamp != domainStamp)
+          {
+	    if(this->domainChanged() < 0)
+              {
+	        std::cerr << nombre_clase() << "::" << __FUNCTION__
+			  << "; domainChanged() failed\n";
+	        result= -1;
+                break;
+              }	
+          }
+        const double dtMax= safetyFactor*dtStable;
+        numSubsteps= (dT>dtMax) ? int(ceil(dT/dtMax)) : 1;
+        const double dt= dT/numSubsteps;
+        for(int j= 0;j<numSubsteps;j++)
+          {
+            result= explicit_step(dt);
+            if(result<0)
+              break;
+            if(j<(numSubsteps-1)) //Substep: commit without recording.
+              the_Domain->getMesh().commit();
+          }
+        if(result<0)
+          {
+	    std::cerr << nombre_clase() << "::" << __FUNCTION__
+		      << "; step failed at time "
+		      << the_Domain->getTimeTracker().getCurrentTime()
+		      << std::endl;
+	    the_Domain->revertToLastCommit();
+            domainChanged();
+	    result= -3;
+            break;
+          }
+        result= the_Domain->commit();
+        if(result < 0)
+          {
+	    std::cerr << nombre_clase() << "::" << __FUNCTION__
+		      << "; the domain failed to commit at time "
+		      << the_Domain->getTimeTracker().getCurrentTime()
+		      << std::endl;
+	    result= -4;
+            break;
+          }
+      }
+    metodo_solu->set_owner(old);
+    return result;
+  }
+
+//! @brief Numbers the DOFs, computes the lumped mass and
+//! initializes the response vectors from the committed state.
+int XC::ExplicitDynamicsAnalysis::domainChanged(void)
+  {
+    assert(metodo_solu);
+    Domain *the_Domain= metodo_solu->getDomainPtr();
+    domainStamp= the_Domain->hasDomainChanged();
+
+    AnalysisModel *theModel= metodo_solu->getModelWrapperPtr()->getAnalysisModelPtr();
+    theModel->clearAll();
+    metodo_solu->getModelWrapperPtr()->getConstraintHandlerPtr()->clearAll();
+    metodo_solu->getModelWrapperPtr()->getConstraintHandlerPtr()->handle();
+    metodo_solu->getModelWrapperPtr()->getDOF_NumbererPtr()->numberDOF();
+    metodo_solu->getModelWrapperPtr()->getConstraintHandlerPtr()->doneNumberingDOF();
+    if(check_constraints()<0)
+      return -1;
+
+    const int numEqn= theModel->getNumEqn();
+    invMass.resize(numEqn);
+    U.resize(numEqn); U.Zero();
+    Udot.resize(numEqn); Udot.Zero();
+    Udotdot.resize(numEqn); Udotdot.Zero();
+    R.resize(numEqn); R.Zero();
+
+    nodeDOFs.clear();
+    NodeIter &theNodes= the_Domain->getMesh().getNodes();
+    Node *nodePtr= nullptr;
+    while((nodePtr= theNodes()) != nullptr)
+      {
+        DOF_Group *dofGroup= nodePtr->getDOF_GroupPtr();
+        if(dofGroup)
+          {
+            const ID &id= dofGroup->getID();
+            if(id.Size()!=nodePtr->getNumberDOF())
+              {
+	        std::cerr << nombre_clase() << "::" << __FUNCTION__
+		          << "; the DOFs of node: " << nodePtr->getTag()
+                          << " have been transformed, use the plain"
+                          << " constraint handler.\n";
+                return -1;
+              }
+            nodeDOFs.push_back(NodeDOFs(nodePtr,id));
+            const Vector &disp= nodePtr->getTrialDisp();
+            const Vector &vel= nodePtr->getTrialVel();
+            const Vector &accel= nodePtr->getTrialAccel();
+            for(int j= 0;j<id.Size();j++)
+              {
+                const int eq= id(j);
+                if(eq>=0)
+                  {
+                    U(eq)= disp(j);
+                    Udot(eq)= vel(j);
+                    Udotdot(eq)= accel(j);
+                  }
+              }
+          }
+      }
+
+    elementDOFs.clear();
+    ElementIter &theEles= the_Domain->getMesh().getElements();
+    Element *elePtr= nullptr;
+    while((elePtr= theEles()) != nullptr)
+      {
+        if(elePtr->isAlive())
+          {
+            ID id(elePtr->getNumDOF());
+            int loc= 0;
+            const NodePtrsWithIDs &elemNodes= elePtr->getNodePtrs();
+            for(size_t k= 0;k<elemNodes.size();k++)
+              {
+                const DOF_Group *dofGroup= elemNodes[k]->getDOF_GroupPtr();
+                const ID &nodeId= dofGroup->getID();
+                for(int j= 0;(j<nodeId.Size()) && (loc<id.Size());j++,loc++)
+                  id(loc)= nodeId(j);
+              }
+            elementDOFs.push_back(ElementDOFs(elePtr,id));
+          }
+      }
+
+    if(check_damping()<0)
+      return -1;
+    if(compute_mass()<0)
+      return -2;
+    computeStableTimeStep();
+    return update_elements();
+  }
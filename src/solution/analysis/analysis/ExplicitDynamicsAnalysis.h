@@ -0,0 +1,139 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ExplicitDynamicsAnalysis.h
+
+#ifndef ExplicitDynamicsAnalysis_h
+#define ExplicitDynamicsAnalysis_h
+
+#include "TransientAnalysis.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+#include <vector>
+
+namespace XC {
+class Node;
+class Element;
+
+//! @ingroup AnalysisType
+//
+//! @brief Explicit dynamic analysis (central difference with lumped mass)
+//! that works directly on nodes and elements, without assembling
+//! any system of equations.
+//!
+//! The inverse of the lumped mass is computed once (when the domain
+//! changes); on each step the element resisting forces are
+//! evaluated into a contiguous force vector and the displacement,
+//! velocity and acceleration vectors are updated with simple loops:
+//! \f[ v_{n+1/2}= \frac{(1-\alpha_M \Delta t/2) v_{n-1/2} + \Delta t M^{-1} (P_n - F_n)}{1+\alpha_M \Delta t/2} \f]
+//! \f[ u_{n+1}= u_n + \Delta t v_{n+1/2} \f]
+//!
+//! The equation numbers are taken from the model wrapper of the
+//! solution method; the constrained DOFs must not be numbered
+//! (use the plain constraint handler) and multi-freedom
+//! constraints are not supported. The
+//! algorithm, integrator and system of equations of the
+//! solution method are not used.
+//!
+//! The only damping is the mass proportional one of the analysis
+//! (alphaM); models with element Rayleigh damping factors or
+//! with ground motion load patterns (UniformExcitation,
+//! MultiSupportPattern,...) are rejected.
+//!
+//! When the time increment of the analysis exceeds the stable
+//! time step (times the safety factor) each step is split
+//! into equal substeps (subcycling); recorders are only
+//! called at the end of each step.
+class ExplicitDynamicsAnalysis: public TransientAnalysis
+  {
+  private:
+    //! @brief Node and equation numbers of its DOFs.
+    struct NodeDOFs
+      {
+        Node *node; //!< Pointer to the node.
+        ID eqs; //!< Equation numbers (negative if the DOF is constrained).
+        Vector disp; //!< Work vector for the displacement.
+        Vector vel; //!< Work vector for the velocity.
+        Vector accel; //!< Work vector for the acceleration.
+        NodeDOFs(Node *,const ID &);
+      };
+    //! @brief Element and equation numbers of its DOFs.
+    struct ElementDOFs
+      {
+        Element *element; //!< Pointer to the element.
+        ID eqs; //!< Equation numbers (negative if the DOF is constrained).
+        Vector force; //!< Resisting force of the element.
+        ElementDOFs(Element *,const ID &);
+      };
+    int domainStamp;
+    std::vector<NodeDOFs> nodeDOFs;
+    std::vector<ElementDOFs> elementDOFs;
+    Vector invMass; //!< inverse of the lumped mass.
+    Vector U; //!< displacement at time t.
+    Vector Udot; //!< velocity at time t-dt/2.
+    Vector Udotdot; //!< acceleration at time t.
+    Vector R; //!< unbalanced force (external minus internal) at time t.
+    double alphaM; //!< mass proportional damping factor.
+    double safetyFactor; //!< factor applied to the stable time step.
+    double dtStable; //!< stable time step estimate.
+    int numSubsteps; //!< number of substeps used in the last step.
+
+    int check_constraints(void);
+    int check_damping(void);
+    int check_load_patterns(void);
+    int compute_mass(void);
+    int form_unbalance(void);
+    int update_elements(void);
+    void set_node_response(void);
+    int explicit_step(const double &);
+  protected:
+    friend class ProcSolu;
+    ExplicitDynamicsAnalysis(SoluMethod *metodo);
+    Analysis *getCopy(void) const;
+  public:
+    int analyze(int numSteps, double dT);
+    int domainChanged(void);
+
+    double computeStableTimeStep(void);
+    inline double getStableTimeStep(void) const
+      { return dtStable; }
+    inline int getNumSubsteps(void) const
+      { return numSubsteps; }
+    inline double getAlphaM(void) const
+      { return alphaM; }
+    inline void setAlphaM(const double &a)
+      { alphaM= a; }
+    inline double getSafetyFactor(void) const
+      { return safetyFactor; }
+    void setSafetyFactor(const double &);
+    inline const Vector &getLumpedInverseMass(void) const
+      { return invMass; }
+  };
+inline Analysis *ExplicitDynamicsAnalysis::getCopy(void) const
+  { return new ExplicitDynamicsAnalysis(*this); }
+} // end of XC namespace
+
+#endif
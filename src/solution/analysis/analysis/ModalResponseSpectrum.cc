@@ -0,0 +1,404 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ModalResponseSpectrum.cc
+
+#include "ModalResponseSpectrum.h"
+#include "ModalAnalysis.h"
+#include <domain/domain/Domain.h>
+#include <domain/mesh/Mesh.h>
+#include <domain/mesh/node/Node.h>
+#include <domain/mesh/element/Element.h>
+#include <domain/mesh/element/ElementIter.h>
+#include <domain/mesh/element/utils/NodePtrsWithIDs.h>
+#include <cmath>
+
+//! @brief Constructor.
+//!
+//! @param a: modal analysis that computed the eigenpairs.
+XC::ModalResponseSpectrum::ModalResponseSpectrum(ModalAnalysis &a)
+  : ModalSuperposition(a), zeta(omega.Size()), modalCombination(CQC),
+    directionalCombination(DIR_SRSS), directionalFactor(0.3),
+    numReactionsOffset(0)
+  { setDampingRatio(0.05); }
+
+//! @brief Sets the damping ratio of each mode (used by the CQC rule).
+void XC::ModalResponseSpectrum::setDampingRatios(const Vector &z)
+  {
+    const int nm= getNumModes();
+    if(z.Size()<nm)
+      std::cerr << nombre_clase() << "::" << __FUNCTION__
+                << "; " << nm << " damping ratios expected, got: "
+                << z.Size() << std::endl;
+    else
+      for(int i= 0;i<nm;i++)
+        zeta(i)= z(i);
+  }
+
+//! @brief Sets the same damping ratio for all modes.
+void XC::ModalResponseSpectrum::setDampingRatio(const double &z)
+  {
+    for(int i= 0;i<zeta.Size();i++)
+      zeta(i)= z;
+  }
+
+//! @brief Adds a spectrum acting in the direction argument (one
+//! component for each node DOF, i. e. [1,0,0] for an horizontal
+//! motion in a 2D frame).
+//!
+//! @param s: spectral acceleration as function of the period.
+//! @param dir: direction of the ground motion.
+//! @return index of the spectrum.
+int XC::ModalResponseSpectrum::addSpectrum(const FuncPorPuntosR_R &s,const Vector &dir)
+  {
+    spectra.push_back(s);
+    influences.push_back(get_influence(dir));
+    return spectra.size()-1;
+  }
+
+//! @brief Removes the spectra.
+void XC::ModalResponseSpectrum::clearSpectra(void)
+  {
+    spectra.clear();
+    influences.clear();
+    modalResponses.clear();
+    combinedResponse.resize(0);
+  }
+
+//! @brief Returns the spectral accelerations that correspond to each
+//! mode for the i-th spectrum.
+XC::Vector XC::ModalResponseSpectrum::getSpectralAccelerations(const int &s) const
+  {
+    const int nm= getNumModes();
+    Vector retval(nm);
+    if((s>=0) && (s<int(spectra.size())))
+      {
+        for(int i= 0;i<nm;i++)
+          retval(i)= spectra[s](2.0*M_PI/omega(i));
+      }
+    else
+      std::cerr << nombre_clase() << "::" << __FUNCTION__
+                << "; spectrum index: " << s << " out of range.\n";
+    return retval;
+  }
+
+//! @brief Returns the peak modal displacements (factor that multiplies
+//! each unit mass normalized mode) for the i-th spectrum.
+XC::Vector XC::ModalResponseSpectrum::getModalAmplitudes(const int &s) const
+  {
+    const int nm= getNumModes();
+    const int numEqn= phi.noRows();
+    Vector retval= getSpectralAccelerations(s);
+    if((s>=0) && (s<int(spectra.size())))
+      {
+        const Vector Mr= mass_prod(influences[s]);
+        for(int i= 0;i<nm;i++)
+          {
+            double L= 0.0; // participation factor.
+            for(int j= 0;j<numEqn;j++)
+              L+= phi(j,i)*Mr(j);
+            retval(i)*= L/(omega(i)*omega(i));
+          }
+      }
+    return retval;
+  }
+
+//! @brief Sets the modal combination rule ("SRSS", "CQC" or "ABS").
+void XC::ModalResponseSpectrum::setModalCombination(const std::string &str)
+  {
+    if(str=="SRSS")
+      modalCombination= SRSS;
+    else if(str=="CQC")
+      modalCombination= CQC;
+    else if(str=="ABS")
+      modalCombination= ABS;
+    else
+      std::cerr << nombre_clase() << "::" << __FUNCTION__
+                << "; unknown combination rule: '" << str
+                << "' (must be SRSS, CQC or ABS).\n";
+  }
+
+//! @brief Returns the modal combination rule.
+std::string XC::ModalResponseSpectrum::getModalCombination(void) const
+  {
+    std::string retval= "CQC";
+    if(modalCombination==SRSS)
+      retval= "SRSS";
+    else if(modalCombination==ABS)
+      retval= "ABS";
+    return retval;
+  }
+
+//! @brief Sets the directional combination rule ("SRSS" or "percentage").
+void XC::ModalResponseSpectrum::setDirectionalCombination(const std::string &str)
+  {
+    if(str=="SRSS")
+      directionalCombination= DIR_SRSS;
+    else if(str=="percentage")
+      directionalCombination= DIR_PERCENTAGE;
+    else
+      std::cerr << nombre_clase() << "::" << __FUNCTION__
+                << "; unknown combination rule: '" << str
+                << "' (must be SRSS or percentage).\n";
+  }
+
+//! @brief Returns the directional combination rule.
+std::string XC::ModalResponseSpectrum::getDirectionalCombination(void) const
+  {
+    std::string retval= "SRSS";
+    if(directionalCombination==DIR_PERCENTAGE)
+      retval= "percentage";
+    return retval;
+  }
+
+//! @brief Computes the position of each node and element response
+//! in the results vector and returns its size.
+size_t XC::ModalResponseSpectrum::setup_offsets(void)
+  {
+    nodeOffsets.clear();
+    elementOffsets.clear();
+    int offset= 0;
+    Domain *dom= get_domain();
+    for(std::map<int,ID>::const_iterator i= nodeEqs.begin();i!=nodeEqs.end();i++)
+      {
+        const Node *theNode= dom->getNode(i->first);
+        if(theNode)
+          {
+            const int sz= theNode->getNumberDOF();
+            nodeOffsets[i->first]= std::pair<int,int>(offset,sz);
+            offset+= sz;
+          }
+      }
+    numReactionsOffset= offset;
+    offset*= 2; // displacements and reactions.
+    ElementIter &theElements= dom->getMesh().getElements();
+    Element *elePtr= nullptr;
+    while((elePtr= theElements()) != nullptr)
+      if(elePtr->isAlive())
+        {
+          const int sz= elePtr->getNumDOF();
+          elementOffsets[elePtr->getTag()]= std::pair<int,int>(offset,sz);
+          offset+= sz;
+        }
+    return offset;
+  }
+
+//! @brief Puts the displacements argument (vector of equations) on
+//! the nodes and returns the node displacements, the reactions
+//! and the element resisting forces.
+XC::Vector XC::ModalResponseSpectrum::get_response(const Vector &u,const size_t &sz)
+  {
+    Vector retval(sz);
+    set_node_values(u);
+    Domain *dom= get_domain();
+    dom->update();
+    for(offset_map::const_iterator i= nodeOffsets.begin();i!=nodeOffsets.end();i++)
+      {
+        const Vector &disp= dom->getNode(i->first)->getTrialDisp();
+        const int offset= i->second.first;
+        for(int j= 0;j<i->second.second;j++)
+          retval(offset+j)= disp(j);
+      }
+    for(offset_map::const_iterator i= elementOffsets.begin();i!=elementOffsets.end();i++)
+      {
+        const Element *elePtr= dom->getElement(i->first);
+        const Vector &rf= elePtr->getResistingForce();
+        const int offset= i->second.first;
+        const int nf= std::min(rf.Size(),i->second.second);
+        for(int j= 0;j<nf;j++)
+          retval(offset+j)= rf(j);
+        // reactions: element forces on the constrained DOFs.
+        const NodePtrsWithIDs &theNodes= elePtr->getNodePtrs();
+        const int numNodes= elePtr->getNumExternalNodes();
+        int k= 0;
+        for(int n= 0;n<numNodes;n++)
+          {
+            const Node *theNode= theNodes[n];
+            const int ndof= theNode->getNumberDOF();
+            offset_map::const_iterator iNode= nodeOffsets.find(theNode->getTag());
+            if(iNode!=nodeOffsets.end())
+              {
+                const ID &eqs= nodeEqs[theNode->getTag()];
+                const int rOffset= numReactionsOffset+iNode->second.first;
+                for(int j= 0;(j<ndof) && (k+j<nf);j++)
+                  if((j>=eqs.Size()) || (eqs(j)<0))
+                    retval(rOffset+j)+= rf(k+j);
+              }
+            k+= ndof;
+          }
+      }
+    return retval;
+  }
+
+//! @brief Combines the modal responses (one row for each mode).
+//!
+//! @param R: modal responses.
+//! @param rho: correlation coefficients (only for CQC).
+XC::Vector XC::ModalResponseSpectrum::combine_modes(const Matrix &R,const Matrix &rho) const
+  {
+    const int nm= R.noRows();
+    const int nc= R.noCols();
+    Vector retval(nc);
+    for(int q= 0;q<nc;q++)
+      {
+        double s= 0.0;
+        if(modalCombination==ABS)
+          {
+            for(int i= 0;i<nm;i++)
+              s+= fabs(R(i,q));
+          }
+        else
+          {
+            for(int i= 0;i<nm;i++)
+              {
+                const double ri= R(i,q);
+                s+= ri*ri;
+                if(modalCombination==CQC)
+                  for(int j= i+1;j<nm;j++)
+                    s+= 2.0*rho(i,j)*ri*R(j,q);
+              }
+            s= sqrt(std::max(s,0.0));
+          }
+        retval(q)= s;
+      }
+    return retval;
+  }
+
+//! @brief Computes the combined response.
+int XC::ModalResponseSpectrum::analyze(void)
+  {
+    const size_t numSpectra= spectra.size();
+    if(numSpectra==0)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; no spectra defined.\n";
+        return -1;
+      }
+    Domain *dom= get_domain();
+    const int nm= getNumModes();
+    const int numEqn= phi.noRows();
+    const size_t sz= setup_offsets();
+
+    // save the current state.
+    std::map<int,Vector> trialDisp;
+    for(offset_map::const_iterator i= nodeOffsets.begin();i!=nodeOffsets.end();i++)
+      trialDisp[i->first]= dom->getNode(i->first)->getTrialDisp();
+
+    // response to each unit mode (minus the response to zero
+    // displacements, to remove the effect of the element loads).
+    const Vector base= get_response(Vector(numEqn),sz);
+    Matrix unitResponses(nm,sz);
+    for(int i= 0;i<nm;i++)
+      {
+        const Vector r= get_response(get_mode(i),sz);
+        for(size_t q= 0;q<sz;q++)
+          unitResponses(i,q)= r(q)-base(q);
+      }
+
+    // restore the state.
+    for(std::map<int,Vector>::const_iterator i= trialDisp.begin();i!=trialDisp.end();i++)
+      dom->getNode(i->first)->setTrialDisp(i->second);
+    dom->update();
+
+    Matrix rho;
+    if(modalCombination==CQC)
+      rho= analysis->getCQCModalCrossCorrelationCoefficients(zeta);
+    modalResponses.assign(numSpectra,Matrix(nm,sz));
+    std::vector<Vector> dirResponses(numSpectra);
+    for(size_t s= 0;s<numSpectra;s++)
+      {
+        const Vector a= getModalAmplitudes(s);
+        Matrix &R= modalResponses[s];
+        for(int i= 0;i<nm;i++)
+          for(size_t q= 0;q<sz;q++)
+            R(i,q)= a(i)*unitResponses(i,q);
+        dirResponses[s]= combine_modes(R,rho);
+      }
+
+    // directional combination.
+    combinedResponse.resize(sz);
+    for(size_t q= 0;q<sz;q++)
+      {
+        double r= 0.0;
+        if(directionalCombination==DIR_SRSS)
+          {
+            for(size_t s= 0;s<numSpectra;s++)
+              r+= dirResponses[s](q)*dirResponses[s](q);
+            r= sqrt(r);
+          }
+        else
+          {
+            double sum= 0.0;
+            for(size_t s= 0;s<numSpectra;s++)
+              sum+= dirResponses[s](q);
+            for(size_t s= 0;s<numSpectra;s++)
+              {
+                const double rs= dirResponses[s](q);
+                r= std::max(r,rs+directionalFactor*(sum-rs));
+              }
+          }
+        combinedResponse(q)= r;
+      }
+    return 0;
+  }
+
+//! @brief Returns the components of the combined response
+//! of the node or element.
+XC::Vector XC::ModalResponseSpectrum::get_component(const offset_map &offsets,const int &tag,const int &baseOffset) const
+  {
+    Vector retval;
+    offset_map::const_iterator i= offsets.find(tag);
+    if(i!=offsets.end())
+      {
+        if(combinedResponse.Size()>0)
+          {
+            const int offset= baseOffset+i->second.first;
+            retval.resize(i->second.second);
+            for(int j= 0;j<i->second.second;j++)
+              retval(j)= combinedResponse(offset+j);
+          }
+        else
+          std::cerr << nombre_clase() << "::" << __FUNCTION__
+                    << "; results not computed yet.\n";
+      }
+    else
+      std::cerr << nombre_clase() << "::" << __FUNCTION__
+                << "; object: " << tag << " not found.\n";
+    return retval;
+  }
+
+//! @brief Returns the combined displacement of the node.
+XC::Vector XC::ModalResponseSpectrum::getNodeDisplacement(const int &tag) const
+  { return get_component(nodeOffsets,tag,0); }
+
+//! @brief Returns the combined reaction of the node (element forces
+//! on the constrained DOFs).
+XC::Vector XC::ModalResponseSpectrum::getNodeReaction(const int &tag) const
+  { return get_component(nodeOffsets,tag,numReactionsOffset); }
+
+//! @brief Returns the combined resisting force of the element.
+XC::Vector XC::ModalResponseSpectrum::getElementResistingForce(const int &tag) const
+  { return get_component(elementOffsets,tag,0); }
@@ -0,0 +1,107 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ModalResponseSpectrum.h
+
+#ifndef ModalResponseSpectrum_h
+#define ModalResponseSpectrum_h
+
+#include "ModalSuperposition.h"
+#include "xc_utils/src/geom/d1/func_por_puntos/FuncPorPuntosR_R.h"
+#include <vector>
+
+namespace XC {
+
+//! @ingroup AnalysisType
+//
+//! @brief Response spectrum analysis using the eigenpairs computed
+//! by a modal analysis.
+//!
+//! For each mode and each excitation (spectrum and direction) the
+//! peak modal displacements are obtained from the spectral
+//! acceleration. The response of the structure to each unit mode is
+//! computed once (node displacements, reactions and element resisting
+//! forces), scaled for every excitation and then combined using the
+//! SRSS, CQC or ABS rules. The responses to the excitations in
+//! different directions are combined using the SRSS rule or the
+//! percentage rule (i.e. 100/30/30).
+class ModalResponseSpectrum: public ModalSuperposition
+  {
+  public:
+    enum ModalCombination {SRSS, CQC, ABS};
+    enum DirectionalCombination {DIR_SRSS, DIR_PERCENTAGE};
+  private:
+    Vector zeta; //!< damping ratios.
+    std::vector<FuncPorPuntosR_R> spectra; //!< spectral accelerations as function of the period.
+    std::vector<Vector> influences; //!< influence vector of each spectrum.
+    ModalCombination modalCombination; //!< modal combination rule.
+    DirectionalCombination directionalCombination; //!< directional combination rule.
+    double directionalFactor; //!< factor for the percentage rule (0.3 means 100/30/30).
+
+    typedef std::map<int,std::pair<int,int> > offset_map; //!< tag -> (offset,size)
+    offset_map nodeOffsets; //!< position of the node DOFs in the results.
+    offset_map elementOffsets; //!< position of the element forces in the results.
+    int numReactionsOffset; //!< position of the reactions in the results.
+    std::vector<Matrix> modalResponses; //!< peak response of each mode (modes x components) for each spectrum.
+    Vector combinedResponse; //!< combined response.
+
+    size_t setup_offsets(void);
+    Vector get_response(const Vector &,const size_t &);
+    Vector combine_modes(const Matrix &,const Matrix &) const;
+    Vector get_component(const offset_map &,const int &,const int &) const;
+  public:
+    ModalResponseSpectrum(ModalAnalysis &);
+
+    inline const Vector &getDampingRatios(void) const
+      { return zeta; }
+    void setDampingRatios(const Vector &);
+    void setDampingRatio(const double &);
+
+    int addSpectrum(const FuncPorPuntosR_R &,const Vector &);
+    void clearSpectra(void);
+    inline int getNumSpectra(void) const
+      { return spectra.size(); }
+    Vector getSpectralAccelerations(const int &) const;
+    Vector getModalAmplitudes(const int &) const;
+
+    void setModalCombination(const std::string &);
+    std::string getModalCombination(void) const;
+    void setDirectionalCombination(const std::string &);
+    std::string getDirectionalCombination(void) const;
+    inline void setDirectionalFactor(const double &f)
+      { directionalFactor= f; }
+    inline const double &getDirectionalFactor(void) const
+      { return directionalFactor; }
+
+    int analyze(void);
+
+    Vector getNodeDisplacement(const int &) const;
+    Vector getNodeReaction(const int &) const;
+    Vector getElementResistingForce(const int &) const;
+  };
+} // end of XC namespace
+
+#endif
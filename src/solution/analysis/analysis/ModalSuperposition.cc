@@ -0,0 +1,205 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ModalSuperposition.cc
+
+#include "ModalSuperposition.h"
+#include "ModalAnalysis.h"
+#include <solution/system_of_eqn/eigenSOE/EigenSOE.h>
+#include <solution/analysis/model/dof_grp/DOF_Group.h>
+#include <domain/domain/Domain.h>
+#include <domain/mesh/Mesh.h>
+#include <domain/mesh/node/Node.h>
+#include <domain/mesh/node/NodeIter.h>
+#include <cmath>
+
+//! @brief Constructor.
+//!
+//! @param a: modal analysis that computed the eigenpairs.
+XC::ModalSuperposition::ModalSuperposition(ModalAnalysis &a)
+  : EntCmd(), analysis(&a), omega(a.getAngularFrequencies()),
+    phi(a.getEigenvectors())
+  {
+    const int numEqn= phi.noRows();
+    const int nm= getNumModes();
+    // normalize the modes to unit modal mass.
+    for(int i= 0;i<nm;i++)
+      {
+        const Vector fi= get_mode(i);
+        const double m= fi^mass_prod(fi);
+        if(m>0.0)
+          {
+            const double f= 1.0/sqrt(m);
+            for(int j= 0;j<numEqn;j++)
+              phi(j,i)*= f;
+          }
+        else
+          std::cerr << nombre_clase() << "::" << __FUNCTION__
+                    << "; mode: " << i+1 << " has zero modal mass.\n";
+      }
+
+    // equation numbers of the node DOFs.
+    Domain *dom= get_domain();
+    if(dom)
+      {
+        NodeIter &theNodes= dom->getMesh().getNodes();
+        Node *nodePtr= nullptr;
+        while((nodePtr= theNodes()) != nullptr)
+          {
+            const DOF_Group *dofGroup= nodePtr->getDOF_GroupPtr();
+            if(dofGroup)
+              nodeEqs[nodePtr->getTag()]= dofGroup->getID();
+          }
+      }
+  }
+
+//! @brief Returns the number of modes.
+int XC::ModalSuperposition::getNumModes(void) const
+  { return std::min(omega.Size(),phi.noCols()); }
+
+//! @brief Returns the domain of the modal analysis.
+XC::Domain *XC::ModalSuperposition::get_domain(void)
+  { return analysis->getDomainPtr(); }
+
+//! @brief Returns the domain of the modal analysis.
+const XC::Domain *XC::ModalSuperposition::get_domain(void) const
+  { return analysis->getDomainPtr(); }
+
+//! @brief Returns the i-th mode (zero based).
+XC::Vector XC::ModalSuperposition::get_mode(const int &i) const
+  {
+    const int numEqn= phi.noRows();
+    Vector retval(numEqn);
+    for(int j= 0;j<numEqn;j++)
+      retval(j)= phi(j,i);
+    return retval;
+  }
+
+//! @brief Returns the product of the mass matrix by the vector.
+XC::Vector XC::ModalSuperposition::mass_prod(const Vector &v) const
+  {
+    const size_t sz= v.Size();
+    Vector retval(sz);
+    const EigenSOE *soe= analysis->getEigenSOEPtr();
+    if(soe)
+      {
+        const EigenSOE::sparse_matrix &M= soe->getMassMatrix();
+        if((M.size1()==sz) && (M.size2()==sz))
+          {
+            boost::numeric::ublas::vector<double> tmp(sz);
+            for(size_t i= 0;i<sz;i++)
+              tmp(i)= v(i);
+            const boost::numeric::ublas::vector<double> prd= boost::numeric::ublas::prod(M,tmp);
+            for(size_t i= 0;i<sz;i++)
+              retval(i)= prd(i);
+          }
+        else
+          std::cerr << nombre_clase() << "::" << __FUNCTION__
+                    << "; the vector has dimension " << sz
+                    << " and the mass matrix " << M.size1()
+                    << "x" << M.size2() << ".\n";
+      }
+    return retval;
+  }
+
+//! @brief Returns the equation number of the DOF of the node
+//! (-1 if the DOF is constrained or doesn't exists).
+int XC::ModalSuperposition::get_eq(const int &nodeTag,const int &dof) const
+  {
+    int retval= -1;
+    std::map<int,ID>::const_iterator i= nodeEqs.find(nodeTag);
+    if(i!=nodeEqs.end())
+      {
+        if((dof>=0) && (dof<i->second.Size()))
+          retval= i->second(dof);
+      }
+    else
+      std::cerr << nombre_clase() << "::" << __FUNCTION__
+                << "; node: " << nodeTag << " not found.\n";
+    return retval;
+  }
+
+//! @brief Returns the influence vector (in the space of the equations)
+//! that corresponds to the direction argument (one component
+//! for each node DOF, i. e. [1,0,0] for an horizontal motion
+//! in a 2D frame).
+XC::Vector XC::ModalSuperposition::get_influence(const Vector &dir) const
+  {
+    Vector retval(phi.noRows());
+    for(std::map<int,ID>::const_iterator i= nodeEqs.begin();i!=nodeEqs.end();i++)
+      {
+        const ID &eqs= i->second;
+        const int sz= std::min(eqs.Size(),dir.Size());
+        for(int j= 0;j<sz;j++)
+          if(eqs(j)>=0)
+            retval(eqs(j))= dir(j);
+      }
+    return retval;
+  }
+
+//! @brief Returns the current displacements of the nodes
+//! as a vector of equations.
+XC::Vector XC::ModalSuperposition::get_node_values(void) const
+  {
+    Vector retval(phi.noRows());
+    const Domain *dom= get_domain();
+    for(std::map<int,ID>::const_iterator i= nodeEqs.begin();i!=nodeEqs.end();i++)
+      {
+        const Node *theNode= dom->getNode(i->first);
+        if(theNode)
+          {
+            const Vector &disp= theNode->getDisp();
+            const ID &eqs= i->second;
+            const int sz= std::min(eqs.Size(),disp.Size());
+            for(int j= 0;j<sz;j++)
+              if(eqs(j)>=0)
+                retval(eqs(j))= disp(j);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Puts the displacements argument (vector of equations)
+//! as trial displacements of the nodes (the constrained
+//! components are not modified).
+void XC::ModalSuperposition::set_node_values(const Vector &u)
+  {
+    Domain *dom= get_domain();
+    for(std::map<int,ID>::const_iterator i= nodeEqs.begin();i!=nodeEqs.end();i++)
+      {
+        Node *theNode= dom->getNode(i->first);
+        if(theNode)
+          {
+            Vector disp(theNode->getTrialDisp());
+            const ID &eqs= i->second;
+            const int sz= std::min(eqs.Size(),disp.Size());
+            for(int j= 0;j<sz;j++)
+              if(eqs(j)>=0)
+                disp(j)= u(eqs(j));
+            theNode->setTrialDisp(disp);
+          }
+      }
+  }
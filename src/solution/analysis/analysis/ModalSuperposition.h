@@ -0,0 +1,79 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ModalSuperposition.h
+
+#ifndef ModalSuperposition_h
+#define ModalSuperposition_h
+
+#include "xc_utils/src/nucleo/EntCmd.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/ID.h"
+#include <map>
+
+namespace XC {
+class ModalAnalysis;
+class Domain;
+
+//! @ingroup AnalysisType
+//
+//! @brief Base class for the computations that combine the
+//! eigenpairs obtained by a modal analysis (time history by
+//! modal superposition, response spectrum analysis,...).
+//!
+//! Keeps a copy of the angular frequencies and the modes (normalized
+//! to unit modal mass) and the equation numbers of the node DOFs,
+//! that are read when the object is created, so it must be created
+//! just after the modal analysis.
+class ModalSuperposition: public EntCmd
+  {
+  protected:
+    ModalAnalysis *analysis; //!< modal analysis that computed the eigenpairs.
+    Vector omega; //!< angular frequencies.
+    Matrix phi; //!< eigenvectors (by columns) normalized to unit modal mass.
+    std::map<int,ID> nodeEqs; //!< equation numbers of the DOFs of each node.
+
+    Domain *get_domain(void);
+    const Domain *get_domain(void) const;
+    Vector mass_prod(const Vector &) const;
+    int get_eq(const int &,const int &) const;
+    Vector get_influence(const Vector &) const;
+    Vector get_node_values(void) const;
+    void set_node_values(const Vector &);
+    Vector get_mode(const int &) const;
+  public:
+    ModalSuperposition(ModalAnalysis &);
+
+    int getNumModes(void) const;
+    inline const Vector &getAngularFrequencies(void) const
+      { return omega; }
+    inline const Matrix &getModes(void) const
+      { return phi; }
+  };
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,381 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ModalTimeHistory.cc
+
+#include "ModalTimeHistory.h"
+#include "ModalAnalysis.h"
+#include <domain/domain/Domain.h>
+#include <cmath>
+
+//! @brief Constructor.
+//!
+//! @param a: modal analysis that computed the eigenpairs.
+XC::ModalTimeHistory::ModalTimeHistory(ModalAnalysis &a)
+  : ModalSuperposition(a), zeta(omega.Size()), lastCorrection(nullptr)
+  {
+    setDampingRatio(0.05);
+    loadVector.resize(phi.noRows());
+    influence.resize(phi.noRows());
+  }
+
+//! @brief Sets the damping ratio of each mode.
+void XC::ModalTimeHistory::setDampingRatios(const Vector &z)
+  {
+    const int nm= getNumModes();
+    if(z.Size()<nm)
+      std::cerr << nombre_clase() << "::" << __FUNCTION__
+                << "; " << nm << " damping ratios expected, got: "
+                << z.Size() << std::endl;
+    else
+      for(int i= 0;i<nm;i++)
+        zeta(i)= z(i);
+  }
+
+//! @brief Sets the same damping ratio for all modes.
+void XC::ModalTimeHistory::setDampingRatio(const double &z)
+  {
+    for(int i= 0;i<zeta.Size();i++)
+      zeta(i)= z;
+  }
+
+//! @brief Adds a load on the node (spatial distribution of the loads
+//! whose time variation is given in computeLoadResponse).
+int XC::ModalTimeHistory::addNodalLoad(const int &nodeTag,const Vector &load)
+  {
+    int retval= 0;
+    for(int j= 0;j<load.Size();j++)
+      {
+        const int eq= get_eq(nodeTag,j);
+        if(eq>=0)
+          loadVector(eq)+= load(j);
+        else
+          retval--;
+      }
+    return retval;
+  }
+
+//! @brief Removes the loads.
+void XC::ModalTimeHistory::clearLoads(void)
+  {
+    loadVector.Zero();
+    loadCorrection.resize(0);
+  }
+
+//! @brief Sets the direction of the ground motion (one component
+//! for each node DOF, i. e. [1,0,0] for an horizontal motion
+//! in a 2D frame).
+int XC::ModalTimeHistory::setGroundMotionDirection(const Vector &dir)
+  {
+    influence= get_influence(dir);
+    groundCorrection.resize(0);
+    return 0;
+  }
+
+//! @brief Returns the modal loads for an unit load factor.
+XC::Vector XC::ModalTimeHistory::getModalLoadFactors(void) const
+  {
+    const int nm= getNumModes();
+    const int numEqn= phi.noRows();
+    Vector retval(nm);
+    for(int i= 0;i<nm;i++)
+      for(int j= 0;j<numEqn;j++)
+        retval(i)+= phi(j,i)*loadVector(j);
+    return retval;
+  }
+
+//! @brief Returns the modal loads for an unit ground acceleration
+//! (minus the modal participation factors in the ground motion
+//! direction).
+XC::Vector XC::ModalTimeHistory::getModalGroundMotionFactors(void) const
+  {
+    const int nm= getNumModes();
+    const int numEqn= phi.noRows();
+    const Vector Mr= mass_prod(influence);
+    Vector retval(nm);
+    for(int i= 0;i<nm;i++)
+      {
+        for(int j= 0;j<numEqn;j++)
+          retval(i)-= phi(j,i)*Mr(j);
+      }
+    return retval;
+  }
+
+//! @brief Adds a DOF to the list of DOFs whose response
+//! will be computed.
+int XC::ModalTimeHistory::addRecordedDOF(const int &nodeTag,const int &dof)
+  {
+    recordedEqs.push_back(get_eq(nodeTag,dof));
+    return recordedEqs.size()-1;
+  }
+
+//! @brief Clears the list of recorded DOFs.
+void XC::ModalTimeHistory::clearRecordedDOFs(void)
+  { recordedEqs.clear(); }
+
+//! @brief Returns the part of the static response (us) to the
+//! load (p) that isn't represented by the computed modes.
+XC::Vector XC::ModalTimeHistory::static_correction(const Vector &us,const Vector &p) const
+  {
+    Vector retval(us);
+    const int nm= getNumModes();
+    const int numEqn= phi.noRows();
+    for(int i= 0;i<nm;i++)
+      {
+        double fp= 0.0;
+        for(int j= 0;j<numEqn;j++)
+          fp+= phi(j,i)*p(j);
+        const double f= fp/(omega(i)*omega(i));
+        for(int j= 0;j<numEqn;j++)
+          retval(j)-= f*phi(j,i);
+      }
+    return retval;
+  }
+
+//! @brief Takes the current displacement of the nodes as
+//! the static response to the loads defined with addNodalLoad
+//! and computes the static correction for the truncated modes.
+int XC::ModalTimeHistory::setLoadStaticResponse(void)
+  {
+    loadCorrection= static_correction(get_node_values(),loadVector);
+    return 0;
+  }
+
+//! @brief Takes the current displacement of the nodes as the static
+//! response to the loads M*r (inertia forces that correspond to an
+//! unit acceleration in the ground motion direction) and computes
+//! the static correction for the truncated modes.
+int XC::ModalTimeHistory::setGroundMotionStaticResponse(void)
+  {
+    groundCorrection= static_correction(get_node_values(),mass_prod(influence));
+    groundCorrection*= -1.0;
+    return 0;
+  }
+
+//! @brief Removes the static corrections.
+void XC::ModalTimeHistory::clearStaticCorrection(void)
+  {
+    loadCorrection.resize(0);
+    groundCorrection.resize(0);
+  }
+
+//! @brief Integrates the modal equations.
+//!
+//! @param exc: excitation histories (one record by row).
+//! @param g: modal loads for an unit excitation.
+//! @param dt: time step of the records.
+//! @param corr: static correction for an unit excitation (may be empty).
+//! @param out: responses at the recorded DOFs (one matrix (steps x DOFs) for each record).
+//! @param qHist: if not null, modal displacements for the first record.
+int XC::ModalTimeHistory::integrate(const Matrix &exc,const Vector &g,const double &dt,const Vector &corr,std::vector<Matrix> &out,Matrix *qHist)
+  {
+    const int nm= getNumModes();
+    const int nRec= exc.noRows();
+    const int nSteps= exc.noCols();
+    const int nDOFs= recordedEqs.size();
+    if(dt<=0.0)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; wrong time step: " << dt << std::endl;
+        return -1;
+      }
+    // Coefficients of the recurrence (Chopra, Dynamics of structures, table 5.2.1),
+    // unit modal mass.
+    std::vector<double> A(nm), B(nm), C(nm), D(nm), Ap(nm), Bp(nm), Cp(nm), Dp(nm);
+    for(int i= 0;i<nm;i++)
+      {
+        const double w= omega(i);
+        const double z= zeta(i);
+        if((w<=0.0) || (z<0.0) || (z>=1.0))
+          {
+            std::cerr << nombre_clase() << "::" << __FUNCTION__
+                      << "; mode: " << i+1 << " with angular frequency: " << w
+                      << " and damping ratio: " << z << " can't be integrated.\n";
+            return -2;
+          }
+        const double k= w*w;
+        const double sq= sqrt(1.0-z*z);
+        const double wd= w*sq;
+        const double e= exp(-z*w*dt);
+        const double s= sin(wd*dt);
+        const double c= cos(wd*dt);
+        A[i]= e*(z/sq*s+c);
+        B[i]= e*s/wd;
+        C[i]= (2.0*z/(w*dt)+e*(((1.0-2.0*z*z)/(wd*dt)-z/sq)*s-(1.0+2.0*z/(w*dt))*c))/k;
+        D[i]= (1.0-2.0*z/(w*dt)+e*((2.0*z*z-1.0)/(wd*dt)*s+2.0*z/(w*dt)*c))/k;
+        Ap[i]= -e*w/sq*s;
+        Bp[i]= e*(c-z/sq*s);
+        Cp[i]= (-1.0/dt+e*((w/sq+z/(dt*sq))*s+c/dt))/k;
+        Dp[i]= (1.0-e*(z/sq*s+c))/(k*dt);
+      }
+    // Modes and static correction at the recorded DOFs.
+    Matrix phiRec(nDOFs,nm);
+    std::vector<double> corrRec(nDOFs,0.0);
+    for(int j= 0;j<nDOFs;j++)
+      {
+        const int eq= recordedEqs[j];
+        if(eq>=0)
+          {
+            for(int i= 0;i<nm;i++)
+              phiRec(j,i)= phi(eq,i);
+            if(corr.Size()>eq)
+              corrRec[j]= corr(eq);
+          }
+      }
+    std::vector<double> q(nRec*nm,0.0), qd(nRec*nm,0.0);
+    out.assign(nRec,Matrix(nSteps,nDOFs));
+    if(qHist)
+      qHist->resize(nSteps,nm);
+    for(int k= 0;k<nSteps;k++)
+      {
+        if(k>0)
+          for(int r= 0;r<nRec;r++)
+            {
+              const double e0= exc(r,k-1);
+              const double e1= exc(r,k);
+              double *qr= &q[r*nm];
+              double *qdr= &qd[r*nm];
+              for(int i= 0;i<nm;i++)
+                {
+                  const double p0= g(i)*e0;
+                  const double p1= g(i)*e1;
+                  const double qi= qr[i];
+                  const double qdi= qdr[i];
+                  qr[i]= A[i]*qi+B[i]*qdi+C[i]*p0+D[i]*p1;
+                  qdr[i]= Ap[i]*qi+Bp[i]*qdi+Cp[i]*p0+Dp[i]*p1;
+                }
+            }
+        for(int r= 0;r<nRec;r++)
+          {
+            const double *qr= &q[r*nm];
+            Matrix &o= out[r];
+            for(int j= 0;j<nDOFs;j++)
+              {
+                double s= corrRec[j]*exc(r,k);
+                for(int i= 0;i<nm;i++)
+                  s+= phiRec(j,i)*qr[i];
+                o(k,j)= s;
+              }
+          }
+        if(qHist)
+          for(int i= 0;i<nm;i++)
+            (*qHist)(k,i)= q[i];
+      }
+    return 0;
+  }
+
+//! @brief Computes the response to the loads defined with
+//! addNodalLoad multiplied by the load factors argument.
+//!
+//! @param f: load factors (sampled each dt, linear in between).
+//! @param dt: time step.
+//! @return displacements of the recorded DOFs (steps x DOFs).
+XC::Matrix XC::ModalTimeHistory::computeLoadResponse(const Vector &f,const double &dt)
+  {
+    Matrix exc(1,f.Size());
+    for(int k= 0;k<f.Size();k++)
+      exc(0,k)= f(k);
+    std::vector<Matrix> out;
+    integrate(exc,getModalLoadFactors(),dt,loadCorrection,out,&modalHistory);
+    excitationHistory= f;
+    lastCorrection= &loadCorrection;
+    Matrix retval;
+    if(!out.empty())
+      retval= out[0];
+    return retval;
+  }
+
+//! @brief Computes the response (relative to the ground) to the
+//! ground acceleration record.
+//!
+//! @param ag: ground accelerations (sampled each dt, linear in between).
+//! @param dt: time step.
+//! @return displacements of the recorded DOFs (steps x DOFs).
+XC::Matrix XC::ModalTimeHistory::computeGroundMotionResponse(const Vector &ag,const double &dt)
+  {
+    Matrix exc(1,ag.Size());
+    for(int k= 0;k<ag.Size();k++)
+      exc(0,k)= ag(k);
+    std::vector<Matrix> out;
+    integrate(exc,getModalGroundMotionFactors(),dt,groundCorrection,out,&modalHistory);
+    excitationHistory= ag;
+    lastCorrection= &groundCorrection;
+    Matrix retval;
+    if(!out.empty())
+      retval= out[0];
+    return retval;
+  }
+
+//! @brief Computes the responses (relative to the ground) to
+//! several ground acceleration records at once.
+//!
+//! @param records: ground accelerations (one record by row, all sampled each dt).
+//! @param dt: time step.
+//! @return displacements of the recorded DOFs for each record (steps x DOFs).
+std::vector<XC::Matrix> XC::ModalTimeHistory::computeGroundMotionResponses(const Matrix &records,const double &dt)
+  {
+    std::vector<Matrix> retval;
+    integrate(records,getModalGroundMotionFactors(),dt,groundCorrection,retval,nullptr);
+    return retval;
+  }
+
+//! @brief Python version of computeGroundMotionResponses.
+boost::python::list XC::ModalTimeHistory::computeGroundMotionResponsesPy(const Matrix &records,const double &dt)
+  {
+    boost::python::list retval;
+    const std::vector<Matrix> tmp= computeGroundMotionResponses(records,dt);
+    for(std::vector<Matrix>::const_iterator i= tmp.begin();i!=tmp.end();i++)
+      retval.append(*i);
+    return retval;
+  }
+
+//! @brief Puts the displacements that correspond to the step argument
+//! of the last computation (computeLoadResponse or
+//! computeGroundMotionResponse) on the nodes and updates the
+//! elements, so their response can be obtained.
+int XC::ModalTimeHistory::setDomainResponse(const int &step)
+  {
+    const int nm= getNumModes();
+    if((step<0) || (step>=modalHistory.noRows()))
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; step: " << step << " out of range [0,"
+                  << modalHistory.noRows() << ").\n";
+        return -1;
+      }
+    const int numEqn= phi.noRows();
+    Vector u(numEqn);
+    for(int i= 0;i<nm;i++)
+      {
+        const double qi= modalHistory(step,i);
+        for(int j= 0;j<numEqn;j++)
+          u(j)+= phi(j,i)*qi;
+      }
+    if(lastCorrection && (lastCorrection->Size()==numEqn))
+      u.addVector(1.0,*lastCorrection,excitationHistory(step));
+    set_node_values(u);
+    return get_domain()->update();
+  }
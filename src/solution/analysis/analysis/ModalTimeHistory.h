@@ -0,0 +1,99 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ModalTimeHistory.h
+
+#ifndef ModalTimeHistory_h
+#define ModalTimeHistory_h
+
+#include "ModalSuperposition.h"
+#include <vector>
+#include <boost/python/list.hpp>
+
+namespace XC {
+
+//! @ingroup AnalysisType
+//
+//! @brief Linear time history analysis by modal superposition,
+//! reusing the eigenpairs computed by a modal analysis.
+//!
+//! The loads (spatial distribution times a load factor history) or
+//! the ground accelerations (influence vector times the record) are
+//! projected on the computed modes and the uncoupled modal equations
+//! are integrated exactly for piecewise-linear excitation
+//! (Nigam-Jennings recurrence). The responses are recovered only
+//! at the recorded DOFs (and at the domain on demand). The
+//! contribution of the truncated modes can be added through a
+//! static correction.
+class ModalTimeHistory: public ModalSuperposition
+  {
+  private:
+    Vector zeta; //!< damping ratios.
+    Vector loadVector; //!< spatial distribution of the load.
+    Vector influence; //!< ground motion influence vector.
+    Vector loadCorrection; //!< static correction for the loads.
+    Vector groundCorrection; //!< static correction for the ground motion.
+    std::vector<int> recordedEqs; //!< equation numbers of the recorded DOFs.
+    Matrix modalHistory; //!< modal displacements of the last computation (steps x modes).
+    Vector excitationHistory; //!< excitation of the last computation.
+    const Vector *lastCorrection; //!< static correction of the last computation.
+
+    Vector static_correction(const Vector &,const Vector &) const;
+    int integrate(const Matrix &,const Vector &,const double &,const Vector &,std::vector<Matrix> &,Matrix *);
+  public:
+    ModalTimeHistory(ModalAnalysis &);
+
+    inline const Vector &getDampingRatios(void) const
+      { return zeta; }
+    void setDampingRatios(const Vector &);
+    void setDampingRatio(const double &);
+
+    int addNodalLoad(const int &,const Vector &);
+    void clearLoads(void);
+    int setGroundMotionDirection(const Vector &);
+    Vector getModalLoadFactors(void) const;
+    Vector getModalGroundMotionFactors(void) const;
+
+    int addRecordedDOF(const int &,const int &);
+    void clearRecordedDOFs(void);
+    inline int getNumRecordedDOFs(void) const
+      { return recordedEqs.size(); }
+
+    int setLoadStaticResponse(void);
+    int setGroundMotionStaticResponse(void);
+    void clearStaticCorrection(void);
+
+    Matrix computeLoadResponse(const Vector &,const double &);
+    Matrix computeGroundMotionResponse(const Vector &,const double &);
+    std::vector<Matrix> computeGroundMotionResponses(const Matrix &,const double &);
+    boost::python::list computeGroundMotionResponsesPy(const Matrix &,const double &);
+    inline const Matrix &getModalDisplacements(void) const
+      { return modalHistory; }
+    int setDomainResponse(const int &);
+  };
+} // end of XC namespace
+
+#endif
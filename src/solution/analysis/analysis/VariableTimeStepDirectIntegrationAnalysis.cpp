@@ -134,7 +134,10 @@ int XC::VariableTimeStepDirectIntegrationAnalysis::analyze(int numSteps, double
         // othewise revert the XC::Domain to last committed state & see if can go on
 
         if(result >= 0) 
-          currentTimeIncr += currentDt;
+          {
+            currentTimeIncr += currentDt;
+            checkpoint_step();
+          }
         else
           {
             // invoke the revertToLastCommit
@@ -30,13 +30,17 @@
 #include "solution/analysis/analysis/StaticAnalysis.h"
 #include "solution/analysis/analysis/DomainDecompositionAnalysis.h"
 #include "solution/analysis/analysis/DirectIntegrationAnalysis.h"
+#include "solution/analysis/analysis/ExplicitDynamicsAnalysis.h"
 #include "solution/analysis/analysis/LinearBucklingAnalysis.h"
 #include "solution/analysis/analysis/EigenAnalysis.h"
 #include "solution/analysis/analysis/ModalAnalysis.h"
+#include "solution/analysis/analysis/ModalTimeHistory.h"
+#include "solution/analysis/analysis/ModalResponseSpectrum.h"
 //#include "solution/analysis/analysis/SubdomainAnalysis.h"
 //#include "solution/analysis/analysis/SubstructuringAnalysis.h"
 #include "solution/analysis/analysis/TransientAnalysis.h"
 #include "solution/analysis/analysis/VariableTimeStepDirectIntegrationAnalysis.h"
+#include "solution/analysis/analysis/AdaptiveTimeStepDirectIntegrationAnalysis.h"
 
 #ifdef _PARALLEL_PROCESSING
 #include "solution/analysis/analysis/StaticDomainDecompositionAnalysis.h"
@@ -78,15 +78,89 @@ class_<XC::ModalAnalysis , bases<XC::EigenAnalysis>, boost::noncopyable >("Modal
   .def("getCQCModalCrossCorrelationCoefficients",&XC::ModalAnalysis::getCQCModalCrossCorrelationCoefficients,"Returns CQC correlation coefficients.")
   ;
 
+class_<XC::ModalSuperposition, bases<EntCmd>, boost::noncopyable >("ModalSuperposition", no_init)
+  .add_property("numModes",&XC::ModalSuperposition::getNumModes,"Number of modes.")
+  .def("getAngularFrequencies",make_function(&XC::ModalSuperposition::getAngularFrequencies,return_internal_reference<>()),"Returns the angular frequencies.")
+  .def("getModes",make_function(&XC::ModalSuperposition::getModes,return_internal_reference<>()),"Returns the modes (by columns) normalized to unit modal mass.")
+  ;
+
+class_<XC::ModalTimeHistory, bases<XC::ModalSuperposition>, boost::noncopyable >("ModalTimeHistory", init<XC::ModalAnalysis &>())
+  .add_property("dampingRatios", make_function(&XC::ModalTimeHistory::getDampingRatios,return_internal_reference<>()),&XC::ModalTimeHistory::setDampingRatios,"Damping ratio of each mode.")
+  .def("setDampingRatio",&XC::ModalTimeHistory::setDampingRatio,"Sets the same damping ratio for all modes.")
+  .def("addNodalLoad",&XC::ModalTimeHistory::addNodalLoad,"addNodalLoad(nodeTag,load): adds a load to the spatial distribution of the loads.")
+  .def("clearLoads",&XC::ModalTimeHistory::clearLoads,"Removes the loads.")
+  .def("setGroundMotionDirection",&XC::ModalTimeHistory::setGroundMotionDirection,"setGroundMotionDirection(dir): sets the ground motion direction (one component for each node DOF).")
+  .def("getModalLoadFactors",&XC::ModalTimeHistory::getModalLoadFactors,"Returns the modal loads for an unit load factor.")
+  .def("getModalGroundMotionFactors",&XC::ModalTimeHistory::getModalGroundMotionFactors,"Returns the modal loads for an unit ground acceleration.")
+  .def("addRecordedDOF",&XC::ModalTimeHistory::addRecordedDOF,"addRecordedDOF(nodeTag,dof): adds a DOF to the list of recorded DOFs and returns its index.")
+  .def("clearRecordedDOFs",&XC::ModalTimeHistory::clearRecordedDOFs,"Clears the list of recorded DOFs.")
+  .add_property("numRecordedDOFs",&XC::ModalTimeHistory::getNumRecordedDOFs,"Number of recorded DOFs.")
+  .def("setLoadStaticResponse",&XC::ModalTimeHistory::setLoadStaticResponse,"Takes the current node displacements as the static response to the loads (static correction).")
+  .def("setGroundMotionStaticResponse",&XC::ModalTimeHistory::setGroundMotionStaticResponse,"Takes the current node displacements as the static response to the loads M*r (static correction).")
+  .def("clearStaticCorrection",&XC::ModalTimeHistory::clearStaticCorrection,"Removes the static corrections.")
+  .def("computeLoadResponse",&XC::ModalTimeHistory::computeLoadResponse,"computeLoadResponse(factors,dt): returns the displacements of the recorded DOFs (steps x DOFs).")
+  .def("computeGroundMotionResponse",&XC::ModalTimeHistory::computeGroundMotionResponse,"computeGroundMotionResponse(accel,dt): returns the displacements of the recorded DOFs (steps x DOFs).")
+  .def("computeGroundMotionResponses",&XC::ModalTimeHistory::computeGroundMotionResponsesPy,"computeGroundMotionResponses(records,dt): returns a list with the displacements of the recorded DOFs for each record (one record by row).")
+  .def("getModalDisplacements",make_function(&XC::ModalTimeHistory::getModalDisplacements,return_internal_reference<>()),"Returns the modal displacements of the last computation (steps x modes).")
+  .def("setDomainResponse",&XC::ModalTimeHistory::setDomainResponse,"setDomainResponse(step): puts the displacements of the step on the nodes and updates the domain.")
+  ;
+
+class_<XC::ModalResponseSpectrum, bases<XC::ModalSuperposition>, boost::noncopyable >("ModalResponseSpectrum", init<XC::ModalAnalysis &>())
+  .add_property("dampingRatios", make_function(&XC::ModalResponseSpectrum::getDampingRatios,return_internal_reference<>()),&XC::ModalResponseSpectrum::setDampingRatios,"Damping ratio of each mode (used by the CQC rule).")
+  .def("setDampingRatio",&XC::ModalResponseSpectrum::setDampingRatio,"Sets the same damping ratio for all modes.")
+  .def("addSpectrum",&XC::ModalResponseSpectrum::addSpectrum,"addSpectrum(spectrum,dir): adds a spectrum (acceleration as function of the period) acting in the direction argument (one component for each node DOF). Returns its index.")
+  .def("clearSpectra",&XC::ModalResponseSpectrum::clearSpectra,"Removes the spectra.")
+  .add_property("numSpectra",&XC::ModalResponseSpectrum::getNumSpectra,"Number of spectra.")
+  .def("getSpectralAccelerations",&XC::ModalResponseSpectrum::getSpectralAccelerations,"getSpectralAccelerations(i): spectral acceleration of each mode for the i-th spectrum.")
+  .def("getModalAmplitudes",&XC::ModalResponseSpectrum::getModalAmplitudes,"getModalAmplitudes(i): peak displacement of each unit mass normalized mode for the i-th spectrum.")
+  .add_property("modalCombination",&XC::ModalResponseSpectrum::getModalCombination,&XC::ModalResponseSpectrum::setModalCombination,"Modal combination rule: SRSS, CQC or ABS.")
+  .add_property("directionalCombination",&XC::ModalResponseSpectrum::getDirectionalCombination,&XC::ModalResponseSpectrum::setDirectionalCombination,"Directional combination rule: SRSS or percentage.")
+  .add_property("directionalFactor",make_function(&XC::ModalResponseSpectrum::getDirectionalFactor,return_value_policy<copy_const_reference>()),&XC::ModalResponseSpectrum::setDirectionalFactor,"Factor for the percentage rule (0.3 for 100/30/30).")
+  .def("analyze",&XC::ModalResponseSpectrum::analyze,"Computes the combined response.")
+  .def("getNodeDisplacement",&XC::ModalResponseSpectrum::getNodeDisplacement,"getNodeDisplacement(tag): combined displacement of the node.")
+  .def("getNodeReaction",&XC::ModalResponseSpectrum::getNodeReaction,"getNodeReaction(tag): combined reaction of the node.")
+  .def("getElementResistingForce",&XC::ModalResponseSpectrum::getElementResistingForce,"getElementResistingForce(tag): combined resisting force of the element.")
+  ;
+
 
 //class_<XC::SubdomainAnalysis, bases<XC::Analysis, XC::MovableObject>, boost::noncopyable >("SubdomainAnalysis", no_init);
 
 class_<XC::TransientAnalysis, bases<XC::Analysis>, boost::noncopyable >("TransientAnalysis", no_init);
 
-class_<XC::DirectIntegrationAnalysis, bases<XC::TransientAnalysis>, boost::noncopyable >("DirectIntegrationAnalysis", no_init);
+class_<XC::DirectIntegrationAnalysis, bases<XC::TransientAnalysis>, boost::noncopyable >("DirectIntegrationAnalysis", no_init)
+  .def("setCheckpoint", &XC::DirectIntegrationAnalysis::setCheckpoint,"setCheckpoint(fileName,period) writes the state of the domain and the integrator to a compressed file each period steps (0: no checkpoints).")
+  .add_property("checkpointFile", make_function(&XC::DirectIntegrationAnalysis::getCheckpointFile,return_value_policy<copy_const_reference>()),"Name of the checkpoint file.")
+  .add_property("checkpointPeriod", &XC::DirectIntegrationAnalysis::getCheckpointPeriod,"Number of steps between checkpoints.")
+  .add_property("numCommittedSteps", &XC::DirectIntegrationAnalysis::getNumCommittedSteps,"Number of steps committed by the analysis.")
+  .def("writeCheckpoint", &XC::DirectIntegrationAnalysis::writeCheckpoint,"Writes the checkpoint now.")
+  .def("restart", &XC::DirectIntegrationAnalysis::restart,"Restores the state stored in the checkpoint file; returns the number of committed steps at the checkpoint.")
+  ;
+
+class_<XC::ExplicitDynamicsAnalysis, bases<XC::TransientAnalysis>, boost::noncopyable >("ExplicitDynamicsAnalysis", no_init)
+  .def("analyze", &XC::ExplicitDynamicsAnalysis::analyze,"analyze(numSteps,dT) performs the analysis.")
+  .add_property("alphaM", &XC::ExplicitDynamicsAnalysis::getAlphaM, &XC::ExplicitDynamicsAnalysis::setAlphaM,"Mass proportional damping factor.")
+  .add_property("safetyFactor", &XC::ExplicitDynamicsAnalysis::getSafetyFactor, &XC::ExplicitDynamicsAnalysis::setSafetyFactor,"Factor applied to the stable time step.")
+  .def("computeStableTimeStep", &XC::ExplicitDynamicsAnalysis::computeStableTimeStep,"Computes the stable time step with the current stiffness.")
+  .def("getStableTimeStep", &XC::ExplicitDynamicsAnalysis::getStableTimeStep,"Returns the stable time step.")
+  .def("getNumSubsteps", &XC::ExplicitDynamicsAnalysis::getNumSubsteps,"Returns the number of substeps used in the last step.")
+  .def("getLumpedInverseMass", make_function(&XC::ExplicitDynamicsAnalysis::getLumpedInverseMass, return_internal_reference<>()),"Returns the inverse of the lumped mass.")
+  ;
 
 class_<XC::VariableTimeStepDirectIntegrationAnalysis, bases<XC::DirectIntegrationAnalysis>, boost::noncopyable >("VariableTimeStepDirectIntegrationAnalysis", no_init);
 
+class_<XC::AdaptiveTimeStepDirectIntegrationAnalysis, bases<XC::DirectIntegrationAnalysis>, boost::noncopyable >("AdaptiveTimeStepDirectIntegrationAnalysis", no_init)
+  .def("analyze", &XC::AdaptiveTimeStepDirectIntegrationAnalysis::analyze,"analyze(numSteps,dT,dtMin,dtMax) performs the analysis until time numSteps*dT.")
+  .add_property("relTol", make_function(&XC::AdaptiveTimeStepDirectIntegrationAnalysis::getRelTol,return_value_policy<copy_const_reference>()), &XC::AdaptiveTimeStepDirectIntegrationAnalysis::setRelTol,"Relative tolerance for the local error.")
+  .add_property("absTol", make_function(&XC::AdaptiveTimeStepDirectIntegrationAnalysis::getAbsTol,return_value_policy<copy_const_reference>()), &XC::AdaptiveTimeStepDirectIntegrationAnalysis::setAbsTol,"Absolute tolerance for the local error.")
+  .add_property("safetyFactor", make_function(&XC::AdaptiveTimeStepDirectIntegrationAnalysis::getSafetyFactor,return_value_policy<copy_const_reference>()), &XC::AdaptiveTimeStepDirectIntegrationAnalysis::setSafetyFactor,"Safety factor of the step size controller.")
+  .add_property("minFactor", make_function(&XC::AdaptiveTimeStepDirectIntegrationAnalysis::getMinFactor,return_value_policy<copy_const_reference>()), &XC::AdaptiveTimeStepDirectIntegrationAnalysis::setMinFactor,"Minimum ratio between consecutive time steps.")
+  .add_property("maxFactor", make_function(&XC::AdaptiveTimeStepDirectIntegrationAnalysis::getMaxFactor,return_value_policy<copy_const_reference>()), &XC::AdaptiveTimeStepDirectIntegrationAnalysis::setMaxFactor,"Maximum ratio between consecutive time steps.")
+  .add_property("excitationDt", make_function(&XC::AdaptiveTimeStepDirectIntegrationAnalysis::getExcitationDt,return_value_policy<copy_const_reference>()), &XC::AdaptiveTimeStepDirectIntegrationAnalysis::setExcitationDt,"Sampling interval of the ground motion records (the steps end at the sampling instants).")
+  .def("getNumAcceptedSteps", &XC::AdaptiveTimeStepDirectIntegrationAnalysis::getNumAcceptedSteps,"Returns the number of accepted steps.")
+  .def("getNumRejectedSteps", &XC::AdaptiveTimeStepDirectIntegrationAnalysis::getNumRejectedSteps,"Returns the number of rejected steps.")
+  .def("getLastTimeStep", make_function(&XC::AdaptiveTimeStepDirectIntegrationAnalysis::getLastTimeStep,return_value_policy<copy_const_reference>()),"Returns the last accepted time step.")
+  ;
+
 #ifdef _PARALLEL_PROCESSING
 class_<XC::DomainDecompositionAnalysis, bases<XC::Analysis, XC::MovableObject>, boost::noncopyable >("DomainDecompositionAnalysis", no_init);
 
@@ -106,6 +106,8 @@ int XC::CTestEnergyIncr::test(void)
     if(currentIter <= maxNumIter) 
       norms(currentIter-1)= calculatedEnergyProduct;
     
+    record_iteration(); // telemetry (if enabled).
+
     // print the data if required
     if(printFlag)
       std::clog << getStatusMsg(printFlag);
@@ -110,6 +110,8 @@ int XC::CTestFixedNumIter::test(void)
     if(currentIter <= maxNumIter) 
       norms(currentIter-1)= calculatedEnergyProduct;
 
+    record_iteration(); // telemetry (if enabled).
+
     // print the data if required
     if(printFlag)
       std::clog << getStatusMsg(printFlag);
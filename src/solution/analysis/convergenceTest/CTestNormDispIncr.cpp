@@ -96,6 +96,8 @@ int XC::CTestNormDispIncr::test(void)
     if(currentIter <= maxNumIter) 
       norms(currentIter-1)= calculatedNormX;
     
+    record_iteration(); // telemetry (if enabled).
+
     // print the data if required
     if(printFlag)
       std::clog << getStatusMsg(printFlag);
@@ -102,6 +102,8 @@ int XC::CTestNormUnbalance::test(void)
         if(currentIter <= maxNumIter) 
           norms(currentIter-1)= calculatedNormB;
     
+        record_iteration(); // telemetry (if enabled).
+
         // print the data if required
 	if(printFlag)
           std::clog << getStatusMsg(printFlag) << std::endl;
@@ -114,6 +114,8 @@ int XC::CTestRelativeEnergyIncr::test(void)
     if(norm0 != 0.0)
       lastRatio /= norm0;
     
+    record_iteration(); // telemetry (if enabled).
+
     // print the data if required
     if(printFlag)
       std::clog << getStatusMsg(printFlag);
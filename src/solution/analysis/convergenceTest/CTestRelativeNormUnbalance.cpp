@@ -103,6 +103,8 @@ int XC::CTestRelativeNormUnbalance::test(void)
     if(norm0 != 0.0)
       lastRatio/= norm0;
     
+    record_iteration(); // telemetry (if enabled).
+
     // print the data if required
     if(printFlag)
       std::clog << getStatusMsg(printFlag);
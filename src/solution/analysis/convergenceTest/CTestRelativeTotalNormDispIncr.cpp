@@ -113,6 +113,8 @@ int XC::CTestRelativeTotalNormDispIncr::test(void)
     if(norm0 != 0.0)
       lastRatio/= norm0;
     
+    record_iteration(); // telemetry (if enabled).
+
     // print the data if required
     if(printFlag)
       std::clog << getStatusMsg(printFlag);
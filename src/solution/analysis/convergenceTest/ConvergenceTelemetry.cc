@@ -0,0 +1,345 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ConvergenceTelemetry.cc
+
+#include "ConvergenceTelemetry.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+#include <iostream>
+
+//! @brief Constructor.
+XC::IterationTelemetry::IterationTelemetry(void)
+  : step(0), iteration(0), normX(0.0), normB(0.0), energy(0.0), ratio(0.0),
+    actions(0), lineSearchEta(1.0), factorTime(0.0), solveTime(0.0),
+    numFailedElements(0) {}
+
+//! @brief Resets the data reported by the algorithm.
+void XC::IterationTelemetry::clearActions(void)
+  {
+    actions= 0;
+    lineSearchEta= 1.0;
+    factorTime= 0.0;
+    solveTime= 0.0;
+  }
+
+//! @brief Constructor.
+XC::ConvergenceTelemetry::ConvergenceTelemetry(EntCmd *owr)
+  : EntCmd(owr), enabled(false), capacity(1000), first(0), numRecords(0),
+    numSteps(0), outputFile(nullptr) {}
+
+//! @brief Copy constructor (the output file is not shared).
+XC::ConvergenceTelemetry::ConvergenceTelemetry(const ConvergenceTelemetry &other)
+  : EntCmd(other), enabled(other.enabled), capacity(other.capacity),
+    records(other.records), first(other.first), numRecords(other.numRecords),
+    numSteps(other.numSteps), pending(other.pending), outputFile(nullptr) {}
+
+//! @brief Assignment operator (the output file is not shared).
+XC::ConvergenceTelemetry &XC::ConvergenceTelemetry::operator=(const ConvergenceTelemetry &other)
+  {
+    EntCmd::operator=(other);
+    close_file();
+    enabled= other.enabled;
+    capacity= other.capacity;
+    records= other.records;
+    first= other.first;
+    numRecords= other.numRecords;
+    numSteps= other.numSteps;
+    pending= other.pending;
+    return *this;
+  }
+
+//! @brief Destructor.
+XC::ConvergenceTelemetry::~ConvergenceTelemetry(void)
+  { close_file(); }
+
+//! @brief Closes the output file (if any).
+void XC::ConvergenceTelemetry::close_file(void)
+  {
+    if(outputFile)
+      {
+        outputFile->close();
+        delete outputFile;
+        outputFile= nullptr;
+      }
+    fileName.clear();
+  }
+
+//! @brief Enables or disables the recording of the iterations.
+void XC::ConvergenceTelemetry::setEnabled(const bool &b)
+  { enabled= b; }
+
+//! @brief Returns the maximum number of records stored.
+size_t XC::ConvergenceTelemetry::getCapacity(void) const
+  { return capacity; }
+
+//! @brief Sets the maximum number of records stored (the stored records
+//! are discarded).
+void XC::ConvergenceTelemetry::setCapacity(const size_t &sz)
+  {
+    capacity= sz;
+    clear();
+  }
+
+//! @brief Returns the name of the output file.
+const std::string &XC::ConvergenceTelemetry::getFileName(void) const
+  { return fileName; }
+
+//! @brief Sets the name of the file where the records are written
+//! as they are produced (an empty string closes the current file).
+void XC::ConvergenceTelemetry::setFileName(const std::string &nmb)
+  {
+    close_file();
+    if(!nmb.empty())
+      {
+        outputFile= new std::ofstream(nmb.c_str());
+        if(outputFile->good())
+          {
+            fileName= nmb;
+            (*outputFile) << "step iteration normX normB energy ratio"
+                          << " actions lineSearchEta factorTime solveTime"
+                          << " numFailedElements" << std::endl;
+          }
+        else
+          {
+            std::cerr << nombre_clase() << "::" << __FUNCTION__
+                      << "; can't open file: '" << nmb << "'.\n";
+            close_file();
+          }
+      }
+  }
+
+//! @brief Discards the stored records.
+void XC::ConvergenceTelemetry::clear(void)
+  {
+    records.clear();
+    first= 0;
+    numRecords= 0;
+    numSteps= 0;
+    pending= IterationTelemetry();
+  }
+
+//! @brief Notifies the start of a new step (the actions reported since
+//! the last iteration are kept, they belong to the first iteration of
+//! the new step).
+void XC::ConvergenceTelemetry::newStep(void)
+  {
+    if(enabled)
+      numSteps++;
+  }
+
+//! @brief Adds an action (see Action enum) to the iteration in progress.
+void XC::ConvergenceTelemetry::addAction(const int &a)
+  {
+    if(enabled)
+      pending.actions|= a;
+  }
+
+//! @brief Sets the line search parameter of the iteration in progress.
+void XC::ConvergenceTelemetry::setLineSearchEta(const double &eta)
+  {
+    if(enabled)
+      {
+        pending.actions|= LINE_SEARCH;
+        pending.lineSearchEta= eta;
+      }
+  }
+
+//! @brief Adds time spent solving the system with a new tangent.
+void XC::ConvergenceTelemetry::addFactorTime(const double &t)
+  {
+    if(enabled)
+      pending.factorTime+= t;
+  }
+
+//! @brief Adds time spent solving the system with a factored tangent.
+void XC::ConvergenceTelemetry::addSolveTime(const double &t)
+  {
+    if(enabled)
+      pending.solveTime+= t;
+  }
+
+//! @brief Stores the data of the iteration that has just finished.
+//!
+//! @param iter: iteration number.
+//! @param nX: norm of the solution vector.
+//! @param nB: norm of the right hand side.
+//! @param e: energy increment.
+//! @param r: last ratio computed by the convergence test.
+//! @param nFailed: number of elements that failed in the last update.
+void XC::ConvergenceTelemetry::newIteration(const int &iter,const double &nX,const double &nB,const double &e,const double &r,const int &nFailed)
+  {
+    if(enabled && (capacity>0))
+      {
+        pending.step= numSteps;
+        pending.iteration= iter;
+        pending.normX= nX;
+        pending.normB= nB;
+        pending.energy= e;
+        pending.ratio= r;
+        pending.numFailedElements= nFailed;
+        if(records.size()<capacity)
+          records.push_back(pending);
+        else
+          {
+            records[(first+numRecords)%capacity]= pending;
+            if(numRecords==capacity)
+              first= (first+1)%capacity;
+          }
+        if(numRecords<capacity)
+          numRecords++;
+        if(outputFile)
+          write(*outputFile,pending);
+        pending.clearActions();
+      }
+  }
+
+//! @brief Writes the record on the stream.
+void XC::ConvergenceTelemetry::write(std::ostream &os,const IterationTelemetry &r) const
+  {
+    os << r.step << ' ' << r.iteration << ' ' << r.normX << ' '
+       << r.normB << ' ' << r.energy << ' ' << r.ratio << ' '
+       << r.actions << ' ' << r.lineSearchEta << ' ' << r.factorTime
+       << ' ' << r.solveTime << ' ' << r.numFailedElements << '\n';
+  }
+
+//! @brief Returns the i-th record (in chronological order).
+const XC::IterationTelemetry &XC::ConvergenceTelemetry::get(const size_t &i) const
+  { return records[(first+i)%records.size()]; }
+
+//! @brief Returns the number of steps started since the last clear().
+int XC::ConvergenceTelemetry::getNumSteps(void) const
+  { return numSteps; }
+
+//! @brief Returns the number of records stored.
+size_t XC::ConvergenceTelemetry::getNumRecords(void) const
+  { return numRecords; }
+
+//! @brief Returns the step numbers of the stored records.
+XC::ID XC::ConvergenceTelemetry::getSteps(void) const
+  {
+    ID retval(numRecords);
+    for(size_t i= 0;i<numRecords;i++)
+      retval[i]= get(i).step;
+    return retval;
+  }
+
+//! @brief Returns the iteration numbers of the stored records.
+XC::ID XC::ConvergenceTelemetry::getIterations(void) const
+  {
+    ID retval(numRecords);
+    for(size_t i= 0;i<numRecords;i++)
+      retval[i]= get(i).iteration;
+    return retval;
+  }
+
+//! @brief Returns the norms of the solution vector.
+XC::Vector XC::ConvergenceTelemetry::getNormsX(void) const
+  {
+    Vector retval(numRecords);
+    for(size_t i= 0;i<numRecords;i++)
+      retval[i]= get(i).normX;
+    return retval;
+  }
+
+//! @brief Returns the norms of the right hand side.
+XC::Vector XC::ConvergenceTelemetry::getNormsB(void) const
+  {
+    Vector retval(numRecords);
+    for(size_t i= 0;i<numRecords;i++)
+      retval[i]= get(i).normB;
+    return retval;
+  }
+
+//! @brief Returns the energy increments.
+XC::Vector XC::ConvergenceTelemetry::getEnergies(void) const
+  {
+    Vector retval(numRecords);
+    for(size_t i= 0;i<numRecords;i++)
+      retval[i]= get(i).energy;
+    return retval;
+  }
+
+//! @brief Returns the ratios computed by the convergence test.
+XC::Vector XC::ConvergenceTelemetry::getRatios(void) const
+  {
+    Vector retval(numRecords);
+    for(size_t i= 0;i<numRecords;i++)
+      retval[i]= get(i).ratio;
+    return retval;
+  }
+
+//! @brief Returns the actions (bit masks) of the stored records.
+XC::ID XC::ConvergenceTelemetry::getActions(void) const
+  {
+    ID retval(numRecords);
+    for(size_t i= 0;i<numRecords;i++)
+      retval[i]= get(i).actions;
+    return retval;
+  }
+
+//! @brief Returns the line search parameters.
+XC::Vector XC::ConvergenceTelemetry::getLineSearchEtas(void) const
+  {
+    Vector retval(numRecords);
+    for(size_t i= 0;i<numRecords;i++)
+      retval[i]= get(i).lineSearchEta;
+    return retval;
+  }
+
+//! @brief Returns the solution times with a new tangent.
+XC::Vector XC::ConvergenceTelemetry::getFactorTimes(void) const
+  {
+    Vector retval(numRecords);
+    for(size_t i= 0;i<numRecords;i++)
+      retval[i]= get(i).factorTime;
+    return retval;
+  }
+
+//! @brief Returns the solution times with an already factored tangent.
+XC::Vector XC::ConvergenceTelemetry::getSolveTimes(void) const
+  {
+    Vector retval(numRecords);
+    for(size_t i= 0;i<numRecords;i++)
+      retval[i]= get(i).solveTime;
+    return retval;
+  }
+
+//! @brief Returns the number of failed elements of the stored records.
+XC::ID XC::ConvergenceTelemetry::getNumFailedElements(void) const
+  {
+    ID retval(numRecords);
+    for(size_t i= 0;i<numRecords;i++)
+      retval[i]= get(i).numFailedElements;
+    return retval;
+  }
+
+//! @brief Prints the stored records.
+void XC::ConvergenceTelemetry::Print(std::ostream &os) const
+  {
+    for(size_t i= 0;i<numRecords;i++)
+      write(os,get(i));
+  }
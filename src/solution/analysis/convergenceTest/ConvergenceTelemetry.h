@@ -0,0 +1,129 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ConvergenceTelemetry.h
+
+#ifndef ConvergenceTelemetry_h
+#define ConvergenceTelemetry_h
+
+#include "xc_utils/src/nucleo/EntCmd.h"
+#include <vector>
+#include <string>
+#include <fstream>
+
+namespace XC {
+class Vector;
+class ID;
+
+//! @ingroup CTest
+//
+//! @brief Data of an iteration of the solution algorithm.
+struct IterationTelemetry
+  {
+    int step; //!< step number (calls to ConvergenceTest::start).
+    int iteration; //!< iteration number inside the step.
+    double normX; //!< norm of the solution vector (displacement increment).
+    double normB; //!< norm of the right hand side (unbalance).
+    double energy; //!< energy increment |0.5*(x ^ b)|.
+    double ratio; //!< last ratio computed by the test (relative tests).
+    int actions; //!< actions performed by the algorithm (bit mask).
+    double lineSearchEta; //!< line search parameter (1.0 if no line search).
+    double factorTime; //!< time spent solving the system with a new tangent (factorization included).
+    double solveTime; //!< time spent solving the system with an already factored tangent.
+    int numFailedElements; //!< number of elements that failed in the last update.
+
+    IterationTelemetry(void);
+    void clearActions(void);
+  };
+
+//! @ingroup CTest
+//
+//! @brief Per-iteration record of the solution process (norms, actions
+//! of the algorithm, solution times and element failures).
+//!
+//! The records are stored on a circular buffer of fixed capacity (once
+//! full, the oldest records are discarded) and, optionally, written on
+//! a file as they are produced.
+class ConvergenceTelemetry: public EntCmd
+  {
+  public:
+    //! @brief Actions performed by the solution algorithm.
+    enum Action {TANGENT_FORMED= 1, LINE_SEARCH= 2, FULL_NEWTON= 4, TANGENT_REUSED= 8};
+  private:
+    bool enabled; //!< if true the iterations are recorded.
+    size_t capacity; //!< maximum number of records stored.
+    std::vector<IterationTelemetry> records; //!< circular buffer.
+    size_t first; //!< position of the oldest record.
+    size_t numRecords; //!< number of records stored.
+    int numSteps; //!< step counter.
+    IterationTelemetry pending; //!< data of the iteration in progress.
+    std::string fileName; //!< name of the output file (empty if none).
+    std::ofstream *outputFile; //!< output stream.
+
+    void close_file(void);
+    void write(std::ostream &,const IterationTelemetry &) const;
+    const IterationTelemetry &get(const size_t &) const;
+  public:
+    ConvergenceTelemetry(EntCmd *owr= nullptr);
+    ConvergenceTelemetry(const ConvergenceTelemetry &);
+    ConvergenceTelemetry &operator=(const ConvergenceTelemetry &);
+    virtual ~ConvergenceTelemetry(void);
+
+    inline bool isEnabled(void) const
+      { return enabled; }
+    void setEnabled(const bool &);
+    size_t getCapacity(void) const;
+    void setCapacity(const size_t &);
+    const std::string &getFileName(void) const;
+    void setFileName(const std::string &);
+    void clear(void);
+
+    void newStep(void);
+    void addAction(const int &);
+    void setLineSearchEta(const double &);
+    void addFactorTime(const double &);
+    void addSolveTime(const double &);
+    void newIteration(const int &,const double &,const double &,const double &,const double &,const int &);
+
+    int getNumSteps(void) const;
+    size_t getNumRecords(void) const;
+    ID getSteps(void) const;
+    ID getIterations(void) const;
+    Vector getNormsX(void) const;
+    Vector getNormsB(void) const;
+    Vector getEnergies(void) const;
+    Vector getRatios(void) const;
+    ID getActions(void) const;
+    Vector getLineSearchEtas(void) const;
+    Vector getFactorTimes(void) const;
+    Vector getSolveTimes(void) const;
+    ID getNumFailedElements(void) const;
+
+    void Print(std::ostream &) const;
+  };
+} // end of XC namespace
+
+#endif
@@ -64,14 +64,16 @@
 #include <solution/system_of_eqn/linearSOE/LinearSOE.h>
 
 #include "solution/SoluMethod.h"
+#include "domain/domain/Domain.h"
+#include "domain/mesh/Mesh.h"
 
 XC::ConvergenceTest::ConvergenceTest(EntCmd *owr,int clasTag)
   :MovableObject(clasTag), EntWOwner(owr), currentIter(0), maxNumIter(0),
-   printFlag(0), nType(2), norms(1), lastRatio(0.0), calculatedNormX(0.0), calculatedNormB(0.0) {}
+   printFlag(0), nType(2), norms(1), lastRatio(0.0), calculatedNormX(0.0), calculatedNormB(0.0), calculatedEnergyProduct(0.0), telemetry(this) {}
 
 XC::ConvergenceTest::ConvergenceTest(EntCmd *owr,int clasTag,int maxIter,int prtFlg, int normType, int sz_norms)
   :MovableObject(clasTag), EntWOwner(owr), currentIter(0), maxNumIter(maxIter),
-   printFlag(prtFlg), nType(normType), norms(sz_norms), lastRatio(0.0), calculatedNormX(0.0), calculatedNormB(0.0) {}
+   printFlag(prtFlg), nType(normType), norms(sz_norms), lastRatio(0.0), calculatedNormX(0.0), calculatedNormB(0.0), calculatedEnergyProduct(0.0), telemetry(this) {}
 
 XC::ConvergenceTest* XC::ConvergenceTest::getCopy(int iterations) const
   {
@@ -125,6 +127,7 @@ int XC::ConvergenceTest::start(void)
         // set iteration count = 1
         currentIter = 1;
         norms.Zero();
+        telemetry.newStep();
       }
     else
       {
@@ -191,6 +194,29 @@ double XC::ConvergenceTest::getEnergyProduct(void) const
     return retval;
   }
 
+//! @brief Returns the per-iteration record of the solution process.
+XC::ConvergenceTelemetry &XC::ConvergenceTest::getTelemetry(void)
+  { return telemetry; }
+
+//! @brief Returns the per-iteration record of the solution process.
+const XC::ConvergenceTelemetry &XC::ConvergenceTest::getTelemetry(void) const
+  { return telemetry; }
+
+//! @brief Stores the data of the current iteration on the telemetry
+//! record (if enabled). Called by the test() method of the subclasses.
+void XC::ConvergenceTest::record_iteration(void)
+  {
+    if(telemetry.isEnabled())
+      {
+        int numFailedElements= 0;
+        const SoluMethod *sm= getSoluMethod();
+        const Domain *dom= (sm ? sm->getDomainPtr() : nullptr);
+        if(dom)
+          numFailedElements= dom->getMesh().getNumFailedElements();
+        telemetry.newIteration(currentIter,getNormX(),getNormB(),getEnergyProduct(),lastRatio,numFailedElements);
+      }
+  }
+
 //! @brief Send object members through the channel being passed as parameter.
 int XC::ConvergenceTest::sendData(CommParameters &cp)
   {
@@ -64,6 +64,7 @@
 #include "xc_utils/src/nucleo/EntWOwner.h"
 #include "utility/matrix/Vector.h"
 #include "solution/system_of_eqn/linearSOE/LinearSOE.h"
+#include "ConvergenceTelemetry.h"
 
 namespace XC {
 class EquiSolnAlgo;
@@ -89,6 +90,8 @@ class ConvergenceTest: public MovableObject, public EntWOwner
     mutable double calculatedNormB; //!< Last calculated |b|
     mutable double calculatedEnergyProduct; //!< Last calculated |0.5*(x ^ b)|.
 
+    ConvergenceTelemetry telemetry; //!< Per-iteration record of the solution process.
+
     bool hasLinearSOE(void) const;
     LinearSOE *getLinearSOEPtr(void);
     const LinearSOE *getLinearSOEPtr(void) const;
@@ -97,6 +100,7 @@ class ConvergenceTest: public MovableObject, public EntWOwner
     const Vector &getB(void) const;
     double getNormB(void) const;
     double getEnergyProduct(void) const;
+    void record_iteration(void);
 
   protected:
     int sendData(CommParameters &);
@@ -127,6 +131,8 @@ class ConvergenceTest: public MovableObject, public EntWOwner
     virtual int getMaxNumTests(void) const;        
     virtual double getRatioNumToMax(void) const;            
     virtual const Vector &getNorms(void) const;
+    ConvergenceTelemetry &getTelemetry(void);
+    const ConvergenceTelemetry &getTelemetry(void) const;
     int sendSelf(CommParameters &);
     int recvSelf(const CommParameters &);
 
@@ -21,11 +21,33 @@
 //----------------------------------------------------------------------------
 //python_interface.tcc
 
+class_<XC::ConvergenceTelemetry, bases<EntCmd>, boost::noncopyable >("ConvergenceTelemetry", no_init)
+  .add_property("enabled", &XC::ConvergenceTelemetry::isEnabled, &XC::ConvergenceTelemetry::setEnabled,"If true, the iterations are recorded.")
+  .add_property("capacity", &XC::ConvergenceTelemetry::getCapacity, &XC::ConvergenceTelemetry::setCapacity,"Maximum number of records stored (the oldest ones are discarded).")
+  .add_property("fileName", make_function(&XC::ConvergenceTelemetry::getFileName,return_value_policy<copy_const_reference>()), &XC::ConvergenceTelemetry::setFileName,"Name of the file where the records are written (empty string: no file).")
+  .add_property("numSteps", &XC::ConvergenceTelemetry::getNumSteps,"Number of steps started.")
+  .add_property("numRecords", &XC::ConvergenceTelemetry::getNumRecords,"Number of records stored.")
+  .def("clear", &XC::ConvergenceTelemetry::clear,"Discards the stored records.")
+  .def("getSteps", &XC::ConvergenceTelemetry::getSteps,"Return the step numbers of the records.")
+  .def("getIterations", &XC::ConvergenceTelemetry::getIterations,"Return the iteration numbers of the records.")
+  .def("getNormsX", &XC::ConvergenceTelemetry::getNormsX,"Return the norms of the solution vector.")
+  .def("getNormsB", &XC::ConvergenceTelemetry::getNormsB,"Return the norms of the unbalanced vector.")
+  .def("getEnergies", &XC::ConvergenceTelemetry::getEnergies,"Return the energy increments.")
+  .def("getRatios", &XC::ConvergenceTelemetry::getRatios,"Return the ratios computed by the convergence test.")
+  .def("getActions", &XC::ConvergenceTelemetry::getActions,"Return the actions of the algorithm (1: tangent formed, 2: line search, 4: full Newton, 8: tangent reused).")
+  .def("getLineSearchEtas", &XC::ConvergenceTelemetry::getLineSearchEtas,"Return the line search parameters.")
+  .def("getFactorTimes", &XC::ConvergenceTelemetry::getFactorTimes,"Return the solution times with a new tangent (factorization included).")
+  .def("getSolveTimes", &XC::ConvergenceTelemetry::getSolveTimes,"Return the solution times with an already factored tangent.")
+  .def("getNumFailedElements", &XC::ConvergenceTelemetry::getNumFailedElements,"Return the number of elements that failed in each iteration.")
+  ;
+
+XC::ConvergenceTelemetry &(XC::ConvergenceTest::*getTelemetryRef)(void)= &XC::ConvergenceTest::getTelemetry;
 class_<XC::ConvergenceTest, bases<XC::MovableObject,EntCmd>, boost::noncopyable >("ConvergenceTest", no_init)
   .add_property("maxNumIter", &XC::ConvergenceTest::getMaxNumIter, &XC::ConvergenceTest::setMaxNumIter)
   .add_property("currentIter", &XC::ConvergenceTest::getCurrentIter, &XC::ConvergenceTest::setCurrentIter)
   .add_property("printFlag", &XC::ConvergenceTest::getPrintFlag, &XC::ConvergenceTest::setPrintFlag)
   .add_property("normType", &XC::ConvergenceTest::getNormType, &XC::ConvergenceTest::setNormType)
+  .add_property("telemetry", make_function(getTelemetryRef, return_internal_reference<>()),"Per-iteration record of the solution process.")
   ;
 
 
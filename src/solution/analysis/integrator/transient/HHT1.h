@@ -89,6 +89,10 @@ class HHT1: public DampingFactorsIntegrator
     HHT1(SoluMethod *,double alpha,const RayleighDampingFactors &rF);        
     Integrator *getCopy(void) const;
   public:
+    //! @brief Returns the beta factor.
+    inline const double &getBeta(void) const
+      { return beta; }
+
     // methods which define what the FE_Element and DOF_Groups add
     // to the system of equation object.
     int formEleTangent(FE_Element *theEle);
@@ -49,6 +49,10 @@ class NewmarkBase2 : public NewmarkBase
     NewmarkBase2(SoluMethod *,int classTag);
     NewmarkBase2(SoluMethod *,int classTag,double gamma, double beta);
     NewmarkBase2(SoluMethod *,int classTag,double gamma, double beta,const RayleighDampingFactors &rF); 
+  public:
+    //! @brief Returns the beta factor.
+    inline const double &getBeta(void) const
+      { return beta; }
   };
 } // end of XC namespace
 
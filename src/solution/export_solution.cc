@@ -35,7 +35,7 @@ void export_solution(void)
 class_<XC::ConvergenceTest, bases<XC::MovableObject,EntCmd>, boost::noncopyable >("ConvergenceTest", no_init);
 
  class_<XC::SoluMethod, bases<EntCmd>, boost::noncopyable >("SoluMethod", "Solution methods container",no_init)
-    .def("newSolutionAlgorithm", &XC::SoluMethod::newSolutionAlgorithm,return_internal_reference<>(),"\n""newSolutionAlgorithm(tipo) \n""Define the solution algorithm to be used.\n" "Parameters: \n""tipo: type of solution algorithm. Available types: 'bfgs_soln_algo', 'broyden_soln_algo','krylov_newton_soln_algo','linear_soln_algo','modified_newton_soln_algo','newton_raphson_soln_algo','newton_line_search_soln_algo','periodic_newton_soln_algo','frequency_soln_algo','standard_eigen_soln_algo','linear_buckling_soln_algo' \n")
+    .def("newSolutionAlgorithm", &XC::SoluMethod::newSolutionAlgorithm,return_internal_reference<>(),"\n""newSolutionAlgorithm(tipo) \n""Define the solution algorithm to be used.\n" "Parameters: \n""tipo: type of solution algorithm. Available types: 'bfgs_soln_algo', 'broyden_soln_algo','krylov_newton_soln_algo','linear_soln_algo','modified_newton_soln_algo','newton_raphson_soln_algo','newton_line_search_soln_algo','periodic_newton_soln_algo','adaptive_newton_soln_algo','frequency_soln_algo','standard_eigen_soln_algo','linear_buckling_soln_algo' \n")
     .def("newIntegrator", &XC::SoluMethod::newIntegrator,return_internal_reference<>()," \n""newIntegrator(tipo,params) \n""Define the integrator to be used. \n""Parameters: \n""tipo: type of integrator. Available types:  'arc_length_integrator', 'arc_length1_integrator', 'displacement_control_integrator', 'distributed_displacement_control_integrator', 'HS_constraint_integrator', 'load_control_integrator', 'load_path_integrator', 'min_unbal_disp_norm_integrator', 'eigen_integrator', 'linear_buckling_integrator', 'alpha_os_integrator', 'alpha_os_generalized_integrator', 'central_difference_integrator', 'central_difference_alternative_integrator', 'central_difference_no_damping_integrator', 'collocation_integrator', 'collocation_hybrid_simulation_integrator', 'HHT_integrator', 'HHT1_integrator', 'HHT_explicit_integrator', 'HHT_generalized_integrator', 'HHT_generalized_explicit_integrator', 'HHT_hybrid_simulation_integrator', 'newmark_integrator', 'newmark1_integrator', 'newmark_explicit_integrator' 'newmark_hybrid_simulation_integrator', 'wilson_theta_integrator'. \n""params: parameters depending upon the integrator type. \n")
     .def("newSystemOfEqn", &XC::SoluMethod::newSystemOfEqn,return_internal_reference<>()," \n""newSystemOfEqn(tipo) \n""Define the system of equations to be used. \n""Parameters: \n""tipo: type of system of equations. Available types: 'band_arpack_soe', 'band_arpackpp_soe', 'sym_arpack_soe', 'sym_band_eigen_soe', 'full_gen_eigen_soe', 'band_gen_lin_soe', 'distributed_band_gen_lin_soe', 'band_spd_lin_soe', 'distributed_band_spd_lin_soe', 'diagonal_soe', 'distributed_diagonal_soe', 'full_gen_lin_soe', 'profile_spd_lin_soe', 'distributed_profile_spd_lin_soe', 'sparse_gen_col_lin_soe', 'distributed_sparse_gen_col_lin_soe', 'sparse_gen_row_lin_soe', 'distributed_sparse_gen_row_lin_soe', 'sym_sparse_lin_soe'.  \n")
     .def("newConvergenceTest", &XC::SoluMethod::newConvergenceTest,return_internal_reference<>()," \n""newConvergenceTest(cmd) \n""Define the convergence test to be used. \n""Parameters: \n""cmd: type of convergente test. Available types: 'energy_inc_conv_test', 'fixed_num_iter_conv_test', 'norm_disp_incr_conv_test', 'norm_unbalance_conv_test', 'relative_energy_incr_conv_test', 'relative_norm_disp_incr_conv_test', 'relative_norm_unbalance_conv_test', 'relative_total_norm_disp_incr_conv_test'. \n")
@@ -57,7 +57,7 @@ XC::ProcSoluControl &(XC::ProcSolu::*getSoluControlRef)(void)= &XC::ProcSolu::ge
  class_<XC::ProcSolu, bases<EntCmd>, boost::noncopyable >("ProcSolu","Definition of the analysis by its type and the parameters that control the solution procedure.",no_init)
    .add_property("getSoluControl", make_function( getSoluControlRef, return_internal_reference<>() )," \n"" Return a reference to the objects  that control the solution procedure.\n")
    .add_property("getAnalysis", make_function( &XC::ProcSolu::getAnalysis, return_internal_reference<>() )," \n"" Return a reference to the analysis object. \n")
-    .def("newAnalysis", &XC::ProcSolu::newAnalysis,return_internal_reference<>()," \n""newAnalysis(nmb,cod_solu_metodo,cod_solu_eigenM) \n""Definition of a new analysis.""Parameters: \n""nmb: name of the type of analysis. Available types: 'direct_integration_analysis', 'eigen_analysis', 'modal_analysis','linear_buckling_analysis', 'linear_buckling_eigen_analysis', 'static_analysis', 'variable_time_step_direct_integration_analysis' \n""cod_solu_metodo: name of the solution method container \n""cod_solu_eigenM: name of the solution method (only when linear buckling analysis defined).\n")
+    .def("newAnalysis", &XC::ProcSolu::newAnalysis,return_internal_reference<>()," \n""newAnalysis(nmb,cod_solu_metodo,cod_solu_eigenM) \n""Definition of a new analysis.""Parameters: \n""nmb: name of the type of analysis. Available types: 'direct_integration_analysis', 'eigen_analysis', 'modal_analysis','linear_buckling_analysis', 'linear_buckling_eigen_analysis', 'static_analysis', 'variable_time_step_direct_integration_analysis', 'adaptive_time_step_direct_integration_analysis', 'explicit_dynamics_analysis' \n""cod_solu_metodo: name of the solution method container \n""cod_solu_eigenM: name of the solution method (only when linear buckling analysis defined).\n")
     ;
 
   }
@@ -94,6 +94,9 @@ class EigenSOE : public SystemOfEqn
     virtual void identityM(void);
 
     const int &getNumModes(void) const;
+    //! @brief Returns the mass matrix.
+    inline const sparse_matrix &getMassMatrix(void) const
+      { return massMatrix; }
 
     //Autovectores
     virtual const Vector &getEigenvector(int mode) const;
@@ -43,6 +43,8 @@
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 #include <cmath>
+#include <cstring>
+#include <algorithm>
 #include <utility/matrix/Vector.h>
 
 //! @brief Constructor.
@@ -308,11 +310,19 @@ int XC::SymArpackSOE::addM(const Matrix &m, const ID &id, double fact)
         std::cerr << "BandArpackSOE::addA(); Matrix and ID not of similar sizes\n";
         return -1;
       }
-    resize_mass_matrix_if_needed(idSize);      
+    resize_mass_matrix_if_needed(size);
 
     for(int i=0; i<idSize; i++)
-      for(int j=0; j<idSize; j++)
-        massMatrix(i,j)+= m(j,i);
+      {
+        const int col= id(i);
+        if(col>=0)
+          for(int j=0; j<idSize; j++)
+            {
+              const int row= id(j);
+              if(row>=0)
+                massMatrix(row,col)+= m(j,i)*fact;
+            }
+      }
     //Added by LCPT ends.
 
     return this->addA(m, id, -shift);
@@ -320,7 +330,89 @@ int XC::SymArpackSOE::addM(const Matrix &m, const ID &id, double fact)
 
 //! @brief Anula la matriz A.
 void XC::SymArpackSOE::zeroA(void)
-  { factored = false; }
+  {
+    if(size>0)
+      {
+        memset(diag, 0, size*sizeof(double));
+        const int profileSize = penv[size] - penv[0];
+        memset(penv[0], 0, profileSize*sizeof(double));
+        OFFDBLK *blkPtr = first;
+        while(blkPtr->beg != size)
+          {
+            const int rLen = xblk[rowblks[blkPtr->beg]+1] - blkPtr->beg;
+            memset(blkPtr->nz, 0, rLen*sizeof(double));
+            blkPtr = blkPtr->next;
+          }
+      }
+    factored = false;
+  }
+
+//! @brief Returns the number of values stored for the matrix A
+//! (diagonal, profile and off-diagonal blocks).
+size_t XC::SymArpackSOE::getNumStoredValues(void) const
+  {
+    size_t retval= 0;
+    if(size>0)
+      {
+        retval= size + (penv[size] - penv[0]);
+        const OFFDBLK *blkPtr = first;
+        while(blkPtr->beg != size)
+          {
+            retval+= xblk[rowblks[blkPtr->beg]+1] - blkPtr->beg;
+            blkPtr = blkPtr->next;
+          }
+      }
+    return retval;
+  }
+
+//! @brief Copies the values of the matrix A (or its factorization)
+//! on the vector argument.
+void XC::SymArpackSOE::pack(std::vector<double> &values) const
+  {
+    values.resize(getNumStoredValues());
+    if(size>0)
+      {
+        std::vector<double>::iterator out= std::copy(diag,diag+size,values.begin());
+        out= std::copy(penv[0],penv[size],out);
+        const OFFDBLK *blkPtr = first;
+        while(blkPtr->beg != size)
+          {
+            const int rLen = xblk[rowblks[blkPtr->beg]+1] - blkPtr->beg;
+            out= std::copy(blkPtr->nz,blkPtr->nz+rLen,out);
+            blkPtr = blkPtr->next;
+          }
+      }
+  }
+
+//! @brief Copies the values of the vector argument on the
+//! matrix A (inverse of pack).
+void XC::SymArpackSOE::unpack(const std::vector<double> &values)
+  {
+    if(values.size()!=getNumStoredValues())
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; wrong number of values: " << values.size()
+                  << " (" << getNumStoredValues() << " expected).\n";
+        return;
+      }
+    if(size>0)
+      {
+        std::vector<double>::const_iterator in= values.begin();
+        std::copy(in,in+size,diag);
+        in+= size;
+        const int profileSize = penv[size] - penv[0];
+        std::copy(in,in+profileSize,penv[0]);
+        in+= profileSize;
+        OFFDBLK *blkPtr = first;
+        while(blkPtr->beg != size)
+          {
+            const int rLen = xblk[rowblks[blkPtr->beg]+1] - blkPtr->beg;
+            std::copy(in,in+rLen,blkPtr->nz);
+            in+= rLen;
+            blkPtr = blkPtr->next;
+          }
+      }
+  }
 
 //! @brief Anula la matriz M.
 void XC::SymArpackSOE::zeroM(void)
@@ -44,6 +44,7 @@
 #define SymArpackSOE_h
 
 #include <solution/system_of_eqn/eigenSOE/ArpackSOE.h>
+#include <vector>
 
 extern "C" {
    #include <solution/system_of_eqn/linearSOE/sparseSYM/FeStructs.h>
@@ -70,6 +71,10 @@ class SymArpackSOE : public ArpackSOE
     int      *rowblks;
     OFFDBLK  **begblk;
     OFFDBLK  *first;
+
+    size_t getNumStoredValues(void) const;
+    void pack(std::vector<double> &) const;
+    void unpack(const std::vector<double> &);
   protected:
     bool setSolver(EigenSolver *);
 
@@ -70,11 +70,82 @@ extern "C" int dseupd_(bool *rvec, char *howmny, long int *select, double *d, do
 //! @brief Constructor.
 XC::SymArpackSolver::SymArpackSolver(int numE)
  :EigenSolver(EigenSOLVER_TAGS_SymArpackSolver, numE),
-theSOE(nullptr), factored(false)
+  theSOE(nullptr), reuseFactorization(false), warmStart(true),
+  numFactorizations(0)
   {
     // nothing to do.
   }
 
+//! @brief Activates or deactivates the reuse of the factorization
+//! when the assembled matrix doesn't change.
+//!
+//! When active, each factorization keeps a copy of the assembled
+//! matrix and of its factor (twice the memory of the matrix) and
+//! each call to factor() compares the new matrix with the stored one.
+void XC::SymArpackSolver::setReuseFactorization(const bool &b)
+  {
+    reuseFactorization= b;
+    if(!reuseFactorization)
+      {
+        storedFactor.clear();
+        factoredMatrix.clear();
+      }
+  }
+
+//! @brief Activates or deactivates the use of the previous eigenvectors
+//! as starting vector.
+void XC::SymArpackSolver::setWarmStart(const bool &b)
+  {
+    warmStart= b;
+    if(!warmStart)
+      startVector.clear();
+  }
+
+//! @brief Computes the LDL^T factorization of the SOE matrix. If the
+//! reuse of the factorization is active and the matrix is equal
+//! to the one that was factored previously the stored factorization
+//! is copied back instead.
+int XC::SymArpackSolver::factor(void)
+  {
+    const int n= theSOE->size;
+    std::vector<double> assembled;
+    if(reuseFactorization)
+      {
+        theSOE->pack(assembled);
+        if(!storedFactor.empty() && (assembled==factoredMatrix))
+          {
+            theSOE->unpack(storedFactor);
+            return 0;
+          }
+      }
+    //call the "C" function to do the numerical factorization.
+    const int info= pfsfct(n, theSOE->diag, theSOE->penv, theSOE->nblks, theSOE->xblk, theSOE->begblk, theSOE->first, theSOE->rowblks);
+    if(info>0)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; error in factorization.\n";
+        storedFactor.clear();
+        factoredMatrix.clear();
+        return -1;
+      }
+    numFactorizations++;
+    if(reuseFactorization)
+      {
+        theSOE->pack(storedFactor);
+        factoredMatrix.swap(assembled);
+      }
+    return 0;
+  }
+
+//! @brief Computes the first eigenpairs.
+//!
+//! @param nModes: number of eigenpairs to compute.
+int XC::SymArpackSolver::solve(int nModes)
+  {
+    numModes= nModes;
+    return solve();
+  }
+
 //! @brief Solves the eigenproblem.
 int XC::SymArpackSolver::solve(void)
   {
@@ -90,9 +161,7 @@ int XC::SymArpackSolver::solve(void)
     //    int      *invp = theSOE->invp;
     double   *diag = theSOE->diag;
     double   **penv = theSOE->penv;
-    int      *rowblks = theSOE->rowblks;
     OFFDBLK  **begblk = theSOE->begblk;
-    OFFDBLK  *first = theSOE->first;
 
     int n = theSOE->size;
 
@@ -100,19 +169,11 @@ int XC::SymArpackSolver::solve(void)
     if(n == 0)
       return 0;
 
-//        timer (FACTOR);
-    if(factored == false)
+    if(!theSOE->factored)
       {
-        //factor the matrix
-        //call the "C" function to do the numerical factorization.
-        int factor;
-        factor = pfsfct(n, diag, penv, nblks, xblk, begblk, first, rowblks);
-        if(factor>0)
-          {
-            std::cerr << "In XC::SymArpackSolver: error in factorization.\n";
-            return -1;
-          }
-        factored = true;
+        if(factor()<0)
+          return -1;
+        theSOE->factored= true;
       }
 
     int nev = numModes;
@@ -137,6 +198,12 @@ int XC::SymArpackSolver::solve(void)
 
     double tol = 0.0;
     int info = 0;
+    if(warmStart && (int(startVector.size())==n))
+      {
+        // start from the previous eigenvectors.
+        resid= startVector;
+        info= 1;
+      }
     maxitr = 1000;
     mode = 3;
 
@@ -210,8 +277,18 @@ int XC::SymArpackSolver::solve(void)
     value= d;
     vector= v;
 
-    theSOE->factored = true;
-
+    if(warmStart)
+      {
+        startVector.assign(n,0.0);
+        for(int k= 0;k<nev;k++)
+          for(int i= 0;i<n;i++)
+            startVector[i]+= vector[k*n+i];
+        double norm= 0.0;
+        for(int i= 0;i<n;i++)
+          norm+= startVector[i]*startVector[i];
+        if(norm==0.0)
+          startVector.clear();
+      }
     return 0;
   }
 
@@ -225,6 +302,9 @@ int XC::SymArpackSolver::setSize(void)
     if(eigenV.Size() != size)
       eigenV.resize(size);
 
+    // the structure of the matrix has changed.
+    storedFactor.clear();
+    startVector.clear();
     return 0;
   }
 
@@ -273,12 +353,10 @@ void XC::SymArpackSolver::myMv(int n, double *v, double *result)
     int *invp = theSOE->invp;
     int i;
 
+    // the input vector is needed by ARPACK, so it's not modified.
+    Vector x(n);
     for(i=0; i<n; i++)
-      { tempX[i] = v[invp[i]]; }
-    for(i=0; i<n; i++)
-      { v[i] = tempX[i]; }
-
-    Vector x(v, n);
+      { x[i] = v[invp[i]]; }
     Vector y(result,n);
 
     y.Zero();
@@ -42,6 +42,7 @@
 
 #include <solution/system_of_eqn/eigenSOE/EigenSolver.h>
 #include "utility/matrix/Vector.h"
+#include <vector>
 
 namespace XC {
 class SymArpackSOE;
@@ -49,16 +50,29 @@ class SymArpackSOE;
 //! @ingroup EigenSolver
 //
 //! @brief <a href="http://www.caam.rice.edu/software/ARPACK/" target="_new"> Arpack</a> based symmetric matrix eigenvalue SOE solver.
+//!
+//! Shift-invert Lanczos on the sparse LDL^T factorization of
+//! the SymArpackSOE matrix. If requested (see setReuseFactorization)
+//! the factorization is kept and reused when the assembled matrix
+//! doesn't change between solutions (repeated modal analyses, linear
+//! buckling steps,...). The iteration can be started from the
+//! eigenvectors of the previous solution.
 class SymArpackSolver : public EigenSolver
   {
   private:
     SymArpackSOE *theSOE;
-    bool factored;
+    bool reuseFactorization; //!< if true, reuse the factorization if the matrix doesn't change (default: false).
+    bool warmStart; //!< if true, start the iteration from the previous eigenvectors.
+    std::vector<double> factoredMatrix; //!< copy of the matrix that corresponds to the stored factorization.
+    std::vector<double> storedFactor; //!< copy of the last factorization.
+    std::vector<double> startVector; //!< starting vector (sum of the previous eigenvectors).
+    int numFactorizations; //!< number of numerical factorizations performed.
 
     Vector value;
     Vector vector;
     mutable Vector eigenV;
     
+    int factor(void);
     void myMv(int n, double *v, double *result);
     void myCopy(int n, double *v, double *result);
     int getNCV(int n, int nev);
@@ -69,7 +83,7 @@ class SymArpackSolver : public EigenSolver
     bool setEigenSOE(EigenSOE *theSOE);
   public:
     virtual int solve(void);
-    virtual int solve(int numModes) {return this->solve();};    
+    virtual int solve(int nModes);
     virtual int setSize(void);
     const int &getSize(void) const;
 
@@ -77,6 +91,15 @@ class SymArpackSolver : public EigenSolver
 	
     virtual const Vector &getEigenvector(int mode) const;
     virtual const double &getEigenvalue(int mode) const;
+
+    inline bool getReuseFactorization(void) const
+      { return reuseFactorization; }
+    void setReuseFactorization(const bool &);
+    inline bool getWarmStart(void) const
+      { return warmStart; }
+    void setWarmStart(const bool &);
+    inline int getNumFactorizations(void) const
+      { return numFactorizations; }
     
     int sendSelf(CommParameters &);
     int recvSelf(const CommParameters &);
@@ -50,6 +50,9 @@ class_<XC::BandArpackppSolver, bases<XC::EigenSolver>, boost::noncopyable >("Ban
   ;
 
 class_<XC::SymArpackSolver, bases<XC::EigenSolver>, boost::noncopyable >("SymArpackSolver", no_init)
+  .add_property("reuseFactorization",&XC::SymArpackSolver::getReuseFactorization,&XC::SymArpackSolver::setReuseFactorization,"If true, reuse the factorization when the matrix doesn't change (default: false).")
+  .add_property("warmStart",&XC::SymArpackSolver::getWarmStart,&XC::SymArpackSolver::setWarmStart,"If true, start the Lanczos iteration from the previous eigenvectors.")
+  .add_property("numFactorizations",&XC::SymArpackSolver::getNumFactorizations,"Number of numerical factorizations performed.")
   ;
 
 class_<XC::BandArpackSolver, bases<XC::EigenSolver>, boost::noncopyable >("BandArpackSolver", no_init)
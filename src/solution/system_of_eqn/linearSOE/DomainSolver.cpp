@@ -68,3 +68,17 @@
 
 XC::DomainSolver::DomainSolver(int classtag)
   : LinearSOESolver(classtag) {}
+
+//! @brief Returns true if the (not yet condensed) matrix of the system
+//! is equal to the matrix of the solver being passed as parameter
+//! (so the condensation can be shared). The default implementation
+//! returns false.
+bool XC::DomainSolver::hasSameA(const DomainSolver &) const
+  { return false; }
+
+//! @brief Copies the condensed matrix (factored interior and Schur
+//! complement) from the solver being passed as parameter, whose
+//! matrix must be equal to this one (see hasSameA). The default
+//! implementation does nothing and returns -1.
+int XC::DomainSolver::copyCondensedA(const DomainSolver &,int numInt)
+  { return -1; }
@@ -91,6 +91,9 @@ class DomainSolver: public virtual LinearSOESolver
 
     virtual int setComputedXext(const Vector &) =0;
     virtual int solveXint(void) =0;
+
+    virtual bool hasSameA(const DomainSolver &) const;
+    virtual int copyCondensedA(const DomainSolver &,int numInt);
   };
 } // end of XC namespace
 
@@ -242,7 +242,6 @@ std::cerr << std::endl;
 
     theSOE->isAcondensed = true;
     theSOE->numInt = numInt;
-    std::cerr << "XC::ProfileSPDLinSubstrSolver::condenseA  numDOF: " << size << "  numInt: " << numInt << "  numExt: " << size-numInt << std::endl;
     return 0;
   }
 
@@ -505,6 +504,54 @@ int XC::ProfileSPDLinSubstrSolver::solveXint(void)
     return 0;
   }
 
+//! @brief Returns true if the matrix of the system (not condensed yet)
+//! has the same profile and values than the matrix of the solver
+//! being passed as parameter (identical substructures).
+bool XC::ProfileSPDLinSubstrSolver::hasSameA(const DomainSolver &other) const
+  {
+    const ProfileSPDLinSubstrSolver *otherPtr= dynamic_cast<const ProfileSPDLinSubstrSolver *>(&other);
+    if(!otherPtr || (otherPtr==this) || !theSOE || !otherPtr->theSOE)
+      return false;
+    const ProfileSPDLinSOE &a= *theSOE;
+    const ProfileSPDLinSOE &b= *(otherPtr->theSOE);
+    if((a.size!=b.size) || (a.profileSize!=b.profileSize))
+      return false;
+    for(int i= 0;i<a.size;i++)
+      if(a.iDiagLoc(i)!=b.iDiagLoc(i))
+        return false;
+    for(int i= 0;i<a.profileSize;i++)
+      if(a.A(i)!=b.A(i))
+        return false;
+    return true;
+  }
+
+//! @brief Copies the results of condenseA (factored A11, M and Kdash)
+//! from the solver being passed as parameter, whose matrix must be
+//! equal to this one (see hasSameA).
+int XC::ProfileSPDLinSubstrSolver::copyCondensedA(const DomainSolver &other,int numInt)
+  {
+    const ProfileSPDLinSubstrSolver *otherPtr= dynamic_cast<const ProfileSPDLinSubstrSolver *>(&other);
+    if(!otherPtr || !theSOE || !otherPtr->theSOE)
+      return -1;
+    const ProfileSPDLinSOE &b= *(otherPtr->theSOE);
+    if((theSOE->profileSize!=b.profileSize) || (size!=otherPtr->size) || (b.numInt!=numInt))
+      {
+	std::cerr << "XC::ProfileSPDLinSubstrSolver::copyCondensedA() :";
+	std::cerr << " - the systems are not compatible.\n";
+	return -1;
+      }
+    // element by element, so topRowPtr remains valid.
+    for(int i= 0;i<theSOE->profileSize;i++)
+      theSOE->A(i)= b.A(i);
+    if(invD.Size()!=otherPtr->invD.Size())
+      invD.resize(otherPtr->invD.Size());
+    for(int i= 0;i<invD.Size();i++)
+      invD(i)= otherPtr->invD(i);
+    theSOE->isAcondensed = b.isAcondensed;
+    theSOE->numInt = numInt;
+    return 0;
+  }
+
 int XC::ProfileSPDLinSubstrSolver::getClassTag(void) const
   { return SOLVER_TAGS_ProfileSPDLinSubstrSolver; }
 
@@ -102,6 +102,9 @@ class ProfileSPDLinSubstrSolver : public ProfileSPDLinDirectSolver,
     int setComputedXext(const Vector &);
     int solveXint(void);
 
+    bool hasSameA(const DomainSolver &) const;
+    int copyCondensedA(const DomainSolver &,int numInt);
+
     int setSize(void);
     int getClassTag() const;
     int sendSelf(CommParameters &);
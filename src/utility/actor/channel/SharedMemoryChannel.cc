@@ -0,0 +1,543 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SharedMemoryChannel.cc
+
+#include "utility/actor/channel/SharedMemoryChannel.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+#include "../message/Message.h"
+#include "../address/ChannelAddress.h"
+#include "../actor/MovableObject.h"
+#include <cstring>
+#include <algorithm>
+#include <cstdlib>
+#include <cerrno>
+#include <ctime>
+#include <sstream>
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+namespace XC {
+
+//! @brief Ring buffer stored in shared memory (single producer,
+//! single consumer).
+struct SharedMemoryRing
+  {
+    pthread_mutex_t mutex;
+    pthread_cond_t notEmpty; //!< signaled when data is written.
+    pthread_cond_t notFull; //!< signaled when data is read.
+    size_t capacity; //!< size of the data area.
+    size_t offset; //!< position of the data area from the start of the segment.
+    size_t head; //!< number of bytes written since the creation.
+    size_t tail; //!< number of bytes read since the creation.
+    int closed; //!< one of the processes has closed the channel.
+  };
+
+//! @brief Header of the shared memory segment. The data areas
+//! of the rings follow.
+struct SharedMemorySegment
+  {
+    pthread_mutex_t mutex;
+    pthread_cond_t attachedCond; //!< signaled when the peer attaches.
+    int attached; //!< true when the peer has attached to the segment.
+    pid_t pids[2]; //!< process ids of the owner and the peer.
+    SharedMemoryRing rings[2]; //!< rings[0]: owner to peer; rings[1]: peer to owner.
+  };
+
+} // end of XC namespace
+
+//! @brief Size of the segment header (rounded to a cache line).
+static size_t header_size(void)
+  { return ((sizeof(XC::SharedMemorySegment)+63)/64)*64; }
+
+//! @brief Locks the mutex (recovering it if the process that
+//! owned it has died).
+static int lock_mutex(pthread_mutex_t *m,int *closed)
+  {
+    int retval= pthread_mutex_lock(m);
+    if(retval==EOWNERDEAD)
+      {
+        if(closed)
+          *closed= 1;
+        pthread_mutex_consistent(m);
+        retval= 0;
+      }
+    return retval;
+  }
+
+//! @brief Initializes a process-shared mutex.
+static void init_mutex(pthread_mutex_t *m)
+  {
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_setpshared(&attr,PTHREAD_PROCESS_SHARED);
+    pthread_mutexattr_setrobust(&attr,PTHREAD_MUTEX_ROBUST);
+    pthread_mutex_init(m,&attr);
+    pthread_mutexattr_destroy(&attr);
+  }
+
+//! @brief Initializes a process-shared condition variable.
+static void init_cond(pthread_cond_t *c)
+  {
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setpshared(&attr,PTHREAD_PROCESS_SHARED);
+    pthread_cond_init(c,&attr);
+    pthread_condattr_destroy(&attr);
+  }
+
+//! @brief Returns false if the process with the id being passed
+//! as parameter has ended. A child process that has ended is found
+//! by kill(pid,0) until it is reaped, so it's checked with WNOWAIT
+//! (the child is reaped only by its parent, i.e. LocalMachineBroker).
+static bool peer_alive(const pid_t &peer)
+  {
+    if(peer<=0)
+      return true; // unknown.
+    siginfo_t info;
+    memset(&info,0,sizeof(info));
+    if((waitid(P_PID,peer,&info,WEXITED|WNOHANG|WNOWAIT)==0) && (info.si_pid==peer))
+      return false;
+    return !((kill(peer,0)!=0) && (errno==ESRCH));
+  }
+
+//! @brief Waits on the condition variable (the mutex must be locked).
+//! Returns false if the process with the id being passed as parameter
+//! no longer exists.
+static bool wait_cond(pthread_cond_t *c,pthread_mutex_t *m,const pid_t &peer)
+  {
+    timespec ts;
+    clock_gettime(CLOCK_REALTIME,&ts);
+    ts.tv_sec+= 1;
+    const int rc= pthread_cond_timedwait(c,m,&ts);
+    if(rc==EOWNERDEAD)
+      {
+        pthread_mutex_consistent(m);
+        return false;
+      }
+    if((rc==ETIMEDOUT) && !peer_alive(peer))
+      return false;
+    return true;
+  }
+
+//! @brief Constructor. Creates the shared memory segment with two rings
+//! of the capacity (in bytes) being passed as parameter.
+XC::SharedMemoryChannel::SharedMemoryChannel(const size_t &capacity)
+  : Channel(), owner(true), unlinked(false), segmentSize(0),
+    segment(nullptr), sendRing(nullptr), recvRing(nullptr)
+  {
+    std::ostringstream os;
+    os << "/xc_shm_" << getpid() << "_" << getTag();
+    segmentName= os.str();
+    create_segment(capacity);
+  }
+
+//! @brief Constructor. Attaches to the segment created by another
+//! process.
+XC::SharedMemoryChannel::SharedMemoryChannel(const std::string &nmb)
+  : Channel(), segmentName(nmb), owner(false), unlinked(true), segmentSize(0),
+    segment(nullptr), sendRing(nullptr), recvRing(nullptr)
+  { open_segment(); }
+
+//! @brief Destructor.
+XC::SharedMemoryChannel::~SharedMemoryChannel(void)
+  { close_segment(); }
+
+//! @brief Creates and maps the shared memory segment.
+int XC::SharedMemoryChannel::create_segment(const size_t &capacity)
+  {
+    const size_t ringSize= ((capacity+63)/64)*64;
+    segmentSize= header_size()+2*ringSize;
+    const int fd= shm_open(segmentName.c_str(),O_CREAT|O_EXCL|O_RDWR,S_IRUSR|S_IWUSR);
+    if(fd<0)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; can't create shared memory segment: '"
+                  << segmentName << "': " << strerror(errno) << std::endl;
+        return -1;
+      }
+    if(ftruncate(fd,segmentSize)!=0)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; can't set the size of the segment: "
+                  << strerror(errno) << std::endl;
+        close(fd);
+        shm_unlink(segmentName.c_str());
+        unlinked= true;
+        return -1;
+      }
+    void *ptr= mmap(nullptr,segmentSize,PROT_READ|PROT_WRITE,MAP_SHARED,fd,0);
+    close(fd);
+    if(ptr==MAP_FAILED)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; can't map the segment: " << strerror(errno) << std::endl;
+        shm_unlink(segmentName.c_str());
+        unlinked= true;
+        return -1;
+      }
+    segment= static_cast<SharedMemorySegment *>(ptr);
+    init_mutex(&segment->mutex);
+    init_cond(&segment->attachedCond);
+    segment->attached= 0;
+    segment->pids[0]= getpid();
+    segment->pids[1]= 0;
+    for(size_t i= 0;i<2;i++)
+      {
+        SharedMemoryRing &r= segment->rings[i];
+        init_mutex(&r.mutex);
+        init_cond(&r.notEmpty);
+        init_cond(&r.notFull);
+        r.capacity= ringSize;
+        r.offset= header_size()+i*ringSize;
+        r.head= 0;
+        r.tail= 0;
+        r.closed= 0;
+      }
+    sendRing= &segment->rings[0];
+    recvRing= &segment->rings[1];
+    return 0;
+  }
+
+//! @brief Maps the shared memory segment created by the other process.
+int XC::SharedMemoryChannel::open_segment(void)
+  {
+    const int fd= shm_open(segmentName.c_str(),O_RDWR,S_IRUSR|S_IWUSR);
+    if(fd<0)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; can't open shared memory segment: '"
+                  << segmentName << "': " << strerror(errno) << std::endl;
+        return -1;
+      }
+    struct stat st;
+    if(fstat(fd,&st)!=0)
+      {
+        close(fd);
+        return -1;
+      }
+    segmentSize= st.st_size;
+    void *ptr= mmap(nullptr,segmentSize,PROT_READ|PROT_WRITE,MAP_SHARED,fd,0);
+    close(fd);
+    if(ptr==MAP_FAILED)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; can't map the segment: " << strerror(errno) << std::endl;
+        return -1;
+      }
+    segment= static_cast<SharedMemorySegment *>(ptr);
+    sendRing= &segment->rings[1];
+    recvRing= &segment->rings[0];
+    return 0;
+  }
+
+//! @brief Closes the channel (the process on the other side gets an
+//! error on its next blocking read or write) and unmaps the segment.
+void XC::SharedMemoryChannel::close_segment(void)
+  {
+    if(segment)
+      {
+        for(size_t i= 0;i<2;i++)
+          {
+            SharedMemoryRing &r= segment->rings[i];
+            lock_mutex(&r.mutex,&r.closed);
+            r.closed= 1;
+            pthread_cond_broadcast(&r.notEmpty);
+            pthread_cond_broadcast(&r.notFull);
+            pthread_mutex_unlock(&r.mutex);
+          }
+        munmap(segment,segmentSize);
+        segment= nullptr;
+        sendRing= nullptr;
+        recvRing= nullptr;
+      }
+    if(owner && !unlinked)
+      {
+        shm_unlink(segmentName.c_str());
+        unlinked= true;
+      }
+  }
+
+//! @brief Writes the data on the send ring (blocks while the ring is full).
+int XC::SharedMemoryChannel::write(const void *data,const size_t &sz)
+  {
+    if(!sendRing)
+      return -1;
+    SharedMemoryRing &r= *sendRing;
+    char *buffer= reinterpret_cast<char *>(segment)+r.offset;
+    const pid_t peer= segment->pids[owner ? 1 : 0];
+    const char *src= static_cast<const char *>(data);
+    size_t left= sz;
+    while(left>0)
+      {
+        lock_mutex(&r.mutex,&r.closed);
+        while(!r.closed && (r.head-r.tail)==r.capacity)
+          if(!wait_cond(&r.notFull,&r.mutex,peer))
+            r.closed= 1;
+        if(r.closed)
+          {
+            pthread_mutex_unlock(&r.mutex);
+            std::cerr << nombre_clase() << "::" << __FUNCTION__
+                      << "; channel closed by the other process." << std::endl;
+            return -1;
+          }
+        const size_t avail= r.capacity-(r.head-r.tail);
+        const size_t pos= r.head%r.capacity;
+        pthread_mutex_unlock(&r.mutex);
+
+        // only this process modifies head, so we can copy without the lock.
+        const size_t chunk= std::min(avail,left);
+        const size_t first= std::min(chunk,r.capacity-pos);
+        memcpy(buffer+pos,src,first);
+        memcpy(buffer,src+first,chunk-first);
+
+        lock_mutex(&r.mutex,&r.closed);
+        r.head+= chunk;
+        pthread_cond_signal(&r.notEmpty);
+        pthread_mutex_unlock(&r.mutex);
+        src+= chunk;
+        left-= chunk;
+      }
+    return 0;
+  }
+
+//! @brief Reads the data from the receive ring (blocks until all
+//! the data is available).
+int XC::SharedMemoryChannel::read(void *data,const size_t &sz)
+  {
+    if(!recvRing)
+      return -1;
+    SharedMemoryRing &r= *recvRing;
+    const char *buffer= reinterpret_cast<const char *>(segment)+r.offset;
+    const pid_t peer= segment->pids[owner ? 1 : 0];
+    char *dest= static_cast<char *>(data);
+    size_t left= sz;
+    while(left>0)
+      {
+        lock_mutex(&r.mutex,&r.closed);
+        while(!r.closed && (r.head==r.tail))
+          if(!wait_cond(&r.notEmpty,&r.mutex,peer))
+            r.closed= 1;
+        if(r.head==r.tail) // closed and empty.
+          {
+            pthread_mutex_unlock(&r.mutex);
+            std::cerr << nombre_clase() << "::" << __FUNCTION__
+                      << "; channel closed by the other process." << std::endl;
+            return -1;
+          }
+        const size_t avail= r.head-r.tail;
+        const size_t pos= r.tail%r.capacity;
+        pthread_mutex_unlock(&r.mutex);
+
+        // only this process modifies tail, so we can copy without the lock.
+        const size_t chunk= std::min(avail,left);
+        const size_t first= std::min(chunk,r.capacity-pos);
+        memcpy(dest,buffer+pos,first);
+        memcpy(dest+first,buffer,chunk-first);
+
+        lock_mutex(&r.mutex,&r.closed);
+        r.tail+= chunk;
+        pthread_cond_signal(&r.notFull);
+        pthread_mutex_unlock(&r.mutex);
+        dest+= chunk;
+        left-= chunk;
+      }
+    return 0;
+  }
+
+//! @brief Returns the name of the shared memory segment.
+const std::string &XC::SharedMemoryChannel::getSegmentName(void) const
+  { return segmentName; }
+
+//! @brief Returns true if this process has created the segment.
+bool XC::SharedMemoryChannel::isOwner(void) const
+  { return owner; }
+
+//! @brief Returns the information needed by the other process to
+//! attach to the channel.
+char *XC::SharedMemoryChannel::addToProgram(void)
+  {
+    const std::string tmp= " 3 "+segmentName+" ";
+    char *newStuff= (char *)malloc((tmp.size()+1)*sizeof(char));
+    strcpy(newStuff,tmp.c_str());
+    return newStuff;
+  }
+
+//! @brief Sets the id of the process that will attach to the
+//! segment (owner only), so setUpConnection stops waiting if that
+//! process ends before attaching.
+void XC::SharedMemoryChannel::setPeerPID(const pid_t &pid)
+  {
+    if(segment && owner)
+      {
+        lock_mutex(&segment->mutex,nullptr);
+        if(!segment->attached)
+          segment->pids[1]= pid;
+        pthread_mutex_unlock(&segment->mutex);
+      }
+  }
+
+//! @brief Sets up the connection: the owner waits until the other
+//! process attaches to the segment and then removes the segment
+//! name (the memory is released when both processes unmap it).
+//! If the id of the other process is known (see setPeerPID) the
+//! owner returns an error if that process ends before attaching.
+int XC::SharedMemoryChannel::setUpConnection(void)
+  {
+    if(!segment)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; segment not mapped." << std::endl;
+        return -1;
+      }
+    lock_mutex(&segment->mutex,nullptr);
+    if(owner)
+      {
+        while(!segment->attached)
+          if(!wait_cond(&segment->attachedCond,&segment->mutex,segment->pids[1]))
+            {
+              pthread_mutex_unlock(&segment->mutex);
+              std::cerr << nombre_clase() << "::" << __FUNCTION__
+                        << "; the other process has ended before"
+                        << " connecting." << std::endl;
+              return -1;
+            }
+      }
+    else
+      {
+        segment->pids[1]= getpid();
+        segment->attached= 1;
+        pthread_cond_broadcast(&segment->attachedCond);
+      }
+    pthread_mutex_unlock(&segment->mutex);
+    if(owner && !unlinked)
+      {
+        shm_unlink(segmentName.c_str());
+        unlinked= true;
+      }
+    return 0;
+  }
+
+//! @brief A shared memory channel can only communicate with
+//! the process on the other side of the segment.
+int XC::SharedMemoryChannel::setNextAddress(const ChannelAddress &theAddress)
+  {
+    std::cerr << nombre_clase() << "::" << __FUNCTION__
+              << "; a shared memory channel can only communicate"
+              << " with the process on the other side." << std::endl;
+    return -1;
+  }
+
+//! @brief Returns a null pointer (there is only one possible sender).
+XC::ChannelAddress *XC::SharedMemoryChannel::getLastSendersAddress(void)
+  { return nullptr; }
+
+//! @brief Sends the object.
+int XC::SharedMemoryChannel::sendObj(int commitTag,MovableObject &theObject, ChannelAddress *theAddress)
+  {
+    if(theAddress)
+      return setNextAddress(*theAddress);
+    return sendMovable(commitTag,theObject);
+  }
+
+//! @brief Receives the object.
+int XC::SharedMemoryChannel::recvObj(int commitTag, MovableObject &theObject, FEM_ObjectBroker &theBroker, ChannelAddress *theAddress)
+  {
+    if(theAddress)
+      return setNextAddress(*theAddress);
+    return receiveMovable(commitTag,theObject,theBroker);
+  }
+
+//! @brief Receives the message.
+int XC::SharedMemoryChannel::recvMsg(int dbTag, int commitTag, Message &msg, ChannelAddress *theAddress)
+  {
+    if(theAddress)
+      return setNextAddress(*theAddress);
+    return read(msg.data,msg.length);
+  }
+
+//! @brief Sends the message.
+int XC::SharedMemoryChannel::sendMsg(int dbTag, int commitTag, const Message &msg, ChannelAddress *theAddress)
+  {
+    if(theAddress)
+      return setNextAddress(*theAddress);
+    return write(msg.data,msg.length);
+  }
+
+//! @brief Receives the matrix (directly into its storage).
+int XC::SharedMemoryChannel::recvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddress *theAddress)
+  {
+    if(theAddress)
+      return setNextAddress(*theAddress);
+    return read(theMatrix.getDataPtr(),theMatrix.getNumBytes());
+  }
+
+//! @brief Sends the matrix (directly from its storage).
+int XC::SharedMemoryChannel::sendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, ChannelAddress *theAddress)
+  {
+    if(theAddress)
+      return setNextAddress(*theAddress);
+    return write(theMatrix.getDataPtr(),theMatrix.getNumBytes());
+  }
+
+//! @brief Receives the vector (directly into its storage).
+int XC::SharedMemoryChannel::recvVector(int dbTag, int commitTag, Vector &theVector, ChannelAddress *theAddress)
+  {
+    if(theAddress)
+      return setNextAddress(*theAddress);
+    return read(theVector.getDataPtr(),theVector.getNumBytes());
+  }
+
+//! @brief Sends the vector (directly from its storage).
+int XC::SharedMemoryChannel::sendVector(int dbTag, int commitTag, const Vector &theVector, ChannelAddress *theAddress)
+  {
+    if(theAddress)
+      return setNextAddress(*theAddress);
+    return write(theVector.getDataPtr(),theVector.getNumBytes());
+  }
+
+//! @brief Receives the ID (directly into its storage).
+int XC::SharedMemoryChannel::recvID(int dbTag, int commitTag, ID &theID, ChannelAddress *theAddress)
+  {
+    if(theAddress)
+      return setNextAddress(*theAddress);
+    return read(theID.getDataPtr(),theID.Size()*sizeof(int));
+  }
+
+//! @brief Sends the ID (directly from its storage).
+int XC::SharedMemoryChannel::sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress)
+  {
+    if(theAddress)
+      return setNextAddress(*theAddress);
+    return write(theID.getDataPtr(),theID.Size()*sizeof(int));
+  }
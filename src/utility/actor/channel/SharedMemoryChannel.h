@@ -0,0 +1,108 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SharedMemoryChannel.h
+
+#ifndef SharedMemoryChannel_h
+#define SharedMemoryChannel_h
+
+#include "utility/actor/channel/Channel.h"
+#include <string>
+#include <sys/types.h>
+
+namespace XC {
+struct SharedMemorySegment;
+struct SharedMemoryRing;
+
+//! @ingroup IPComm
+//
+//! @brief Channel between two processes running on the same machine.
+//!
+//! The channel uses a POSIX shared memory segment that contains
+//! two ring buffers (one for each direction), synchronized by
+//! process-shared mutexes and condition variables. The data of
+//! messages, vectors, matrices and ID's is copied directly from the
+//! object being sent into the ring and from the ring into the object
+//! being received (no intermediate buffers and no system calls while
+//! the ring has room); payloads larger than the ring are streamed
+//! through it in chunks.
+//!
+//! The process that creates the channel (see addToProgram) is the
+//! owner of the segment; the other process attaches to it using
+//! the segment name.
+class SharedMemoryChannel: public Channel
+  {
+  private:
+    std::string segmentName; //!< name of the shared memory segment.
+    bool owner; //!< true if this process has created the segment.
+    bool unlinked; //!< true if the segment name has been removed.
+    size_t segmentSize; //!< size of the mapped segment.
+    SharedMemorySegment *segment; //!< mapped segment.
+    SharedMemoryRing *sendRing; //!< ring to write on.
+    SharedMemoryRing *recvRing; //!< ring to read from.
+
+    int create_segment(const size_t &);
+    int open_segment(void);
+    void close_segment(void);
+    int write(const void *,const size_t &);
+    int read(void *,const size_t &);
+
+    SharedMemoryChannel(const SharedMemoryChannel &);
+    SharedMemoryChannel &operator=(const SharedMemoryChannel &);
+  public:
+    static const size_t defaultCapacity= 1<<22; //!< default capacity of each ring (bytes).
+    SharedMemoryChannel(const size_t &capacity= defaultCapacity);
+    SharedMemoryChannel(const std::string &);
+    ~SharedMemoryChannel(void);
+
+    const std::string &getSegmentName(void) const;
+    bool isOwner(void) const;
+
+    char *addToProgram(void);
+    void setPeerPID(const pid_t &);
+    virtual int setUpConnection(void);
+
+    int setNextAddress(const ChannelAddress &otherChannelAddress);
+    virtual ChannelAddress *getLastSendersAddress(void);
+
+    int sendObj(int commitTag, MovableObject &, ChannelAddress *theAddress= nullptr);
+    int recvObj(int commitTag, MovableObject &, FEM_ObjectBroker &, ChannelAddress *theAddress= nullptr);
+
+    int sendMsg(int dbTag, int commitTag, const Message &, ChannelAddress *theAddress= nullptr);
+    int recvMsg(int dbTag, int commitTag, Message &, ChannelAddress *theAddress= nullptr);
+
+    int sendMatrix(int dbTag, int commitTag, const Matrix &, ChannelAddress *theAddress= nullptr);
+    int recvMatrix(int dbTag, int commitTag, Matrix &, ChannelAddress *theAddress= nullptr);
+
+    int sendVector(int dbTag, int commitTag, const Vector &, ChannelAddress *theAddress= nullptr);
+    int recvVector(int dbTag, int commitTag, Vector &, ChannelAddress *theAddress= nullptr);
+
+    int sendID(int dbTag, int commitTag, const ID &, ChannelAddress *theAddress= nullptr);
+    int recvID(int dbTag, int commitTag, ID &, ChannelAddress *theAddress= nullptr);
+  };
+} // end of XC namespace
+
+#endif
@@ -21,6 +21,19 @@
 //----------------------------------------------------------------------------
 //python_interface.tcc
 
-class_<XC::Channel, bases<EntCmd>, boost::noncopyable  >("Channel", no_init);
+class_<XC::Channel, bases<EntCmd>, boost::noncopyable  >("Channel", no_init)
+  .def("setUpConnection",&XC::Channel::setUpConnection,"Sets up the connection with the other side.")
+  .def("sendVector",&XC::Channel::sendVector,"sendVector(dbTag,commitTag,v,address): sends the vector (address: None to use the default one).")
+  .def("recvVector",&XC::Channel::recvVector,"recvVector(dbTag,commitTag,v,address): receives the vector on v (address: None to use the default one).")
+  .def("sendID",&XC::Channel::sendID,"sendID(dbTag,commitTag,id,address): sends the ID (address: None to use the default one).")
+  .def("recvID",&XC::Channel::recvID,"recvID(dbTag,commitTag,id,address): receives the ID on id (address: None to use the default one).")
+  ;
+
+class_<XC::SharedMemoryChannel, bases<XC::Channel>, boost::noncopyable  >("SharedMemoryChannel", "Channel between two processes of the same machine through a shared memory segment.", init<size_t>())
+  .def(init<std::string>())
+  .add_property("segmentName",make_function(&XC::SharedMemoryChannel::getSegmentName,return_value_policy<copy_const_reference>()),"Name of the shared memory segment (the other process attaches to it).")
+  .add_property("isOwner",&XC::SharedMemoryChannel::isOwner,"True if this process has created the segment.")
+  .def("setPeerPID",&XC::SharedMemoryChannel::setPeerPID,"setPeerPID(pid): id of the process that will attach to the segment (setUpConnection fails if it ends before attaching).")
+  ;
 
 
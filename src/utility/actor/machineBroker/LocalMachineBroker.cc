@@ -0,0 +1,172 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//LocalMachineBroker.cc
+
+#include "utility/actor/machineBroker/LocalMachineBroker.h"
+#include "utility/actor/channel/SharedMemoryChannel.h"
+#include "utility/threads/parallel_for.h"
+#include <unistd.h>
+#include <sys/wait.h>
+#include <cstdio>
+
+//! @brief Constructor.
+//!
+//! @param theBroker: object broker used to create the actors.
+//! @param maxNumProc: maximum number of worker processes (if zero,
+//!                    the number of threads given by getNumThreads()).
+//! @param ringCap: capacity in bytes of each ring of the shared memory
+//!                 channels (if zero, the default capacity).
+XC::LocalMachineBroker::LocalMachineBroker(FEM_ObjectBroker *theBroker,const size_t &maxNumProc,const size_t &ringCap)
+  : MachineBroker(theBroker), maxNumProcesses(maxNumProc),
+    ringCapacity(ringCap), rank(0), myChannel(nullptr)
+  {
+    if(maxNumProcesses==0)
+      maxNumProcesses= getNumThreads();
+    if(ringCapacity==0)
+      ringCapacity= SharedMemoryChannel::defaultCapacity;
+  }
+
+//! @brief Destructor.
+XC::LocalMachineBroker::~LocalMachineBroker(void)
+  { libera(); }
+
+//! @brief Closes the channels and waits for the worker processes.
+void XC::LocalMachineBroker::libera(void)
+  {
+    const size_t sz= theChannels.size();
+    for(size_t i= 0;i<sz;i++)
+      if(theChannels[i])
+        {
+          delete theChannels[i];
+          theChannels[i]= nullptr;
+          waitpid(pids[i],nullptr,0);
+        }
+    theChannels.clear();
+    pids.clear();
+    if(myChannel)
+      {
+        delete myChannel;
+        myChannel= nullptr;
+      }
+  }
+
+//! @brief Returns the process number (0 for the main process).
+int XC::LocalMachineBroker::getPID(void)
+  { return rank; }
+
+//! @brief Returns the number of processes (main process included).
+int XC::LocalMachineBroker::getNP(void)
+  { return maxNumProcesses+1; }
+
+//! @brief Returns the channel with the main process (null pointer
+//! on the main process).
+XC::Channel *XC::LocalMachineBroker::getMyChannel(void)
+  { return myChannel; }
+
+//! @brief Body of the worker process: connects with the main
+//! process and runs the actors it requests.
+void XC::LocalMachineBroker::run_worker(const std::string &segmentName)
+  {
+    // The channels with the other workers belong to the main process.
+    theChannels.clear();
+    pids.clear();
+    myChannel= new SharedMemoryChannel(segmentName);
+    int retval= myChannel->setUpConnection();
+    if(retval==0)
+      retval= runActors();
+    delete myChannel;
+    myChannel= nullptr;
+    fflush(stdout);
+    fflush(stderr);
+    _exit((retval==0) ? 0 : 1);
+  }
+
+//! @brief Starts a new worker process and returns the channel
+//! to communicate with it.
+XC::Channel *XC::LocalMachineBroker::getRemoteProcess(void)
+  {
+    if(rank != 0)
+      {
+        std::cerr << "LocalMachineBroker::" << __FUNCTION__
+                  << "; worker processes can't start other processes.\n";
+        return nullptr;
+      }
+    size_t numRunning= 0;
+    for(size_t i= 0;i<theChannels.size();i++)
+      if(theChannels[i])
+        numRunning++;
+    if(numRunning>=maxNumProcesses)
+      {
+        std::cerr << "LocalMachineBroker::" << __FUNCTION__
+                  << "; maximum number of processes ("
+                  << maxNumProcesses << ") reached.\n";
+        return nullptr;
+      }
+    SharedMemoryChannel *theChannel= new SharedMemoryChannel(ringCapacity);
+    const std::string segmentName= theChannel->getSegmentName();
+    fflush(stdout);
+    fflush(stderr);
+    const pid_t pid= fork();
+    if(pid<0)
+      {
+        std::cerr << "LocalMachineBroker::" << __FUNCTION__
+                  << "; can't create worker process.\n";
+        delete theChannel;
+        return nullptr;
+      }
+    if(pid==0) // worker.
+      {
+        rank= theChannels.size()+1;
+        run_worker(segmentName); // never returns.
+      }
+    theChannel->setPeerPID(pid);
+    if(theChannel->setUpConnection()<0)
+      {
+        delete theChannel;
+        waitpid(pid,nullptr,0);
+        return nullptr;
+      }
+    theChannels.push_back(theChannel);
+    pids.push_back(pid);
+    return theChannel;
+  }
+
+//! @brief Closes the channel and waits for the worker process to end.
+int XC::LocalMachineBroker::freeProcess(Channel *theChannel)
+  {
+    const size_t sz= theChannels.size();
+    for(size_t i= 0;i<sz;i++)
+      if(theChannels[i] && (theChannels[i] == theChannel))
+        {
+          delete theChannels[i];
+          theChannels[i]= nullptr;
+          waitpid(pids[i],nullptr,0);
+          return 0;
+        }
+    // channel not found!
+    return -1;
+  }
@@ -0,0 +1,77 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//LocalMachineBroker.h
+
+#ifndef LocalMachineBroker_h
+#define LocalMachineBroker_h
+
+#include "MachineBroker.h"
+#include <sys/types.h>
+
+namespace XC {
+class SharedMemoryChannel;
+
+//! @ingroup IPComm
+//
+//! @brief Machine broker that runs the actors on worker processes
+//! of the local machine.
+//!
+//! Each call to getRemoteProcess forks a worker process from the
+//! current one (so the worker shares the state of the program at
+//! the moment of its creation) and connects with it through a
+//! SharedMemoryChannel; the worker runs the actors requested by the
+//! main process (see MachineBroker::runActors) until it is shut down.
+class LocalMachineBroker: public MachineBroker
+  {
+  private:
+    size_t maxNumProcesses; //!< maximum number of worker processes.
+    size_t ringCapacity; //!< capacity of the channel rings (bytes).
+    int rank; //!< 0 on the main process, worker number on the workers.
+    std::vector<SharedMemoryChannel *> theChannels; //!< channels with the workers (main process).
+    std::vector<pid_t> pids; //!< process ids of the workers (main process).
+    SharedMemoryChannel *myChannel; //!< channel with the main process (workers).
+
+    void libera(void);
+    void run_worker(const std::string &);
+    LocalMachineBroker(const LocalMachineBroker &);
+    LocalMachineBroker &operator=(const LocalMachineBroker &);
+  public:
+    LocalMachineBroker(FEM_ObjectBroker *theBroker,const size_t &maxNumProcesses= 0,const size_t &ringCapacity= 0);
+    ~LocalMachineBroker(void);
+
+    // methods to return info about local process id and num processes
+    int getPID(void);
+    int getNP(void);
+
+    // methods to get and free Channels (processes)
+    Channel *getMyChannel(void);
+    Channel *getRemoteProcess(void);
+    int freeProcess(Channel *);
+  };
+} // end of XC namespace
+
+#endif
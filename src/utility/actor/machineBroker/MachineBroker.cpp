@@ -104,7 +104,10 @@ int XC::MachineBroker::runActors(void)
     while(done == 0)
       {
         if(theChannel->recvID(0, 0, idData) < 0)
-          { std::cerr << "MachineBroker::runActors(void) - failed to recv XC::ID\n"; }
+          {
+            std::cerr << "MachineBroker::runActors(void) - failed to recv XC::ID\n";
+            return -1; // the channel is no longer usable.
+          }
 
         const int actorType = idData(0);
     
@@ -132,11 +135,14 @@ int XC::MachineBroker::runActors(void)
             if(theChannel->sendID(0, 0, idData) < 0)
               { std::cerr << "MachineBroker::run(void) - failed to send XC::ID\n"; }
 
-            // run the actor object
-            if(theActor->run() != 0)
-              { std::cerr << "MachineBroker::run(void) - actor failed while running\n"; }  
-            // destroying theActor
-            delete theActor;
+            if(theActor)
+              {
+                // run the actor object
+                if(theActor->run() != 0)
+                  { std::cerr << "MachineBroker::run(void) - actor failed while running\n"; }  
+                // destroying theActor
+                delete theActor;
+              }
           }
         done = 0;
       }
@@ -165,9 +171,9 @@ XC::Channel *XC::MachineBroker::startActor(int actorType, int compDemand)
             if(activeChannels(i) == 0)
               {
                 theChannel = actorChannels[i];
-                i=numActorChannels;
                 numActiveChannels++;
                 activeChannels(i) = 1;
+                break;
               }
           }
       }
@@ -183,6 +189,8 @@ XC::Channel *XC::MachineBroker::startActor(int actorType, int compDemand)
           }
         actorChannels.resize(numActorChannels+1,nullptr);
         activeChannels.resize(numActorChannels+1);
+        actorChannels[numActorChannels]= theChannel;
+        activeChannels(numActorChannels)= 1;
 
         numActorChannels++;
         numActiveChannels++;    
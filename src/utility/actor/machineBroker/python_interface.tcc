@@ -0,0 +1,36 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//python_interface.tcc
+
+class_<XC::FEM_ObjectBroker, boost::noncopyable >("FEM_ObjectBroker", no_init)
+  ;
+
+class_<XC::MachineBroker, boost::noncopyable >("MachineBroker", no_init)
+  .add_property("PID",&XC::MachineBroker::getPID,"Number of this process (0 for the main process).")
+  .add_property("NP",&XC::MachineBroker::getNP,"Number of processes.")
+  .def("getRemoteProcess",&XC::MachineBroker::getRemoteProcess,return_internal_reference<>(),"Starts a new process and returns the channel to communicate with it.")
+  .def("freeProcess",&XC::MachineBroker::freeProcess,"freeProcess(channel): closes the channel and waits for the process to end.")
+  .def("shutdown",&XC::MachineBroker::shutdown,"Ends the processes running actors.")
+  ;
+
+class_<XC::LocalMachineBroker, bases<XC::MachineBroker>, boost::noncopyable >("LocalMachineBroker", "Machine broker that runs the actors on worker processes of the local machine.", init<XC::FEM_ObjectBroker *,size_t,size_t>()[with_custodian_and_ward<1,2>()])
+  ;
@@ -92,6 +92,9 @@ class Message
     friend class TCP_SocketNoDelay;
     friend class UDP_Socket;
     friend class MPI_Channel;
+    friend class SharedMemoryChannel;
+    friend class MappedFileDatastore;
+    friend class MemoryDatastore;
   };
 } // end of XC namespace
 
@@ -927,6 +927,9 @@ XC::DataOutputHandler *XC::FEM_ObjectBroker::getPtrNewDataOutputHandler(int clas
         case DATAHANDLER_TAGS_DataOutputDatabaseHandler:
              return new DataOutputDatabaseHandler();
 
+        case DATAHANDLER_TAGS_DataOutputHDF5Handler:
+             return new DataOutputHDF5Handler();
+
         default:
              std::cerr << "FEM_ObjectBroker::getPtrNewDataOutputHandler - ";
              std::cerr << " - no XC::DataOutputHandler type exists for class tag ";
@@ -1062,6 +1065,9 @@ XC::EquiSolnAlgo *XC::FEM_ObjectBroker::getNewEquiSolnAlgo(int classTag)
         case EquiALGORITHM_TAGS_Broyden:
              return new Broyden(nullptr);
 
+        case EquiALGORITHM_TAGS_AdaptiveNewton:
+             return new AdaptiveNewton(nullptr);
+
         default:
              std::cerr << "FEM_ObjectBroker::getNewEquiSolnAlgo - ";
              std::cerr << " - no XC::EquiSolnAlgo type exists for class tag ";
@@ -464,6 +464,9 @@ XC::TimeSeries *XC::FEM_ObjectBrokerAllClasses::getNewTimeSeries(int classTag)
         case TSERIES_TAG_PathSeries:
           return new PathSeries;
 
+        case TSERIES_TAG_MappedPathSeries:
+          return new MappedPathSeries;
+
         case TSERIES_TAG_ConstantSeries:
           return new ConstantSeries;
 
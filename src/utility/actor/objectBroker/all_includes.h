@@ -234,6 +234,9 @@
 
 #include "utility/handler/DataOutputStreamHandler.h"
 #include "utility/handler/DataOutputFileHandler.h"
+#include "utility/handler/DataOutputHDF5Handler.h"
+#include "utility/handler/HDF5ResultsStore.h"
+#include "post_process/FieldExtractor.h"
 #include "utility/handler/DataOutputDatabaseHandler.h"
 
 #include "utility/recorder/NodeRecorder.h"
@@ -241,6 +244,7 @@
 #include "utility/recorder/PropRecorder.h"
 #include "utility/recorder/NodePropRecorder.h"
 #include "utility/recorder/ElementPropRecorder.h"
+#include "utility/recorder/VtkRecorder.h"
 #include "utility/recorder/EnvelopeNodeRecorder.h"
 #include "utility/recorder/EnvelopeElementRecorder.h"
 #include "utility/recorder/response/Response.h"
@@ -377,6 +381,7 @@
 #include "domain/load/pattern/time_series/LinearSeries.h"
 #include "domain/load/pattern/time_series/PathSeries.h"
 #include "domain/load/pattern/time_series/PathTimeSeries.h"
+#include "domain/load/pattern/time_series/MappedPathSeries.h"
 #include "domain/load/pattern/time_series/PathSeriesBase.h"
 #include "domain/load/pattern/time_series/RectangularSeries.h"
 #include "domain/load/pattern/time_series/ConstantSeries.h"
@@ -432,6 +437,9 @@
 #include "utility/matrix/ID.h"
 #include "utility/xc_python_utils.h"
 #include "utility/database/SQLiteDatastore.h"
+#include "utility/database/MappedFileDatastore.h"
+#include "utility/database/MemoryDatastore.h"
+#include "utility/database/CheckpointDatastore.h"
 #include "utility/database/OracleDatastore.h"
 #include "utility/database/BerkeleyDbDatastore.h"
 #include "utility/database/NEESData.h"
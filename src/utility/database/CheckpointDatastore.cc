@@ -0,0 +1,310 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CheckpointDatastore.cc
+
+#include <utility/database/CheckpointDatastore.h>
+#include <utility/actor/actor/MovableObject.h>
+#include <utility/actor/actor/CommParameters.h>
+#include "preprocessor/Preprocessor.h"
+#include "domain/domain/Domain.h"
+#include <utility/matrix/Vector.h>
+#include <boost/thread/thread.hpp>
+#include <zlib.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace XC {
+//! @brief File signature.
+static const char checkpoint_magic[8]= {'X','C','C','K','P','T','0','2'};
+
+//! @brief Returns the size of each value of the record type.
+static size_t checkpoint_value_size(const int &type)
+  {
+    switch(type)
+      {
+      case MemoryDatastore::MSG:
+        return sizeof(char);
+      case MemoryDatastore::MATRIX:
+      case MemoryDatastore::VECTOR:
+        return sizeof(double);
+      case MemoryDatastore::IDS:
+        return sizeof(int);
+      default:
+        return 0;
+      }
+  }
+
+//! @brief Writes the whole block to the file descriptor.
+static bool checkpoint_write_all(const int &fd,const char *data,size_t numBytes)
+  {
+    while(numBytes>0)
+      {
+        const ssize_t written= ::write(fd,data,numBytes);
+        if(written<=0)
+          return false;
+        data+= written;
+        numBytes-= written;
+      }
+    return true;
+  }
+
+//! @brief Flushes to disk the directory that contains the file
+//! (so the rename is durable).
+static bool checkpoint_sync_dir(const std::string &fName)
+  {
+    const size_t pos= fName.find_last_of('/');
+    const std::string dirName= (pos==std::string::npos) ? "." : ((pos==0) ? "/" : fName.substr(0,pos));
+    const int fd= ::open(dirName.c_str(),O_RDONLY);
+    if(fd<0)
+      return false;
+    const bool retval= (fsync(fd)==0);
+    ::close(fd);
+    return retval;
+  }
+} // end of XC namespace
+
+//! @brief Writes the file.
+void XC::CheckpointDatastore::Writer::operator()(void)
+  { ds->writeStatus= ds->write_file(); }
+
+//! @brief Constructor.
+//!
+//! @param fName: name of the checkpoint file.
+XC::CheckpointDatastore::CheckpointDatastore(const std::string &fName, Preprocessor &preprocessor, FEM_ObjectBroker &theObjectBroker)
+  :MemoryDatastore(preprocessor, theObjectBroker,1), fileName(fName),
+   compressionLevel(1), asynchronous(true), writer(nullptr), writeStatus(0) {}
+
+//! @brief Destructor (waits until the file is written).
+XC::CheckpointDatastore::~CheckpointDatastore(void)
+  { wait(); }
+
+//! @brief Waits until the background thread finishes writing
+//! the file and returns the result of the write.
+int XC::CheckpointDatastore::wait(void)
+  {
+    if(writer)
+      {
+        writer->join();
+        delete writer;
+        writer= nullptr;
+      }
+    return writeStatus;
+  }
+
+//! @brief Copies the records of the snapshot to the buffer.
+//!
+//! The buffer contains: commit tag, preprocessor dbTag, dbTag of
+//! the additional object, number of records and then, for each
+//! record, its dbTag, type and size followed by its values. At the
+//! end goes the output state of the recorders (size and values).
+void XC::CheckpointDatastore::flatten(const int &commitTag,const int &objDbTag,const Vector &recordersState)
+  {
+    buffer.clear();
+    const record_blocks *records= get_records(commitTag);
+    if(records)
+      {
+        const int32_t hdr[4]= {commitTag,get_preprocessor()->getDbTag(),objDbTag,int32_t(records->size())};
+        buffer.insert(buffer.end(),reinterpret_cast<const char *>(hdr),reinterpret_cast<const char *>(hdr)+sizeof(hdr));
+        for(record_blocks::const_iterator i= records->begin();i!=records->end();i++)
+          {
+            const int32_t key[3]= {i->first.dbTag,i->first.type,i->first.size};
+            buffer.insert(buffer.end(),reinterpret_cast<const char *>(key),reinterpret_cast<const char *>(key)+sizeof(key));
+            const std::vector<char> &data= get_block_data(i->second);
+            buffer.insert(buffer.end(),data.begin(),data.end());
+          }
+        const int32_t sz= recordersState.Size();
+        buffer.insert(buffer.end(),reinterpret_cast<const char *>(&sz),reinterpret_cast<const char *>(&sz)+sizeof(sz));
+        for(int32_t i= 0;i<sz;i++)
+          {
+            const double value= recordersState(i);
+            buffer.insert(buffer.end(),reinterpret_cast<const char *>(&value),reinterpret_cast<const char *>(&value)+sizeof(value));
+          }
+      }
+  }
+
+//! @brief Compresses the buffer and writes it to the file. The
+//! temporary file is flushed to disk before renaming it and the
+//! directory after it, so a crash leaves either the previous
+//! checkpoint or the new one.
+int XC::CheckpointDatastore::write_file(void)
+  {
+    uLongf compressedSize= compressBound(buffer.size());
+    std::vector<char> compressed(compressedSize);
+    if(compress2(reinterpret_cast<Bytef *>(&compressed[0]),&compressedSize,reinterpret_cast<const Bytef *>(&buffer[0]),buffer.size(),compressionLevel)!=Z_OK)
+      {
+        std::cerr << "CheckpointDatastore::" << __FUNCTION__
+                  << "; compression failed." << std::endl;
+        return -1;
+      }
+    const std::string tmpName= fileName+".tmp";
+    const uint64_t sizes[2]= {buffer.size(),compressedSize};
+    bool ok= false;
+    const int fd= ::open(tmpName.c_str(),O_WRONLY|O_CREAT|O_TRUNC,0644);
+    if(fd>=0)
+      {
+        ok= checkpoint_write_all(fd,checkpoint_magic,sizeof(checkpoint_magic));
+        ok= ok && checkpoint_write_all(fd,reinterpret_cast<const char *>(sizes),sizeof(sizes));
+        ok= ok && checkpoint_write_all(fd,&compressed[0],compressedSize);
+        ok= ok && (fsync(fd)==0); //data on disk before the rename.
+        ok= (::close(fd)==0) && ok;
+      }
+    ok= ok && (rename(tmpName.c_str(),fileName.c_str())==0);
+    ok= ok && checkpoint_sync_dir(fileName);
+    if(!ok)
+      {
+        std::cerr << "CheckpointDatastore::" << __FUNCTION__
+                  << "; can't write file: " << fileName << std::endl;
+        return -1;
+      }
+    return 0;
+  }
+
+//! @brief Saves the state of the model (and the state of the object
+//! being passed as parameter) and writes it to the checkpoint file.
+//! The output of the recorders is flushed and its position (see
+//! Recorder::getOutputState) is saved too.
+//!
+//! @param commitTag: identifier of the checkpoint (greater than 0).
+//! @param obj: additional object to store (i.e. the integrator).
+int XC::CheckpointDatastore::saveCheckpoint(const int &commitTag,MovableObject *obj)
+  {
+    if(wait()<0)
+      std::cerr << "CheckpointDatastore::" << __FUNCTION__
+                << "; the previous checkpoint was not written." << std::endl;
+    if(obj && (obj->getDbTag()==0))
+      obj->setDbTag(getDbTag()); // before lastDbTag is saved.
+    int retval= commitState(commitTag);
+    if((retval>=0) && obj)
+      {
+        CommParameters cp(commitTag,*this);
+        retval= obj->sendSelf(cp);
+      }
+    if(retval<0)
+      {
+        std::cerr << "CheckpointDatastore::" << __FUNCTION__
+                  << "; can't save the state: " << commitTag << std::endl;
+        erase(commitTag);
+        return retval;
+      }
+    Domain *dom= get_preprocessor()->getDomain();
+    flatten(commitTag,(obj ? obj->getDbTag() : 0),(dom ? dom->getRecordersOutputState() : Vector()));
+    if(asynchronous)
+      writer= new boost::thread(Writer(this));
+    else
+      retval= writeStatus= write_file();
+    return retval;
+  }
+
+//! @brief Restores the state of the model (and the state of the object
+//! being passed as parameter) from the checkpoint file. The output
+//! written by the recorders after the checkpoint is discarded, so
+//! the steps computed again are not written twice. Returns the
+//! identifier of the checkpoint or a negative number in case of error.
+int XC::CheckpointDatastore::loadCheckpoint(MovableObject *obj)
+  {
+    wait();
+    std::ifstream in(fileName.c_str(),std::ios::binary);
+    char magic[sizeof(checkpoint_magic)];
+    uint64_t sizes[2]= {0,0};
+    in.read(magic,sizeof(magic));
+    in.read(reinterpret_cast<char *>(sizes),sizeof(sizes));
+    if(!in || (memcmp(magic,checkpoint_magic,sizeof(magic))!=0))
+      {
+        std::cerr << "CheckpointDatastore::" << __FUNCTION__
+                  << "; can't read checkpoint file: " << fileName << std::endl;
+        return -1;
+      }
+    std::vector<char> compressed(sizes[1]);
+    in.read(&compressed[0],sizes[1]);
+    buffer.resize(sizes[0]);
+    uLongf rawSize= sizes[0];
+    if(!in || (uncompress(reinterpret_cast<Bytef *>(&buffer[0]),&rawSize,reinterpret_cast<const Bytef *>(&compressed[0]),sizes[1])!=Z_OK) || (rawSize!=sizes[0]))
+      {
+        std::cerr << "CheckpointDatastore::" << __FUNCTION__
+                  << "; corrupted checkpoint file: " << fileName << std::endl;
+        return -1;
+      }
+    int32_t hdr[4]= {0,0,0,0};
+    if(buffer.size()>=sizeof(hdr))
+      memcpy(hdr,&buffer[0],sizeof(hdr));
+    const int commitTag= hdr[0];
+    clear();
+    size_t offset= sizeof(hdr);
+    for(int32_t i= 0;i<hdr[3];i++)
+      {
+        int32_t key[3]= {0,0,0};
+        if(offset+sizeof(key)<=buffer.size())
+          memcpy(key,&buffer[0]+offset,sizeof(key));
+        offset+= sizeof(key);
+        const size_t valueSize= checkpoint_value_size(key[1]);
+        const size_t numBytes= size_t(key[2])*valueSize;
+        if((valueSize==0) || (key[2]<0) || (offset+numBytes>buffer.size()))
+          {
+            std::cerr << "CheckpointDatastore::" << __FUNCTION__
+                      << "; wrong record in checkpoint file: "
+                      << fileName << std::endl;
+            clear();
+            return -1;
+          }
+        storeData(static_cast<RecordType>(key[1]),key[0],commitTag,&buffer[0]+offset,key[2],valueSize);
+        offset+= numBytes;
+      }
+    int32_t numValues= 0;
+    if(offset+sizeof(numValues)<=buffer.size())
+      memcpy(&numValues,&buffer[0]+offset,sizeof(numValues));
+    offset+= sizeof(numValues);
+    if((numValues<0) || (offset+numValues*sizeof(double)>buffer.size()))
+      {
+        std::cerr << "CheckpointDatastore::" << __FUNCTION__
+                  << "; wrong recorder state in checkpoint file: "
+                  << fileName << std::endl;
+        clear();
+        return -1;
+      }
+    Vector recordersState(numValues);
+    for(int32_t i= 0;i<numValues;i++)
+      memcpy(&recordersState(i),&buffer[0]+offset+i*sizeof(double),sizeof(double));
+    get_preprocessor()->setDbTag(hdr[1]);
+    int retval= restoreState(commitTag);
+    if((retval>=0) && obj)
+      {
+        obj->setDbTag(hdr[2]);
+        CommParameters cp(commitTag,*this,*getObjectBroker());
+        retval= obj->recvSelf(cp);
+      }
+    Domain *dom= get_preprocessor()->getDomain();
+    if((retval>=0) && dom && (dom->setRecordersOutputState(recordersState)<0))
+      std::cerr << "CheckpointDatastore::" << __FUNCTION__
+                << "; can't restore the output of the recorders." << std::endl;
+    if(retval>=0)
+      retval= commitTag;
+    return retval;
+  }
@@ -0,0 +1,105 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CheckpointDatastore.h
+
+#ifndef CheckpointDatastore_h
+#define CheckpointDatastore_h
+
+#include "MemoryDatastore.h"
+
+namespace boost {
+class thread;
+}
+
+namespace XC {
+class MovableObject;
+class Vector;
+
+//! @ingroup Database
+//
+//! @brief Datastore that writes the last saved state of the model
+//! (and, optionally, the state of another object, i.e. the integrator
+//! of a transient analysis) to a compressed checkpoint file.
+//!
+//! The state is captured in memory (see MemoryDatastore) and then
+//! compressed (zlib) and written to the file on a background thread,
+//! so the analysis can go on while the file is written. The file
+//! is written with a temporary name, flushed to disk and renamed
+//! when complete, so the previous checkpoint remains valid if the
+//! program dies while the new one is being written.
+//!
+//! The position of the output of the domain recorders is saved
+//! too; on restart the output written after the checkpoint is
+//! discarded, so the recomputed steps are not written twice.
+class CheckpointDatastore: public MemoryDatastore
+  {
+  private:
+    //! @brief Writes the checkpoint file on the background thread.
+    class Writer
+      {
+        CheckpointDatastore *ds;
+      public:
+        Writer(CheckpointDatastore *d)
+          : ds(d) {}
+        void operator()(void);
+      };
+    friend class Writer;
+
+    std::string fileName; //!< Name of the checkpoint file.
+    int compressionLevel; //!< zlib compression level (1: fastest, 9: best).
+    bool asynchronous; //!< If true write the file on a background thread.
+    boost::thread *writer; //!< Background thread.
+    std::vector<char> buffer; //!< Uncompressed contents of the file.
+    int writeStatus; //!< Result of the last write.
+
+    void flatten(const int &,const int &,const Vector &);
+    int write_file(void);
+
+    CheckpointDatastore(const CheckpointDatastore &);
+    CheckpointDatastore &operator=(const CheckpointDatastore &);
+  public:
+    CheckpointDatastore(const std::string &,Preprocessor &, FEM_ObjectBroker &);
+    ~CheckpointDatastore(void);
+
+    inline const std::string &getFileName(void) const
+      { return fileName; }
+    inline int getCompressionLevel(void) const
+      { return compressionLevel; }
+    inline void setCompressionLevel(const int &l)
+      { compressionLevel= l; }
+    inline bool getAsynchronous(void) const
+      { return asynchronous; }
+    inline void setAsynchronous(const bool &b)
+      { asynchronous= b; }
+
+    int wait(void);
+    int saveCheckpoint(const int &,MovableObject *obj= nullptr);
+    int loadCheckpoint(MovableObject *obj= nullptr);
+  };
+} // end of XC namespace
+
+#endif
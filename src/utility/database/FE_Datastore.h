@@ -84,6 +84,8 @@ class FE_Datastore: public Channel
     FEM_ObjectBroker *getObjectBroker(void);
     const Preprocessor *get_preprocessor(void) const
       { return preprocessor; }
+    Preprocessor *get_preprocessor(void)
+      { return preprocessor; }
   public:
     FE_Datastore(Preprocessor &, FEM_ObjectBroker &theBroker);
     inline virtual ~FE_Datastore(void) {} 
@@ -106,7 +108,7 @@ class FE_Datastore: public Channel
 
     virtual int commitState(int commitTag);
     virtual int restoreState(int commitTag);
-    bool isSaved(int commitTag) const;
+    virtual bool isSaved(int commitTag) const;
 
     virtual int createTable(const std::string &tableName, const std::vector<std::string> &);
     virtual int insertData(const std::string &tableName,const std::vector<std::string> &, int commitTag, const Vector &data);
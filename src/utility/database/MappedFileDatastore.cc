@@ -0,0 +1,419 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MappedFileDatastore.cc
+
+#include <utility/database/MappedFileDatastore.h>
+#include <utility/matrix/Vector.h>
+#include <utility/matrix/Matrix.h>
+#include <utility/matrix/ID.h>
+#include <utility/actor/message/Message.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <cstring>
+
+namespace XC {
+//! @brief File signature.
+static const char mapped_file_magic[8]= {'X','C','M','F','D','S','0','1'};
+//! @brief Size of the file header (signature and committed size).
+static const uint64_t mapped_file_header_size= 64;
+//! @brief Size of the record header (dbTag, commitTag, type and size).
+static const uint64_t record_header_size= 4*sizeof(int32_t);
+//! @brief Initial size of the file.
+static const uint64_t mapped_file_initial_size= 1<<20;
+
+//! @brief Returns the size of each value of the record type.
+static size_t record_value_size(const int &type)
+  {
+    switch(type)
+      {
+      case MappedFileDatastore::MSG:
+        return sizeof(char);
+      case MappedFileDatastore::MATRIX:
+      case MappedFileDatastore::VECTOR:
+        return sizeof(double);
+      case MappedFileDatastore::IDS:
+        return sizeof(int);
+      default:
+        return 0;
+      }
+  }
+
+//! @brief Returns the size of the record values padded to 8 bytes.
+inline uint64_t padded_size(const uint64_t &numBytes)
+  { return (numBytes+7) & ~uint64_t(7); }
+} // end of XC namespace
+
+//! @brief Constructor.
+XC::MappedFileDatastore::RecordKey::RecordKey(const int &dbt,const int &ct,const int &t,const int &sz)
+  : dbTag(dbt), commitTag(ct), type(t), size(sz) {}
+
+//! @brief Order of the keys in the index.
+bool XC::MappedFileDatastore::RecordKey::operator<(const RecordKey &other) const
+  {
+    if(dbTag!=other.dbTag) return (dbTag<other.dbTag);
+    if(commitTag!=other.commitTag) return (commitTag<other.commitTag);
+    if(type!=other.type) return (type<other.type);
+    return (size<other.size);
+  }
+
+//! @brief Constructor.
+//!
+//! @param fName: name of the file (created if it doesn't exists).
+XC::MappedFileDatastore::MappedFileDatastore(const std::string &fName, Preprocessor &preprocessor, FEM_ObjectBroker &theObjectBroker)
+  :DBDatastore(preprocessor, theObjectBroker), fileName(fName), fd(-1),
+   mappedData(nullptr), capacity(0), committedSize(0), syncOnCommit(true)
+  {
+    if(open()!=0)
+      {
+        std::cerr << "MappedFileDatastore::MappedFileDatastore() - could not open the file: "
+                  << fileName << std::endl;
+        close();
+      }
+  }
+
+//! @brief Destructor.
+XC::MappedFileDatastore::~MappedFileDatastore(void)
+  { close(); }
+
+//! @brief Maps the file in memory with the size being passed
+//! as parameter (the file is enlarged if needed).
+int XC::MappedFileDatastore::map(const uint64_t &sz)
+  {
+    if(mappedData)
+      {
+        munmap(mappedData,capacity);
+        mappedData= nullptr;
+        capacity= 0;
+      }
+    struct stat st;
+    if(fstat(fd,&st)!=0)
+      return -1;
+    if((uint64_t(st.st_size)<sz) && (ftruncate(fd,sz)!=0))
+      {
+        std::cerr << "MappedFileDatastore::" << __FUNCTION__
+                  << "; can't resize file: " << fileName
+                  << " to " << sz << " bytes." << std::endl;
+        return -1;
+      }
+    void *ptr= mmap(nullptr,sz,PROT_READ|PROT_WRITE,MAP_SHARED,fd,0);
+    if(ptr==MAP_FAILED)
+      {
+        std::cerr << "MappedFileDatastore::" << __FUNCTION__
+                  << "; can't map file: " << fileName << std::endl;
+        return -1;
+      }
+    mappedData= static_cast<char *>(ptr);
+    capacity= sz;
+    return 0;
+  }
+
+//! @brief Opens (or creates) the file and builds the index
+//! of the committed records.
+int XC::MappedFileDatastore::open(void)
+  {
+    fd= ::open(fileName.c_str(),O_RDWR|O_CREAT,0644);
+    if(fd<0)
+      return -1;
+    struct stat st;
+    if(fstat(fd,&st)!=0)
+      return -1;
+    const uint64_t fileSize= st.st_size;
+    if(fileSize==0) //new file.
+      {
+        if(map(mapped_file_initial_size)!=0)
+          return -1;
+        memset(mappedData,0,mapped_file_header_size);
+        memcpy(mappedData,mapped_file_magic,sizeof(mapped_file_magic));
+        committedSize= mapped_file_header_size;
+        memcpy(mappedData+sizeof(mapped_file_magic),&committedSize,sizeof(committedSize));
+        return 0;
+      }
+    if(fileSize<mapped_file_header_size)
+      {
+        std::cerr << "MappedFileDatastore::" << __FUNCTION__
+                  << "; file: " << fileName
+                  << " is not a mapped file datastore." << std::endl;
+        return -1;
+      }
+    if(map(fileSize)!=0)
+      return -1;
+    if(memcmp(mappedData,mapped_file_magic,sizeof(mapped_file_magic))!=0)
+      {
+        std::cerr << "MappedFileDatastore::" << __FUNCTION__
+                  << "; file: " << fileName
+                  << " is not a mapped file datastore." << std::endl;
+        return -1;
+      }
+    memcpy(&committedSize,mappedData+sizeof(mapped_file_magic),sizeof(committedSize));
+    if((committedSize<mapped_file_header_size) || (committedSize>fileSize))
+      {
+        std::cerr << "MappedFileDatastore::" << __FUNCTION__
+                  << "; file: " << fileName << " is corrupted." << std::endl;
+        return -1;
+      }
+    return scan();
+  }
+
+//! @brief Builds the index of the committed records.
+int XC::MappedFileDatastore::scan(void)
+  {
+    index.clear();
+    commits.clear();
+    uint64_t offset= mapped_file_header_size;
+    while(offset+record_header_size<=committedSize)
+      {
+        int32_t hdr[4];
+        memcpy(hdr,mappedData+offset,record_header_size);
+        const size_t valueSize= record_value_size(hdr[2]);
+        const uint64_t next= offset+record_header_size+padded_size(uint64_t(hdr[3])*valueSize);
+        if(((valueSize==0) && (hdr[2]!=COMMIT)) || (hdr[3]<0) || (next>committedSize))
+          {
+            std::cerr << "MappedFileDatastore::" << __FUNCTION__
+                      << "; wrong record at offset: " << offset
+                      << " of file: " << fileName << std::endl;
+            return -1;
+          }
+        if(hdr[2]==COMMIT)
+          commits[hdr[1]]= offset;
+        else
+          index[RecordKey(hdr[0],hdr[1],hdr[2],hdr[3])]= offset;
+        offset= next;
+      }
+    return 0;
+  }
+
+//! @brief Copies the pending records to the mapped file and then
+//! updates the committed size in the file header. If syncOnCommit
+//! is true the records reach the disk before the header does.
+int XC::MappedFileDatastore::write_batch(const int &commitTag)
+  {
+    if(batch.empty())
+      return 0;
+    const uint64_t newSize= committedSize+batch.size();
+    if(newSize>capacity)
+      {
+        uint64_t newCapacity= std::max(capacity,mapped_file_initial_size);
+        while(newCapacity<newSize)
+          newCapacity*= 2;
+        if(map(newCapacity)!=0)
+          return -1;
+      }
+    memcpy(mappedData+committedSize,&batch[0],batch.size());
+    if(syncOnCommit)
+      {
+        const uint64_t pageSize= sysconf(_SC_PAGESIZE);
+        const uint64_t first= (committedSize/pageSize)*pageSize;
+        if(msync(mappedData+first,newSize-first,MS_SYNC)!=0)
+          {
+            std::cerr << "MappedFileDatastore::" << __FUNCTION__
+                      << "; can't flush the data of commit: "
+                      << commitTag << std::endl;
+            return -1;
+          }
+      }
+    committedSize= newSize;
+    memcpy(mappedData+sizeof(mapped_file_magic),&committedSize,sizeof(committedSize));
+    if(syncOnCommit)
+      msync(mappedData,mapped_file_header_size,MS_SYNC);
+    batch.clear();
+    replaced.clear();
+    return 0;
+  }
+
+//! @brief Discards the pending records, restoring the index entries
+//! of the committed records they replaced.
+void XC::MappedFileDatastore::discard_batch(void)
+  {
+    batch.clear();
+    for(record_index::iterator i= index.begin();i!=index.end();)
+      {
+        if(i->second>=committedSize)
+          index.erase(i++);
+        else
+          i++;
+      }
+    for(record_index::const_iterator i= replaced.begin();i!=replaced.end();i++)
+      index[i->first]= i->second;
+    replaced.clear();
+  }
+
+//! @brief Closes the file. The pending records (not committed)
+//! are discarded.
+void XC::MappedFileDatastore::close(void)
+  {
+    discard_batch();
+    if(mappedData)
+      {
+        munmap(mappedData,capacity);
+        mappedData= nullptr;
+        capacity= 0;
+      }
+    if(fd>=0)
+      {
+        if(committedSize>=mapped_file_header_size)
+          if(ftruncate(fd,committedSize)!=0)
+            std::cerr << "MappedFileDatastore::" << __FUNCTION__
+                      << "; can't truncate file: " << fileName << std::endl;
+        ::close(fd);
+        fd= -1;
+      }
+  }
+
+//! @brief Returns true if the state has been saved (in this
+//! session or in a previous one).
+bool XC::MappedFileDatastore::isSaved(int commitTag) const
+  { return (commits.count(commitTag)>0) || DBDatastore::isSaved(commitTag); }
+
+//! @brief Stores the model state. All the records of the state are
+//! written in a single block, followed by a commit mark; if any of
+//! them fails nothing is written.
+int XC::MappedFileDatastore::commitState(int commitTag)
+  {
+    if(!mappedData)
+      return -1;
+    int retval= DBDatastore::commitState(commitTag);
+    if(retval>=0)
+      {
+        const uint64_t offset= committedSize+batch.size();
+        storeData(COMMIT,0,commitTag,nullptr,0,0);
+        if(write_batch(commitTag)==0)
+          commits[commitTag]= offset;
+        else
+          retval= -1;
+      }
+    if(retval<0) // discard the pending records.
+      discard_batch();
+    return retval;
+  }
+
+//! @brief Appends a record to the pending block.
+int XC::MappedFileDatastore::storeData(const RecordType &type,const int &dbTag,const int &commitTag,const void *values,const int &sz,const size_t &valueSize)
+  {
+    if(!mappedData)
+      return -1;
+    const uint64_t offset= committedSize+batch.size();
+    const uint64_t numBytes= uint64_t(sz)*valueSize;
+    const int32_t hdr[4]= {dbTag,commitTag,type,sz};
+    const size_t first= batch.size();
+    batch.resize(first+record_header_size+padded_size(numBytes),0);
+    memcpy(&batch[first],hdr,record_header_size);
+    if(numBytes)
+      memcpy(&batch[first+record_header_size],values,numBytes);
+    if(type!=COMMIT)
+      {
+        const RecordKey key(dbTag,commitTag,type,sz);
+        record_index::iterator i= index.find(key);
+        if((i!=index.end()) && (i->second<committedSize))
+          replaced[key]= i->second; //restored if the batch is discarded.
+        index[key]= offset;
+      }
+    return 0;
+  }
+
+//! @brief Returns a pointer to the values of the record
+//! (nullptr if not found).
+const char *XC::MappedFileDatastore::find(const RecordType &type,const int &dbTag,const int &commitTag,const int &sz) const
+  {
+    const char *retval= nullptr;
+    record_index::const_iterator i= index.find(RecordKey(dbTag,commitTag,type,sz));
+    if(i!=index.end())
+      {
+        const uint64_t offset= i->second+record_header_size;
+        if(i->second<committedSize)
+          retval= mappedData+offset;
+        else
+          retval= &batch[offset-committedSize];
+      }
+    return retval;
+  }
+
+//! @brief Copies the values of the record into the buffer argument.
+int XC::MappedFileDatastore::retrieveData(const RecordType &type,const int &dbTag,const int &commitTag,void *values,const int &sz,const size_t &valueSize)
+  {
+    const char *ptr= find(type,dbTag,commitTag,sz);
+    if(!ptr)
+      {
+        std::cerr << "MappedFileDatastore::" << __FUNCTION__
+                  << "; no data for object with dbTag= " << dbTag
+                  << " commitTag= " << commitTag << " and size= " << sz
+                  << std::endl;
+        return -1;
+      }
+    if(sz)
+      memcpy(values,ptr,size_t(sz)*valueSize);
+    return 0;
+  }
+
+int XC::MappedFileDatastore::sendMsg(int dbTag, int commitTag, const Message &msg, ChannelAddress *theAddress)
+  { return storeData(MSG,dbTag,commitTag,msg.data,msg.length,sizeof(char)); }
+
+int XC::MappedFileDatastore::recvMsg(int dbTag, int commitTag, Message &msg, ChannelAddress *theAddress)
+  { return retrieveData(MSG,dbTag,commitTag,msg.data,msg.length,sizeof(char)); }
+
+int XC::MappedFileDatastore::sendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << "Error en MappedFileDatastore::sendMatrix." << std::endl;
+    return storeData(MATRIX,dbTag,commitTag,theMatrix.getDataPtr(),theMatrix.getDataSize(),sizeof(double));
+  }
+
+int XC::MappedFileDatastore::recvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << "Error en MappedFileDatastore::recvMatrix." << std::endl;
+    return retrieveData(MATRIX,dbTag,commitTag,theMatrix.getDataPtr(),theMatrix.getDataSize(),sizeof(double));
+  }
+
+int XC::MappedFileDatastore::sendVector(int dbTag, int commitTag, const Vector &theVector, ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << "Error en MappedFileDatastore::sendVector." << std::endl;
+    return storeData(VECTOR,dbTag,commitTag,theVector.getDataPtr(),theVector.Size(),sizeof(double));
+  }
+
+int XC::MappedFileDatastore::recvVector(int dbTag, int commitTag, Vector &theVector,ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << "Error en MappedFileDatastore::recvVector." << std::endl;
+    return retrieveData(VECTOR,dbTag,commitTag,theVector.getDataPtr(),theVector.Size(),sizeof(double));
+  }
+
+int XC::MappedFileDatastore::sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << "Error en MappedFileDatastore::sendID." << std::endl;
+    return storeData(IDS,dbTag,commitTag,theID.getDataPtr(),theID.Size(),sizeof(int));
+  }
+
+int XC::MappedFileDatastore::recvID(int dbTag, int commitTag,ID &theID,ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << "Error en MappedFileDatastore::recvID." << std::endl;
+    return retrieveData(IDS,dbTag,commitTag,theID.getDataPtr(),theID.Size(),sizeof(int));
+  }
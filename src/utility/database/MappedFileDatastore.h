@@ -0,0 +1,125 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MappedFileDatastore.h
+
+#ifndef MappedFileDatastore_h
+#define MappedFileDatastore_h
+
+#include "DBDatastore.h"
+#include <map>
+#include <vector>
+#include <string>
+#include <stdint.h>
+
+namespace XC {
+//! @ingroup Database
+//
+//! @brief Datastore that keeps all the objects in a single
+//! append-only, memory-mapped file.
+//!
+//! Each record (ID, Vector, Matrix or Message) has a small header
+//! (dbTag, commitTag, type and number of values) followed by its
+//! values. The records sent between two calls to commitState are
+//! accumulated in a memory buffer and copied to the mapped file in
+//! a single block; the file header, that stores the size of the
+//! committed data, is updated only after the block has been flushed
+//! to disk, so a crash never leaves a partially written state
+//! (the records beyond the committed size are ignored when the file
+//! is opened again). An index (dbTag, commitTag, type, size) -> offset
+//! is built when the file is opened and updated with each record;
+//! the values are read directly from the mapped memory.
+class MappedFileDatastore: public DBDatastore
+  {
+  public:
+    //! @brief Type of the record values.
+    enum RecordType {MSG= 1, MATRIX, VECTOR, IDS, COMMIT};
+    //! @brief Key of a record in the index.
+    struct RecordKey
+      {
+        int dbTag;
+        int commitTag;
+        int type;
+        int size; //!< number of values.
+        RecordKey(const int &,const int &,const int &,const int &);
+        bool operator<(const RecordKey &) const;
+      };
+    typedef std::map<RecordKey,uint64_t> record_index;
+  private:
+    std::string fileName; //!< Name of the file.
+    int fd; //!< File descriptor.
+    char *mappedData; //!< Pointer to the mapped file.
+    uint64_t capacity; //!< Size of the mapping.
+    uint64_t committedSize; //!< Size of the committed data (header included).
+    std::vector<char> batch; //!< Records waiting to be written.
+    record_index index; //!< Offset of the last version of each record.
+    record_index replaced; //!< Committed offsets of the records replaced by the pending ones.
+    std::map<int,uint64_t> commits; //!< Offset of the commit mark of each saved state.
+    bool syncOnCommit; //!< If true flush the data to disk on each commit.
+
+    int open(void);
+    void close(void);
+    int map(const uint64_t &);
+    int scan(void);
+    int write_batch(const int &);
+    void discard_batch(void);
+    int storeData(const RecordType &,const int &,const int &,const void *,const int &,const size_t &);
+    int retrieveData(const RecordType &,const int &,const int &,void *,const int &,const size_t &);
+    const char *find(const RecordType &,const int &,const int &,const int &) const;
+
+    MappedFileDatastore(const MappedFileDatastore &);
+    MappedFileDatastore &operator=(const MappedFileDatastore &);
+  public:
+    MappedFileDatastore(const std::string &,Preprocessor &, FEM_ObjectBroker &);
+    ~MappedFileDatastore(void);
+
+    inline bool getSyncOnCommit(void) const
+      { return syncOnCommit; }
+    inline void setSyncOnCommit(const bool &b)
+      { syncOnCommit= b; }
+    inline uint64_t getFileSize(void) const
+      { return committedSize; }
+    inline size_t getNumRecords(void) const
+      { return index.size(); }
+
+    bool isSaved(int commitTag) const;
+    int commitState(int commitTag);
+
+    int sendMsg(int , int , const Message &, ChannelAddress *a= nullptr);
+    int recvMsg(int , int , Message &, ChannelAddress *a= nullptr);
+
+    int sendMatrix(int , int , const Matrix &,ChannelAddress *a= nullptr);
+    int recvMatrix(int , int , Matrix &, ChannelAddress *a= nullptr);
+
+    int sendVector(int , int , const Vector &,ChannelAddress *a= nullptr);
+    int recvVector(int , int , Vector &,ChannelAddress *a= nullptr);
+
+    int sendID(int , int ,const ID &,ChannelAddress *a= nullptr);
+    int recvID(int , int ,ID &,ChannelAddress *a= nullptr);
+  };
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,300 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MemoryDatastore.cc
+
+#include <utility/database/MemoryDatastore.h>
+#include <utility/matrix/Vector.h>
+#include <utility/matrix/Matrix.h>
+#include <utility/matrix/ID.h>
+#include <utility/actor/message/Message.h>
+#include <cstring>
+
+//! @brief Constructor.
+XC::MemoryDatastore::RecordKey::RecordKey(const int &dbt,const int &t,const int &sz)
+  : dbTag(dbt), type(t), size(sz) {}
+
+//! @brief Order of the keys in the snapshot.
+bool XC::MemoryDatastore::RecordKey::operator<(const RecordKey &other) const
+  {
+    if(dbTag!=other.dbTag) return (dbTag<other.dbTag);
+    if(type!=other.type) return (type<other.type);
+    return (size<other.size);
+  }
+
+//! @brief Constructor.
+//!
+//! @param maxSnap: maximum number of snapshots (0: no limit).
+XC::MemoryDatastore::MemoryDatastore(Preprocessor &preprocessor, FEM_ObjectBroker &theObjectBroker,const size_t &maxSnap)
+  :DBDatastore(preprocessor, theObjectBroker), lastCommitTag(-1),
+   maxSnapshots(maxSnap), memoryUsage(0) {}
+
+//! @brief Sets the maximum number of snapshots (0: no limit),
+//! discarding the least recently used ones if needed.
+void XC::MemoryDatastore::setMaxSnapshots(const size_t &sz)
+  {
+    maxSnapshots= sz;
+    while(maxSnapshots && (snapshots.size()>maxSnapshots))
+      erase(lru.back());
+  }
+
+//! @brief Returns the snapshot for the commit tag (creating it if needed).
+XC::MemoryDatastore::Snapshot &XC::MemoryDatastore::get_snapshot(const int &commitTag)
+  {
+    snapshot_map::iterator i= snapshots.find(commitTag);
+    if(i==snapshots.end())
+      {
+        i= snapshots.insert(snapshot_map::value_type(commitTag,Snapshot())).first;
+        lru.push_front(commitTag);
+        i->second.lruPos= lru.begin();
+      }
+    return i->second;
+  }
+
+//! @brief Returns the records of the snapshot (nullptr if it doesn't exists).
+const XC::MemoryDatastore::record_blocks *XC::MemoryDatastore::get_records(const int &commitTag) const
+  {
+    const record_blocks *retval= nullptr;
+    snapshot_map::const_iterator i= snapshots.find(commitTag);
+    if(i!=snapshots.end())
+      retval= &(i->second.records);
+    return retval;
+  }
+
+//! @brief Marks the snapshot as the most recently used one.
+void XC::MemoryDatastore::touch(Snapshot &s,const int &commitTag)
+  {
+    lru.erase(s.lruPos);
+    lru.push_front(commitTag);
+    s.lruPos= lru.begin();
+  }
+
+//! @brief Decrements the reference count of the block, freeing
+//! its memory if it is no longer used.
+void XC::MemoryDatastore::release(const size_t &iBlock)
+  {
+    Block &b= blocks[iBlock];
+    b.refCount--;
+    if(b.refCount==0)
+      {
+        memoryUsage-= b.data.size();
+        std::vector<char>().swap(b.data);
+        freeBlocks.push_back(iBlock);
+      }
+  }
+
+//! @brief Discards the snapshot.
+void XC::MemoryDatastore::erase_snapshot(const snapshot_map::iterator &i)
+  {
+    const record_blocks &records= i->second.records;
+    for(record_blocks::const_iterator j= records.begin();j!=records.end();j++)
+      release(j->second);
+    lru.erase(i->second.lruPos);
+    if(i->first==lastCommitTag)
+      lastCommitTag= -1;
+    snapshots.erase(i);
+  }
+
+//! @brief Discards the snapshot with the tag being passed as parameter.
+void XC::MemoryDatastore::erase(const int &commitTag)
+  {
+    snapshot_map::iterator i= snapshots.find(commitTag);
+    if(i!=snapshots.end())
+      erase_snapshot(i);
+  }
+
+//! @brief Discards all the snapshots.
+void XC::MemoryDatastore::clear(void)
+  {
+    snapshots.clear();
+    lru.clear();
+    blocks.clear();
+    freeBlocks.clear();
+    lastCommitTag= -1;
+    memoryUsage= 0;
+  }
+
+//! @brief Stores the values in a new block and returns its index.
+size_t XC::MemoryDatastore::new_block(const void *values,const size_t &numBytes)
+  {
+    size_t retval= blocks.size();
+    if(!freeBlocks.empty())
+      {
+        retval= freeBlocks.back();
+        freeBlocks.pop_back();
+      }
+    else
+      blocks.push_back(Block());
+    Block &b= blocks[retval];
+    b.data.assign(static_cast<const char *>(values),static_cast<const char *>(values)+numBytes);
+    b.refCount= 1;
+    memoryUsage+= numBytes;
+    return retval;
+  }
+
+//! @brief Returns true if the snapshot exists.
+bool XC::MemoryDatastore::isSaved(int commitTag) const
+  { return (snapshots.find(commitTag)!=snapshots.end()); }
+
+//! @brief Saves the model state in a new snapshot (replacing the
+//! previous one with the same tag, if any).
+int XC::MemoryDatastore::commitState(int commitTag)
+  {
+    erase(commitTag);
+    get_snapshot(commitTag);
+    const int retval= DBDatastore::commitState(commitTag);
+    if(retval<0)
+      erase(commitTag);
+    else
+      {
+        lastCommitTag= commitTag;
+        while(maxSnapshots && (snapshots.size()>maxSnapshots))
+          erase(lru.back());
+      }
+    return retval;
+  }
+
+//! @brief Restores the model state from the snapshot.
+int XC::MemoryDatastore::restoreState(int commitTag)
+  {
+    snapshot_map::iterator i= snapshots.find(commitTag);
+    if(i==snapshots.end())
+      {
+        std::cerr << "MemoryDatastore::" << __FUNCTION__
+                  << "; there is no snapshot with tag: "
+                  << commitTag << std::endl;
+        return -1;
+      }
+    touch(i->second,commitTag);
+    lastCommitTag= commitTag;
+    return DBDatastore::restoreState(commitTag);
+  }
+
+//! @brief Stores the record values in the snapshot. If the
+//! values are the same of the last saved (or restored) snapshot
+//! the block is shared with it.
+int XC::MemoryDatastore::storeData(const RecordType &type,const int &dbTag,const int &commitTag,const void *values,const int &sz,const size_t &valueSize)
+  {
+    const RecordKey key(dbTag,type,sz);
+    const size_t numBytes= size_t(sz)*valueSize;
+    Snapshot &s= get_snapshot(commitTag);
+    record_blocks::iterator i= s.records.find(key);
+    if(i!=s.records.end()) // record sent again.
+      {
+        release(i->second);
+        s.records.erase(i);
+      }
+    if(commitTag!=lastCommitTag)
+      {
+        snapshot_map::const_iterator prev= snapshots.find(lastCommitTag);
+        if(prev!=snapshots.end())
+          {
+            record_blocks::const_iterator j= prev->second.records.find(key);
+            if(j!=prev->second.records.end())
+              {
+                Block &b= blocks[j->second];
+                if((numBytes==0) || (memcmp(&b.data[0],values,numBytes)==0))
+                  {
+                    b.refCount++;
+                    s.records[key]= j->second;
+                    return 0;
+                  }
+              }
+          }
+      }
+    s.records[key]= new_block(values,numBytes);
+    return 0;
+  }
+
+//! @brief Copies the values of the record into the buffer argument.
+int XC::MemoryDatastore::retrieveData(const RecordType &type,const int &dbTag,const int &commitTag,void *values,const int &sz,const size_t &valueSize)
+  {
+    snapshot_map::const_iterator i= snapshots.find(commitTag);
+    if(i!=snapshots.end())
+      {
+        record_blocks::const_iterator j= i->second.records.find(RecordKey(dbTag,type,sz));
+        if(j!=i->second.records.end())
+          {
+            const size_t numBytes= size_t(sz)*valueSize;
+            if(numBytes)
+              memcpy(values,&blocks[j->second].data[0],numBytes);
+            return 0;
+          }
+      }
+    std::cerr << "MemoryDatastore::" << __FUNCTION__
+              << "; no data for object with dbTag= " << dbTag
+              << " commitTag= " << commitTag << " and size= " << sz
+              << std::endl;
+    return -1;
+  }
+
+int XC::MemoryDatastore::sendMsg(int dbTag, int commitTag, const Message &msg, ChannelAddress *theAddress)
+  { return storeData(MSG,dbTag,commitTag,msg.data,msg.length,sizeof(char)); }
+
+int XC::MemoryDatastore::recvMsg(int dbTag, int commitTag, Message &msg, ChannelAddress *theAddress)
+  { return retrieveData(MSG,dbTag,commitTag,msg.data,msg.length,sizeof(char)); }
+
+int XC::MemoryDatastore::sendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << "Error en MemoryDatastore::sendMatrix." << std::endl;
+    return storeData(MATRIX,dbTag,commitTag,theMatrix.getDataPtr(),theMatrix.getDataSize(),sizeof(double));
+  }
+
+int XC::MemoryDatastore::recvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << "Error en MemoryDatastore::recvMatrix." << std::endl;
+    return retrieveData(MATRIX,dbTag,commitTag,theMatrix.getDataPtr(),theMatrix.getDataSize(),sizeof(double));
+  }
+
+int XC::MemoryDatastore::sendVector(int dbTag, int commitTag, const Vector &theVector, ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << "Error en MemoryDatastore::sendVector." << std::endl;
+    return storeData(VECTOR,dbTag,commitTag,theVector.getDataPtr(),theVector.Size(),sizeof(double));
+  }
+
+int XC::MemoryDatastore::recvVector(int dbTag, int commitTag, Vector &theVector,ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << "Error en MemoryDatastore::recvVector." << std::endl;
+    return retrieveData(VECTOR,dbTag,commitTag,theVector.getDataPtr(),theVector.Size(),sizeof(double));
+  }
+
+int XC::MemoryDatastore::sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << "Error en MemoryDatastore::sendID." << std::endl;
+    return storeData(IDS,dbTag,commitTag,theID.getDataPtr(),theID.Size(),sizeof(int));
+  }
+
+int XC::MemoryDatastore::recvID(int dbTag, int commitTag,ID &theID,ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << "Error en MemoryDatastore::recvID." << std::endl;
+    return retrieveData(IDS,dbTag,commitTag,theID.getDataPtr(),theID.Size(),sizeof(int));
+  }
@@ -0,0 +1,138 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MemoryDatastore.h
+
+#ifndef MemoryDatastore_h
+#define MemoryDatastore_h
+
+#include "DBDatastore.h"
+#include <map>
+#include <list>
+#include <vector>
+#include <string>
+
+namespace XC {
+//! @ingroup Database
+//
+//! @brief Datastore that keeps the saved states (snapshots) in memory.
+//!
+//! Each snapshot (one for each commitTag) maps the records sent
+//! by the model objects (dbTag, type and size) to blocks of memory.
+//! A record whose values are the same of the last saved (or restored)
+//! snapshot shares its block with it (the block is copied only when
+//! the values change), so the unchanged part of the model (geometry,
+//! elastic elements,...) is stored only once. The number of
+//! snapshots can be bounded; when the bound is reached the least
+//! recently used snapshot is discarded.
+class MemoryDatastore: public DBDatastore
+  {
+  public:
+    //! @brief Type of the record values.
+    enum RecordType {MSG= 1, MATRIX, VECTOR, IDS};
+    //! @brief Key of a record in a snapshot.
+    struct RecordKey
+      {
+        int dbTag;
+        int type;
+        int size; //!< number of values.
+        RecordKey(const int &,const int &,const int &);
+        bool operator<(const RecordKey &) const;
+      };
+    typedef std::map<RecordKey,size_t> record_blocks; //!< Record -> block index.
+    //! @brief Saved state.
+    struct Snapshot
+      {
+        record_blocks records;
+        std::list<int>::iterator lruPos; //!< position in the LRU list.
+      };
+    typedef std::map<int,Snapshot> snapshot_map;
+  private:
+    //! @brief Block of memory shared by one or more snapshots.
+    struct Block
+      {
+        std::vector<char> data;
+        size_t refCount;
+        Block(void)
+          : refCount(0) {}
+      };
+    std::vector<Block> blocks; //!< Memory blocks.
+    std::vector<size_t> freeBlocks; //!< Indexes of the unused blocks.
+    snapshot_map snapshots; //!< Saved states.
+    std::list<int> lru; //!< Commit tags from the most recently used to the least one.
+    int lastCommitTag; //!< Tag of the last saved or restored snapshot.
+    size_t maxSnapshots; //!< Maximum number of snapshots (0: no limit).
+    size_t memoryUsage; //!< Size of the stored values (bytes).
+
+    Snapshot &get_snapshot(const int &);
+    void touch(Snapshot &,const int &);
+    void release(const size_t &);
+    void erase_snapshot(const snapshot_map::iterator &);
+    size_t new_block(const void *,const size_t &);
+
+    MemoryDatastore(const MemoryDatastore &);
+    MemoryDatastore &operator=(const MemoryDatastore &);
+  protected:
+    int storeData(const RecordType &,const int &,const int &,const void *,const int &,const size_t &);
+    int retrieveData(const RecordType &,const int &,const int &,void *,const int &,const size_t &);
+    const record_blocks *get_records(const int &) const;
+    //! @brief Returns the values stored in the block.
+    inline const std::vector<char> &get_block_data(const size_t &iBlock) const
+      { return blocks[iBlock].data; }
+  public:
+    MemoryDatastore(Preprocessor &, FEM_ObjectBroker &,const size_t &maxSnap= 0);
+
+    inline size_t getMaxSnapshots(void) const
+      { return maxSnapshots; }
+    void setMaxSnapshots(const size_t &);
+    inline size_t getNumSnapshots(void) const
+      { return snapshots.size(); }
+    inline size_t getNumBlocks(void) const
+      { return blocks.size()-freeBlocks.size(); }
+    inline size_t getMemoryUsage(void) const
+      { return memoryUsage; }
+    void erase(const int &);
+    void clear(void);
+
+    bool isSaved(int commitTag) const;
+    int commitState(int commitTag);
+    int restoreState(int commitTag);
+
+    int sendMsg(int , int , const Message &, ChannelAddress *a= nullptr);
+    int recvMsg(int , int , Message &, ChannelAddress *a= nullptr);
+
+    int sendMatrix(int , int , const Matrix &,ChannelAddress *a= nullptr);
+    int recvMatrix(int , int , Matrix &, ChannelAddress *a= nullptr);
+
+    int sendVector(int , int , const Vector &,ChannelAddress *a= nullptr);
+    int recvVector(int , int , Vector &,ChannelAddress *a= nullptr);
+
+    int sendID(int , int ,const ID &,ChannelAddress *a= nullptr);
+    int recvID(int , int ,ID &,ChannelAddress *a= nullptr);
+  };
+} // end of XC namespace
+
+#endif
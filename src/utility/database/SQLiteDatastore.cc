@@ -27,88 +27,235 @@
 // SQLiteDatastore.cpp
 
 #include <utility/database/SQLiteDatastore.h>
-#include "xc_utils/src/sqlite/SqLiteQuery.h"
 #include <utility/matrix/Vector.h>
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/ID.h>
-#include "boost/lexical_cast.hpp"
+#include <cstring>
+#include <algorithm>
+
+const char *XC::SQLiteDatastore::tableNames[NUM_TABLES]= {"Messages","Matrices","Vectors","IDs"};
 
 XC::SQLiteDatastore::SQLiteDatastore(const std::string &projectName, Preprocessor &preprocessor, FEM_ObjectBroker &theObjectBroker, int run)
-  :DBDatastore(preprocessor, theObjectBroker), connection(false), db(projectName)
+  :DBDatastore(preprocessor, theObjectBroker), connection(false), db(nullptr), inTransaction(false)
   {
+    for(int i= 0;i<NUM_TABLES;i++)
+      { insertStmts[i]= nullptr; selectStmts[i]= nullptr; }
     if(this->createOpenSeesDatabase(projectName) == 0)
       connection= true;
     else
-      std::cerr << "SQLiteDatastore::SQLiteDatastore() - could not open the database\n";
+      {
+        std::cerr << "SQLiteDatastore::SQLiteDatastore() - could not open the database\n";
+        close();
+      }
   }
 
-int XC::SQLiteDatastore::sendMsg(int dataTag, int commitTag,const XC::Message &,ChannelAddress *theAddress)
+//! @brief Destructor.
+XC::SQLiteDatastore::~SQLiteDatastore(void)
+  { close(); }
+
+//! @brief Closes the connection with the database, committing
+//! any pending transaction.
+void XC::SQLiteDatastore::close(void)
   {
-    std::cerr << "SQLiteDatastore::sendMsg() - not yet implemented\n";
-    return -1;
+    if(inTransaction)
+      endTransaction(true);
+    finalize_statements();
+    if(db)
+      {
+        sqlite3_close(db);
+        db= nullptr;
+      }
+    connection= false;
   }
 
-int XC::SQLiteDatastore::recvMsg(int dataTag, int commitTag, Message &, ChannelAddress *theAddress)
+//! @brief Compiles the SQL statement argument.
+sqlite3_stmt *XC::SQLiteDatastore::prepare(const std::string &sql)
   {
-    std::cerr << "SQLiteDatastore::recvMsg() - not yet implemented\n";
-    return -1;
+    sqlite3_stmt *retval= nullptr;
+    if(sqlite3_prepare_v2(db,sql.c_str(),-1,&retval,nullptr) != SQLITE_OK)
+      {
+        std::cerr << "SQLiteDatastore::" << __FUNCTION__
+                  << "; could not prepare statement: " << sql
+                  << std::endl << sqlite3_errmsg(db) << std::endl;
+        if(retval)
+          {
+            sqlite3_finalize(retval);
+            retval= nullptr;
+          }
+      }
+    return retval;
   }
 
-//! @brief Inserts data on a BLOB field.
-bool XC::SQLiteDatastore::insertData(const std::string &tbName,const int &dbTag,const int &commitTag,const void *blobData,const int &sz,const int &szTipo)
+//! @brief Compiles the statements used to store and retrieve
+//! the blobs of each table.
+bool XC::SQLiteDatastore::prepare_statements(void)
   {
-    const int numBytes= sz*szTipo;
-    query= "INSERT INTO " + tbName + " VALUES (" + boost::lexical_cast<std::string>(dbTag) + ",";
-    query+= boost::lexical_cast<std::string>(commitTag) + ",";
-    query+= boost::lexical_cast<std::string>(sz) + ",?)";
-    return db.getDefaultQuery()->insert_blob1(query,blobData,numBytes);
+    bool retval= true;
+    for(int i= 0;i<NUM_TABLES;i++)
+      {
+        const std::string tbName(tableNames[i]);
+        insertStmts[i]= prepare("INSERT OR REPLACE INTO " + tbName + " VALUES (?,?,?,?)");
+        selectStmts[i]= prepare("SELECT data FROM " + tbName + " WHERE dbTag= ? AND commitTag= ? AND size= ?");
+        retval= retval && insertStmts[i] && selectStmts[i];
+      }
+    return retval;
   }
 
-//! @brief Updates data o a BLOB field.
-bool XC::SQLiteDatastore::updateData(const std::string &tbName,const int &dbTag,const int &commitTag,const void *blobData,const int &sz,const int &szTipo)
+//! @brief Releases the cached statements.
+void XC::SQLiteDatastore::finalize_statements(void)
   {
-    const int numBytes= sz*szTipo;
-    query= "UPDATE " + tbName + " SET data= ? WHERE dbTag= " + boost::lexical_cast<std::string>(dbTag);
-    query+= " AND commitTag= " + boost::lexical_cast<std::string>(commitTag) + " AND size= ";
-    query+= boost::lexical_cast<std::string>(sz);
-    return db.getDefaultQuery()->insert_blob1(query,blobData,numBytes);
+    for(int i= 0;i<NUM_TABLES;i++)
+      {
+        if(insertStmts[i])
+          {
+            sqlite3_finalize(insertStmts[i]);
+            insertStmts[i]= nullptr;
+          }
+        if(selectStmts[i])
+          {
+            sqlite3_finalize(selectStmts[i]);
+            selectStmts[i]= nullptr;
+          }
+      }
   }
 
-const void *XC::SQLiteDatastore::retrieveData(const std::string &tbName,const int &dbTag,const int &commitTag,const int &sz)
+//! @brief Opens a transaction (if not already opened).
+int XC::SQLiteDatastore::beginTransaction(void)
   {
-    const void *retval= nullptr;
-    // check that we have a connection
+    int retval= 0;
+    if(!inTransaction)
+      {
+        retval= execute("BEGIN TRANSACTION");
+        if(retval==0)
+          inTransaction= true;
+      }
+    return retval;
+  }
+
+//! @brief Closes the current transaction.
+//! @param commit: if true commit the changes, otherwise roll them back.
+int XC::SQLiteDatastore::endTransaction(const bool &commit)
+  {
+    int retval= 0;
+    if(inTransaction)
+      {
+        if(commit)
+          retval= execute("COMMIT");
+        else
+          retval= execute("ROLLBACK");
+        inTransaction= false;
+      }
+    return retval;
+  }
+
+//! @brief Stores the model state in the database. All the blobs
+//! of the commit are written in a single transaction.
+int XC::SQLiteDatastore::commitState(int commitTag)
+  {
+    int retval= -1;
     if(connection)
       {
-        // to receive the data the database we do the following:
-        // 1. use SELECT to receive the data from the database
-        // 2. fetch the results from the server and copy to the Matrices data area
-        // 3. clean up the SQLITE_RES datastructure
+        if(beginTransaction()!=0)
+          return -1;
+        retval= DBDatastore::commitState(commitTag);
+        if(endTransaction(retval>=0)!=0)
+          retval= -1;
+      }
+    return retval;
+  }
 
-        // form the SELECT query
-        query= "SELECT data FROM " + tbName + " WHERE dbTag= " + boost::lexical_cast<std::string>(dbTag) + " AND commitTag= " + boost::lexical_cast<std::string>(commitTag) + " AND size= " + boost::lexical_cast<std::string>(sz);
+//! @brief Restores the model state from the database. The data
+//! is read inside a single (read) transaction.
+int XC::SQLiteDatastore::restoreState(int commitTag)
+  {
+    int retval= -1;
+    if(connection)
+      {
+        if(beginTransaction()!=0)
+          return -1;
+        retval= DBDatastore::restoreState(commitTag);
+        if(endTransaction(true)!=0)
+          retval= -1;
+      }
+    return retval;
+  }
 
-        sqlite3_stmt *result= db.getDefaultQuery()->get_result(query);
+int XC::SQLiteDatastore::sendMsg(int dataTag, int commitTag,const XC::Message &,ChannelAddress *theAddress)
+  {
+    std::cerr << "SQLiteDatastore::sendMsg() - not yet implemented\n";
+    return -1;
+  }
 
-        // fetch the results from the database
-        if(!result)
-          {
-            // no data stored in db with these keys
-            std::cerr << "SQLiteDatastore::retrieveData - no data in table= " << tbName << " for object with dbTag= "
-                      << dbTag << " commitTag= " << commitTag << " and size= " << sz << " query= " << query << std::endl;
-          }
-        else
+int XC::SQLiteDatastore::recvMsg(int dataTag, int commitTag, Message &, ChannelAddress *theAddress)
+  {
+    std::cerr << "SQLiteDatastore::recvMsg() - not yet implemented\n";
+    return -1;
+  }
+
+//! @brief Inserts (or replaces) data on a BLOB field using the cached statement.
+bool XC::SQLiteDatastore::storeData(const TableIndex &tb,const int &dbTag,const int &commitTag,const void *blobData,const int &sz,const int &szTipo)
+  {
+    bool retval= false;
+    sqlite3_stmt *stmt= insertStmts[tb];
+    if(stmt)
+      {
+        const int numBytes= sz*szTipo;
+        sqlite3_bind_int(stmt,1,dbTag);
+        sqlite3_bind_int(stmt,2,commitTag);
+        sqlite3_bind_int(stmt,3,sz);
+        if(numBytes>0)
+          sqlite3_bind_blob(stmt,4,blobData,numBytes,SQLITE_STATIC);
+        else //Empty vector (its data pointer may be null).
+          sqlite3_bind_zeroblob(stmt,4,0);
+        retval= (sqlite3_step(stmt) == SQLITE_DONE);
+        if(!retval)
+          std::cerr << "SQLiteDatastore::" << __FUNCTION__
+                    << "; failed to store data in table= " << tableNames[tb]
+                    << " for object with dbTag= " << dbTag
+                    << " commitTag= " << commitTag << " and size= " << sz
+                    << std::endl << sqlite3_errmsg(db) << std::endl;
+        sqlite3_reset(stmt);
+        sqlite3_clear_bindings(stmt);
+      }
+    return retval;
+  }
+
+//! @brief Copies the contents of a BLOB field into the buffer argument.
+bool XC::SQLiteDatastore::retrieveData(const TableIndex &tb,const int &dbTag,const int &commitTag,void *buffer,const int &sz,const int &szTipo)
+  {
+    bool retval= false;
+    sqlite3_stmt *stmt= selectStmts[tb];
+    if(stmt)
+      {
+        sqlite3_bind_int(stmt,1,dbTag);
+        sqlite3_bind_int(stmt,2,commitTag);
+        sqlite3_bind_int(stmt,3,sz);
+        if(sqlite3_step(stmt) == SQLITE_ROW)
           {
-            db.getDefaultQuery()->fetch_row();
-            retval= db.getDefaultQuery()->getBlob("data");
-            if(!retval)
+            const void *blob= sqlite3_column_blob(stmt,0);
+            const int numBytes= sqlite3_column_bytes(stmt,0);
+            if(numBytes == sz*szTipo)
               {
-                // no vector stored in db with these keys
-                std::cerr << "SQLiteDatastore::retrieveData - no data in table= " << tbName << " for object with dbTag= "
-                      << dbTag << " and commitTag= " << commitTag << " and size= " << sz << " query= " << query << std::endl;
-                db.getDefaultQuery()->free_result();
+                if(numBytes>0) //Zero-length BLOBs are returned as NULL.
+                  {
+                    if(blob)
+                      {
+                        memcpy(buffer,blob,numBytes);
+                        retval= true;
+                      }
+                  }
+                else
+                  retval= true;
               }
           }
+        if(!retval)
+          std::cerr << "SQLiteDatastore::" << __FUNCTION__
+                    << "; no data in table= " << tableNames[tb]
+                    << " for object with dbTag= " << dbTag
+                    << " commitTag= " << commitTag << " and size= " << sz
+                    << std::endl;
+        sqlite3_reset(stmt);
+        sqlite3_clear_bindings(stmt);
       }
     return retval;
   }
@@ -120,14 +267,7 @@ int XC::SQLiteDatastore::sendMatrix(int dbTag, int commitTag, const Matrix &theM
     int retval= -1;
     if(connection)
       {
-        // to send the data the database we do the following:
-        // 1. try to INSERT the data into the database
-        // 2. if INSERT fails we have to reformulate the query to UPDATE the existing data,
-        //    as the row given by dbTag, commitTag and vectorSize may already already exist.
-        bool ok= insertData("Matrices",dbTag,commitTag,theMatrix.getDataPtr(),theMatrix.getDataSize(),sizeof(double));
-        if(!ok)
-          ok= updateData("Matrices",dbTag,commitTag,theMatrix.getDataPtr(),theMatrix.getDataSize(),sizeof(double));
-        if(ok)
+        if(storeData(MATRICES,dbTag,commitTag,theMatrix.getDataPtr(),theMatrix.getDataSize(),sizeof(double)))
           retval= 0;
       }
     return retval;
@@ -140,24 +280,12 @@ int XC::SQLiteDatastore::recvMatrix(int dbTag, int commitTag, Matrix &theMatrix,
     int retval= -1;
     if(connection)
       {
-        const void *blob= retrieveData("Matrices",dbTag,commitTag,theMatrix.getDataSize());
-	if(blob)
-          {
-            // place the results into the vectors double array
-            const double *blobData = reinterpret_cast<const double *>(blob);
-            double *matrixData= theMatrix.getDataPtr();
-            for(int i=0; i<theMatrix.getDataSize(); i++)
-              matrixData[i] = blobData[i];
-            // free the SQLITE_RES structure
-            db.getDefaultQuery()->free_result();
-            retval= 0;
-          }
+        if(retrieveData(MATRICES,dbTag,commitTag,theMatrix.getDataPtr(),theMatrix.getDataSize(),sizeof(double)))
+          retval= 0;
       }
     return retval;
   }
 
-
-
 int XC::SQLiteDatastore::sendVector(int dbTag, int commitTag, const Vector &theVector, ChannelAddress *theAddress)
   {
     if(!checkDbTag(dbTag))
@@ -165,14 +293,7 @@ int XC::SQLiteDatastore::sendVector(int dbTag, int commitTag, const Vector &theV
     int retval= -1;
     if(connection)
       {
-        // to send the data the database we do the following:
-        // 1. try to INSERT the data into the database
-        // 2. if INSERT fails we have to reformulate the query to UPDATE the existing data,
-        //    as the row given by dbTag, commitTag and vectorSize may already already exist.
-        bool ok= (insertData("Vectors",dbTag,commitTag,theVector.getDataPtr(),theVector.Size(),sizeof(double))!= SQLITE_OK);
-        if(!ok)
-          ok= updateData("Vectors",dbTag,commitTag,theVector.getDataPtr(),theVector.Size(),sizeof(double));
-        if(ok)
+        if(storeData(VECTORS,dbTag,commitTag,theVector.getDataPtr(),theVector.Size(),sizeof(double)))
           retval= 0;
       }
     return retval;
@@ -185,22 +306,12 @@ int XC::SQLiteDatastore::recvVector(int dbTag, int commitTag, Vector &theVector,
     int retval= -1;
     if(connection)
       {
-        const void *blob= retrieveData("Vectors",dbTag,commitTag,theVector.Size());
-	if(blob)
-          {
-            // place the results into the vectors double array
-            const double *blobData = reinterpret_cast<const double *>(blob);
-            for(int i=0; i<theVector.Size(); i++)
-              theVector[i] = blobData[i];
-            // free the SQLITE_RES structure
-            db.getDefaultQuery()->free_result();
-            retval= 0;
-          }
+        if(retrieveData(VECTORS,dbTag,commitTag,theVector.getDataPtr(),theVector.Size(),sizeof(double)))
+          retval= 0;
       }
     return retval;
   }
 
-
 int XC::SQLiteDatastore::sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress)
   {
     if(!checkDbTag(dbTag))
@@ -208,14 +319,7 @@ int XC::SQLiteDatastore::sendID(int dbTag, int commitTag, const ID &theID, Chann
     int retval= -1;
     if(connection)
       {
-        // to send the data the database we do the following:
-        // 1. try to INSERT the data into the database
-        // 2. if INSERT fails we have to reformulate the query to UPDATE the existing data,
-        //    as the row given by dbTag, commitTag and vectorSize may already already exist.
-        bool ok= insertData("IDs",dbTag,commitTag,theID.getDataPtr(),theID.Size(),sizeof(int));
-        if(!ok)
-          ok= updateData("IDs",dbTag,commitTag,theID.getDataPtr(),theID.Size(),sizeof(int));
-        if(ok)
+        if(storeData(IDS,dbTag,commitTag,theID.getDataPtr(),theID.Size(),sizeof(int)))
           retval= 0;
       }
     return retval;
@@ -228,17 +332,8 @@ int XC::SQLiteDatastore::recvID(int dbTag, int commitTag,ID &theID,ChannelAddres
     int retval= -1;
     if(connection)
       {
-        const void *blob= retrieveData("IDs",dbTag,commitTag,theID.Size());
-	if(blob)
-          {
-            // place the results into the vectors double array
-            const int *blobData = reinterpret_cast<const int *>(blob);
-            for(int i=0; i<theID.Size(); i++)
-              theID[i] = blobData[i];
-            // free the SQLITE_RES structure
-            db.getDefaultQuery()->free_result();
-            retval= 0;
-          }
+        if(retrieveData(IDS,dbTag,commitTag,theID.getDataPtr(),theID.Size(),sizeof(int)))
+          retval= 0;
       }
     return retval;
   }
@@ -250,12 +345,11 @@ int XC::SQLiteDatastore::createTable(const std::string &tableName, const std::ve
     if(connection)
       {
         // create the sql query
-        query= "CREATE TABLE " + tableName + " (dbTag INT NOT nullptr, commitTag INT NOT nullptr, ";
+        query= "CREATE TABLE IF NOT EXISTS " + tableName + " (dbTag INT NOT NULL, commitTag INT NOT NULL, ";
         for(int j=0; j<numColumns; j++)
-          query+= columns[j] + " DOUBLE NOT nullptr, ";
+          query+= columns[j] + " DOUBLE NOT NULL, ";
         query+= "PRIMARY KEY (dbTag, commitTag) )";
-        db.getDefaultQuery()->execute(query);
-        return 0;
+        return execute(query);
       }
     else
       return -1;
@@ -263,117 +357,118 @@ int XC::SQLiteDatastore::createTable(const std::string &tableName, const std::ve
 
 int XC::SQLiteDatastore::insertData(const std::string &tableName,const std::vector<std::string> &columns, int commitTag, const Vector &data)
   {
+    int retval= -1;
     // check that we have a connection
     if(connection)
       {
-        // check that query string is big enough to hold the data, if not enlarge
-        //const int sizeData = 128 + strlen(tableName);
-
-        // form the insert query
-        query= "INSERT INTO " + tableName + "VALUES (" + boost::lexical_cast<std::string>(dbTAG) + "," + boost::lexical_cast<std::string>(commitTag);
+        query= "INSERT OR REPLACE INTO " + tableName + " VALUES (?,?";
         for(int i=0; i<data.Size(); i++)
-          query+= boost::lexical_cast<std::string>(data(i));
+          query+= ",?";
         query+= ")";
-
-        // execute the query
-        if(db.getDefaultQuery()->execute(query) != SQLITE_OK)
+        sqlite3_stmt *stmt= prepare(query);
+        if(stmt)
           {
-          
-            // if INSERT fails we reformulate query and try an UPDATE
-            // formulate the query
-            query= "UPDATE " + tableName + " SET " + columns[0] + "= " + boost::lexical_cast<std::string>(data(0));
-            for(int i=1; i<data.Size(); i++)
-              query+= columns[i] + "= " + boost::lexical_cast<std::string>(data(i));
-            query+= " WHERE dbTag= " + boost::lexical_cast<std::string>(dbTAG) + " AND commitTag= " + boost::lexical_cast<std::string>(commitTag);
-
-            // invoke the query on the database
-            if(db.getDefaultQuery()->execute(query) != SQLITE_OK)
+            sqlite3_bind_int(stmt,1,dbTAG);
+            sqlite3_bind_int(stmt,2,commitTag);
+            for(int i=0; i<data.Size(); i++)
+              sqlite3_bind_double(stmt,i+3,data(i));
+            if(sqlite3_step(stmt) == SQLITE_DONE)
+              retval= 0;
+            else
               {
-                std::cerr << "SQLiteDatastore::insertData() - failed to send the data to SQLite database";
+                std::cerr << "SQLiteDatastore::insertData() - failed to send the data to SQLite database ";
                 std::cerr << query;
-                std::cerr << std::endl << db.getDefaultQuery()->getError() << std::endl;
-                return -3;
+                std::cerr << std::endl << sqlite3_errmsg(db) << std::endl;
+                retval= -3;
               }
+            sqlite3_finalize(stmt);
           }
-        return 0;
       }
-    else
-      return -1;
+    return retval;
   }
 
 int XC::SQLiteDatastore::getData(const std::string &tableName,const std::vector<std::string> &columns, int commitTag, Vector &data)
   {
+    int retval= -1;
     // check that we have a connection
-    if(!connection)
+    if(connection)
       {
-
-        // check that query string is big enough to hold the data, if not enlarge
-        //const int sizeData = 128 + strlen(tableName);
-
-
-        // to receive the data the database we do the following:
-        // 1. use SELECT to receive the data from the database
-        // 2. fetch the results from the server and copy to the Vectors data area
-        // 3. clean up the SQLITE_RES datastructure
-        //
-        // form the SELECT query
-        query= "Select * FROM " + tableName + " WHERE dbTag= " + boost::lexical_cast<std::string>(dbTAG) + " AND commitTag= " + boost::lexical_cast<std::string>(commitTag);
-
-        sqlite3_stmt *result= db.getDefaultQuery()->get_result(query);
-
-        // fetch the results from the database
-        if(!result)
+        const size_t numColumns= columns.size();
+        query= "SELECT ";
+        for(size_t j=0; j<numColumns; j++)
           {
-            // no data stored in db with these keys
-            std::cerr << "SQLiteDatastore::getData - no data in database for object with dbTag, cTag: ";
-            std::cerr << dbTAG << ", " << commitTag << std::endl;
+            if(j>0) query+= ", ";
+            query+= columns[j];
           }
-        else
+        query+= " FROM " + tableName + " WHERE dbTag= ? AND commitTag= ?";
+        sqlite3_stmt *stmt= prepare(query);
+        if(stmt)
           {
-            for(int i=0; i<data.Size(); i++)
-              data[i] = db.getDefaultQuery()->getDouble(i);
+            sqlite3_bind_int(stmt,1,dbTAG);
+            sqlite3_bind_int(stmt,2,commitTag);
+            if(sqlite3_step(stmt) == SQLITE_ROW)
+              {
+                const int sz= std::min(data.Size(),sqlite3_column_count(stmt));
+                for(int i=0; i<sz; i++)
+                  data[i]= sqlite3_column_double(stmt,i);
+                retval= 0;
+              }
+            else
+              {
+                // no data stored in db with these keys
+                std::cerr << "SQLiteDatastore::getData - no data in database for object with dbTag, cTag: ";
+                std::cerr << dbTAG << ", " << commitTag << std::endl;
+              }
+            sqlite3_finalize(stmt);
           }
-        db.getDefaultQuery()->free_result();
-        return 0;
       }
-    else
-      return -1;
+    return retval;
   }
 
-
+//! @brief Opens the database and creates the tables (if needed).
 int XC::SQLiteDatastore::createOpenSeesDatabase(const std::string &projectName)
   {
+    if(sqlite3_open(projectName.c_str(),&db) != SQLITE_OK)
+      {
+        std::cerr << "SQLiteDatastore::createOpenSeesDatabase() - could not open database: "
+                  << projectName << std::endl << sqlite3_errmsg(db) << std::endl;
+        return -1;
+      }
+    // write-ahead log: one fsync per commit instead of one per page.
+    execute("PRAGMA journal_mode=WAL");
+    execute("PRAGMA synchronous=NORMAL");
 
-    const std::string campos= "(dbTag INTEGER NOT nullptr,commitTag INTEGER NOT nullptr, size INTEGER NOT nullptr, data BLOB, PRIMARY KEY (dbTag, commitTag, size) )";
+    const std::string campos= "(dbTag INTEGER NOT NULL,commitTag INTEGER NOT NULL, size INTEGER NOT NULL, data BLOB, PRIMARY KEY (dbTag, commitTag, size) )";
     // now create the tables in the database
-
-    query= "CREATE TABLE Messages " + campos;
-    if(execute(query) != 0)
-      std::cerr << "SQLiteDatastore::createOpenSeesDatabase() - could not create the Messagess table\n";
-    query= "CREATE TABLE Matrices " + campos;
-    if(execute(query) != 0)
-      std::cerr << "SQLiteDatastore::createOpenSeesDatabase() - could not create the Matricess table\n";
-
-    query= "CREATE TABLE Vectors " + campos;
-    if(execute(query) != 0)
-      std::cerr << "SQLiteDatastore::createOpenSeesDatabase() - could not create the Vectors table\n";
-
-    query= "CREATE TABLE IDs " + campos;
-    if(execute(query) != 0)
-       std::cerr << "SQLiteDatastore::createOpenSeesDatabase() - could not create the ID's table\n";
+    for(int i= 0;i<NUM_TABLES;i++)
+      {
+        query= "CREATE TABLE IF NOT EXISTS " + std::string(tableNames[i]) + " " + campos;
+        if(execute(query) != 0)
+          {
+            std::cerr << "SQLiteDatastore::createOpenSeesDatabase() - could not create the "
+                      << tableNames[i] << " table\n";
+            return -1;
+          }
+      }
+    if(!prepare_statements())
+      return -1;
     return 0;
   }
 
 int XC::SQLiteDatastore::execute(const std::string &query)
   {
-    bool tmp= db.getDefaultQuery()->execute(query);
-    if(!tmp)
+    char *errMsg= nullptr;
+    if(sqlite3_exec(db,query.c_str(),nullptr,nullptr,&errMsg) != SQLITE_OK)
       {
         std::cerr << "SQLiteDatastore::execute() - could not execute command: " << query;
-        std::cerr << std::endl << db.getDefaultQuery()->getError() << std::endl;
+        if(errMsg)
+          {
+            std::cerr << std::endl << errMsg;
+            sqlite3_free(errMsg);
+          }
+        std::cerr << std::endl;
         return -1;
       }
     else
       return 0;
   }
-
@@ -30,7 +30,7 @@
 #define SQLiteDatastore_h
 
 #include "DBDatastore.h"
-#include "xc_utils/src/sqlite/SqLiteDatabase.h"
+#include <sqlite3.h>
 
 namespace XC {
 //! @ingroup Utils
@@ -39,20 +39,47 @@ namespace XC {
 //
 //! @ingroup Database
 //
+//! @brief Datastore that uses a SQLite database.
+//!
+//! The statements used to store and retrieve the objects are prepared
+//! once and reused (binding the keys and the blob on each call). Rows
+//! are written with INSERT OR REPLACE and each call to commitState
+//! runs inside a single transaction, so the blobs of a whole commit
+//! reach the disk together. The database is opened in WAL mode.
 class SQLiteDatastore: public DBDatastore
   {
   private:
+    //! @brief Tables used to store the objects.
+    enum TableIndex {MESSAGES= 0, MATRICES, VECTORS, IDS, NUM_TABLES};
+    static const char *tableNames[NUM_TABLES];
+
     bool connection;
-    SqLiteDatabase db; //!< database SqLite.
+    sqlite3 *db; //!< SQLite database connection.
+    sqlite3_stmt *insertStmts[NUM_TABLES]; //!< cached INSERT OR REPLACE statements.
+    sqlite3_stmt *selectStmts[NUM_TABLES]; //!< cached SELECT statements.
+    bool inTransaction; //!< true if there is an open transaction.
     std::string query;
-    bool insertData(const std::string &,const int &,const int &,const void *,const int &,const int &);
-    bool updateData(const std::string &,const int &,const int &,const void *,const int &,const int &);
-    const void *retrieveData(const std::string &tbName,const int &dbTag,const int &commitTag,const int &sz);
+
+    sqlite3_stmt *prepare(const std::string &);
+    bool prepare_statements(void);
+    void finalize_statements(void);
+    void close(void);
+    bool storeData(const TableIndex &,const int &,const int &,const void *,const int &,const int &);
+    bool retrieveData(const TableIndex &,const int &,const int &,void *,const int &,const int &);
+    int beginTransaction(void);
+    int endTransaction(const bool &);
+
+    SQLiteDatastore(const SQLiteDatastore &);
+    SQLiteDatastore &operator=(const SQLiteDatastore &);
   protected:
     int createOpenSeesDatabase(const std::string &projectName);
     int execute(const std::string &query);
   public:
     SQLiteDatastore(const std::string &,Preprocessor &, FEM_ObjectBroker &,int dbRun = 0);    
+    ~SQLiteDatastore(void);
+
+    int commitState(int commitTag);
+    int restoreState(int commitTag);
 
     // methods for sending and recieving matrices, vectors and id's
     int sendMsg(int , int , const Message &, ChannelAddress *a= nullptr);    
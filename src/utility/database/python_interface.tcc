@@ -36,6 +36,21 @@ class_<XC::BerkeleyDbDatastore, bases<XC::DBDatastore>, boost::noncopyable  >("B
 class_<XC::SQLiteDatastore, bases<XC::DBDatastore>, boost::noncopyable  >("SQLiteDatastore", no_init)
   ;
 
+class_<XC::MappedFileDatastore, bases<XC::DBDatastore>, boost::noncopyable  >("MappedFileDatastore", no_init)
+  .add_property("syncOnCommit",&XC::MappedFileDatastore::getSyncOnCommit,&XC::MappedFileDatastore::setSyncOnCommit,"If true the data is flushed to disk on each commit.")
+  .add_property("fileSize",&XC::MappedFileDatastore::getFileSize,"Size of the committed data (bytes).")
+  .add_property("numRecords",&XC::MappedFileDatastore::getNumRecords,"Number of records in the index.")
+  ;
+
+class_<XC::MemoryDatastore, bases<XC::DBDatastore>, boost::noncopyable  >("MemoryDatastore", no_init)
+  .add_property("maxSnapshots",&XC::MemoryDatastore::getMaxSnapshots,&XC::MemoryDatastore::setMaxSnapshots,"Maximum number of snapshots (0: no limit); the least recently used ones are discarded.")
+  .add_property("numSnapshots",&XC::MemoryDatastore::getNumSnapshots,"Number of snapshots.")
+  .add_property("numBlocks",&XC::MemoryDatastore::getNumBlocks,"Number of memory blocks (shared between snapshots).")
+  .add_property("memoryUsage",&XC::MemoryDatastore::getMemoryUsage,"Size of the stored values (bytes).")
+  .def("erase",&XC::MemoryDatastore::erase,"Discards the snapshot with the tag being passed as parameter.")
+  .def("clear",&XC::MemoryDatastore::clear,"Discards all the snapshots.")
+  ;
+
 //class_<XC::OracleDatastore, bases<XC::DBDatastore>, boost::noncopyable  >("OracleDatastore", no_init)
 //  ;
 
@@ -23,6 +23,13 @@
 
 #include "ProblemaEF.h"
 #include "python_interface.h"
+#include "utility/threads/parallel_for.h"
+#include "utility/handler/HDF5ResultsStore.h"
+#include "utility/handler/DataOutputFileHandler.h"
+#include "utility/handler/DataOutputHDF5Handler.h"
+#include "utility/actor/channel/SharedMemoryChannel.h"
+#include "utility/actor/machineBroker/LocalMachineBroker.h"
+#include "utility/actor/objectBroker/FEM_ObjectBroker.h"
 
 void export_utility(void)
   {
@@ -40,9 +47,14 @@ void export_utility(void)
        ;
 
 #include "actor/channel/python_interface.tcc"
+#include "actor/machineBroker/python_interface.tcc"
 #include "database/python_interface.tcc"
 #include "med_xc/python_interface.tcc"
 #include "recorder/python_interface.tcc"
+#include "handler/python_interface.tcc"
+
+    def("getNumThreads",XC::getNumThreads,"Return the number of threads used in parallel loops.");
+    def("setNumThreads",XC::setNumThreads,"Set the number of threads used in parallel loops (0: as many as hardware threads).");
 
   }
 
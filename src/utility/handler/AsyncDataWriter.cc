@@ -0,0 +1,156 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AsyncDataWriter.cc
+
+#include "AsyncDataWriter.h"
+#include "utility/matrix/Vector.h"
+#include <iostream>
+#include <algorithm>
+
+//! @brief Calls the run method of the writer.
+class AsyncDataWriterRunner
+  {
+    XC::AsyncDataWriter *writer;
+    void (XC::AsyncDataWriter::*method)(void);
+  public:
+    AsyncDataWriterRunner(XC::AsyncDataWriter *w,void (XC::AsyncDataWriter::*m)(void))
+      : writer(w), method(m) {}
+    void operator()(void)
+      { (writer->*method)(); }
+  };
+
+//! @brief Constructor.
+//! @param s: output stream.
+//! @param numCols: number of values on each row.
+//! @param bufferRows: number of rows that can be stored in the buffer.
+XC::AsyncDataWriter::AsyncDataWriter(std::ostream &s,const size_t &numCols,const size_t &bufferRows)
+  : os(s), numColumns(numCols), capacity(std::max(bufferRows,size_t(1))),
+    buffer(capacity*numCols,0.0), head(0), tail(0), stopRequested(false),
+    writerThread(nullptr)
+  {
+    writerThread= new boost::thread(AsyncDataWriterRunner(this,&AsyncDataWriter::run));
+  }
+
+//! @brief Destructor (writes pending rows).
+XC::AsyncDataWriter::~AsyncDataWriter(void)
+  { stop(); }
+
+//! @brief Writes the rows [first,last) to the stream (same
+//! format as operator<<(std::ostream &,const Vector &)).
+void XC::AsyncDataWriter::write_rows(const size_t &first,const size_t &last)
+  {
+    for(size_t r= first;r<last;r++)
+      {
+        const double *row= &buffer[(r%capacity)*numColumns];
+        for(size_t j= 0;j<numColumns;j++)
+          os << row[j] << " ";
+      }
+  }
+
+//! @brief Writer thread main loop.
+void XC::AsyncDataWriter::run(void)
+  {
+    boost::unique_lock<boost::mutex> lock(mtx);
+    while(true)
+      {
+        while((head==tail) && !stopRequested)
+          notEmpty.wait(lock);
+        if(head==tail) //Stop requested and nothing to write.
+          break;
+        const size_t first= head;
+        const size_t last= tail;
+        lock.unlock();
+        //The producer doesn't touch the rows in [first,last).
+        write_rows(first,last);
+        lock.lock();
+        head= last;
+        notFull.notify_all();
+      }
+    os.flush();
+  }
+
+//! @brief Appends the row to the buffer. If the buffer is
+//! full waits until the writer thread frees some space.
+int XC::AsyncDataWriter::write(const Vector &data)
+  {
+    if(size_t(data.Size())!=numColumns)
+      {
+        std::cerr << "AsyncDataWriter::" << __FUNCTION__
+                  << "; vector size: " << data.Size()
+                  << " is not equal to the number of columns: "
+                  << numColumns << std::endl;
+        return -1;
+      }
+    size_t slot= 0;
+    {
+      boost::unique_lock<boost::mutex> lock(mtx);
+      if(!writerThread || stopRequested)
+        {
+          std::cerr << "AsyncDataWriter::" << __FUNCTION__
+                    << "; writer stopped." << std::endl;
+          return -1;
+        }
+      while((tail-head)>=capacity)
+        notFull.wait(lock);
+      slot= tail%capacity;
+    }
+    double *row= &buffer[slot*numColumns];
+    for(size_t j= 0;j<numColumns;j++)
+      row[j]= data(j);
+    {
+      boost::lock_guard<boost::mutex> lock(mtx);
+      tail++;
+    }
+    notEmpty.notify_one();
+    return 0;
+  }
+
+//! @brief Waits until all the rows are written and flushes the stream.
+int XC::AsyncDataWriter::flush(void)
+  {
+    boost::unique_lock<boost::mutex> lock(mtx);
+    while(head!=tail)
+      notFull.wait(lock);
+    os.flush();
+    return 0;
+  }
+
+//! @brief Writes the pending rows and stops the writer thread.
+void XC::AsyncDataWriter::stop(void)
+  {
+    if(writerThread)
+      {
+        {
+          boost::lock_guard<boost::mutex> lock(mtx);
+          stopRequested= true;
+        }
+        notEmpty.notify_one();
+        writerThread->join();
+        delete writerThread;
+        writerThread= nullptr;
+      }
+  }
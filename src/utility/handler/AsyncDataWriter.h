@@ -0,0 +1,83 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//AsyncDataWriter.h
+
+#ifndef ASYNC_DATA_WRITER_H
+#define ASYNC_DATA_WRITER_H
+
+#include <ostream>
+#include <vector>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+namespace XC {
+class Vector;
+
+//! @brief Writes rows of doubles to an output stream
+//! from a background thread.
+//!
+//! The rows are copied (raw binary) into a bounded ring buffer
+//! and formatted as text by the writer thread. When the buffer
+//! is full write() waits until the writer frees some room (back-pressure),
+//! so memory usage is bounded by the buffer size.
+//! Single producer, single consumer: the mutex is held only
+//! to update the buffer indexes, never while copying or formatting.
+class AsyncDataWriter
+  {
+    std::ostream &os; //!< Output stream.
+    size_t numColumns; //!< Number of values on each row.
+    size_t capacity; //!< Number of rows in the ring buffer.
+    std::vector<double> buffer; //!< Ring buffer (capacity x numColumns).
+    size_t head; //!< Number of rows written to the stream.
+    size_t tail; //!< Number of rows appended to the buffer.
+    bool stopRequested;
+    boost::mutex mtx;
+    boost::condition_variable notEmpty; //!< Signals new rows or stop.
+    boost::condition_variable notFull; //!< Signals freed rows.
+    boost::thread *writerThread;
+
+    void write_rows(const size_t &,const size_t &);
+    void run(void);
+
+    AsyncDataWriter(const AsyncDataWriter &);
+    AsyncDataWriter &operator=(const AsyncDataWriter &);
+  public:
+    AsyncDataWriter(std::ostream &,const size_t &numCols,const size_t &bufferRows= 1024);
+    ~AsyncDataWriter(void);
+
+    inline size_t getNumColumns(void) const
+      { return numColumns; }
+    inline size_t getCapacity(void) const
+      { return capacity; }
+    int write(const Vector &);
+    int flush(void);
+    void stop(void);
+  };
+} // end of XC namespace
+
+#endif
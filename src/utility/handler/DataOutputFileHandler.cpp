@@ -57,12 +57,15 @@
 // What: "@(#) DataOutputFileHandler.C, revA"
 
 #include "utility/handler/DataOutputFileHandler.h"
+#include "utility/handler/AsyncDataWriter.h"
 #include <utility/matrix/Vector.h>
 #include <utility/matrix/ID.h>
 #include <utility/actor/channel/Channel.h>
 #include <utility/actor/message/Message.h>
 #include <fstream>
 #include "utility/actor/actor/CommMetaData.h"
+#include <sys/stat.h>
+#include <unistd.h>
 
 
 int setFile(std::ofstream &theFile,const std::string &name, XC::openMode mode)
@@ -73,6 +76,8 @@ int setFile(std::ofstream &theFile,const std::string &name, XC::openMode mode)
         return -1;
       }
 
+    if(theFile.is_open())
+      theFile.close();
     if(mode == XC::OVERWRITE) 
       theFile.open(name.c_str(), std::ios::out);
     else
@@ -89,7 +94,8 @@ int setFile(std::ofstream &theFile,const std::string &name, XC::openMode mode)
 
 XC::DataOutputFileHandler::DataOutputFileHandler(const std::string &theFileName, echoMode theEMode, openMode theOMode)
   :DataOutputHandler(DATAHANDLER_TAGS_DataOutputFileHandler),
-   fileName(""), theEchoMode(theEMode), theOpenMode(theOMode), numColumns(-1)
+   fileName(theFileName), theEchoMode(theEMode), theOpenMode(theOMode), numColumns(-1),
+   async(false), bufferSize(1024), asyncWriter(nullptr)
   {
     if(fileName != "" && setFile(outputFile,fileName, theOpenMode) < 0)
       {
@@ -98,6 +104,39 @@ XC::DataOutputFileHandler::DataOutputFileHandler(const std::string &theFileName,
       }
   }
 
+//! @brief Destructor (writes pending data).
+XC::DataOutputFileHandler::~DataOutputFileHandler(void)
+  {
+    free_writer();
+    if(outputFile.is_open())
+      outputFile.close();
+  }
+
+//! @brief Writes the pending rows and deletes the asynchronous writer.
+void XC::DataOutputFileHandler::free_writer(void)
+  {
+    if(asyncWriter)
+      {
+        delete asyncWriter; //Stops the writer thread.
+        asyncWriter= nullptr;
+      }
+  }
+
+//! @brief Enables (or disables) the asynchronous writing of the data.
+//!
+//! When enabled, write() copies the row into a buffer and returns;
+//! a background thread formats the rows and writes them to the file.
+//! @param b: true to enable asynchronous writing.
+//! @param bufferRows: maximum number of rows waiting to be written.
+void XC::DataOutputFileHandler::setAsync(const bool &b,const size_t &bufferRows)
+  {
+    free_writer();
+    async= b;
+    bufferSize= bufferRows;
+    if(async && (numColumns>=0) && outputFile.is_open())
+      asyncWriter= new AsyncDataWriter(outputFile,numColumns,bufferSize);
+  }
+
 int XC::DataOutputFileHandler::open(const std::vector<std::string> &dataDescription)
   {
     if(fileName.empty())
@@ -114,6 +153,7 @@ int XC::DataOutputFileHandler::open(const std::vector<std::string> &dataDescript
     else
       numColumns = numData;
 
+    free_writer(); //Pending rows go to the previous file.
     if(theEchoMode == DATA_FILE)
       {
         if(setFile(outputFile,fileName, theOpenMode) == 0)
@@ -156,6 +196,8 @@ int XC::DataOutputFileHandler::open(const std::vector<std::string> &dataDescript
             res = -1;
           }
       }
+    if(async && outputFile.is_open())
+      asyncWriter= new AsyncDataWriter(outputFile,numColumns,bufferSize);
     return 0;
   }
 
@@ -169,7 +211,12 @@ int XC::DataOutputFileHandler::write(Vector &data)
       }
 
     if(data.Size() == numColumns)
-      outputFile << data;
+      {
+        if(asyncWriter)
+          return asyncWriter->write(data);
+        else
+          outputFile << data;
+      }
     else
       {
         std::cerr << fileName;
@@ -179,6 +226,56 @@ int XC::DataOutputFileHandler::write(Vector &data)
     return 0;
   }
 
+//! @brief Waits until all rows are written and flushes the file.
+int XC::DataOutputFileHandler::flush(void)
+  {
+    int retval= 0;
+    if(asyncWriter)
+      retval= asyncWriter->flush();
+    else if(outputFile.is_open())
+      outputFile.flush();
+    return retval;
+  }
+
+//! @brief Writes the pending rows and returns the size of the file
+//! (-1 if the file is not open).
+long XC::DataOutputFileHandler::getOutputPosition(void)
+  {
+    long retval= -1;
+    if(outputFile.is_open())
+      {
+        flush();
+        struct stat st;
+        if(stat(fileName.c_str(),&st)==0)
+          retval= st.st_size;
+      }
+    return retval;
+  }
+
+//! @brief Truncates the file to the size being passed as parameter
+//! (see getOutputPosition), so the rows written after that position
+//! are discarded. The file is never extended.
+int XC::DataOutputFileHandler::setOutputPosition(const long &pos)
+  {
+    if(!outputFile.is_open() || (pos<0))
+      return 0;
+    flush();
+    struct stat st;
+    if((stat(fileName.c_str(),&st)!=0) || (pos>=st.st_size))
+      return 0;
+    free_writer();
+    outputFile.close();
+    int retval= truncate(fileName.c_str(),pos);
+    if(retval<0)
+      std::cerr << "XC::DataOutputFileHandler::setOutputPosition() - can't truncate file: "
+                << fileName << std::endl;
+    if(setFile(outputFile,fileName,APPEND)<0)
+      retval= -1;
+    else if(async)
+      asyncWriter= new AsyncDataWriter(outputFile,numColumns,bufferSize);
+    return retval;
+  }
+
 //! @brief Sends object members through the communicator being passed as parameter.
 int XC::DataOutputFileHandler::sendData(CommParameters &cp)
   {
@@ -57,6 +57,13 @@
 enum echoMode  {NONE, DATA_FILE, XML_FILE};
 
 namespace XC {
+class AsyncDataWriter;
+
+//! @brief Writes the data to a text file.
+//!
+//! If the asynchronous mode is enabled (see setAsync) the
+//! rows are buffered and written by a background thread so
+//! the analysis doesn't wait for the text formatting.
 class DataOutputFileHandler : public DataOutputHandler
   {
   private:
@@ -65,15 +72,30 @@ class DataOutputFileHandler : public DataOutputHandler
     echoMode theEchoMode;
     openMode theOpenMode;
     int numColumns;
+    bool async; //!< If true write rows from a background thread.
+    size_t bufferSize; //!< Number of rows of the asynchronous buffer.
+    AsyncDataWriter *asyncWriter;
+
+    void free_writer(void);
+    DataOutputFileHandler(const DataOutputFileHandler &);
+    DataOutputFileHandler &operator=(const DataOutputFileHandler &);
   protected:
     int sendData(CommParameters &cp);
     int recvData(const CommParameters &cp);
 
   public:
-    DataOutputFileHandler(const std::string &fileName =0, echoMode = NONE, openMode mode = OVERWRITE);
+    DataOutputFileHandler(const std::string &fileName= "", echoMode = NONE, openMode mode = OVERWRITE);
+    ~DataOutputFileHandler(void);
+
+    void setAsync(const bool &,const size_t &bufferRows= 1024);
+    inline bool isAsync(void) const
+      { return async; }
 
     int open(const std::vector<std::string> &dataDescription);
     int write(Vector &data);
+    int flush(void);
+    long getOutputPosition(void);
+    int setOutputPosition(const long &);
 
     int sendSelf(CommParameters &);  
     int recvSelf(const CommParameters &);
@@ -0,0 +1,142 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//DataOutputHDF5Handler.cc
+
+#include "utility/handler/DataOutputHDF5Handler.h"
+#include "utility/handler/HDF5ResultsStore.h"
+#include "utility/matrix/Vector.h"
+#include "classTags.h"
+
+//! @brief Constructor.
+//! @param fileName: name of the HDF5 file.
+//! @param tName: name of the table.
+XC::DataOutputHDF5Handler::DataOutputHDF5Handler(const std::string &fileName,const std::string &tName)
+  : DataOutputHandler(DATAHANDLER_TAGS_DataOutputHDF5Handler),
+    store(nullptr), ownsStore(false), tableName(tName)
+  {
+    if(!fileName.empty())
+      {
+        store= new HDF5ResultsStore(fileName);
+        ownsStore= true;
+      }
+  }
+
+//! @brief Constructor.
+//! @param s: results store (shared with other handlers).
+//! @param tName: name of the table.
+XC::DataOutputHDF5Handler::DataOutputHDF5Handler(HDF5ResultsStore &s,const std::string &tName)
+  : DataOutputHandler(DATAHANDLER_TAGS_DataOutputHDF5Handler),
+    store(&s), ownsStore(false), tableName(tName) {}
+
+//! @brief Destructor.
+XC::DataOutputHDF5Handler::~DataOutputHDF5Handler(void)
+  {
+    if(store)
+      {
+        if(ownsStore)
+          delete store;
+        else
+          store->flush();
+        store= nullptr;
+      }
+  }
+
+//! @brief Creates the table (if it doesn't already exists).
+int XC::DataOutputHDF5Handler::open(const std::vector<std::string> &dataDescription)
+  {
+    if(!store || !store->isOpen())
+      {
+        std::cerr << "XC::DataOutputHDF5Handler::open() - no results store.\n";
+        return -1;
+      }
+    int retval= 0;
+    if(store->hasTable(tableName))
+      {
+        if(store->getNumColumns(tableName)!=dataDescription.size())
+          {
+            std::cerr << "XC::DataOutputHDF5Handler::open() - table: '"
+                      << tableName << "' already exists with "
+                      << store->getNumColumns(tableName) << " columns.\n";
+            retval= -1;
+          }
+      }
+    else
+      retval= store->newTable(tableName,dataDescription);
+    return retval;
+  }
+
+//! @brief Appends the data to the table.
+int XC::DataOutputHDF5Handler::write(Vector &data)
+  {
+    if(!store)
+      {
+        std::cerr << "XC::DataOutputHDF5Handler::write() - no results store.\n";
+        return -1;
+      }
+    return store->appendRow(tableName,data);
+  }
+
+//! @brief Writes the buffered rows to the file.
+int XC::DataOutputHDF5Handler::flush(void)
+  {
+    int retval= 0;
+    if(store)
+      retval= store->flush();
+    return retval;
+  }
+
+//! @brief Returns the number of rows of the table (-1 if there is
+//! no results store).
+long XC::DataOutputHDF5Handler::getOutputPosition(void)
+  {
+    long retval= -1;
+    if(store && store->hasTable(tableName))
+      retval= store->getNumRows(tableName);
+    return retval;
+  }
+
+//! @brief Discards the rows of the table after the position being
+//! passed as parameter (see getOutputPosition).
+int XC::DataOutputHDF5Handler::setOutputPosition(const long &pos)
+  {
+    int retval= 0;
+    if(store && (pos>=0) && store->hasTable(tableName))
+      retval= store->truncateTable(tableName,pos);
+    return retval;
+  }
+
+int XC::DataOutputHDF5Handler::sendSelf(CommParameters &)
+  {
+    std::cerr << "XC::DataOutputHDF5Handler::sendSelf() - not yet implemented\n";
+    return -1;
+  }
+
+int XC::DataOutputHDF5Handler::recvSelf(const CommParameters &)
+  {
+    std::cerr << "XC::DataOutputHDF5Handler::recvSelf() - not yet implemented\n";
+    return -1;
+  }
@@ -0,0 +1,72 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//DataOutputHDF5Handler.h
+
+#ifndef DATAOUTPUTHDF5HANDLER_H
+#define DATAOUTPUTHDF5HANDLER_H
+
+#include "utility/handler/DataOutputHandler.h"
+#include <string>
+
+namespace XC {
+class HDF5ResultsStore;
+
+//! @brief Writes the data to a table of a HDF5 results store.
+//!
+//! Each row written by the recorder is appended to the table;
+//! the column names are those passed to open().
+class DataOutputHDF5Handler: public DataOutputHandler
+  {
+  private:
+    HDF5ResultsStore *store; //!< Results store.
+    bool ownsStore; //!< True if the store must be deleted by this object.
+    std::string tableName; //!< Name of the table.
+
+    DataOutputHDF5Handler(const DataOutputHDF5Handler &);
+    DataOutputHDF5Handler &operator=(const DataOutputHDF5Handler &);
+  public:
+    DataOutputHDF5Handler(const std::string &fileName= "",const std::string &tableName= "data");
+    DataOutputHDF5Handler(HDF5ResultsStore &,const std::string &tableName);
+    ~DataOutputHDF5Handler(void);
+
+    inline const std::string &getTableName(void) const
+      { return tableName; }
+    inline HDF5ResultsStore *getStore(void)
+      { return store; }
+
+    int open(const std::vector<std::string> &dataDescription);
+    int write(Vector &data);
+    int flush(void);
+    long getOutputPosition(void);
+    int setOutputPosition(const long &);
+
+    int sendSelf(CommParameters &);  
+    int recvSelf(const CommParameters &);
+  };
+} // end of XC namespace
+
+#endif
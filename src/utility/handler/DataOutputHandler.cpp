@@ -57,9 +57,27 @@
 // What: "@(#) DataOutputHandler.C, revA"
 
 #include "utility/handler/DataOutputHandler.h"
+#include "utility/xc_python_utils.h"
 
 XC::DataOutputHandler::DataOutputHandler(int classTag)
   :MovableObject(classTag)
   {}
 
- 
+
+//! @brief Opens the handler (column descriptions in a python list).
+int XC::DataOutputHandler::openPy(const boost::python::list &l)
+  { return open(vector_string_from_py_list(l)); }
+
+//! @brief Writes pending data (if any) to its destination.
+int XC::DataOutputHandler::flush(void)
+  { return 0; }
+
+//! @brief Returns the position of the end of the written data
+//! (-1 if the output can't be positioned).
+long XC::DataOutputHandler::getOutputPosition(void)
+  { return -1; }
+
+//! @brief Discards the data written after the position being passed
+//! as parameter (see getOutputPosition).
+int XC::DataOutputHandler::setOutputPosition(const long &)
+  { return 0; }
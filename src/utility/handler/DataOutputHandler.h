@@ -54,6 +54,7 @@
 #include <utility/actor/actor/MovableObject.h>
 #include "xc_utils/src/nucleo/EntCmd.h"
 #include <map>
+#include <boost/python/list.hpp>
 
 namespace XC {
 class Vector;
@@ -68,7 +69,11 @@ class DataOutputHandler: public MovableObject, public EntCmd
 
     //virtual int open(const std::vector<std::string> &dataDescription, int numData) =0;
     virtual int open(const std::vector<std::string> &dataDescription) =0;
+    int openPy(const boost::python::list &);
     virtual int write(Vector &data) =0;
+    virtual int flush(void);
+    virtual long getOutputPosition(void);
+    virtual int setOutputPosition(const long &);
   };
 } // end of XC namespace
 
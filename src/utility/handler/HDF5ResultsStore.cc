@@ -0,0 +1,865 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//HDF5ResultsStore.cc
+
+#include "HDF5ResultsStore.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/ID.h"
+#include "utility/xc_python_utils.h"
+#include <iostream>
+#include <algorithm>
+
+//! @brief Constructor (saves the current error handler and
+//! disables the automatic printing of errors).
+XC::HDF5ErrorSilencer::HDF5ErrorSilencer(void)
+  : func(nullptr), clientData(nullptr)
+  {
+    H5Eget_auto2(H5E_DEFAULT,&func,&clientData);
+    H5Eset_auto2(H5E_DEFAULT,nullptr,nullptr);
+  }
+
+//! @brief Destructor (restores the previous error handler).
+XC::HDF5ErrorSilencer::~HDF5ErrorSilencer(void)
+  { H5Eset_auto2(H5E_DEFAULT,func,clientData); }
+
+//! @brief Writes the strings in an attribute of the object.
+int write_string_attribute(hid_t obj,const std::string &name,const std::vector<std::string> &v)
+  {
+    int retval= 0;
+    const hsize_t dims[1]= {v.size()};
+    hid_t space= H5Screate_simple(1,dims,nullptr);
+    hid_t type= H5Tcopy(H5T_C_S1);
+    H5Tset_size(type,H5T_VARIABLE);
+    hid_t attr= H5Acreate2(obj,name.c_str(),type,space,H5P_DEFAULT,H5P_DEFAULT);
+    if(attr>=0)
+      {
+        std::vector<const char *> ptrs(v.size(),nullptr);
+        for(size_t i= 0;i<v.size();i++)
+          ptrs[i]= v[i].c_str();
+        if(!v.empty())
+          retval= H5Awrite(attr,type,&ptrs[0]);
+        H5Aclose(attr);
+      }
+    else
+      retval= -1;
+    H5Tclose(type);
+    H5Sclose(space);
+    return retval;
+  }
+
+//! @brief Reads the strings of an attribute of the object.
+std::vector<std::string> read_string_attribute(hid_t obj,const std::string &name)
+  {
+    std::vector<std::string> retval;
+    if(H5Aexists(obj,name.c_str())>0)
+      {
+        hid_t attr= H5Aopen(obj,name.c_str(),H5P_DEFAULT);
+        hid_t space= H5Aget_space(attr);
+        const hssize_t sz= H5Sget_simple_extent_npoints(space);
+        hid_t type= H5Tcopy(H5T_C_S1);
+        H5Tset_size(type,H5T_VARIABLE);
+        if(sz>0)
+          {
+            std::vector<char *> ptrs(sz,nullptr);
+            if(H5Aread(attr,type,&ptrs[0])>=0)
+              {
+                for(hssize_t i= 0;i<sz;i++)
+                  retval.push_back(ptrs[i] ? std::string(ptrs[i]) : std::string());
+                H5Dvlen_reclaim(type,space,H5P_DEFAULT,&ptrs[0]);
+              }
+          }
+        H5Tclose(type);
+        H5Sclose(space);
+        H5Aclose(attr);
+      }
+    return retval;
+  }
+
+//! @brief Returns the dimensions of the dataset.
+std::vector<hsize_t> get_dims(hid_t dataset)
+  {
+    hid_t space= H5Dget_space(dataset);
+    const int rank= H5Sget_simple_extent_ndims(space);
+    std::vector<hsize_t> retval(std::max(rank,0),0);
+    if(rank>0)
+      H5Sget_simple_extent_dims(space,&retval[0],nullptr);
+    H5Sclose(space);
+    return retval;
+  }
+
+//! @brief Reads the hyperslab of a double dataset into the buffer.
+int read_double_slab(hid_t dataset,const int &rank,const hsize_t *offset,const hsize_t *count,double *buffer)
+  {
+    hid_t fileSpace= H5Dget_space(dataset);
+    H5Sselect_hyperslab(fileSpace,H5S_SELECT_SET,offset,nullptr,count,nullptr);
+    hid_t memSpace= H5Screate_simple(rank,count,nullptr);
+    const herr_t retval= H5Dread(dataset,H5T_NATIVE_DOUBLE,memSpace,fileSpace,H5P_DEFAULT,buffer);
+    H5Sclose(memSpace);
+    H5Sclose(fileSpace);
+    return retval;
+  }
+
+//! @brief Extends the dataset along its first dimension and
+//! writes the buffer at the end.
+int append_double_slab(hid_t dataset,const int &rank,const hsize_t &oldSize,const hsize_t *count,const double *buffer)
+  {
+    std::vector<hsize_t> dims= get_dims(dataset);
+    dims[0]= oldSize+count[0];
+    herr_t retval= H5Dset_extent(dataset,&dims[0]);
+    if(retval>=0)
+      {
+        std::vector<hsize_t> offset(rank,0);
+        offset[0]= oldSize;
+        hid_t fileSpace= H5Dget_space(dataset);
+        H5Sselect_hyperslab(fileSpace,H5S_SELECT_SET,&offset[0],nullptr,count,nullptr);
+        hid_t memSpace= H5Screate_simple(rank,count,nullptr);
+        retval= H5Dwrite(dataset,H5T_NATIVE_DOUBLE,memSpace,fileSpace,H5P_DEFAULT,buffer);
+        H5Sclose(memSpace);
+        H5Sclose(fileSpace);
+      }
+    return retval;
+  }
+
+//! @brief Constructor.
+XC::HDF5ResultsStore::Table::Table(void)
+  : dataset(-1), numColumns(0), numRows(0), buffer() {}
+
+//! @brief Constructor.
+XC::HDF5ResultsStore::Field::Field(void)
+  : values(-1), steps(-1), numEntities(0), numComponents(0), numSteps(0) {}
+
+//! @brief Constructor.
+//! @param fName: file name (if not empty the file is opened).
+//! @param append: if true, open an existing file (created if it doesn't exist).
+XC::HDF5ResultsStore::HDF5ResultsStore(const std::string &fName,const bool &append)
+  : EntCmd(), fileName(), file(-1), chunkSize(256), compressionLevel(4)
+  {
+    if(!fName.empty())
+      open(fName,append);
+  }
+
+//! @brief Destructor (writes pending data and closes the file).
+XC::HDF5ResultsStore::~HDF5ResultsStore(void)
+  { close(); }
+
+//! @brief Opens the file.
+//! @param fName: file name.
+//! @param append: if true, open an existing file (created if it doesn't exist).
+int XC::HDF5ResultsStore::open(const std::string &fName,const bool &append)
+  {
+    close();
+    fileName= fName;
+    HDF5ErrorSilencer silencer; //Errors reported here.
+    if(append && (H5Fis_hdf5(fileName.c_str())>0))
+      file= H5Fopen(fileName.c_str(),H5F_ACC_RDWR,H5P_DEFAULT);
+    else
+      file= H5Fcreate(fileName.c_str(),H5F_ACC_TRUNC,H5P_DEFAULT,H5P_DEFAULT);
+    if(file<0)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; can't open file: '" << fileName << "'." << std::endl;
+        return -1;
+      }
+    return 0;
+  }
+
+//! @brief Closes the datasets.
+void XC::HDF5ResultsStore::close_objects(void)
+  {
+    for(table_map::iterator i= tables.begin();i!=tables.end();i++)
+      {
+        write_table_buffer(i->second);
+        H5Dclose(i->second.dataset);
+      }
+    tables.clear();
+    for(field_map::iterator i= fields.begin();i!=fields.end();i++)
+      {
+        H5Dclose(i->second.values);
+        H5Dclose(i->second.steps);
+      }
+    fields.clear();
+  }
+
+//! @brief Writes pending data and closes the file.
+void XC::HDF5ResultsStore::close(void)
+  {
+    if(isOpen())
+      {
+        close_objects();
+        H5Fclose(file);
+        file= -1;
+      }
+  }
+
+//! @brief Sets the number of rows (or steps) of each chunk.
+void XC::HDF5ResultsStore::setChunkSize(const size_t &sz)
+  { chunkSize= std::max(sz,size_t(1)); }
+
+//! @brief Sets the compression level (0: no compression, 9: maximum).
+void XC::HDF5ResultsStore::setCompressionLevel(const int &l)
+  { compressionLevel= std::max(0,std::min(l,9)); }
+
+//! @brief Writes all pending data to the file.
+int XC::HDF5ResultsStore::flush(void)
+  {
+    int retval= 0;
+    if(isOpen())
+      {
+        for(table_map::iterator i= tables.begin();i!=tables.end();i++)
+          retval+= write_table_buffer(i->second);
+        retval+= H5Fflush(file,H5F_SCOPE_GLOBAL);
+      }
+    return retval;
+  }
+
+//! @brief Returns the creation properties for a chunked and
+//! compressed dataset.
+hid_t XC::HDF5ResultsStore::create_chunked_props(const int &rank,const hsize_t *chunk) const
+  {
+    hid_t retval= H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_chunk(retval,rank,chunk);
+    if(compressionLevel>0)
+      {
+        H5Pset_shuffle(retval);
+        H5Pset_deflate(retval,compressionLevel);
+      }
+    return retval;
+  }
+
+//! @brief Returns a pointer to the table (opens it if needed).
+XC::HDF5ResultsStore::Table *XC::HDF5ResultsStore::get_table(const std::string &name)
+  {
+    Table *retval= nullptr;
+    table_map::iterator i= tables.find(name);
+    if(i!=tables.end())
+      retval= &(i->second);
+    else if(isOpen() && (H5Lexists(file,name.c_str(),H5P_DEFAULT)>0))
+      {
+        const std::string path= name+"/values";
+        if(H5Lexists(file,path.c_str(),H5P_DEFAULT)>0)
+          {
+            Table t;
+            t.dataset= H5Dopen2(file,path.c_str(),H5P_DEFAULT);
+            const std::vector<hsize_t> dims= get_dims(t.dataset);
+            if(dims.size()==2)
+              {
+                t.numRows= dims[0];
+                t.numColumns= dims[1];
+                retval= &(tables[name]= t);
+              }
+            else
+              H5Dclose(t.dataset);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Returns true if the table exists.
+bool XC::HDF5ResultsStore::hasTable(const std::string &name)
+  { return (get_table(name)!=nullptr); }
+
+//! @brief Creates a new table.
+//! @param name: name of the table.
+//! @param columnNames: names of the columns.
+int XC::HDF5ResultsStore::newTable(const std::string &name,const std::vector<std::string> &columnNames)
+  {
+    if(!isOpen())
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; file not open." << std::endl;
+        return -1;
+      }
+    if(hasTable(name) || hasField(name))
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; object: '" << name << "' already exists." << std::endl;
+        return -1;
+      }
+    const size_t numColumns= columnNames.size();
+    hid_t group= H5Gcreate2(file,name.c_str(),H5P_DEFAULT,H5P_DEFAULT,H5P_DEFAULT);
+    if(group<0)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; can't create table: '" << name << "'." << std::endl;
+        return -1;
+      }
+    const hsize_t dims[2]= {0,numColumns};
+    const hsize_t maxDims[2]= {H5S_UNLIMITED,numColumns};
+    const hsize_t chunk[2]= {chunkSize,std::max(numColumns,size_t(1))};
+    hid_t space= H5Screate_simple(2,dims,maxDims);
+    hid_t props= create_chunked_props(2,chunk);
+    Table t;
+    t.dataset= H5Dcreate2(group,"values",H5T_NATIVE_DOUBLE,space,H5P_DEFAULT,props,H5P_DEFAULT);
+    t.numColumns= numColumns;
+    H5Pclose(props);
+    H5Sclose(space);
+    int retval= 0;
+    if(t.dataset>=0)
+      {
+        write_string_attribute(t.dataset,"columns",columnNames);
+        tables[name]= t;
+      }
+    else
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; can't create dataset for table: '"
+                  << name << "'." << std::endl;
+        retval= -1;
+      }
+    H5Gclose(group);
+    return retval;
+  }
+
+//! @brief Writes the buffered rows of the table.
+int XC::HDF5ResultsStore::write_table_buffer(Table &t)
+  {
+    int retval= 0;
+    if(!t.buffer.empty() && (t.numColumns>0))
+      {
+        const size_t numNewRows= t.buffer.size()/t.numColumns;
+        const hsize_t count[2]= {numNewRows,t.numColumns};
+        retval= append_double_slab(t.dataset,2,t.numRows,count,&t.buffer[0]);
+        if(retval>=0)
+          t.numRows+= numNewRows;
+        else
+          std::cerr << nombre_clase() << "::" << __FUNCTION__
+                    << "; error writing to file: '" << fileName
+                    << "'." << std::endl;
+        t.buffer.clear();
+      }
+    return retval;
+  }
+
+//! @brief Appends a row to the table. Rows are written
+//! to the file a chunk at a time.
+int XC::HDF5ResultsStore::appendRow(const std::string &name,const Vector &v)
+  {
+    Table *t= get_table(name);
+    if(!t)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; table: '" << name << "' not found." << std::endl;
+        return -1;
+      }
+    if(size_t(v.Size())!=t->numColumns)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; vector size: " << v.Size()
+                  << " is not equal to the number of columns: "
+                  << t->numColumns << std::endl;
+        return -1;
+      }
+    if(t->buffer.capacity()<chunkSize*t->numColumns)
+      t->buffer.reserve(chunkSize*t->numColumns);
+    for(size_t j= 0;j<t->numColumns;j++)
+      t->buffer.push_back(v(j));
+    int retval= 0;
+    if(t->buffer.size()>=chunkSize*t->numColumns)
+      retval= write_table_buffer(*t);
+    return retval;
+  }
+
+//! @brief Returns the number of rows of the table.
+size_t XC::HDF5ResultsStore::getNumRows(const std::string &name)
+  {
+    size_t retval= 0;
+    Table *t= get_table(name);
+    if(t)
+      retval= t->numRows+((t->numColumns>0) ? t->buffer.size()/t->numColumns : 0);
+    return retval;
+  }
+
+//! @brief Discards the rows of the table after the first numRows
+//! ones (the table is never extended).
+int XC::HDF5ResultsStore::truncateTable(const std::string &name,const size_t &numRows)
+  {
+    Table *t= get_table(name);
+    if(!t)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; table: '" << name << "' not found." << std::endl;
+        return -1;
+      }
+    int retval= write_table_buffer(*t);
+    if((retval>=0) && (numRows<t->numRows))
+      {
+        std::vector<hsize_t> dims= get_dims(t->dataset);
+        dims[0]= numRows;
+        retval= H5Dset_extent(t->dataset,&dims[0]);
+        if(retval>=0)
+          t->numRows= numRows;
+        else
+          std::cerr << nombre_clase() << "::" << __FUNCTION__
+                    << "; can't resize table: '" << name
+                    << "'." << std::endl;
+      }
+    return retval;
+  }
+
+//! @brief Returns the number of columns of the table.
+size_t XC::HDF5ResultsStore::getNumColumns(const std::string &name)
+  {
+    size_t retval= 0;
+    Table *t= get_table(name);
+    if(t)
+      retval= t->numColumns;
+    return retval;
+  }
+
+//! @brief Returns the column names of the table.
+std::vector<std::string> XC::HDF5ResultsStore::getColumnNames(const std::string &name)
+  {
+    std::vector<std::string> retval;
+    Table *t= get_table(name);
+    if(t)
+      retval= read_string_attribute(t->dataset,"columns");
+    return retval;
+  }
+
+//! @brief Reads rows from the table.
+//! @param name: name of the table.
+//! @param first: index of the first row to read.
+//! @param num: number of rows to read (0: up to the last row).
+XC::Matrix XC::HDF5ResultsStore::readRows(const std::string &name,const size_t &first,const size_t &num)
+  {
+    Matrix retval;
+    Table *t= get_table(name);
+    if(t)
+      {
+        write_table_buffer(*t);
+        if(first<t->numRows)
+          {
+            size_t n= t->numRows-first;
+            if(num>0)
+              n= std::min(num,n);
+            const hsize_t offset[2]= {first,0};
+            const hsize_t count[2]= {n,t->numColumns};
+            std::vector<double> buffer(n*t->numColumns);
+            if(!buffer.empty() && (read_double_slab(t->dataset,2,offset,count,&buffer[0])>=0))
+              {
+                retval= Matrix(n,t->numColumns);
+                for(size_t i= 0;i<n;i++)
+                  for(size_t j= 0;j<t->numColumns;j++)
+                    retval(i,j)= buffer[i*t->numColumns+j];
+              }
+          }
+      }
+    else
+      std::cerr << nombre_clase() << "::" << __FUNCTION__
+                << "; table: '" << name << "' not found." << std::endl;
+    return retval;
+  }
+
+//! @brief Reads a column of the table.
+//! @param name: name of the table.
+//! @param col: column index.
+//! @param first: index of the first row to read.
+//! @param num: number of rows to read (0: up to the last row).
+XC::Vector XC::HDF5ResultsStore::readColumn(const std::string &name,const size_t &col,const size_t &first,const size_t &num)
+  {
+    Vector retval;
+    Table *t= get_table(name);
+    if(t && (col<t->numColumns))
+      {
+        write_table_buffer(*t);
+        if(first<t->numRows)
+          {
+            size_t n= t->numRows-first;
+            if(num>0)
+              n= std::min(num,n);
+            const hsize_t offset[2]= {first,col};
+            const hsize_t count[2]= {n,1};
+            retval= Vector(n);
+            if(read_double_slab(t->dataset,2,offset,count,retval.getDataPtr())<0)
+              retval= Vector();
+          }
+      }
+    else
+      std::cerr << nombre_clase() << "::" << __FUNCTION__
+                << "; table: '" << name << "' or column: "
+                << col << " not found." << std::endl;
+    return retval;
+  }
+
+//! @brief Returns a pointer to the field (opens it if needed).
+XC::HDF5ResultsStore::Field *XC::HDF5ResultsStore::get_field(const std::string &name)
+  {
+    Field *retval= nullptr;
+    field_map::iterator i= fields.find(name);
+    if(i!=fields.end())
+      retval= &(i->second);
+    else if(isOpen() && (H5Lexists(file,name.c_str(),H5P_DEFAULT)>0))
+      {
+        const std::string path= name+"/values";
+        const std::string stepsPath= name+"/steps";
+        if((H5Lexists(file,path.c_str(),H5P_DEFAULT)>0) && (H5Lexists(file,stepsPath.c_str(),H5P_DEFAULT)>0))
+          {
+            Field f;
+            f.values= H5Dopen2(file,path.c_str(),H5P_DEFAULT);
+            const std::vector<hsize_t> dims= get_dims(f.values);
+            if(dims.size()==3)
+              {
+                f.steps= H5Dopen2(file,stepsPath.c_str(),H5P_DEFAULT);
+                f.numSteps= dims[0];
+                f.numEntities= dims[1];
+                f.numComponents= dims[2];
+                retval= &(fields[name]= f);
+              }
+            else
+              H5Dclose(f.values);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Returns true if the field exists.
+bool XC::HDF5ResultsStore::hasField(const std::string &name)
+  { return (get_field(name)!=nullptr); }
+
+//! @brief Creates a new field.
+//! @param name: name of the field.
+//! @param tags: identifiers of the entities (nodes, elements,...).
+//! @param componentNames: names of the components.
+int XC::HDF5ResultsStore::newField(const std::string &name,const ID &tags,const std::vector<std::string> &componentNames)
+  {
+    if(!isOpen())
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; file not open." << std::endl;
+        return -1;
+      }
+    if(hasTable(name) || hasField(name))
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; object: '" << name << "' already exists." << std::endl;
+        return -1;
+      }
+    const size_t numEntities= tags.Size();
+    const size_t numComponents= componentNames.size();
+    if((numEntities==0) || (numComponents==0))
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; field: '" << name << "' has no entities ("
+                  << numEntities << ") or no components ("
+                  << numComponents << ")." << std::endl;
+        return -1;
+      }
+    hid_t group= H5Gcreate2(file,name.c_str(),H5P_DEFAULT,H5P_DEFAULT,H5P_DEFAULT);
+    if(group<0)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; can't create field: '" << name << "'." << std::endl;
+        return -1;
+      }
+    //Entity tags.
+    const hsize_t tagDims[1]= {numEntities};
+    hid_t tagSpace= H5Screate_simple(1,tagDims,nullptr);
+    hid_t tagSet= H5Dcreate2(group,"tags",H5T_NATIVE_INT,tagSpace,H5P_DEFAULT,H5P_DEFAULT,H5P_DEFAULT);
+    std::vector<int> tmp(numEntities);
+    for(size_t i= 0;i<numEntities;i++)
+      tmp[i]= tags(i);
+    H5Dwrite(tagSet,H5T_NATIVE_INT,H5S_ALL,H5S_ALL,H5P_DEFAULT,&tmp[0]);
+    H5Dclose(tagSet);
+    H5Sclose(tagSpace);
+
+    //Values (the chunks don't mix too many entities so the
+    //history of a single entity can be read quickly).
+    const hsize_t dims[3]= {0,numEntities,numComponents};
+    const hsize_t maxDims[3]= {H5S_UNLIMITED,numEntities,numComponents};
+    const hsize_t stepsPerChunk= std::max(chunkSize/16,size_t(1));
+    const hsize_t chunk[3]= {stepsPerChunk,std::min(numEntities,size_t(1024)),numComponents};
+    hid_t space= H5Screate_simple(3,dims,maxDims);
+    hid_t props= create_chunked_props(3,chunk);
+    Field f;
+    f.values= H5Dcreate2(group,"values",H5T_NATIVE_DOUBLE,space,H5P_DEFAULT,props,H5P_DEFAULT);
+    H5Pclose(props);
+    H5Sclose(space);
+
+    //Step labels.
+    const hsize_t stepDims[1]= {0};
+    const hsize_t stepMaxDims[1]= {H5S_UNLIMITED};
+    const hsize_t stepChunk[1]= {chunkSize};
+    hid_t stepSpace= H5Screate_simple(1,stepDims,stepMaxDims);
+    hid_t stepProps= H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_chunk(stepProps,1,stepChunk);
+    hid_t strType= H5Tcopy(H5T_C_S1);
+    H5Tset_size(strType,H5T_VARIABLE);
+    f.steps= H5Dcreate2(group,"steps",strType,stepSpace,H5P_DEFAULT,stepProps,H5P_DEFAULT);
+    H5Tclose(strType);
+    H5Pclose(stepProps);
+    H5Sclose(stepSpace);
+
+    int retval= 0;
+    if((f.values>=0) && (f.steps>=0))
+      {
+        write_string_attribute(f.values,"components",componentNames);
+        f.numEntities= numEntities;
+        f.numComponents= numComponents;
+        fields[name]= f;
+      }
+    else
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; can't create datasets for field: '"
+                  << name << "'." << std::endl;
+        if(f.values>=0) H5Dclose(f.values);
+        if(f.steps>=0) H5Dclose(f.steps);
+        retval= -1;
+      }
+    H5Gclose(group);
+    return retval;
+  }
+
+//! @brief Appends the values of a step (or load combination).
+//! @param name: name of the field.
+//! @param label: step label (i.e. combination name).
+//! @param values: matrix with a row for each entity and a column
+//! for each component.
+int XC::HDF5ResultsStore::appendStep(const std::string &name,const std::string &label,const Matrix &values)
+  {
+    Field *f= get_field(name);
+    if(!f)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; field: '" << name << "' not found." << std::endl;
+        return -1;
+      }
+    if((size_t(values.noRows())!=f->numEntities) || (size_t(values.noCols())!=f->numComponents))
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; matrix dimensions: (" << values.noRows()
+                  << "x" << values.noCols() << ") don't match field dimensions: ("
+                  << f->numEntities << "x" << f->numComponents << ")." << std::endl;
+        return -1;
+      }
+    //Row major order.
+    std::vector<double> buffer(f->numEntities*f->numComponents);
+    for(size_t i= 0;i<f->numEntities;i++)
+      for(size_t j= 0;j<f->numComponents;j++)
+        buffer[i*f->numComponents+j]= values(i,j);
+    const hsize_t count[3]= {1,f->numEntities,f->numComponents};
+    int retval= 0;
+    if(!buffer.empty())
+      retval= append_double_slab(f->values,3,f->numSteps,count,&buffer[0]);
+    else
+      {
+        const hsize_t dims[3]= {f->numSteps+1,f->numEntities,f->numComponents};
+        retval= H5Dset_extent(f->values,dims);
+      }
+    if(retval>=0)
+      {
+        const hsize_t newSize[1]= {f->numSteps+1};
+        retval= H5Dset_extent(f->steps,newSize);
+        if(retval>=0)
+          {
+            const hsize_t offset[1]= {f->numSteps};
+            const hsize_t one[1]= {1};
+            hid_t fileSpace= H5Dget_space(f->steps);
+            H5Sselect_hyperslab(fileSpace,H5S_SELECT_SET,offset,nullptr,one,nullptr);
+            hid_t memSpace= H5Screate_simple(1,one,nullptr);
+            hid_t strType= H5Tcopy(H5T_C_S1);
+            H5Tset_size(strType,H5T_VARIABLE);
+            const char *str= label.c_str();
+            retval= H5Dwrite(f->steps,strType,memSpace,fileSpace,H5P_DEFAULT,&str);
+            H5Tclose(strType);
+            H5Sclose(memSpace);
+            H5Sclose(fileSpace);
+          }
+      }
+    if(retval>=0)
+      f->numSteps++;
+    else
+      std::cerr << nombre_clase() << "::" << __FUNCTION__
+                << "; error writing to file: '" << fileName
+                << "'." << std::endl;
+    return retval;
+  }
+
+//! @brief Returns the number of steps of the field.
+size_t XC::HDF5ResultsStore::getNumSteps(const std::string &name)
+  {
+    size_t retval= 0;
+    Field *f= get_field(name);
+    if(f)
+      retval= f->numSteps;
+    return retval;
+  }
+
+//! @brief Returns the identifiers of the field entities.
+XC::ID XC::HDF5ResultsStore::getFieldTags(const std::string &name)
+  {
+    ID retval;
+    Field *f= get_field(name);
+    if(f && (f->numEntities>0))
+      {
+        const std::string path= name+"/tags";
+        hid_t tagSet= H5Dopen2(file,path.c_str(),H5P_DEFAULT);
+        std::vector<int> tmp(f->numEntities);
+        if(H5Dread(tagSet,H5T_NATIVE_INT,H5S_ALL,H5S_ALL,H5P_DEFAULT,&tmp[0])>=0)
+          {
+            retval= ID(f->numEntities);
+            for(size_t i= 0;i<f->numEntities;i++)
+              retval(i)= tmp[i];
+          }
+        H5Dclose(tagSet);
+      }
+    return retval;
+  }
+
+//! @brief Returns the names of the field components.
+std::vector<std::string> XC::HDF5ResultsStore::getComponentNames(const std::string &name)
+  {
+    std::vector<std::string> retval;
+    Field *f= get_field(name);
+    if(f)
+      retval= read_string_attribute(f->values,"components");
+    return retval;
+  }
+
+//! @brief Returns the labels of the field steps.
+std::vector<std::string> XC::HDF5ResultsStore::getStepLabels(const std::string &name)
+  {
+    std::vector<std::string> retval;
+    Field *f= get_field(name);
+    if(f && (f->numSteps>0))
+      {
+        hid_t strType= H5Tcopy(H5T_C_S1);
+        H5Tset_size(strType,H5T_VARIABLE);
+        hid_t space= H5Dget_space(f->steps);
+        std::vector<char *> ptrs(f->numSteps,nullptr);
+        if(H5Dread(f->steps,strType,H5S_ALL,H5S_ALL,H5P_DEFAULT,&ptrs[0])>=0)
+          {
+            for(size_t i= 0;i<f->numSteps;i++)
+              retval.push_back(ptrs[i] ? std::string(ptrs[i]) : std::string());
+            H5Dvlen_reclaim(strType,space,H5P_DEFAULT,&ptrs[0]);
+          }
+        H5Sclose(space);
+        H5Tclose(strType);
+      }
+    return retval;
+  }
+
+//! @brief Returns the values of the field for the step
+//! (a row for each entity and a column for each component).
+XC::Matrix XC::HDF5ResultsStore::readStep(const std::string &name,const size_t &step)
+  {
+    Matrix retval;
+    Field *f= get_field(name);
+    if(f && (step<f->numSteps))
+      {
+        const hsize_t offset[3]= {step,0,0};
+        const hsize_t count[3]= {1,f->numEntities,f->numComponents};
+        std::vector<double> buffer(f->numEntities*f->numComponents);
+        if(!buffer.empty() && (read_double_slab(f->values,3,offset,count,&buffer[0])>=0))
+          {
+            retval= Matrix(f->numEntities,f->numComponents);
+            for(size_t i= 0;i<f->numEntities;i++)
+              for(size_t j= 0;j<f->numComponents;j++)
+                retval(i,j)= buffer[i*f->numComponents+j];
+          }
+      }
+    else
+      std::cerr << nombre_clase() << "::" << __FUNCTION__
+                << "; field: '" << name << "' or step: "
+                << step << " not found." << std::endl;
+    return retval;
+  }
+
+//! @brief Returns the values of an entity for all the steps
+//! (a row for each step and a column for each component).
+//! @param name: name of the field.
+//! @param entity: index of the entity (position in the tags vector).
+XC::Matrix XC::HDF5ResultsStore::readHistory(const std::string &name,const size_t &entity)
+  {
+    Matrix retval;
+    Field *f= get_field(name);
+    if(f && (entity<f->numEntities))
+      {
+        const hsize_t offset[3]= {0,entity,0};
+        const hsize_t count[3]= {f->numSteps,1,f->numComponents};
+        std::vector<double> buffer(f->numSteps*f->numComponents);
+        if(!buffer.empty() && (read_double_slab(f->values,3,offset,count,&buffer[0])>=0))
+          {
+            retval= Matrix(f->numSteps,f->numComponents);
+            for(size_t i= 0;i<f->numSteps;i++)
+              for(size_t j= 0;j<f->numComponents;j++)
+                retval(i,j)= buffer[i*f->numComponents+j];
+          }
+      }
+    else
+      std::cerr << nombre_clase() << "::" << __FUNCTION__
+                << "; field: '" << name << "' or entity: "
+                << entity << " not found." << std::endl;
+    return retval;
+  }
+
+//! @brief Returns the values of a component of an entity for all the steps.
+//! @param name: name of the field.
+//! @param entity: index of the entity (position in the tags vector).
+//! @param component: index of the component.
+XC::Vector XC::HDF5ResultsStore::readComponentHistory(const std::string &name,const size_t &entity,const size_t &component)
+  {
+    Vector retval;
+    Field *f= get_field(name);
+    if(f && (entity<f->numEntities) && (component<f->numComponents))
+      {
+        if(f->numSteps>0)
+          {
+            const hsize_t offset[3]= {0,entity,component};
+            const hsize_t count[3]= {f->numSteps,1,1};
+            retval= Vector(f->numSteps);
+            if(read_double_slab(f->values,3,offset,count,retval.getDataPtr())<0)
+              retval= Vector();
+          }
+      }
+    else
+      std::cerr << nombre_clase() << "::" << __FUNCTION__
+                << "; field: '" << name << "', entity: " << entity
+                << " or component: " << component << " not found." << std::endl;
+    return retval;
+  }
+
+//! @brief Creates a new table (column names in a python list).
+int XC::HDF5ResultsStore::newTablePy(const std::string &name,const boost::python::list &l)
+  { return newTable(name,vector_string_from_py_list(l)); }
+
+//! @brief Returns the column names in a python list.
+boost::python::list XC::HDF5ResultsStore::getColumnNamesPy(const std::string &name)
+  { return vector_string_to_py_list(getColumnNames(name)); }
+
+//! @brief Creates a new field (component names in a python list).
+int XC::HDF5ResultsStore::newFieldPy(const std::string &name,const ID &tags,const boost::python::list &l)
+  { return newField(name,tags,vector_string_from_py_list(l)); }
+
+//! @brief Returns the component names in a python list.
+boost::python::list XC::HDF5ResultsStore::getComponentNamesPy(const std::string &name)
+  { return vector_string_to_py_list(getComponentNames(name)); }
+
+//! @brief Returns the step labels in a python list.
+boost::python::list XC::HDF5ResultsStore::getStepLabelsPy(const std::string &name)
+  { return vector_string_to_py_list(getStepLabels(name)); }
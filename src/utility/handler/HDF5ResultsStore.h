@@ -0,0 +1,163 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//HDF5ResultsStore.h
+
+#ifndef HDF5RESULTSSTORE_H
+#define HDF5RESULTSSTORE_H
+
+#include "xc_utils/src/nucleo/EntCmd.h"
+#include <hdf5.h>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace XC {
+class Vector;
+class Matrix;
+class ID;
+
+//! @ingroup Utils
+//
+//! @brief Disables the automatic printing of the HDF5 error stack
+//! while the object exists (the destructor restores the previous
+//! error handler, so the rest of the process is not affected).
+class HDF5ErrorSilencer
+  {
+    H5E_auto2_t func; //!< Previous error handler.
+    void *clientData; //!< Previous error handler data.
+
+    HDF5ErrorSilencer(const HDF5ErrorSilencer &);
+    HDF5ErrorSilencer &operator=(const HDF5ErrorSilencer &);
+  public:
+    HDF5ErrorSilencer(void);
+    ~HDF5ErrorSilencer(void);
+  };
+
+//! @ingroup Utils
+//
+//! @brief Columnar binary results store (HDF5 file).
+//!
+//! Stores two kind of objects, each one in its own HDF5 group:
+//! - tables: rows of values with a fixed number of columns
+//!   (i.e. the output of a recorder). Dataset "values" (rows x columns)
+//!   with the column names in the "columns" attribute.
+//! - fields: values indexed by (step, entity, component), i.e. the
+//!   displacements of a node set for each load combination. Datasets
+//!   "values" (steps x entities x components), "tags" (entity
+//!   identifiers) and "steps" (step labels), component names in the
+//!   "components" attribute.
+//!
+//! All the datasets are chunked and compressed (deflate) and
+//! can be read by slices without loading the whole file.
+class HDF5ResultsStore: public EntCmd
+  {
+  public:
+    //! @brief Table data.
+    struct Table
+      {
+        hid_t dataset;
+        size_t numColumns;
+        size_t numRows; //!< Rows already written to the file.
+        std::vector<double> buffer; //!< Rows waiting to be written.
+        Table(void);
+      };
+    //! @brief Field data.
+    struct Field
+      {
+        hid_t values;
+        hid_t steps;
+        size_t numEntities;
+        size_t numComponents;
+        size_t numSteps;
+        Field(void);
+      };
+    typedef std::map<std::string,Table> table_map;
+    typedef std::map<std::string,Field> field_map;
+  private:
+    std::string fileName; //!< File name.
+    hid_t file; //!< HDF5 file identifier.
+    size_t chunkSize; //!< Number of rows (steps) per chunk.
+    int compressionLevel; //!< Deflate level (0: no compression).
+    table_map tables;
+    field_map fields;
+
+    Table *get_table(const std::string &);
+    Field *get_field(const std::string &);
+    hid_t create_chunked_props(const int &,const hsize_t *) const;
+    int write_table_buffer(Table &);
+    void close_objects(void);
+
+    HDF5ResultsStore(const HDF5ResultsStore &);
+    HDF5ResultsStore &operator=(const HDF5ResultsStore &);
+  public:
+    HDF5ResultsStore(const std::string &fName= "",const bool &append= false);
+    ~HDF5ResultsStore(void);
+
+    int open(const std::string &,const bool &append= false);
+    void close(void);
+    inline bool isOpen(void) const
+      { return (file>=0); }
+    inline const std::string &getFileName(void) const
+      { return fileName; }
+    inline size_t getChunkSize(void) const
+      { return chunkSize; }
+    void setChunkSize(const size_t &);
+    inline int getCompressionLevel(void) const
+      { return compressionLevel; }
+    void setCompressionLevel(const int &);
+    int flush(void);
+
+    bool hasTable(const std::string &);
+    int newTable(const std::string &,const std::vector<std::string> &);
+    int appendRow(const std::string &,const Vector &);
+    size_t getNumRows(const std::string &);
+    int truncateTable(const std::string &,const size_t &);
+    size_t getNumColumns(const std::string &);
+    std::vector<std::string> getColumnNames(const std::string &);
+    Matrix readRows(const std::string &,const size_t &,const size_t &);
+    Vector readColumn(const std::string &,const size_t &,const size_t &first= 0,const size_t &num= 0);
+
+    bool hasField(const std::string &);
+    int newField(const std::string &,const ID &,const std::vector<std::string> &);
+    int appendStep(const std::string &,const std::string &,const Matrix &);
+    size_t getNumSteps(const std::string &);
+    ID getFieldTags(const std::string &);
+    std::vector<std::string> getComponentNames(const std::string &);
+    std::vector<std::string> getStepLabels(const std::string &);
+    Matrix readStep(const std::string &,const size_t &);
+    Matrix readHistory(const std::string &,const size_t &);
+    Vector readComponentHistory(const std::string &,const size_t &,const size_t &);
+
+    int newTablePy(const std::string &,const boost::python::list &);
+    boost::python::list getColumnNamesPy(const std::string &);
+    int newFieldPy(const std::string &,const ID &,const boost::python::list &);
+    boost::python::list getComponentNamesPy(const std::string &);
+    boost::python::list getStepLabelsPy(const std::string &);
+  };
+} // end of XC namespace
+
+#endif
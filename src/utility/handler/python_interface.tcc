@@ -0,0 +1,68 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  XC is free software: you can redistribute it and/or modify 
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of 
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//python_interface.tcc
+
+class_<XC::DataOutputHandler, bases<XC::MovableObject,EntCmd>, boost::noncopyable >("DataOutputHandler", no_init)
+  .def("open",&XC::DataOutputHandler::openPy,"open(columnDescriptions): prepares the output for rows with the given columns.")
+  .def("write",&XC::DataOutputHandler::write,"write(vector): writes a row.")
+  .def("flush",&XC::DataOutputHandler::flush,"Writes pending data (if any) to its destination.")
+  ;
+
+class_<XC::DataOutputFileHandler, bases<XC::DataOutputHandler>, boost::noncopyable >("DataOutputFileHandler", init<const std::string &>())
+  .def("setAsync",&XC::DataOutputFileHandler::setAsync,"setAsync(enable,bufferRows): if enabled the rows are buffered and written to the file from a background thread.")
+  .add_property("isAsync",&XC::DataOutputFileHandler::isAsync,"True if the rows are written from a background thread.")
+  ;
+
+class_<XC::HDF5ResultsStore, bases<EntCmd>, boost::noncopyable >("HDF5ResultsStore", init<const std::string &, bool>())
+  .def(init<const std::string &>())
+  .def("open",&XC::HDF5ResultsStore::open,"open(fileName,append): opens the file.")
+  .def("close",&XC::HDF5ResultsStore::close,"Writes pending data and closes the file.")
+  .def("flush",&XC::HDF5ResultsStore::flush,"Writes pending data to the file.")
+  .add_property("isOpen",&XC::HDF5ResultsStore::isOpen,"True if the file is open.")
+  .add_property("fileName",make_function(&XC::HDF5ResultsStore::getFileName,return_value_policy<copy_const_reference>()),"Name of the file.")
+  .add_property("chunkSize",&XC::HDF5ResultsStore::getChunkSize,&XC::HDF5ResultsStore::setChunkSize,"Number of rows (steps) of each chunk.")
+  .add_property("compressionLevel",&XC::HDF5ResultsStore::getCompressionLevel,&XC::HDF5ResultsStore::setCompressionLevel,"Compression level (0: none, 9: maximum).")
+  .def("hasTable",&XC::HDF5ResultsStore::hasTable,"hasTable(name): true if the table exists.")
+  .def("newTable",&XC::HDF5ResultsStore::newTablePy,"newTable(name,columnNames): creates a new table.")
+  .def("appendRow",&XC::HDF5ResultsStore::appendRow,"appendRow(name,vector): appends a row to the table.")
+  .def("getNumRows",&XC::HDF5ResultsStore::getNumRows,"getNumRows(name): returns the number of rows of the table.")
+  .def("truncateTable",&XC::HDF5ResultsStore::truncateTable,"truncateTable(name,numRows): discards the rows of the table after the first numRows ones.")
+  .def("getNumColumns",&XC::HDF5ResultsStore::getNumColumns,"getNumColumns(name): returns the number of columns of the table.")
+  .def("getColumnNames",&XC::HDF5ResultsStore::getColumnNamesPy,"getColumnNames(name): returns the column names of the table.")
+  .def("readRows",&XC::HDF5ResultsStore::readRows,"readRows(name,first,num): returns num rows of the table starting at first (num= 0: up to the last one).")
+  .def("readColumn",&XC::HDF5ResultsStore::readColumn,"readColumn(name,col,first,num): returns num values of the column starting at row first (num= 0: up to the last one).")
+  .def("hasField",&XC::HDF5ResultsStore::hasField,"hasField(name): true if the field exists.")
+  .def("newField",&XC::HDF5ResultsStore::newFieldPy,"newField(name,tags,componentNames): creates a new field for the entities whose identifiers are passed as parameter.")
+  .def("appendStep",&XC::HDF5ResultsStore::appendStep,"appendStep(name,label,matrix): appends the values of a step or load combination (a row for each entity, a column for each component).")
+  .def("getNumSteps",&XC::HDF5ResultsStore::getNumSteps,"getNumSteps(name): returns the number of steps of the field.")
+  .def("getFieldTags",&XC::HDF5ResultsStore::getFieldTags,"getFieldTags(name): returns the identifiers of the field entities.")
+  .def("getComponentNames",&XC::HDF5ResultsStore::getComponentNamesPy,"getComponentNames(name): returns the names of the field components.")
+  .def("getStepLabels",&XC::HDF5ResultsStore::getStepLabelsPy,"getStepLabels(name): returns the labels of the field steps.")
+  .def("readStep",&XC::HDF5ResultsStore::readStep,"readStep(name,step): returns the values of the step (a row for each entity).")
+  .def("readHistory",&XC::HDF5ResultsStore::readHistory,"readHistory(name,entityIndex): returns the values of the entity (a row for each step).")
+  .def("readComponentHistory",&XC::HDF5ResultsStore::readComponentHistory,"readComponentHistory(name,entityIndex,component): returns the values of the component of the entity for each step.")
+  ;
+
+class_<XC::DataOutputHDF5Handler, bases<XC::DataOutputHandler>, boost::noncopyable >("DataOutputHDF5Handler", init<const std::string &, const std::string &>())
+  .def(init<XC::HDF5ResultsStore &, const std::string &>()[with_custodian_and_ward<1,2>()])
+  .add_property("tableName",make_function(&XC::DataOutputHDF5Handler::getTableName,return_value_policy<copy_const_reference>()),"Name of the table.")
+  ;
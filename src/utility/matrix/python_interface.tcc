@@ -23,7 +23,9 @@
 
 class_<XC::ID, bases<EntCmd> >("ID")
   .def(vector_indexing_suite<XC::ID>() )  
+  .def("__init__",make_constructor(XC::id_from_py_buffer),"Constructor from a contiguous array (NumPy array,...).")
   .def(init<boost::python::list>())
+  .add_property("__array_interface__",XC::id_array_interface,"NumPy array interface (numpy.asarray(id) returns a view of the data, without copying them).")
   .def(init<std::set<int> >())
   .def(init<std::vector<int> >())
   .def(self_ns::str(self_ns::self))
@@ -41,7 +43,9 @@ def("id_to_py_list",XC::xc_id_to_py_list);
 
 double &(XC::Vector::*getItemVector)(const size_t &)= &XC::Vector::at;
 class_<XC::Vector, bases<EntCmd> >("Vector")
+  .def("__init__",make_constructor(XC::vector_from_py_buffer),"Constructor from a contiguous array (NumPy array,...).")
   .def(init<boost::python::list>())
+  .add_property("__array_interface__",XC::vector_array_interface,"NumPy array interface (numpy.asarray(v) returns a view of the data, without copying them).")
   .def("__getitem__",getItemVector, return_value_policy<return_by_value>())
 //  .def( "__getitem__", getItemVector, boost::python::arg( "index" ), boost::python::return_internal_reference<>() )
   .def(self * double())
@@ -71,7 +75,9 @@ implicitly_convertible<boost::python::list,XC::Vector>();
 
 double &(XC::Matrix::*at)(int,int)= &XC::Matrix::operator();
 class_<XC::Matrix, bases<EntCmd> >("Matrix")
+  .def("__init__",make_constructor(XC::matrix_from_py_buffer),"Constructor from a contiguous two-dimensional array (NumPy array,...).")
   .def(init<boost::python::list>())
+  .add_property("__array_interface__",XC::matrix_array_interface,"NumPy array interface (numpy.asarray(m) returns a view of the data, without copying them).")
   .def("__call__",at, return_value_policy<return_by_value>())
   .def(self * double())
   .def(double() * self)
@@ -28,11 +28,61 @@
 #include "domain/mesh/element/utils/gauss_models/GaussModel.h"
 #include "utility/xc_python_utils.h"
 #include "xc_utils/src/nucleo/python_utils.h"
+#include "post_process/FieldExtractor.h"
 
 //! @brief Constructor.
 XC::MEDDblFieldInfo::MEDDblFieldInfo(const FieldInfo &fi,MEDGroupInfo *grp)
   : MEDTFieldInfo<double>(fi,grp) {}
 
+//! @brief Assigns the field values using the compiled accessor whose
+//! name is the components property (see FieldExtractor), so the values
+//! of all the nodes or elements are obtained without evaluating
+//! a Python expression for each one of them. Returns false (and
+//! doesn't assign any value) if the property is not the name of an
+//! accessor, if the accessor gives a value for each Gauss point and
+//! numPoints is zero, or if some of the values can't be obtained.
+//!
+//! @param numPoints: number of Gauss points of the elements.
+bool XC::MEDDblFieldInfo::populateWithAccessor(const Set &set,const FieldInfo &fi,const size_t &numPoints)
+  {
+    const std::string &nmb_prop= fi.getComponentsProperty();
+    if(!FieldExtractor::isAccessor(nmb_prop))
+      return false;
+    if((numPoints==0) && FieldExtractor::isPerPointAccessor(nmb_prop))
+      return false;
+    const size_t dim= fi.getNumberOfComponents();
+    ID components(dim);
+    for(size_t k= 0;k<dim;k++)
+      components[k]= k;
+    FieldExtractor extractor(std::vector<std::string>(1,nmb_prop),components,numPoints);
+    int ok= 0;
+    if(fi.isDefinedOnNodes())
+      ok= extractor.compile(set.GetNodos());
+    else
+      ok= extractor.compile(set.getElements());
+    Matrix values;
+    if((ok<0) || (extractor.extract(values)<0))
+      return false; // use the Python expression.
+    const size_t numRows= values.noRows();
+    if(fi.isDefinedOnGaussPoints())
+      {
+        const DqPtrsElem &elements= set.getElements();
+        DqPtrsElem::const_iterator j= elements.begin();
+        for(size_t i= 0;i<numRows;i++,j++)
+          {
+            const MED_EN::medGeometryElement tipo= (*j)->getMEDCellType();
+            for(size_t k= 1;k<=dim;k++)
+              for(size_t l=1;l<=numPoints;l++)
+                setValueIJK(i+1,k,l,tipo,values(i,(l-1)*dim+k-1));
+          }
+      }
+    else
+      for(size_t i= 0;i<numRows;i++)
+        for(size_t k= 1;k<=dim;k++)
+          setValueIJ(i+1,k,values(i,k-1));
+    return true;
+  }
+
 //! @brief Asigna los valores del campo en los nodos.
 void XC::MEDDblFieldInfo::populateOnNodes(const Set &set,const FieldInfo &fi)
   {
@@ -40,6 +90,8 @@ void XC::MEDDblFieldInfo::populateOnNodes(const Set &set,const FieldInfo &fi)
     const size_t dim= fi.getNumberOfComponents();
     int conta= 1; std::vector<double> valor(dim);
     const std::string nmb_prop= fi.getComponentsProperty();
+    if(populateWithAccessor(set,fi))
+      return;
     if(!nmb_prop.empty())
       {
         for(DqPtrsNode::const_iterator j= nodos.begin();j!=nodos.end();j++,conta++)
@@ -73,7 +125,7 @@ void XC::MEDDblFieldInfo::populateOnElements(const Set &set,const FieldInfo &fi)
     const std::string nmb_prop= fi.getComponentsProperty();
     if(nmb_prop.empty())
       std::cerr << "Components property name is empty" << std::endl;
-    else
+    else if(!populateWithAccessor(set,fi))
       {
         for(DqPtrsElem::const_iterator j= elements.begin();j!=elements.end();j++,conta++)
           {
@@ -107,6 +159,20 @@ void XC::MEDDblFieldInfo::populateOnGaussPoints(const Set &set,const FieldInfo &
       std::cerr << "Components property name is empty" << std::endl;
     else
       {
+        // The compiled accessor needs the same number of
+        // Gauss points in all the elements.
+        size_t num_ptos= 0;
+        bool sameNumPoints= true;
+        for(DqPtrsElem::const_iterator j= elements.begin();j!=elements.end();j++)
+          {
+            const size_t n= (*j)->getGaussModel().getNumGaussPoints();
+            if(j==elements.begin())
+              num_ptos= n;
+            else if(n!=num_ptos)
+              { sameNumPoints= false; break; }
+          }
+        if(sameNumPoints && (num_ptos>0) && populateWithAccessor(set,fi,num_ptos))
+          return;
         for(DqPtrsElem::const_iterator j= elements.begin();j!=elements.end();j++,conta++)
           {
             boost::python::object pyObj(boost::ref(*j));
@@ -40,6 +40,7 @@ class MEDDblFieldInfo: public MEDTFieldInfo<double>
     friend class MEDMeshing;
     MEDDblFieldInfo(const FieldInfo &,MEDGroupInfo *);
 
+    bool populateWithAccessor(const Set &,const FieldInfo &,const size_t &numPoints= 0);
 
     void populateOnNodes(const Set &,const FieldInfo &);
     void populateOnElements(const Set &,const FieldInfo &);
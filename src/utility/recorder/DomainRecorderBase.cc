@@ -29,7 +29,7 @@
 #include <utility/recorder/DomainRecorderBase.h>
 
 XC::DomainRecorderBase::DomainRecorderBase(int classTag,Domain *ptr_dom)
-  :Recorder(classTag),theDomain(0) {}
+  :Recorder(classTag),theDomain(ptr_dom) {}
 
 
 int XC::DomainRecorderBase::setDomain(Domain &theDom)
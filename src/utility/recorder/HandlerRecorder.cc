@@ -28,6 +28,7 @@
 
 #include <utility/recorder/HandlerRecorder.h>
 #include <utility/handler/DataOutputHandler.h>
+#include <utility/matrix/Vector.h>
 
 XC::HandlerRecorder::HandlerRecorder(int classTag)
   :DomainRecorderBase(classTag,nullptr), theHandler(nullptr), initializationDone(false), echoTimeFlag(false)
@@ -40,6 +41,42 @@ XC::HandlerRecorder::HandlerRecorder(int classTag,Domain &theDom,DataOutputHandl
 void XC::HandlerRecorder::SetOutputHandler(DataOutputHandler *tH)
   { theHandler= tH; }
 
+//! @brief Writes the data buffered by the output handler.
+int XC::HandlerRecorder::flush(void)
+  {
+    int retval= 0;
+    if(theHandler)
+      retval= theHandler->flush();
+    return retval;
+  }
+
+//! @brief Returns the position of the output handler (empty if
+//! the handler can't be positioned).
+XC::Vector XC::HandlerRecorder::getOutputState(void)
+  {
+    Vector retval;
+    if(theHandler)
+      {
+        const long pos= theHandler->getOutputPosition();
+        if(pos>=0)
+          {
+            retval.resize(1);
+            retval(0)= pos;
+          }
+      }
+    return retval;
+  }
+
+//! @brief Brings the output handler back to the position being
+//! passed as parameter.
+int XC::HandlerRecorder::setOutputState(const Vector &v)
+  {
+    int retval= 0;
+    if(theHandler && (v.Size()>0))
+      retval= theHandler->setOutputPosition(long(v(0)));
+    return retval;
+  }
+
 
 //! @brief Sends objet through the communicator being passed as parameter.
 int XC::HandlerRecorder::sendData(CommParameters &cp)
@@ -53,7 +53,9 @@ class HandlerRecorder: public DomainRecorderBase
     HandlerRecorder(int classTag);
     HandlerRecorder(int classTag, Domain &theDomain, DataOutputHandler &theOutputHandler,bool timeFlag);
     void SetOutputHandler(DataOutputHandler *tH);
-
+    int flush(void);
+    Vector getOutputState(void);
+    int setOutputState(const Vector &);
   };
 } // end of XC namespace
 
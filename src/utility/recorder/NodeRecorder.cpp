@@ -196,6 +196,26 @@ XC::NodeRecorder::NodeRecorder(const XC::ID &dofs, const XC::ID &nodes,
     setup_data_flag(dataToStore);
   }
 
+//! @brief Sets the DOFs and the nodes to record and the response
+//! to store ("disp", "vel", "accel", "reaction",...).
+void XC::NodeRecorder::setup(const ID &dofs,const ID &nodes,const std::string &dataToStore)
+  {
+    if(theDofs)
+      {
+        delete theDofs;
+        theDofs= nullptr;
+      }
+    if(theNodalTags)
+      {
+        delete theNodalTags;
+        theNodalTags= nullptr;
+      }
+    setup_dofs(dofs);
+    setup_nodes(nodes);
+    setup_data_flag(dataToStore);
+    initializationDone= false;
+  }
+
 int XC::NodeRecorder::record(int commitTag, double timeStamp)
   {
     if(theDomain == 0 || theNodalTags == 0 || theDofs == 0)
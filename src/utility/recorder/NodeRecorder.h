@@ -94,6 +94,8 @@ class NodeRecorder: public NodeRecorderBase
 		 Domain &theDomain, DataOutputHandler &theOutputHandler,
 		 double deltaT = 0.0, bool echoTimeFlag = true); 
 
+    void setup(const ID &dofs,const ID &nodes,const std::string &dataToStore);
+
     int record(int commitTag, double timeStamp);
 
     int sendSelf(CommParameters &);  
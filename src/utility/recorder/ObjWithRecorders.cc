@@ -64,6 +64,8 @@
 #include <utility/recorder/PatternRecorder.h>
 #include <utility/recorder/NodePropRecorder.h>
 #include <utility/recorder/ElementPropRecorder.h>
+#include <utility/recorder/VtkRecorder.h>
+#include <utility/matrix/Vector.h>
 
 
 #include "boost/any.hpp"
@@ -151,6 +153,11 @@ XC::Recorder *XC::ObjWithRecorders::newRecorder(const std::string &cod,DataOutpu
         ElementPropRecorder *tmp= new ElementPropRecorder(get_domain_ptr());
         retval= tmp;
       }
+    else if(cod == "vtk_recorder")
+      {
+        VtkRecorder *tmp= new VtkRecorder(get_domain_ptr());
+        retval= tmp;
+      }
     else
       std::cerr << "Recorder type: '" << cod
                 << "' unknown." << std::endl;
@@ -189,9 +196,69 @@ void XC::ObjWithRecorders::restart(void)
       (*i)->restart();
   }
 
+//! @brief Writes the output buffered by the recorders.
+void XC::ObjWithRecorders::flush(void)
+  {
+    for(lista_recorders::iterator i= theRecorders.begin();i!= theRecorders.end(); i++)
+      (*i)->flush();
+  }
+
+//! @brief Returns the output state of the recorders (see
+//! Recorder::getOutputState): number of recorders followed,
+//! for each recorder, by the size of its state and its values.
+XC::Vector XC::ObjWithRecorders::getRecordersOutputState(void)
+  {
+    std::vector<double> tmp(1,double(theRecorders.size()));
+    for(lista_recorders::iterator i= theRecorders.begin();i!= theRecorders.end(); i++)
+      {
+        const Vector v= (*i)->getOutputState();
+        tmp.push_back(v.Size());
+        for(int j= 0;j<v.Size();j++)
+          tmp.push_back(v(j));
+      }
+    return Vector(tmp);
+  }
+
+//! @brief Restores the output state of the recorders (see
+//! getRecordersOutputState).
+int XC::ObjWithRecorders::setRecordersOutputState(const Vector &v)
+  {
+    if(v.Size()<1)
+      return 0;
+    if(size_t(v(0))!=theRecorders.size())
+      {
+        std::cerr << "ObjWithRecorders::" << __FUNCTION__
+                  << "; the number of recorders: " << theRecorders.size()
+                  << " is not equal to the number of stored states: "
+                  << v(0) << std::endl;
+        return -1;
+      }
+    int retval= 0;
+    int offset= 1;
+    for(lista_recorders::iterator i= theRecorders.begin();i!= theRecorders.end(); i++)
+      {
+        const int sz= (offset<v.Size()) ? int(v(offset)) : -1;
+        offset++;
+        if((sz<0) || (offset+sz>v.Size()))
+          {
+            std::cerr << "ObjWithRecorders::" << __FUNCTION__
+                      << "; wrong recorder state." << std::endl;
+            return -1;
+          }
+        Vector state(sz);
+        for(int j= 0;j<sz;j++)
+          state(j)= v(offset+j);
+        offset+= sz;
+        if((*i)->setOutputState(state)<0)
+          retval= -1;
+      }
+    return retval;
+  }
+
 //! @brief Elimina los recorders.
 int XC::ObjWithRecorders::removeRecorders(void)
   {
+    flush();
     for(lista_recorders::iterator i= theRecorders.begin();i!= theRecorders.end(); i++)
       delete *i; 
     theRecorders.erase(theRecorders.begin(),theRecorders.end());
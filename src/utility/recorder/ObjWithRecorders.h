@@ -37,6 +37,7 @@
 namespace XC {
 class Recorder;
  class Domain;
+class Vector;
 
 //! @ingroup Recorder
 //
@@ -75,6 +76,9 @@ class ObjWithRecorders: public EntCmd
       { return theRecorders.end(); }
     virtual int record(int track, double timeStamp= 0.0);
     void restart(void);
+    void flush(void);
+    Vector getRecordersOutputState(void);
+    int setRecordersOutputState(const Vector &);
     virtual int removeRecorders(void);
     void setLinks(Domain *dom);
     void SetOutputHandlers(DataOutputHandler::map_output_handlers *oh);
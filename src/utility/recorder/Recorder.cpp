@@ -58,6 +58,7 @@
 // What: "@(#) Recorder.cpp, revA"
 
 #include <utility/recorder/Recorder.h>
+#include <utility/matrix/Vector.h>
 
 XC::Recorder::Recorder(int classTag)
   :MovableObject(classTag), EntCmd() {}
@@ -65,6 +66,21 @@ XC::Recorder::Recorder(int classTag)
 int XC::Recorder::restart(void)
   { return 0; }
 
+//! @brief Writes buffered output (if any).
+int XC::Recorder::flush(void)
+  { return 0; }
+
+//! @brief Returns the position of the output written so far
+//! (i.e. file size or number of written steps), so it can be
+//! stored in a checkpoint. Empty if the recorder has no such state.
+XC::Vector XC::Recorder::getOutputState(void)
+  { return Vector(); }
+
+//! @brief Discards the output written after the position being
+//! passed as parameter (see getOutputState).
+int XC::Recorder::setOutputState(const Vector &)
+  { return 0; }
+
 int XC::Recorder::setDomain(Domain &theDomain)
   { return 0; }
 
@@ -67,6 +67,7 @@
 
 namespace XC {
 class Domain;
+class Vector;
 
 //! @ingroup Utils
 //
@@ -85,6 +86,9 @@ class Recorder: public MovableObject, public EntCmd
     virtual int record(int commitTag, double timeStamp) =0;
     
     virtual int restart(void);
+    virtual int flush(void);
+    virtual Vector getOutputState(void);
+    virtual int setOutputState(const Vector &);
     virtual int setDomain(Domain &theDomain);
     virtual int sendSelf(CommParameters &);  
     virtual int recvSelf(const CommParameters &);
@@ -0,0 +1,660 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//VtkRecorder.cc
+
+#include "VtkRecorder.h"
+#include "domain/domain/Domain.h"
+#include "domain/mesh/node/Node.h"
+#include "domain/mesh/element/Element.h"
+#include "domain/mesh/element/utils/NodePtrsWithIDs.h"
+#include "preprocessor/Preprocessor.h"
+#include "preprocessor/set_mgmt/MapSet.h"
+#include "preprocessor/set_mgmt/Set.h"
+#include "post_process/FieldExtractor.h"
+#include "utility/xc_python_utils.h"
+#include "utility/handler/HDF5ResultsStore.h"
+#include "vtkCellType.h"
+#include <boost/lexical_cast.hpp>
+#include <fstream>
+#include <map>
+#include <algorithm>
+
+namespace XC {
+//! @brief Returns the byte order of this machine as VTK names it.
+static const char *vtk_byte_order(void)
+  {
+    const int one= 1;
+    return (*reinterpret_cast<const char *>(&one)==1) ? "LittleEndian" : "BigEndian";
+  }
+
+//! @brief Returns the XDMF type of a VTK cell (0 if unknown).
+static int xdmf_cell_type(const int &vtkType)
+  {
+    switch(vtkType)
+      {
+      case VTK_VERTEX:
+      case VTK_POLY_VERTEX:
+        return 1; //Polyvertex.
+      case VTK_LINE:
+      case VTK_POLY_LINE:
+        return 2; //Polyline.
+      case VTK_TRIANGLE:
+        return 4;
+      case VTK_QUAD:
+        return 5;
+      case VTK_TETRA:
+        return 6;
+      case VTK_PYRAMID:
+        return 7;
+      case VTK_WEDGE:
+        return 8;
+      case VTK_HEXAHEDRON:
+        return 9;
+      case VTK_QUADRATIC_TRIANGLE:
+        return 36; //Tri_6
+      case VTK_QUADRATIC_QUAD:
+        return 37; //Quad_8
+      case VTK_BIQUADRATIC_QUAD:
+        return 35; //Quad_9
+      case VTK_QUADRATIC_HEXAHEDRON:
+        return 48; //Hex_20
+      case VTK_TRIQUADRATIC_HEXAHEDRON:
+        return 50; //Hex_27
+      default:
+        return 0;
+      }
+  }
+
+//! @brief Returns the XDMF attribute type for the number of components.
+static const char *xdmf_attribute_type(const size_t &numComponents)
+  {
+    switch(numComponents)
+      {
+      case 1:
+        return "Scalar";
+      case 3:
+        return "Vector";
+      default:
+        return "Matrix";
+      }
+  }
+
+//! @brief Returns the file name without its directory.
+static std::string base_name(const std::string &path)
+  {
+    const size_t pos= path.find_last_of('/');
+    return (pos==std::string::npos ? path : path.substr(pos+1));
+  }
+
+//! @brief Writes the binary block (size header followed by the values)
+//! of an appended VTK data array.
+template <class T>
+void write_vtk_block(std::ostream &out,const std::vector<T> &v)
+  {
+    const unsigned long long sz= v.size()*sizeof(T);
+    out.write(reinterpret_cast<const char *>(&sz),sizeof(sz));
+    if(sz)
+      out.write(reinterpret_cast<const char *>(&v[0]),sz);
+  }
+} // end of XC namespace
+
+//! @brief Constructor.
+XC::VtkRecorder::FieldOutput::FieldOutput(const std::string &nmb,FieldExtractor *ext)
+  : name(nmb), extractor(ext), values(), buffer() {}
+
+//! @brief Constructor.
+XC::VtkRecorder::VtkRecorder(Domain *ptr_dom)
+  : DomainRecorderBase(RECORDER_TAGS_VtkRecorder,ptr_dom), fileName("results"),
+    format("vtu"), setName("total"), deltaT(0.0), nextTimeStampToRecord(0.0),
+    fields(), meshCompiled(false), topologySize(0), h5file(-1) {}
+
+//! @brief Destructor.
+XC::VtkRecorder::~VtkRecorder(void)
+  {
+    close();
+    free_fields();
+  }
+
+//! @brief Deletes the field extractors.
+void XC::VtkRecorder::free_fields(void)
+  {
+    for(field_outputs::iterator i= fields.begin();i!=fields.end();i++)
+      if(i->extractor) delete i->extractor;
+    fields.clear();
+  }
+
+//! @brief Sets the output format ("vtu" or "xdmf").
+void XC::VtkRecorder::setFormat(const std::string &s)
+  {
+    if((s=="vtu") || (s=="xdmf"))
+      format= s;
+    else
+      std::cerr << nombre_clase() << "::" << __FUNCTION__
+                << "; unknown format: '" << s
+                << "' (must be 'vtu' or 'xdmf')." << std::endl;
+  }
+
+//! @brief Adds a field to write at each step.
+//!
+//! @param name: name of the field in the output files.
+//! @param quantity: nodal or element quantity (see FieldExtractor).
+//! @param cmps: components to write (all if empty).
+//! @param nPoints: number of integration points (see FieldExtractor).
+void XC::VtkRecorder::addField(const std::string &name,const std::vector<std::string> &quantity,const ID &cmps,const size_t &nPoints)
+  {
+    fields.push_back(FieldOutput(name,new FieldExtractor(quantity,cmps,nPoints)));
+    meshCompiled= false;
+  }
+
+//! @brief Adds a field to write at each step (Python interface).
+void XC::VtkRecorder::addFieldPy(const std::string &name,const boost::python::list &quantity,const boost::python::list &cmps,const size_t &nPoints)
+  {
+    std::vector<std::string> q;
+    const size_t sz= len(quantity);
+    for(size_t i= 0;i<sz;i++)
+      q.push_back(boost::python::extract<std::string>(quantity[i]));
+    addField(name,q,ID(vector_int_from_py_object(cmps)),nPoints);
+  }
+
+//! @brief Returns the set to write.
+const XC::Set *XC::VtkRecorder::get_set(void) const
+  {
+    const Set *retval= nullptr;
+    const Preprocessor *preprocessor= (theDomain ? theDomain->GetPreprocessor() : nullptr);
+    if(preprocessor)
+      retval= dynamic_cast<const Set *>(preprocessor->get_sets().busca_set(setName));
+    if(!retval)
+      std::cerr << nombre_clase() << "::" << __FUNCTION__
+                << "; set: '" << setName << "' not found." << std::endl;
+    return retval;
+  }
+
+//! @brief Returns the VTK cell type of the element (the type returned
+//! by the element is corrected using its number of nodes).
+int XC::VtkRecorder::get_vtk_cell_type(const Element &e)
+  {
+    int retval= e.getVtkCellType();
+    const int numNodes= e.getNumExternalNodes();
+    if((retval==VTK_VERTEX) && (numNodes>1)) //zero length elements.
+      retval= VTK_POLY_VERTEX;
+    else if((retval==VTK_LINE) && (numNodes>2))
+      retval= VTK_POLY_LINE;
+    else if((retval==VTK_QUADRATIC_QUAD) && (numNodes==9))
+      retval= VTK_BIQUADRATIC_QUAD;
+    return retval;
+  }
+
+//! @brief Computes the points, connectivity and cell types of the mesh
+//! and compiles the field extractors.
+int XC::VtkRecorder::compile_mesh(void)
+  {
+    const Set *s= get_set();
+    if(!s)
+      return -1;
+    const DqPtrsNode &nodes= s->GetNodos();
+    const size_t numNodes= nodes.size();
+    std::map<int,int> pointIndex; //node tag -> point index.
+    nodeTags.resize(numNodes);
+    points.assign(3*numNodes,0.0);
+    size_t i= 0;
+    for(DqPtrsNode::const_iterator j= nodes.begin();j!=nodes.end();j++,i++)
+      {
+        const Node *n= *j;
+        nodeTags[i]= n->getTag();
+        pointIndex[n->getTag()]= i;
+        const Vector &crd= n->getCrds();
+        const size_t dim= std::min(size_t(crd.Size()),size_t(3));
+        for(size_t k= 0;k<dim;k++)
+          points[3*i+k]= crd(k);
+      }
+
+    const DqPtrsElem &elements= s->getElements();
+    connectivity.clear();
+    offsets.clear();
+    cellTypes.clear();
+    std::vector<int> rows;
+    size_t numSkipped= 0;
+    i= 0;
+    for(DqPtrsElem::const_iterator j= elements.begin();j!=elements.end();j++,i++)
+      {
+        const Element *e= *j;
+        const int type= get_vtk_cell_type(*e);
+        const ID &nTags= e->getNodePtrs().getExternalNodes();
+        const size_t sz= nTags.Size();
+        bool ok= (type!=VTK_EMPTY_CELL) && (sz>0);
+        for(size_t k= 0;ok && (k<sz);k++)
+          ok= (pointIndex.find(nTags(k))!=pointIndex.end());
+        if(!ok)
+          { numSkipped++; continue; }
+        for(size_t k= 0;k<sz;k++)
+          connectivity.push_back(pointIndex[nTags(k)]);
+        offsets.push_back(connectivity.size());
+        cellTypes.push_back(type);
+        rows.push_back(i);
+      }
+    if(numSkipped)
+      std::cerr << nombre_clase() << "::" << __FUNCTION__
+                << "; " << numSkipped << " elements of the set: '"
+                << setName << "' have an unknown cell type or nodes"
+                << " that are not in the set; they are ignored." << std::endl;
+    elementRows= ID(rows);
+
+    int retval= 0;
+    for(field_outputs::iterator j= fields.begin();j!=fields.end();j++)
+      if(j->extractor->compile(*s)<0)
+        retval= -1;
+    meshCompiled= true;
+    return retval;
+  }
+
+//! @brief Extracts the current values of the field and puts them in its
+//! buffer (row major, one row for each point or cell).
+void XC::VtkRecorder::fill_buffer(FieldOutput &f,const bool &nodal)
+  {
+    f.extractor->extract(f.values);
+    const size_t numCols= f.values.noCols();
+    const size_t numRows= (nodal ? size_t(f.values.noRows()) : size_t(elementRows.Size()));
+    f.buffer.resize(numRows*numCols);
+    for(size_t i= 0;i<numRows;i++)
+      {
+        const size_t row= (nodal ? i : size_t(elementRows(i)));
+        for(size_t j= 0;j<numCols;j++)
+          f.buffer[i*numCols+j]= f.values(row,j);
+      }
+  }
+
+//! @brief Returns the name of the VTU file for the step.
+std::string XC::VtkRecorder::get_step_file_name(const size_t &step) const
+  { return fileName+"_"+boost::lexical_cast<std::string>(step)+".vtu"; }
+
+//! @brief Writes the mesh and the field values in a VTU file
+//! (appended raw binary data).
+int XC::VtkRecorder::write_vtu_step(const size_t &step)
+  {
+    const std::string fName= get_step_file_name(step);
+    std::ofstream out(fName.c_str(),std::ios::binary);
+    if(!out)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; can't open file: '" << fName << "'." << std::endl;
+        return -1;
+      }
+    const char *intType= (sizeof(int)==4 ? "Int32" : "Int64");
+    const size_t blockHeader= sizeof(unsigned long long);
+    size_t offset= 0;
+    out << "<?xml version=\"1.0\"?>\n"
+        << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\""
+        << vtk_byte_order() << "\" header_type=\"UInt64\">\n"
+        << "  <UnstructuredGrid>\n"
+        << "    <Piece NumberOfPoints=\"" << getNumPoints()
+        << "\" NumberOfCells=\"" << getNumCells() << "\">\n";
+    out << "      <PointData>\n";
+    for(field_outputs::const_iterator i= fields.begin();i!=fields.end();i++)
+      if(i->extractor->isNodal())
+        {
+          out << "        <DataArray type=\"Float64\" Name=\"" << i->name
+              << "\" NumberOfComponents=\"" << i->values.noCols()
+              << "\" format=\"appended\" offset=\"" << offset << "\"/>\n";
+          offset+= blockHeader+i->buffer.size()*sizeof(double);
+        }
+    out << "      </PointData>\n"
+        << "      <CellData>\n";
+    for(field_outputs::const_iterator i= fields.begin();i!=fields.end();i++)
+      if(!i->extractor->isNodal())
+        {
+          out << "        <DataArray type=\"Float64\" Name=\"" << i->name
+              << "\" NumberOfComponents=\"" << i->values.noCols()
+              << "\" format=\"appended\" offset=\"" << offset << "\"/>\n";
+          offset+= blockHeader+i->buffer.size()*sizeof(double);
+        }
+    out << "      </CellData>\n"
+        << "      <Points>\n"
+        << "        <DataArray type=\"Float64\" NumberOfComponents=\"3\" format=\"appended\" offset=\""
+        << offset << "\"/>\n"
+        << "      </Points>\n";
+    offset+= blockHeader+points.size()*sizeof(double);
+    out << "      <Cells>\n"
+        << "        <DataArray type=\"" << intType << "\" Name=\"connectivity\" format=\"appended\" offset=\""
+        << offset << "\"/>\n";
+    offset+= blockHeader+connectivity.size()*sizeof(int);
+    out << "        <DataArray type=\"" << intType << "\" Name=\"offsets\" format=\"appended\" offset=\""
+        << offset << "\"/>\n";
+    offset+= blockHeader+offsets.size()*sizeof(int);
+    out << "        <DataArray type=\"UInt8\" Name=\"types\" format=\"appended\" offset=\""
+        << offset << "\"/>\n"
+        << "      </Cells>\n"
+        << "    </Piece>\n"
+        << "  </UnstructuredGrid>\n"
+        << "  <AppendedData encoding=\"raw\">\n_";
+    for(field_outputs::const_iterator i= fields.begin();i!=fields.end();i++)
+      if(i->extractor->isNodal())
+        write_vtk_block(out,i->buffer);
+    for(field_outputs::const_iterator i= fields.begin();i!=fields.end();i++)
+      if(!i->extractor->isNodal())
+        write_vtk_block(out,i->buffer);
+    write_vtk_block(out,points);
+    write_vtk_block(out,connectivity);
+    write_vtk_block(out,offsets);
+    write_vtk_block(out,cellTypes);
+    out << "\n  </AppendedData>\n"
+        << "</VTKFile>\n";
+    return (out.good() ? 0 : -1);
+  }
+
+//! @brief Writes the PVD file that collects the VTU files of all the steps.
+int XC::VtkRecorder::write_pvd(void) const
+  {
+    const std::string fName= fileName+".pvd";
+    std::ofstream out(fName.c_str());
+    if(!out)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; can't open file: '" << fName << "'." << std::endl;
+        return -1;
+      }
+    out << "<?xml version=\"1.0\"?>\n"
+        << "<VTKFile type=\"Collection\" version=\"0.1\" byte_order=\""
+        << vtk_byte_order() << "\">\n"
+        << "  <Collection>\n";
+    for(size_t i= 0;i<stepTimes.size();i++)
+      out << "    <DataSet timestep=\"" << stepTimes[i]
+          << "\" group=\"\" part=\"0\" file=\""
+          << base_name(get_step_file_name(i)) << "\"/>\n";
+    out << "  </Collection>\n"
+        << "</VTKFile>\n";
+    return (out.good() ? 0 : -1);
+  }
+
+//! @brief Writes a dataset (rows x cols or rows if cols is zero)
+//! in the HDF5 file.
+int XC::VtkRecorder::write_h5_dataset(const std::string &path,const hid_t &type,const void *data,const size_t &rows,const size_t &cols)
+  {
+    const int rank= (cols ? 2 : 1);
+    hsize_t dims[2]= {rows,cols};
+    hid_t space= H5Screate_simple(rank,dims,nullptr);
+    hid_t dataset= H5Dcreate2(h5file,path.c_str(),type,space,H5P_DEFAULT,H5P_DEFAULT,H5P_DEFAULT);
+    herr_t status= -1;
+    if(dataset>=0)
+      {
+        status= (rows ? H5Dwrite(dataset,type,H5S_ALL,H5S_ALL,H5P_DEFAULT,data) : 0);
+        H5Dclose(dataset);
+      }
+    H5Sclose(space);
+    if(status<0)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; can't write dataset: '" << path << "'." << std::endl;
+        return -1;
+      }
+    return 0;
+  }
+
+//! @brief Removes from the HDF5 file the groups of the steps
+//! from the one being passed as parameter.
+void XC::VtkRecorder::remove_h5_steps(const size_t &firstStep)
+  {
+    for(size_t s= firstStep;;s++)
+      {
+        const std::string groupName= "/step_"+boost::lexical_cast<std::string>(s);
+        if(H5Lexists(h5file,groupName.c_str(),H5P_DEFAULT)<=0)
+          break;
+        H5Ldelete(h5file,groupName.c_str(),H5P_DEFAULT);
+      }
+  }
+
+//! @brief Creates the HDF5 file and writes the mesh on it. If the
+//! first step to write is not the first one (analysis restarted
+//! from a checkpoint) the existing file is reused: the mesh and
+//! the steps from firstStep are written again.
+int XC::VtkRecorder::open_h5(const size_t &firstStep)
+  {
+    const std::string fName= fileName+".h5";
+    HDF5ErrorSilencer silencer; //Errors reported here.
+    if(firstStep>0)
+      {
+        h5file= H5Fopen(fName.c_str(),H5F_ACC_RDWR,H5P_DEFAULT);
+        if(h5file>=0)
+          {
+            remove_h5_steps(firstStep);
+            H5Ldelete(h5file,"/points",H5P_DEFAULT);
+            H5Ldelete(h5file,"/topology",H5P_DEFAULT);
+          }
+      }
+    if(h5file<0)
+      h5file= H5Fcreate(fName.c_str(),H5F_ACC_TRUNC,H5P_DEFAULT,H5P_DEFAULT);
+    if(h5file<0)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; can't open file: '" << fName << "'." << std::endl;
+        return -1;
+      }
+    // Mixed topology: XDMF type, number of nodes (only for
+    // polyvertices and polylines) and node indices of each cell.
+    std::vector<int> topology;
+    topology.reserve(connectivity.size()+2*cellTypes.size());
+    size_t first= 0;
+    for(size_t i= 0;i<cellTypes.size();i++)
+      {
+        const int type= xdmf_cell_type(cellTypes[i]);
+        const size_t last= offsets[i];
+        topology.push_back(type);
+        if((type==1) || (type==2))
+          topology.push_back(last-first);
+        topology.insert(topology.end(),connectivity.begin()+first,connectivity.begin()+last);
+        first= last;
+      }
+    topologySize= topology.size();
+    int retval= write_h5_dataset("/points",H5T_NATIVE_DOUBLE,(points.empty() ? nullptr : &points[0]),getNumPoints(),3);
+    retval+= write_h5_dataset("/topology",H5T_NATIVE_INT,(topology.empty() ? nullptr : &topology[0]),topologySize,0);
+    return retval;
+  }
+
+//! @brief Writes the field values of the step in the HDF5 file.
+int XC::VtkRecorder::write_h5_step(const size_t &step)
+  {
+    if((h5file<0) && (open_h5(step)<0))
+      return -1;
+    HDF5ErrorSilencer silencer; //Errors reported here.
+    const std::string groupName= "/step_"+boost::lexical_cast<std::string>(step);
+    hid_t group= H5Gcreate2(h5file,groupName.c_str(),H5P_DEFAULT,H5P_DEFAULT,H5P_DEFAULT);
+    if(group<0)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; can't create group: '" << groupName << "'." << std::endl;
+        return -1;
+      }
+    H5Gclose(group);
+    int retval= 0;
+    for(field_outputs::const_iterator i= fields.begin();i!=fields.end();i++)
+      {
+        const size_t numCols= i->values.noCols();
+        const size_t numRows= (numCols ? i->buffer.size()/numCols : 0);
+        retval+= write_h5_dataset(groupName+"/"+i->name,H5T_NATIVE_DOUBLE,(i->buffer.empty() ? nullptr : &i->buffer[0]),numRows,numCols);
+      }
+    H5Fflush(h5file,H5F_SCOPE_GLOBAL);
+    return retval;
+  }
+
+//! @brief Writes the XDMF file that describes the steps written
+//! in the HDF5 file.
+int XC::VtkRecorder::write_xdmf(void) const
+  {
+    const std::string fName= fileName+".xmf";
+    const std::string h5Name= base_name(fileName+".h5");
+    std::ofstream out(fName.c_str());
+    if(!out)
+      {
+        std::cerr << nombre_clase() << "::" << __FUNCTION__
+                  << "; can't open file: '" << fName << "'." << std::endl;
+        return -1;
+      }
+    out << "<?xml version=\"1.0\" ?>\n"
+        << "<Xdmf Version=\"3.0\">\n"
+        << "  <Domain>\n"
+        << "    <Grid Name=\"" << base_name(fileName)
+        << "\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+    for(size_t s= 0;s<stepTimes.size();s++)
+      {
+        const std::string stepName= "step_"+boost::lexical_cast<std::string>(s);
+        out << "      <Grid Name=\"" << stepName << "\" GridType=\"Uniform\">\n"
+            << "        <Time Value=\"" << stepTimes[s] << "\"/>\n"
+            << "        <Topology TopologyType=\"Mixed\" NumberOfElements=\"" << getNumCells() << "\">\n"
+            << "          <DataItem Dimensions=\"" << topologySize
+            << "\" NumberType=\"Int\" Precision=\"" << sizeof(int)
+            << "\" Format=\"HDF\">" << h5Name << ":/topology</DataItem>\n"
+            << "        </Topology>\n"
+            << "        <Geometry GeometryType=\"XYZ\">\n"
+            << "          <DataItem Dimensions=\"" << getNumPoints()
+            << " 3\" NumberType=\"Float\" Precision=\"8\" Format=\"HDF\">"
+            << h5Name << ":/points</DataItem>\n"
+            << "        </Geometry>\n";
+        for(field_outputs::const_iterator i= fields.begin();i!=fields.end();i++)
+          {
+            const bool nodal= i->extractor->isNodal();
+            const size_t numCols= i->values.noCols();
+            const size_t numRows= (nodal ? getNumPoints() : getNumCells());
+            out << "        <Attribute Name=\"" << i->name
+                << "\" AttributeType=\"" << xdmf_attribute_type(numCols)
+                << "\" Center=\"" << (nodal ? "Node" : "Cell") << "\">\n"
+                << "          <DataItem Dimensions=\"" << numRows << " " << numCols
+                << "\" NumberType=\"Float\" Precision=\"8\" Format=\"HDF\">"
+                << h5Name << ":/" << stepName << "/" << i->name << "</DataItem>\n"
+                << "        </Attribute>\n";
+          }
+        out << "      </Grid>\n";
+      }
+    out << "    </Grid>\n"
+        << "  </Domain>\n"
+        << "</Xdmf>\n";
+    return (out.good() ? 0 : -1);
+  }
+
+//! @brief Writes the mesh and the fields values if the time interval
+//! from the last record is greater or equal than deltaT.
+int XC::VtkRecorder::record(int commitTag, double timeStamp)
+  {
+    if((deltaT!=0.0) && (timeStamp<nextTimeStampToRecord))
+      return 0;
+    if(deltaT!=0.0)
+      nextTimeStampToRecord= timeStamp+deltaT;
+    if(!meshCompiled)
+      {
+        const int ok= compile_mesh();
+        if(!meshCompiled)
+          return -1;
+        if(ok<0)
+          std::cerr << nombre_clase() << "::" << __FUNCTION__
+                    << "; some fields can't be obtained." << std::endl;
+      }
+    const size_t step= stepTimes.size();
+    stepTimes.push_back(timeStamp);
+    for(field_outputs::iterator i= fields.begin();i!=fields.end();i++)
+      fill_buffer(*i,i->extractor->isNodal());
+    int retval= 0;
+    if(format=="xdmf")
+      {
+        retval= write_h5_step(step);
+        if(retval==0)
+          retval= write_xdmf();
+      }
+    else
+      {
+        retval= write_vtu_step(step);
+        if(retval==0)
+          retval= write_pvd();
+      }
+    return retval;
+  }
+
+//! @brief Starts a new series of output files (the mesh is compiled
+//! again on the next record).
+int XC::VtkRecorder::restart(void)
+  {
+    close();
+    stepTimes.clear();
+    nextTimeStampToRecord= 0.0;
+    meshCompiled= false;
+    return 0;
+  }
+
+//! @brief Writes the buffered data (xdmf format).
+int XC::VtkRecorder::flush(void)
+  {
+    if(h5file>=0)
+      H5Fflush(h5file,H5F_SCOPE_GLOBAL);
+    return 0;
+  }
+
+//! @brief Returns the time of the next record followed by the
+//! times of the written steps.
+XC::Vector XC::VtkRecorder::getOutputState(void)
+  {
+    flush();
+    Vector retval(stepTimes.size()+1);
+    retval(0)= nextTimeStampToRecord;
+    for(size_t i= 0;i<stepTimes.size();i++)
+      retval(i+1)= stepTimes[i];
+    return retval;
+  }
+
+//! @brief Restores the written steps from the vector being passed as
+//! parameter (see getOutputState); the steps written after them are
+//! discarded and the collection file is written again.
+int XC::VtkRecorder::setOutputState(const Vector &v)
+  {
+    if(v.Size()<1)
+      return 0;
+    nextTimeStampToRecord= v(0);
+    stepTimes.resize(v.Size()-1);
+    for(size_t i= 0;i<stepTimes.size();i++)
+      stepTimes[i]= v(i+1);
+    int retval= 0;
+    if(format=="xdmf")
+      {
+        if(h5file>=0)
+          {
+            HDF5ErrorSilencer silencer;
+            remove_h5_steps(stepTimes.size());
+            H5Fflush(h5file,H5F_SCOPE_GLOBAL);
+          }
+        if(meshCompiled)
+          retval= write_xdmf();
+      }
+    else if(meshCompiled)
+      retval= write_pvd();
+    return retval;
+  }
+
+//! @brief Closes the HDF5 file (xdmf format).
+void XC::VtkRecorder::close(void)
+  {
+    if(h5file>=0)
+      {
+        H5Fclose(h5file);
+        h5file= -1;
+      }
+  }
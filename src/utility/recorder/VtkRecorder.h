@@ -0,0 +1,148 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//VtkRecorder.h
+
+#ifndef VtkRecorder_h
+#define VtkRecorder_h
+
+#include <utility/recorder/DomainRecorderBase.h>
+#include "utility/matrix/ID.h"
+#include "utility/matrix/Matrix.h"
+#include <hdf5.h>
+#include <vector>
+#include <string>
+#include <boost/python/list.hpp>
+
+namespace XC {
+class Set;
+class Element;
+class FieldExtractor;
+
+//! @ingroup Recorder
+//
+//! @brief Writes the mesh of a set and the values of some nodal
+//! and element fields at each commit, so the results can be
+//! visualized (i.e. with ParaView) while the analysis runs.
+//!
+//! The mesh topology (points, connectivity and cell types) is
+//! compiled only once, on the first call to record. Two output
+//! formats are available:
+//! - "vtu": one VTU file (appended raw binary data) for each step
+//!   and a PVD collection file that references them.
+//! - "xdmf": one HDF5 file with the mesh (written once) and the
+//!   field values of each step, and an XDMF file that describes
+//!   the temporal collection.
+//! The collection file is rewritten after each step so it's always
+//! valid, even if the analysis doesn't end.
+class VtkRecorder: public DomainRecorderBase
+  {
+  public:
+    //! @brief Field to write.
+    struct FieldOutput
+      {
+        std::string name; //!< Name of the field.
+        FieldExtractor *extractor; //!< Compiled extractor.
+        Matrix values; //!< Values of the last step (one row for each node or element).
+        std::vector<double> buffer; //!< Values of the last step (row major).
+        FieldOutput(const std::string &,FieldExtractor *);
+      };
+    typedef std::vector<FieldOutput> field_outputs;
+  private:
+    std::string fileName; //!< Base name of the output files (without extension).
+    std::string format; //!< Output format ("vtu" or "xdmf").
+    std::string setName; //!< Name of the set to write.
+    double deltaT; //!< Time interval between records (0: all the commits).
+    double nextTimeStampToRecord;
+    field_outputs fields; //!< Fields to write.
+
+    bool meshCompiled;
+    ID nodeTags; //!< Tags of the nodes (one for each point).
+    ID elementRows; //!< Row of each written element in the element fields.
+    std::vector<double> points; //!< Point coordinates (3 per node).
+    std::vector<int> connectivity; //!< Node indices of each cell.
+    std::vector<int> offsets; //!< End of each cell in connectivity.
+    std::vector<unsigned char> cellTypes; //!< VTK cell types.
+    size_t topologySize; //!< Size of the XDMF mixed topology array.
+    std::vector<double> stepTimes; //!< Time of each written step.
+
+    hid_t h5file; //!< HDF5 file (xdmf format).
+
+    const Set *get_set(void) const;
+    static int get_vtk_cell_type(const Element &);
+    int compile_mesh(void);
+    void fill_buffer(FieldOutput &,const bool &);
+    std::string get_step_file_name(const size_t &) const;
+    int write_vtu_step(const size_t &);
+    int write_pvd(void) const;
+    int open_h5(const size_t &);
+    void remove_h5_steps(const size_t &);
+    int write_h5_dataset(const std::string &,const hid_t &,const void *,const size_t &,const size_t &);
+    int write_h5_step(const size_t &);
+    int write_xdmf(void) const;
+    void free_fields(void);
+
+    VtkRecorder(const VtkRecorder &);
+    VtkRecorder &operator=(const VtkRecorder &);
+  public:
+    VtkRecorder(Domain *ptr_dom= nullptr);
+    ~VtkRecorder(void);
+
+    inline const std::string &getFileName(void) const
+      { return fileName; }
+    inline void setFileName(const std::string &s)
+      { fileName= s; }
+    inline const std::string &getFormat(void) const
+      { return format; }
+    void setFormat(const std::string &);
+    inline const std::string &getSetName(void) const
+      { return setName; }
+    inline void setSetName(const std::string &s)
+      { setName= s; meshCompiled= false; }
+    inline double getDeltaT(void) const
+      { return deltaT; }
+    inline void setDeltaT(const double &dt)
+      { deltaT= dt; }
+    inline size_t getNumSteps(void) const
+      { return stepTimes.size(); }
+    inline size_t getNumPoints(void) const
+      { return nodeTags.Size(); }
+    inline size_t getNumCells(void) const
+      { return cellTypes.size(); }
+
+    void addField(const std::string &,const std::vector<std::string> &,const ID &cmps= ID(),const size_t &nPoints= 0);
+    void addFieldPy(const std::string &,const boost::python::list &,const boost::python::list &,const size_t &);
+
+    int record(int commitTag, double timeStamp);
+    int restart(void);
+    int flush(void);
+    Vector getOutputState(void);
+    int setOutputState(const Vector &);
+    void close(void);
+  };
+} // end of XC namespace
+
+#endif
@@ -24,7 +24,9 @@
 
 class_<XC::EnvelopeData, boost::noncopyable >("EnvelopeData", no_init);
 
-class_<XC::Recorder, bases<EntCmd>, boost::noncopyable >("Recorder", no_init);
+class_<XC::Recorder, bases<EntCmd>, boost::noncopyable >("Recorder", no_init)
+  .def("flush",&XC::Recorder::flush,"Writes buffered output (if any).")
+  ;
 
 //class_<XC::AlgorithmIncrements , bases<XC::Recorder>, boost::noncopyable >("AlgorithmIncrements", no_init);
 
@@ -73,7 +75,9 @@ class_<XC::ElementRecorderBase, bases<XC::MeshCompRecorder>, boost::noncopyable
 
 class_<XC::NodeRecorderBase, bases<XC::MeshCompRecorder>, boost::noncopyable >("NodeRecorderBase", no_init);
 
-class_<XC::NodeRecorder, bases<XC::NodeRecorderBase>, boost::noncopyable >("NodeRecorder", no_init);
+class_<XC::NodeRecorder, bases<XC::NodeRecorderBase>, boost::noncopyable >("NodeRecorder", no_init)
+  .def("setup",&XC::NodeRecorder::setup,"setup(dofs,nodes,dataToStore): sets the DOFs and the nodes to record and the response to store ('disp', 'vel', 'accel', 'reaction',...).")
+  ;
 
 class_<XC::EnvelopeNodeRecorder, bases<XC::NodeRecorderBase>, boost::noncopyable >("EnvelopeNodeRecorder", no_init);
 
@@ -81,9 +85,22 @@ class_<XC::ElementRecorder, bases<XC::ElementRecorderBase>, boost::noncopyable >
 
 class_<XC::EnvelopeElementRecorder, bases<XC::ElementRecorderBase>, boost::noncopyable >("EnvelopeElementRecorder", no_init);
 
+class_<XC::VtkRecorder, bases<XC::DomainRecorderBase>, boost::noncopyable >("VtkRecorder", no_init)
+  .add_property("fileName",make_function(&XC::VtkRecorder::getFileName,return_value_policy<copy_const_reference>()),&XC::VtkRecorder::setFileName,"Base name of the output files (without extension).")
+  .add_property("format",make_function(&XC::VtkRecorder::getFormat,return_value_policy<copy_const_reference>()),&XC::VtkRecorder::setFormat,"Output format: 'vtu' (VTU files and PVD collection) or 'xdmf' (HDF5 and XDMF files).")
+  .add_property("setName",make_function(&XC::VtkRecorder::getSetName,return_value_policy<copy_const_reference>()),&XC::VtkRecorder::setSetName,"Name of the set to write.")
+  .add_property("deltaT",&XC::VtkRecorder::getDeltaT,&XC::VtkRecorder::setDeltaT,"Time interval between records (0: record all the commits).")
+  .add_property("numSteps",&XC::VtkRecorder::getNumSteps,"Number of written steps.")
+  .add_property("numPoints",&XC::VtkRecorder::getNumPoints,"Number of points of the mesh.")
+  .add_property("numCells",&XC::VtkRecorder::getNumCells,"Number of cells of the mesh.")
+  .def("addField",&XC::VtkRecorder::addFieldPy,"addField(name,quantity,components,numPoints): adds a nodal or element field (see FieldExtractor).")
+  .def("close",&XC::VtkRecorder::close,"Closes the output files.")
+  ;
+
 class_<XC::ObjWithRecorders, bases<EntCmd>, boost::noncopyable >("ObjWithRecorders", no_init)
   .def("newRecorder",make_function(&XC::ObjWithRecorders::newRecorder,return_internal_reference<>()),"Creates a new recorder.")  
   .def("removeRecorders",&XC::ObjWithRecorders::removeRecorders,"Deletes all the recorders.")  
+  .def("flushRecorders",&XC::ObjWithRecorders::flush,"Writes the output buffered by the recorders.")
   ;
 
 
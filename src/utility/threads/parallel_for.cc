@@ -0,0 +1,48 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//parallel_for.cc
+
+#include "parallel_for.h"
+
+namespace XC {
+//! @brief Number of threads to use in parallel loops (0: hardware concurrency).
+static size_t numThreads= 0;
+}
+
+//! @brief Return the number of threads to use in parallel loops.
+size_t XC::getNumThreads(void)
+  {
+    size_t retval= numThreads;
+    if(retval==0)
+      retval= std::max(boost::thread::hardware_concurrency(),1u);
+    return retval;
+  }
+
+//! @brief Set the number of threads to use in parallel loops
+//! (0 means as many as hardware threads, 1 disables threading).
+void XC::setNumThreads(const size_t &n)
+  { numThreads= n; }
@@ -0,0 +1,99 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//parallel_for.h
+
+#ifndef PARALLEL_FOR_H
+#define PARALLEL_FOR_H
+
+#include <cstddef>
+#include <algorithm>
+#include <boost/thread/thread.hpp>
+
+namespace XC {
+
+size_t getNumThreads(void);
+void setNumThreads(const size_t &);
+
+//! @ingroup Utils
+//!
+//! @brief Calls f(i) for each i in the range [begin,end).
+template <class F>
+class RangeRunner
+  {
+    F &f; //!< Function object.
+    size_t begin; //!< First index.
+    size_t end; //!< One past the last index.
+  public:
+    RangeRunner(F &func,const size_t &b,const size_t &e)
+      : f(func), begin(b), end(e) {}
+    void operator()(void)
+      {
+        for(size_t i= begin;i<end;i++)
+          f(i);
+      }
+  };
+
+//! @ingroup Utils
+//!
+//! @brief Calls f(i) for each i in [0,n) distributing the indexes
+//! in contiguous ranges among the available threads.
+//!
+//! The range assigned to each thread depends only on n and on
+//! the number of threads, so if f(i) only writes on the i-th
+//! position of its output the results are the same whatever
+//! the number of threads is.
+//!
+//! @param n: number of iterations.
+//! @param f: function object to call (must be thread safe).
+//! @param minChunk: minimum number of iterations per thread.
+template <class F>
+void parallel_for(const size_t &n,F &f,const size_t &minChunk= 1)
+  {
+    const size_t chunk= std::max(minChunk,size_t(1));
+    const size_t nThreads= std::min(getNumThreads(),n/chunk);
+    if(nThreads<2)
+      RangeRunner<F>(f,0,n)();
+    else
+      {
+        boost::thread_group threads;
+        const size_t sz= n/nThreads;
+        const size_t rem= n%nThreads;
+        size_t begin= 0;
+        for(size_t t= 0;t<nThreads-1;t++)
+          {
+            const size_t end= begin+sz+(t<rem ? 1 : 0);
+            threads.create_thread(RangeRunner<F>(f,begin,end));
+            begin= end;
+          }
+        RangeRunner<F>(f,begin,n)(); //Last range on this thread.
+        threads.join_all();
+      }
+  }
+
+} // end of XC namespace
+
+#endif
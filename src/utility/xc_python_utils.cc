@@ -32,6 +32,10 @@
 #include "utility/matrix/Vector.h"
 #include "utility/matrix/Matrix.h"
 #include "xc_utils/src/nucleo/python_utils.h"
+#include "xc_utils/src/geom/pos_vec/Pos3d.h"
+#include <boost/python/tuple.hpp>
+#include <boost/python/errors.hpp>
+#include <string>
 
 
 boost::python::list XC::xc_id_to_py_list(const XC::ID &id)
@@ -43,6 +47,33 @@ boost::python::list XC::xc_id_to_py_list(const XC::ID &id)
     return retval;
   }
 
+//! @brief Returns the positions of the Python list.
+std::vector<Pos3d> XC::vector_pos3d_from_py_list(const boost::python::list &l)
+  {
+    const size_t sz= len(l);
+    std::vector<Pos3d> retval(sz);
+    for(size_t i= 0;i<sz;i++)
+      retval[i]= boost::python::extract<Pos3d>(l[i]);
+    return retval;
+  }
+
+std::vector<std::string> XC::vector_string_from_py_list(const boost::python::list &l)
+  {
+    const size_t sz= len(l);
+    std::vector<std::string> retval(sz);
+    for(size_t i= 0;i<sz;i++)
+      retval[i]= boost::python::extract<std::string>(l[i]);
+    return retval;
+  }
+
+boost::python::list XC::vector_string_to_py_list(const std::vector<std::string> &v)
+  {
+    boost::python::list retval;
+    for(std::vector<std::string>::const_iterator i= v.begin();i!=v.end();i++)
+      retval.append(*i);
+    return retval;
+  }
+
 std::vector<double> XC::vector_double_from_py_object(const boost::python::object &o)
   {
     std::vector<double> retval;
@@ -117,3 +148,149 @@ m_double XC::m_double_from_py_object(const boost::python::object &o)
       }
     return retval;
   }
+
+//! @brief Returns the character that represents the byte order
+//! in the NumPy type strings.
+static char byte_order(void)
+  {
+    const int one= 1;
+    return ((*reinterpret_cast<const char *>(&one)==1) ? '<' : '>');
+  }
+
+//! @brief Returns the NumPy array interface (version 3) for the
+//! memory block being passed as parameter. The strides are expressed in
+//! bytes. The array created by NumPy keeps a reference to the Python
+//! object, so the memory remains valid while the array exists
+//! (unless the object is resized).
+static boost::python::dict array_interface(void *data,const char &kind,const size_t &itemSize,const boost::python::tuple &shape,const boost::python::tuple &strides)
+  {
+    static double empty[1]; // NumPy doesn't like null pointers.
+    std::string typestr(1,byte_order());
+    typestr+= kind;
+    typestr+= char('0'+itemSize);
+    boost::python::dict retval;
+    retval["version"]= 3;
+    retval["typestr"]= typestr;
+    retval["shape"]= shape;
+    retval["strides"]= strides;
+    const size_t address= reinterpret_cast<size_t>(data ? data : empty);
+    retval["data"]= boost::python::make_tuple(address,false);
+    return retval;
+  }
+
+//! @brief NumPy array interface for the vector (allows
+//! numpy.asarray(v) to create a view of the vector without copying it).
+boost::python::dict XC::vector_array_interface(Vector &v)
+  {
+    const size_t sz= v.Size();
+    return array_interface(sz ? v.getDataPtr() : nullptr,'f',sizeof(double),boost::python::make_tuple(sz),boost::python::make_tuple(sizeof(double)));
+  }
+
+//! @brief NumPy array interface for the matrix (the
+//! matrix is stored by columns).
+boost::python::dict XC::matrix_array_interface(Matrix &m)
+  {
+    const size_t nRows= m.noRows();
+    const size_t nCols= m.noCols();
+    return array_interface((nRows>0 && nCols>0) ? m.getDataPtr() : nullptr,'f',sizeof(double),boost::python::make_tuple(nRows,nCols),boost::python::make_tuple(sizeof(double),nRows*sizeof(double)));
+  }
+
+//! @brief NumPy array interface for the integer vector.
+boost::python::dict XC::id_array_interface(ID &id)
+  {
+    const size_t sz= id.Size();
+    return array_interface(sz ? id.getDataPtr() : nullptr,'i',sizeof(int),boost::python::make_tuple(sz),boost::python::make_tuple(sizeof(int)));
+  }
+
+//! @brief Raises a Python ValueError exception.
+static void raise_value_error(const std::string &msg)
+  {
+    PyErr_SetString(PyExc_ValueError,msg.c_str());
+    boost::python::throw_error_already_set();
+  }
+
+//! @brief Reads the values of a contiguous buffer (NumPy array,
+//! array.array,...) of numbers. Returns the shape of the buffer.
+template <class T>
+static std::vector<Py_ssize_t> values_from_py_buffer(const boost::python::object &o,std::vector<T> &values)
+  {
+    Py_buffer view;
+    if(PyObject_GetBuffer(o.ptr(),&view,PyBUF_C_CONTIGUOUS|PyBUF_FORMAT)<0)
+      boost::python::throw_error_already_set();
+    std::vector<Py_ssize_t> shape(view.shape,view.shape+view.ndim);
+    if(view.ndim==0)
+      shape.push_back(1);
+    const size_t n= view.len/view.itemsize;
+    std::string format(view.format ? view.format : "B");
+    if(!format.empty() && std::string("@=<>!").find(format[0])!=std::string::npos)
+      format.erase(0,1);
+    const char code= (format.size()==1 ? format[0] : '?');
+    values.resize(n);
+    bool ok= true;
+    for(size_t i= 0;i<n && ok;i++)
+      {
+        const char *ptr= static_cast<const char *>(view.buf)+i*view.itemsize;
+        switch(code)
+          {
+          case 'd': values[i]= T(*reinterpret_cast<const double *>(ptr)); break;
+          case 'f': values[i]= T(*reinterpret_cast<const float *>(ptr)); break;
+          case 'b': values[i]= T(*reinterpret_cast<const signed char *>(ptr)); break;
+          case 'B': values[i]= T(*reinterpret_cast<const unsigned char *>(ptr)); break;
+          case 'h': values[i]= T(*reinterpret_cast<const short *>(ptr)); break;
+          case 'H': values[i]= T(*reinterpret_cast<const unsigned short *>(ptr)); break;
+          case 'i': values[i]= T(*reinterpret_cast<const int *>(ptr)); break;
+          case 'I': values[i]= T(*reinterpret_cast<const unsigned int *>(ptr)); break;
+          case 'l': values[i]= T(*reinterpret_cast<const long *>(ptr)); break;
+          case 'L': values[i]= T(*reinterpret_cast<const unsigned long *>(ptr)); break;
+          case 'q': values[i]= T(*reinterpret_cast<const long long *>(ptr)); break;
+          case 'Q': values[i]= T(*reinterpret_cast<const unsigned long long *>(ptr)); break;
+          default: ok= false;
+          }
+      }
+    PyBuffer_Release(&view);
+    if(!ok)
+      raise_value_error("unsupported buffer format: '"+format+"'.");
+    return shape;
+  }
+
+//! @brief Creates a vector from a contiguous buffer (NumPy array,...).
+XC::Vector *XC::vector_from_py_buffer(const boost::python::object &o)
+  {
+    std::vector<double> values;
+    const std::vector<Py_ssize_t> shape= values_from_py_buffer(o,values);
+    if(shape.size()!=1)
+      raise_value_error("one-dimensional array expected.");
+    const int sz= values.size();
+    Vector *retval= new Vector(sz);
+    for(int i= 0;i<sz;i++)
+      (*retval)(i)= values[i];
+    return retval;
+  }
+
+//! @brief Creates a matrix from a contiguous (C order) two-dimensional
+//! buffer (NumPy array,...).
+XC::Matrix *XC::matrix_from_py_buffer(const boost::python::object &o)
+  {
+    std::vector<double> values;
+    const std::vector<Py_ssize_t> shape= values_from_py_buffer(o,values);
+    if(shape.size()!=2)
+      raise_value_error("two-dimensional array expected.");
+    const int nRows= shape[0];
+    const int nCols= shape[1];
+    Matrix *retval= new Matrix(nRows,nCols);
+    for(int i= 0;i<nRows;i++)
+      for(int j= 0;j<nCols;j++)
+        (*retval)(i,j)= values[i*nCols+j];
+    return retval;
+  }
+
+//! @brief Creates an integer vector from a contiguous buffer
+//! (NumPy array,...).
+XC::ID *XC::id_from_py_buffer(const boost::python::object &o)
+  {
+    std::vector<int> values;
+    const std::vector<Py_ssize_t> shape= values_from_py_buffer(o,values);
+    if(shape.size()!=1)
+      raise_value_error("one-dimensional array expected.");
+    return new ID(values);
+  }
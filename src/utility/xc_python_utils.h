@@ -25,17 +25,56 @@
 #define XC_PYTHON_UTILS_H
 
 #include <boost/python/list.hpp>
+#include <boost/python/dict.hpp>
+#include <boost/ref.hpp>
 #include <vector>
+#include <string>
 #include "xc_basic/src/matrices/m_double.h"
 
+class Pos3d;
+
 namespace XC {
   class ID;
+  class Vector;
+  class Matrix;
 
 boost::python::list xc_id_to_py_list(const XC::ID &);
 
 std::vector<double> vector_double_from_py_object(const boost::python::object &);
 std::vector<int> vector_int_from_py_object(const boost::python::object &);
 m_double m_double_from_py_object(const boost::python::object &);
+std::vector<Pos3d> vector_pos3d_from_py_list(const boost::python::list &);
+std::vector<std::string> vector_string_from_py_list(const boost::python::list &);
+boost::python::list vector_string_to_py_list(const std::vector<std::string> &);
+
+//! @brief Returns a Python object that refers to the object
+//! being passed as parameter (None if the pointer is null).
+template <class T>
+boost::python::object ptr_to_py_object(const T *ptr)
+  {
+    if(ptr)
+      return boost::python::object(boost::ref(*const_cast<T *>(ptr)));
+    else
+      return boost::python::object();
+  }
+
+//! @brief Returns a Python list with the objects pointed by the
+//! iterator range (None for null pointers).
+template <class InputIterator>
+boost::python::list ptrs_to_py_list(InputIterator first,InputIterator last)
+  {
+    boost::python::list retval;
+    for(InputIterator i= first;i!=last;i++)
+      retval.append(ptr_to_py_object(*i));
+    return retval;
+  }
+
+boost::python::dict vector_array_interface(Vector &);
+boost::python::dict matrix_array_interface(Matrix &);
+boost::python::dict id_array_interface(ID &);
+Vector *vector_from_py_buffer(const boost::python::object &);
+Matrix *matrix_from_py_buffer(const boost::python::object &);
+ID *id_from_py_buffer(const boost::python::object &);
 
 } // end of XC namespace
 #endif
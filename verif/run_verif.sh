@@ -156,6 +156,8 @@ python tests/elements/kill_elements_02.py
 
 echo "$BLEU" "Solver tests." "$NORMAL"
 python tests/solution/superlu_solver_test_01.py
+python tests/solution/adaptive_newton_01.py
+python tests/solution/convergence_telemetry_01.py
 
 #Test de los manejadores de coacciones.
 echo "$BLEU" "  Constraint handler tests." "$NORMAL"
@@ -185,7 +187,17 @@ python tests/solution/eigenvalues/test_analisis_modal_03.py
 python tests/solution/eigenvalues/test_analisis_modal_04.py
 python tests/solution/eigenvalues/test_analisis_modal_05.py
 python tests/solution/eigenvalues/test_cqc_01.py
+python tests/solution/eigenvalues/test_cqc_02.py
 python tests/solution/eigenvalues/test_band_arpackpp_solver_01.py
+python tests/solution/eigenvalues/test_sym_arpack_solver_01.py
+
+#Dynamic analysis.
+echo "$BLEU" "  Dynamic analysis tests." "$NORMAL"
+python tests/solution/dynamics/explicit_dynamics_01.py
+python tests/solution/dynamics/modal_time_history_01.py
+python tests/solution/dynamics/adaptive_time_step_01.py
+python tests/solution/dynamics/checkpoint_restart_01.py
+python tests/solution/dynamics/multi_record_runner_01.py
 
 #Preprocessor tests
 echo "$BLEU" "Preprocessor tests." "$NORMAL"
@@ -225,6 +237,8 @@ python tests/preprocessor/cad/test_esquema2d.py
 python tests/preprocessor/cad/test_esquema3d.py
 python tests/preprocessor/cad/test_nearest_node_01.py
 python tests/preprocessor/cad/test_nearest_element_01.py
+python tests/preprocessor/cad/test_nearest_node_02.py
+python tests/preprocessor/cad/test_nearest_element_02.py
 python tests/preprocessor/cad/split_linea_01.py
 python tests/preprocessor/cad/split_linea_02.py
 python tests/preprocessor/cad/split_linea_03.py
@@ -234,6 +248,7 @@ python tests/preprocessor/test_surface_meshing_02.py
 python tests/preprocessor/test_surface_meshing_03.py
 python tests/preprocessor/test_surface_meshing_04.py
 python tests/preprocessor/test_surface_meshing_05.py
+python tests/preprocessor/test_surface_meshing_06.py
 echo "$BLEU" "  Sets handling tests." "$NORMAL"
 python tests/preprocessor/sets/mueve_set.py
 python tests/preprocessor/sets/test_set_01.py
@@ -299,6 +314,7 @@ python tests/loads/test_ground_motion_05.py
 python tests/loads/test_ground_motion_06.py
 python tests/loads/test_ground_motion_07.py
 python tests/loads/test_ground_motion_08.py
+python tests/loads/test_ground_motion_09.py
 
 #Tests de los materiales
 #Materiales uniaxiales.
@@ -497,11 +513,24 @@ python tests/database/test_database_12.py
 python tests/database/test_database_13.py
 python tests/database/test_database_14.py
 python tests/database/test_database_15.py
+python tests/database/test_database_16.py
+python tests/database/test_database_17.py
+python tests/database/test_database_18.py
 python tests/database/prueba_sqlite_01.py
 python tests/database/prueba_sqlite_02.py
 python tests/database/prueba_sqlite_03.py
 python tests/database/prueba_readln_05.py
 
+echo "$BLEU" "Verifiyng Python interface of vectors and matrices." "$NORMAL"
+python tests/utility/test_numpy_views_01.py
+
+echo "$BLEU" "Verifiyng reliability analysis utilities." "$NORMAL"
+python tests/utility/test_philox_lhs_01.py
+python tests/utility/test_gfun_value_cache_01.py
+
+echo "$BLEU" "Verifiyng communication channels." "$NORMAL"
+python tests/utility/test_shared_memory_channel_01.py
+
 echo "$BLEU" "Verifiyng import/export routines (Salome, Code_Aster,...)." "$NORMAL"
 echo "$ROSE" "  MED tests are in quarantine (some debugging pending)." "$NORMAL"
 #python tests/utility/med_xc/test_exporta_med01.py
@@ -526,6 +555,12 @@ python tests/rough_calculations/masonryBridgeVerif_test01_minim.py
 #Postprocess tests
 echo "$BLEU" "Verifiying routines for post processing,...)." "$NORMAL"
 python tests/postprocess/test_export_shell_internal_forces.py
+python tests/postprocess/test_hdf5_results_store.py
+python tests/postprocess/test_async_data_output.py
+python tests/postprocess/test_hdf5_node_recorder.py
+python tests/postprocess/test_field_extractor_01.py
+python tests/postprocess/test_field_accessors_01.py
+python tests/postprocess/test_vtk_recorder_01.py
 
 #VTK tests
 ##python tests/vtk/dibuja_edges.py
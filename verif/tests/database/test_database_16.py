@@ -0,0 +1,114 @@
+# -*- coding: utf-8 -*-
+# home made test
+''' Save/restore round trip of a shell mesh with the SQLite,
+   File and BerkeleyDB datastores. The times spent by each
+   datastore are computed so they can be compared (uncomment
+   the print statements below to see them).'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+from model import fix_node_6dof
+import os
+import time
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 2.1e9 # Young modulus of the steel.
+nu= 0.3 # Poisson's ratio.
+h= .1 # Thickness.
+dens= 1.33 # Density kg/m2.
+F= 1000 # Load
+N= 10 # Number of divisions of each side.
+L= 1.0/N # Element side.
+numSteps= 5 # Number of states saved in each datastore.
+
+prueba= xc.ProblemaEF()
+preprocessor=  prueba.getPreprocessor   
+nodes= preprocessor.getNodeLoader
+
+# Problem type
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+nodes.defaultTag= 1 #First node number.
+for j in range(0,N+1):
+  for i in range(0,N+1):
+    nod= nodes.newNodeXYZ(i*L,j*L,0)
+
+# Materials definition
+memb1= typical_materials.defElasticMembranePlateSection(preprocessor, "memb1",E,nu,dens,h)
+
+# Elements definition
+elementos= preprocessor.getElementLoader
+elementos.defaultMaterial= "memb1"
+for j in range(0,N):
+  for i in range(0,N):
+    n1= j*(N+1)+i+1
+    elem= elementos.newElement("shell_mitc4",xc.ID([n1,n1+1,n1+N+2,n1+N+1]))
+    
+# Constraints
+coacciones= preprocessor.getConstraintLoader
+for j in range(0,N+1):
+  fix_node_6dof.fixNode6DOF(coacciones,j*(N+1)+1)
+
+# Loads definition
+cargas= preprocessor.getLoadLoader
+casos= cargas.getLoadPatterns
+#Load modulation.
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+#Load case definition
+lp0= casos.newLoadPattern("default","0")
+loadedNode= (N+1)*(N+1)
+lp0.newNodalLoad(loadedNode,xc.Vector([F,0,0,0,0,0]))
+#We add the load case to domain.
+casos.addToDomain("0")
+
+# Solution
+analisis= predefined_solutions.simple_static_linear(prueba)
+result= analisis.analyze(1)
+deltax0= nodes.getNode(loadedNode).getDisp[0]
+
+def saveRestore(dbType,fileName):
+  ''' Saves numSteps states of the model in the database
+     and restores them. Returns the elapsed times. '''
+  os.system("rm -rf "+fileName+"*")
+  db= prueba.newDatabase(dbType,fileName)
+  t0= time.time()
+  for k in range(0,numSteps):
+    db.save(100+k)
+  t1= time.time()
+  prueba.clearAll()
+  for k in range(0,numSteps):
+    db.restore(100+k)
+  t2= time.time()
+  return (t1-t0,t2-t1)
+
+tiempos= dict()
+ratios= list()
+for dbType in ["SQLite","File","BerkeleyDB"]:
+  fileName= "/tmp/test16_"+dbType+".db"
+  tiempos[dbType]= saveRestore(dbType,fileName)
+  nodes= preprocessor.getNodeLoader
+  deltax= nodes.getNode(loadedNode).getDisp[0]
+  ratios.append(abs(deltax-deltax0)/deltax0)
+  os.system("rm -rf "+fileName+"*") # Your garbage you clean it
+
+''' 
+print "deltax0= ",deltax0
+for key in tiempos:
+  print key," save: ",tiempos[key][0]," s restore: ",tiempos[key][1]," s"
+print "ratios= ",ratios
+   '''
+
+fname= os.path.basename(__file__)
+if (max(ratios)<1e-10):
+  print "test ",fname,": ok."
+else:
+  print "test ",fname,": ERROR."
@@ -0,0 +1,104 @@
+# -*- coding: utf-8 -*-
+# home made test
+''' Save/restore round trip of a shell mesh with the memory
+   datastore (in-memory snapshots that share the unchanged
+   records).'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+from model import fix_node_6dof
+import os
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 2.1e9 # Young modulus of the steel.
+nu= 0.3 # Poisson's ratio.
+h= .1 # Thickness.
+dens= 1.33 # Density kg/m2.
+F= 1000 # Load
+N= 10 # Number of divisions of each side.
+L= 1.0/N # Element side.
+numSteps= 5 # Number of states saved.
+
+prueba= xc.ProblemaEF()
+preprocessor=  prueba.getPreprocessor   
+nodes= preprocessor.getNodeLoader
+
+# Problem type
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+nodes.defaultTag= 1 #First node number.
+for j in range(0,N+1):
+  for i in range(0,N+1):
+    nod= nodes.newNodeXYZ(i*L,j*L,0)
+
+# Materials definition
+memb1= typical_materials.defElasticMembranePlateSection(preprocessor, "memb1",E,nu,dens,h)
+
+# Elements definition
+elementos= preprocessor.getElementLoader
+elementos.defaultMaterial= "memb1"
+for j in range(0,N):
+  for i in range(0,N):
+    n1= j*(N+1)+i+1
+    elem= elementos.newElement("shell_mitc4",xc.ID([n1,n1+1,n1+N+2,n1+N+1]))
+    
+# Constraints
+coacciones= preprocessor.getConstraintLoader
+for j in range(0,N+1):
+  fix_node_6dof.fixNode6DOF(coacciones,j*(N+1)+1)
+
+# Loads definition
+cargas= preprocessor.getLoadLoader
+casos= cargas.getLoadPatterns
+#Load modulation.
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+#Load case definition
+lp0= casos.newLoadPattern("default","0")
+loadedNode= (N+1)*(N+1)
+lp0.newNodalLoad(loadedNode,xc.Vector([F,0,0,0,0,0]))
+#We add the load case to domain.
+casos.addToDomain("0")
+
+# Solution
+analisis= predefined_solutions.simple_static_linear(prueba)
+result= analisis.analyze(1)
+deltax0= nodes.getNode(loadedNode).getDisp[0]
+
+db= prueba.newDatabase("Memory","")
+db.save(100)
+memoryUsage1= db.memoryUsage
+for k in range(1,numSteps):
+  db.save(100+k)
+memoryUsage2= db.memoryUsage
+# The records that don't change are shared between snapshots.
+ok= (db.numSnapshots==numSteps) and (memoryUsage2<1.5*memoryUsage1)
+db.maxSnapshots= 2 # The least recently used snapshots are discarded.
+ok= ok and (db.numSnapshots==2)
+prueba.clearAll()
+db.restore(100+numSteps-1)
+nodes= preprocessor.getNodeLoader
+deltax= nodes.getNode(loadedNode).getDisp[0]
+ratio= abs(deltax-deltax0)/deltax0
+
+''' 
+print "deltax0= ",deltax0
+print "deltax= ",deltax
+print "memoryUsage1= ",memoryUsage1
+print "memoryUsage2= ",memoryUsage2
+print "ratio= ",ratio
+   '''
+
+fname= os.path.basename(__file__)
+if (ratio<1e-10) & ok:
+  print "test ",fname,": ok."
+else:
+  print "test ",fname,": ERROR."
@@ -0,0 +1,84 @@
+# -*- coding: utf-8 -*-
+# Ground motion record read from a binary file mapped in memory
+# (mapped_path_ts): values, precomputed velocities and displacements
+# and records with non uniform time increment.
+
+import xc_base
+import geom
+import xc
+import os
+import tempfile
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+A= 2.0 # Acceleration slope (a(t)= A*t).
+dT= 0.01 # Time increment.
+n= 201 # Number of points.
+values= xc.Vector([A*i*dT for i in range(0,n)])
+
+tmpDir= tempfile.mkdtemp()
+fileName= tmpDir+'/ramp.ts'
+ok1= (xc.MappedPathSeries.writeFile(fileName,values,dT)==0)
+
+prueba= xc.ProblemaEF()
+preprocessor=  prueba.getPreprocessor
+
+#Load modulation.
+cargas= preprocessor.getLoadLoader
+casos= cargas.getLoadPatterns
+ts= casos.newTimeSeries("constant_ts","ts")
+gm= casos.newLoadPattern("uniform_excitation","gm")
+mr= gm.motionRecord
+hist= mr.history
+accel= casos.newTimeSeries("mapped_path_ts","accel")
+accel.readFromFile(fileName)
+hist.accel= accel
+hist.delta= dT
+
+t= 1.234
+motionDuration= mr.getDuration()
+motionPathSize= mr.history.getNumberOfDataPoints()
+ok2= accel.isUniform and (accel.fileName==fileName)
+
+ratio1= (motionDuration-2.0)/2.0
+ratio2= (motionPathSize-n)/n
+ratio3= (mr.getAccel(t)-A*t)/(A*t)
+ratio4= (mr.getPeakAccel()-A*2.0)/(A*2.0)
+ratio5= (mr.getVel(t)-A*t**2/2.0)/(A*t**2/2.0) # Velocities interpolated linearly.
+ratio6= (mr.getDisp(2.0)-A*2.0**3/6.0)/(A*2.0**3/6.0)
+
+# Non uniform time increment.
+times= xc.Vector([0.0,0.5,0.75,2.0,3.0])
+values2= xc.Vector([0.0,1.0,2.0,-1.0,0.0])
+fileName2= tmpDir+'/non_uniform.ts'
+ok3= (xc.MappedPathSeries.writeFileWithTimes(fileName2,values2,times)==0)
+ts2= casos.newTimeSeries("mapped_path_ts","ts2")
+ts2.readFromFile(fileName2)
+ts2.factor= 2.0
+ok4= (not ts2.isUniform) and (ts2.numDataPoints==5)
+ratio7= abs(ts2.getFactor(0.625)-3.0)+abs(ts2.getFactor(2.5)+1.0)+abs(ts2.getFactor(0.1)-0.4)+abs(ts2.getFactor(3.5))
+
+os.remove(fileName)
+os.remove(fileName2)
+os.rmdir(tmpDir)
+
+''' 
+print "duration= ",motionDuration
+print "ratio1= ",ratio1
+print "ratio2= ",ratio2
+print "ratio3= ",ratio3
+print "ratio4= ",ratio4
+print "ratio5= ",ratio5
+print "ratio6= ",ratio6
+print "ratio7= ",ratio7
+  '''
+
+fname= os.path.basename(__file__)
+if ok1 & ok2 & ok3 & ok4 & (abs(ratio1)<1e-12) & (abs(ratio2)<1e-12) & (abs(ratio3)<1e-12) & (abs(ratio4)<1e-12) & (abs(ratio5)<1e-4) & (abs(ratio6)<1e-4) & (abs(ratio7)<1e-12):
+  print "test ",fname,": ok."
+else:
+  print "test ",fname,": ERROR."
@@ -0,0 +1,53 @@
+# -*- coding: utf-8 -*-
+# Rows written through an asynchronous file handler must be
+# identical (byte by byte) to the ones written synchronously.
+
+import xc_base
+import geom
+import xc
+import os
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+columns= ['time','ux','uy','uz']
+numRows= 500
+
+def writeRows(fName,asyncMode):
+  handler= xc.DataOutputFileHandler(fName)
+  handler.open(columns)
+  if(asyncMode):
+    handler.setAsync(True,4) # Small buffer: the writer must wait.
+  for i in range(0,numRows):
+    t= 0.01*i
+    handler.write(xc.Vector([t,1e-3*t,-2.5e-4*t*t,1.0/(i+3.0)]))
+  handler.flush()
+  return handler
+
+syncFileName= '/tmp/test_async_data_output_sync.dat'
+asyncFileName= '/tmp/test_async_data_output_async.dat'
+syncHandler= writeRows(syncFileName,False)
+asyncHandler= writeRows(asyncFileName,True)
+ratio1= asyncHandler.isAsync and not syncHandler.isAsync
+
+syncData= open(syncFileName,'rb').read()
+asyncData= open(asyncFileName,'rb').read()
+ratio2= (len(syncData)>0)
+ratio3= (syncData==asyncData)
+
+''' 
+print "len(syncData)= ", len(syncData)
+print "len(asyncData)= ", len(asyncData)
+   '''
+
+os.remove(syncFileName)
+os.remove(asyncFileName)
+
+fname= os.path.basename(__file__)
+if(ratio1 and ratio2 and ratio3):
+  print "test ",fname,": ok."
+else:
+  print "test ",fname,": ERROR."
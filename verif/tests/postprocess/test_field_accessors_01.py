@@ -0,0 +1,108 @@
+# -*- coding: utf-8 -*-
+# Compiled field accessors (rotations of a 2D cantilever with
+# a point load at its free end).
+
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from model import fix_node_3dof
+from materials import typical_materials
+import os
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 2.1e6*9.81/1e-4 # Elastic modulus (Pa)
+nu= 0.3 # Poisson's ratio
+G= E/(2*(1+nu)) # Shear modulus
+A= 7.64e-4 # Cross section area (m2)
+Iz= 80.1e-8 # Cross section moment of inertia (m4)
+L= 1.5 # Bar length (m)
+F= 1.5e3 # Load magnitude (N)
+
+prueba= xc.ProblemaEF()
+preprocessor=  prueba.getPreprocessor
+nodes= preprocessor.getNodeLoader
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+nodes.defaultTag= 1 #First node number.
+nodes.newNodeXY(0,0.0)
+nodes.newNodeXY(L,0.0)
+
+trfs= preprocessor.getTransfCooLoader
+lin= trfs.newLinearCrdTransf2d("lin")
+
+caracMecSeccion= xc.CrossSectionProperties2d()
+caracMecSeccion.A= A; caracMecSeccion.E= E; caracMecSeccion.G= G;
+caracMecSeccion.I= Iz;
+seccion= typical_materials.defElasticSectionFromMechProp2d(preprocessor, "seccion",caracMecSeccion)
+
+elementos= preprocessor.getElementLoader
+elementos.defaultTransformation= "lin"
+elementos.defaultMaterial= "seccion"
+elementos.defaultTag= 1 #Tag for the next element.
+beam2d= elementos.newElement("elastic_beam_2d",xc.ID([1,2]));
+
+coacciones= preprocessor.getConstraintLoader
+fix_node_3dof.fixNode000(coacciones,1)
+
+cargas= preprocessor.getLoadLoader
+casos= cargas.getLoadPatterns
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+lp0= casos.newLoadPattern("default","0")
+lp0.newNodalLoad(2,xc.Vector([0,-F,0]))
+casos.addToDomain("0")
+
+analisis= predefined_solutions.simple_static_linear(prueba)
+result= analisis.analyze(1)
+
+setTotal= preprocessor.getSets.getSet("total")
+
+# Rotations (one column: the third DOF of the nodes).
+rot= xc.FieldExtractor(["rot"],[])
+rot.compile(setTotal)
+R= rot.extract()
+tags= list(rot.tags)
+thetaTeor= -F*L**2/(2*E*Iz)
+ratio1= abs((R.at(tags.index(2),0)-thetaTeor)/thetaTeor)+abs(R.at(tags.index(1),0))
+ok1= (rot.numColumns==1)
+
+# User defined accessor.
+xc.FieldExtractor.defineAccessor("vertDisp",["disp"])
+ok2= xc.FieldExtractor.isAccessor("vertDisp") and xc.FieldExtractor.isAccessor("sectionForces") and not xc.FieldExtractor.isAccessor("self.getDisp")
+vDisp= xc.FieldExtractor(["vertDisp"],[1])
+vDisp.compile(setTotal.getNodes)
+U= vDisp.extract()
+deltaTeor= -F*L**3/(3*E*Iz)
+ratio2= abs((U.at(list(vDisp.tags).index(2),0)-deltaTeor)/deltaTeor)
+
+# Fields exported with the compiled accessors.
+fields=  prueba.getFields
+rotField= fields.newField("rot")
+rotField.componentsProperty= "rot"
+dispField= fields.newField("disp")
+dispField.componentsProperty= "self.getDisp"
+stressField= fields.newField("stress")
+stressField.componentsProperty= "stress"
+stressField.definedOnElements()
+ok3= rotField.hasCompiledAccessor and not dispField.hasCompiledAccessor and not stressField.hasCompiledAccessor
+stressField.definedOnGaussPoints()
+ok4= stressField.hasCompiledAccessor and xc.FieldExtractor.isPerPointAccessor("stress") and not xc.FieldExtractor.isPerPointAccessor("rot")
+
+'''
+print "R= ",R
+print "U= ",U
+print "ratio1= ",ratio1
+print "ratio2= ",ratio2
+   '''
+
+fname= os.path.basename(__file__)
+if (ratio1<1e-5) & (ratio2<1e-5) & ok1 & ok2 & ok3 & ok4:
+  print "test ",fname,": ok."
+else:
+  print "test ",fname,": ERROR."
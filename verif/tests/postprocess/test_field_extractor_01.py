@@ -0,0 +1,120 @@
+# -*- coding: utf-8 -*-
+# Bulk extraction of nodal and element results from a set
+# (the bars of truss_test1.py).
+
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+import os
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 30e6 #Young modulus (psi)
+l= 10 #Bar length in inches
+a= 0.3*l #Longitud del tramo a
+b= 0.3*l #Longitud del tramo b
+F1= 1000 #Force magnitude 1 (pounds)
+F2= 1000/2 #Force magnitude 2 (pounds)
+
+prueba= xc.ProblemaEF()
+preprocessor=  prueba.getPreprocessor
+nodes= preprocessor.getNodeLoader
+
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+nodes.defaultTag= 1 #Number for next node will be 1.
+nodes.newNodeXYZ(0,0,0)
+nodes.newNodeXYZ(0,l-a-b,0)
+nodes.newNodeXYZ(0,l-a,0)
+nodes.newNodeXYZ(0,l,0)
+
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+
+elements= preprocessor.getElementLoader
+elements.dimElem= 2 #Bars defined ina a two dimensional space.
+elements.defaultMaterial= "elast"
+elements.defaultTag= 1 #Tag for the next element.
+truss= elements.newElement("truss",xc.ID([1,2]));
+truss.area= 1
+truss= elements.newElement("truss",xc.ID([2,3]));
+truss.area= 1
+truss= elements.newElement("truss",xc.ID([3,4]));
+truss.area= 1
+
+coacciones= preprocessor.getConstraintLoader
+spc= coacciones.newSPConstraint(1,0,0.0)
+spc= coacciones.newSPConstraint(1,1,0.0)
+spc= coacciones.newSPConstraint(4,0,0.0)
+spc= coacciones.newSPConstraint(4,1,0.0)
+spc= coacciones.newSPConstraint(2,0,0.0)
+spc= coacciones.newSPConstraint(3,0,0.0)
+
+cargas= preprocessor.getLoadLoader
+casos= cargas.getLoadPatterns
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+lp0= casos.newLoadPattern("default","0")
+lp0.newNodalLoad(2,xc.Vector([0,-F2]))
+lp0.newNodalLoad(3,xc.Vector([0,-F1]))
+casos.addToDomain("0")
+
+# Solution
+analisis= predefined_solutions.simple_static_linear(prueba)
+result= analisis.analyze(1)
+nodes.calculateNodalReactions(True)
+
+setTotal= preprocessor.getSets.getSet("total")
+
+# Reactions (vertical component only).
+reactions= xc.FieldExtractor(["reaction"],[1])
+reactions.compile(setTotal)
+R= reactions.extract()
+tags= reactions.tags
+R1= R.at(list(tags).index(4),0)
+R2= R.at(list(tags).index(1),0)
+ratio1= (R1-900)/900
+ratio2= (R2-600)/600
+
+# Displacements (all the components), extracted in the same matrix.
+disp= xc.FieldExtractor(["disp"],[])
+disp.compile(setTotal.getNodes)
+U= xc.Matrix()
+disp.extractInto(U)
+ratio3= 0.0
+for i in range(0,disp.numRows):
+  n= nodes.getNode(disp.tags[i])
+  for j in range(0,2):
+    ratio3+= abs(U.at(i,j)-n.getDisp[j])
+ok1= (U.noRows==4) and (U.noCols==2)
+
+# Axial forces of the bars.
+elems= setTotal.getElements
+N= elems.getFieldValues(["force"],[],0)
+axialForces= dict()
+for i in range(0,N.noRows):
+  axialForces[elems.at(i).tag]= N.at(i,0)
+ratio4= abs(abs(axialForces[1])-600)/600+abs(abs(axialForces[3])-900)/900
+ok2= (N.noRows==3) and (N.noCols==1)
+
+''' 
+print "R1= ",R1
+print "R2= ",R2
+print "U= ",U
+print "N= ",N
+print "ratio1= ",ratio1
+print "ratio2= ",ratio2
+print "ratio3= ",ratio3
+print "ratio4= ",ratio4
+   '''
+
+fname= os.path.basename(__file__)
+if (abs(ratio1)<1e-5) & (abs(ratio2)<1e-5) & (ratio3<1e-12) & (ratio4<1e-5) & ok1 & ok2:
+  print "test ",fname,": ok."
+else:
+  print "test ",fname,": ERROR."
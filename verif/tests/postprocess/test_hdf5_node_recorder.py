@@ -0,0 +1,97 @@
+# -*- coding: utf-8 -*-
+# Node recorder writing to a HDF5 results store (the bars of
+# truss_test1.py).
+
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+import os
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 30e6 #Young modulus (psi)
+l= 10 #Bar length in inches
+a= 0.3*l #Longitud del tramo a
+b= 0.3*l #Longitud del tramo b
+F1= 1000 #Force magnitude 1 (pounds)
+F2= 1000/2 #Force magnitude 2 (pounds)
+
+prueba= xc.ProblemaEF()
+preprocessor=  prueba.getPreprocessor
+nodes= preprocessor.getNodeLoader
+
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+nodes.defaultTag= 1 #Number for next node will be 1.
+nodes.newNodeXYZ(0,0,0)
+n2= nodes.newNodeXYZ(0,l-a-b,0)
+n3= nodes.newNodeXYZ(0,l-a,0)
+nodes.newNodeXYZ(0,l,0)
+
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+
+elements= preprocessor.getElementLoader
+elements.dimElem= 2 #Bars defined ina a two dimensional space.
+elements.defaultMaterial= "elast"
+elements.defaultTag= 1 #Tag for the next element.
+truss= elements.newElement("truss",xc.ID([1,2]));
+truss.area= 1
+truss= elements.newElement("truss",xc.ID([2,3]));
+truss.area= 1
+truss= elements.newElement("truss",xc.ID([3,4]));
+truss.area= 1
+
+coacciones= preprocessor.getConstraintLoader
+spc= coacciones.newSPConstraint(1,0,0.0)
+spc= coacciones.newSPConstraint(1,1,0.0)
+spc= coacciones.newSPConstraint(4,0,0.0)
+spc= coacciones.newSPConstraint(4,1,0.0)
+spc= coacciones.newSPConstraint(2,0,0.0)
+spc= coacciones.newSPConstraint(3,0,0.0)
+
+cargas= preprocessor.getLoadLoader
+casos= cargas.getLoadPatterns
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+lp0= casos.newLoadPattern("default","0")
+lp0.newNodalLoad(2,xc.Vector([0,-F2]))
+lp0.newNodalLoad(3,xc.Vector([0,-F1]))
+casos.addToDomain("0")
+
+# Recorder (vertical displacement of nodes 2 and 3 on each commit).
+fName= '/tmp/test_hdf5_node_recorder.h5'
+store= xc.HDF5ResultsStore(fName)
+handler= xc.DataOutputHDF5Handler(store,"disp")
+recorder= prueba.getDomain.newRecorder("node_recorder",handler)
+recorder.setup(xc.ID([1]),xc.ID([2,3]),"disp")
+
+# Solution
+analisis= predefined_solutions.simple_static_linear(prueba)
+result= analisis.analyze(2)
+recorder.flush()
+
+ratio1= (store.getNumRows("disp")==2)
+ratio2= (store.getColumnNames("disp")==["Node2_disp_2","Node3_disp_2"])
+rows= store.readRows("disp",0,0)
+ratio3= abs(rows(1,0)-n2.getDisp[1])<1e-15 and abs(rows(1,1)-n3.getDisp[1])<1e-15
+ratio4= abs(n3.getDisp[1])>0.0
+store.close()
+os.remove(fName)
+
+''' 
+print "rows= ", rows
+print "n2 disp= ", n2.getDisp
+print "n3 disp= ", n3.getDisp
+   '''
+
+fname= os.path.basename(__file__)
+if(ratio1 and ratio2 and ratio3 and ratio4):
+  print "test ",fname,": ok."
+else:
+  print "test ",fname,": ERROR."
@@ -0,0 +1,132 @@
+# -*- coding: utf-8 -*-
+# Store the results of several load combinations in a HDF5 results
+# store and read them back by slices.
+
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from model import fix_node_6dof
+from materials import typical_materials
+from postprocess.reports import export_displacements
+from postprocess.reports import export_internal_forces
+import os
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+# Material properties
+E= 2.1e6*9.81/1e-4 # Elastic modulus (Pa)
+nu= 0.3 # Poisson's ratio
+G= E/(2*(1+nu)) # Shear modulus
+
+# Cross section properties (IPE-80)
+A= 7.64e-4 # Cross section area (m2)
+Iy= 80.1e-8 # Cross section moment of inertia (m4)
+Iz= 8.49e-8 # Cross section moment of inertia (m4)
+J= 0.721e-8 # Cross section torsion constant (m4)
+
+L= 1.5 # Bar length (m)
+f= 1.5e3 # Load magnitude (kN/m)
+
+prueba= xc.ProblemaEF()
+preprocessor=  prueba.getPreprocessor  
+nodes= preprocessor.getNodeLoader
+
+# Problem type
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+nodes.defaultTag= 1 #First node number.
+nodes.newNodeXYZ(0,0.0,0.0)
+nodes.newNodeXYZ(L,0.0,0.0)
+
+# Geometric transformation(s)
+trfs= preprocessor.getTransfCooLoader
+lin= trfs.newLinearCrdTransf3d("lin")
+lin.xzVector= xc.Vector([0,-1,0])
+
+# Materials definition
+scc= typical_materials.defElasticSection3d(preprocessor, "scc",A,E,G,Iz,Iy,J)
+
+# Elements definition
+elementos= preprocessor.getElementLoader
+elementos.defaultTransformation= "lin"
+elementos.defaultMaterial= "scc"
+elementos.defaultTag= 1 #Tag for next element.
+beam3d= elementos.newElement("elastic_beam_3d",xc.ID([1,2]));
+
+# Constraints
+coacciones= preprocessor.getConstraintLoader
+fix_node_6dof.fixNode6DOF(coacciones,1)
+
+# Loads definition
+cargas= preprocessor.getLoadLoader
+casos= cargas.getLoadPatterns
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+lpA= casos.newLoadPattern("default","A")
+lpB= casos.newLoadPattern("default","B")
+eleLoad= lpA.newElementalLoad("beam3d_uniform_load")
+eleLoad.elementTags= xc.ID([1])
+eleLoad.axialComponent= f
+eleLoad= lpB.newElementalLoad("beam3d_uniform_load")
+eleLoad.elementTags= xc.ID([1])
+eleLoad.transComponent= -f
+combs= cargas.getLoadCombinations
+combA= combs.newLoadCombination("COMBA","1.00*A")
+combB= combs.newLoadCombination("COMBB","1.50*B")
+
+fName= "/tmp/test_hdf5_results_store.h5"
+store= xc.HDF5ResultsStore(fName,False)
+total= preprocessor.getSets.getSet("total")
+analisis= predefined_solutions.simple_static_linear(prueba)
+deltas= list()
+for comb in [combA,combB]:
+  preprocessor.resetLoadCase()
+  comb.addToDomain()
+  result= analisis.analyze(1)
+  export_displacements.storeDisplacements(comb.getName,total.getNodes,store)
+  export_internal_forces.storeInternalForces(comb.getName,total.getElements,store)
+  n2= nodes.getNode(2)
+  deltas.append([n2.getDisp[0],n2.getDisp[2]])
+  comb.removeFromDomain()
+
+# Recorder like table.
+store.chunkSize= 16
+store.newTable("history",["t","u"])
+for i in range(0,100):
+  store.appendRow("history",xc.Vector([0.1*i,i*i]))
+store.close()
+
+# Read back.
+store= xc.HDF5ResultsStore(fName,True)
+ratio1= (store.getNumSteps("displacements")==2)
+ratio2= (store.getStepLabels("displacements")==["COMBA","COMBB"])
+tags= store.getFieldTags("displacements")
+i2= list(tags).index(2)
+hist= store.readHistory("displacements",i2)
+ratio3= abs(hist(0,0)-deltas[0][0])<1e-15 and abs(hist(1,2)-deltas[1][1])<1e-15
+ratio4= abs(store.readComponentHistory("displacements",i2,2)[1]-deltas[1][1])<1e-15
+Mz1= store.readStep("internal_forces",1)(0,5)
+ratio5= abs(Mz1-(-1.5*f*L*L/2))/abs(Mz1)<1e-10
+rows= store.readRows("history",40,3)
+ratio6= (rows.noRows==3) and abs(rows(1,1)-41*41)<1e-10
+ratio7= (store.getNumRows("history")==100) and (store.getColumnNames("history")==["t","u"])
+store.close()
+os.remove(fName)
+
+''' 
+print "deltas= ", deltas
+print "hist= ", hist
+print "Mz1= ", Mz1
+print "rows= ", rows
+   '''
+
+fname= os.path.basename(__file__)
+if(ratio1 and ratio2 and ratio3 and ratio4 and ratio5 and ratio6 and ratio7):
+  print "test ",fname,": ok."
+else:
+  print "test ",fname,": ERROR."
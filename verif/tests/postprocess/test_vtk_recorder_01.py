@@ -0,0 +1,131 @@
+# -*- coding: utf-8 -*-
+# Streaming output of the mesh and results to VTU/PVD and XDMF/HDF5
+# files (the bars of truss_test1.py).
+
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+import os
+import re
+import struct
+import tempfile
+import shutil
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 30e6 #Young modulus (psi)
+l= 10 #Bar length in inches
+a= 0.3*l #Longitud del tramo a
+b= 0.3*l #Longitud del tramo b
+F1= 1000 #Force magnitude 1 (pounds)
+F2= 1000/2 #Force magnitude 2 (pounds)
+
+prueba= xc.ProblemaEF()
+preprocessor=  prueba.getPreprocessor
+nodes= preprocessor.getNodeLoader
+
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+nodes.defaultTag= 1 #Number for next node will be 1.
+nodes.newNodeXYZ(0,0,0)
+nodes.newNodeXYZ(0,l-a-b,0)
+nodes.newNodeXYZ(0,l-a,0)
+nodes.newNodeXYZ(0,l,0)
+
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+
+elements= preprocessor.getElementLoader
+elements.dimElem= 2 #Bars defined ina a two dimensional space.
+elements.defaultMaterial= "elast"
+elements.defaultTag= 1 #Tag for the next element.
+truss= elements.newElement("truss",xc.ID([1,2]));
+truss.area= 1
+truss= elements.newElement("truss",xc.ID([2,3]));
+truss.area= 1
+truss= elements.newElement("truss",xc.ID([3,4]));
+truss.area= 1
+
+coacciones= preprocessor.getConstraintLoader
+spc= coacciones.newSPConstraint(1,0,0.0)
+spc= coacciones.newSPConstraint(1,1,0.0)
+spc= coacciones.newSPConstraint(4,0,0.0)
+spc= coacciones.newSPConstraint(4,1,0.0)
+spc= coacciones.newSPConstraint(2,0,0.0)
+spc= coacciones.newSPConstraint(3,0,0.0)
+
+cargas= preprocessor.getLoadLoader
+casos= cargas.getLoadPatterns
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+lp0= casos.newLoadPattern("default","0")
+lp0.newNodalLoad(2,xc.Vector([0,-F2]))
+lp0.newNodalLoad(3,xc.Vector([0,-F1]))
+casos.addToDomain("0")
+
+# Recorders (written on each commit).
+outputDir= tempfile.mkdtemp()
+recorders= list()
+for fmt in ['vtu','xdmf']:
+  recorder= prueba.getDomain.newRecorder("vtk_recorder",None)
+  recorder.fileName= os.path.join(outputDir,'truss_'+fmt)
+  recorder.format= fmt
+  recorder.addField("disp",["disp"],[],0)
+  recorder.addField("N",["force"],[],0)
+  recorders.append(recorder)
+
+# Solution
+analisis= predefined_solutions.simple_static_linear(prueba)
+result= analisis.analyze(2)
+
+ok1= True
+for r in recorders:
+  ok1= ok1 and (r.numPoints==4) and (r.numCells==3) and (r.numSteps==2)
+
+vtuFile= open(os.path.join(outputDir,'truss_vtu_1.vtu'),'rb').read()
+ok2= ('NumberOfPoints="4" NumberOfCells="3"' in vtuFile) and ('Name="disp" NumberOfComponents="2"' in vtuFile)
+# Values of an appended raw data array (UInt64 header followed
+# by the Float64 values); pattern: regular expression that finds
+# the offset of the array.
+def readArray(vtu,pattern):
+  offset= int(re.search(pattern,vtu).group(1))
+  appendedData= '<AppendedData encoding="raw">\n_'
+  start= vtu.index(appendedData)+len(appendedData)+offset
+  byteOrder= ('<' if ('byte_order="LittleEndian"' in vtu) else '>')
+  sz= struct.unpack(byteOrder+'Q',vtu[start:start+8])[0]
+  return struct.unpack(byteOrder+str(sz/8)+'d',vtu[start+8:start+8+sz])
+# Vertical displacement of node 2 written on the last step.
+points= readArray(vtuFile,'<Points>\s*<DataArray[^>]*offset="([0-9]+)"')
+disp= readArray(vtuFile,'Name="disp"[^>]*offset="([0-9]+)"')
+nod2= nodes.getNode(2)
+uy= nod2.getDisp[1]
+ok5= False
+for i in range(0,len(points)/3):
+  if(abs(points[3*i+1]-nod2.getCoo[1])<1e-9):
+    ok5= (uy!=0.0) and (abs(disp[2*i+1]-uy)<=1e-12*abs(uy))
+pvdFile= open(os.path.join(outputDir,'truss_vtu.pvd')).read()
+ok3= ('truss_vtu_0.vtu' in pvdFile) and ('truss_vtu_1.vtu' in pvdFile)
+for r in recorders:
+  r.close()
+xmfFile= open(os.path.join(outputDir,'truss_xdmf.xmf')).read()
+ok4= ('truss_xdmf.h5:/step_1/N' in xmfFile) and os.path.exists(os.path.join(outputDir,'truss_xdmf.h5'))
+shutil.rmtree(outputDir)
+
+'''
+print "ok1= ",ok1
+print "ok2= ",ok2
+print "ok3= ",ok3
+print "ok4= ",ok4
+print "ok5= ",ok5
+   '''
+
+fname= os.path.basename(__file__)
+if ok1 & ok2 & ok3 & ok4 & ok5:
+  print "test ",fname,": ok."
+else:
+  print "test ",fname,": ERROR."
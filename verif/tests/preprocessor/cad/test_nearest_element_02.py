@@ -0,0 +1,74 @@
+# -*- coding: utf-8 -*-
+# Point location in hexahedral elements whose faces are not aligned
+# with the axes (the bounding box of the element nodes is not enough
+# to decide which element contains the point).
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+prueba= xc.ProblemaEF()
+preprocessor=  prueba.getPreprocessor
+elast= typical_materials.defElasticIsotropic3d(preprocessor, "elast3d",1e6,0.25,0.0)
+
+nodes= preprocessor.getNodeLoader
+modelSpace= predefined_spaces.SolidMechanics3D(nodes)
+# Two bricks sharing an inclined face (x= 1.5 at z= 0, x= 0.5 at z= 1).
+coords= [(0,0,0),(1.5,0,0),(2,0,0),(0,1,0),(1.5,1,0),(2,1,0),
+         (0,0,1),(0.5,0,1),(2,0,1),(0,1,1),(0.5,1,1),(2,1,1)]
+for i,c in enumerate(coords):
+  nodes.newNodeIDXYZ(i+1,c[0],c[1],c[2])
+# Two unit cubes far away.
+tag= len(coords)+1
+for x0 in [10.0,12.0]:
+  for z in [0.0,1.0]:
+    for (x,y) in [(x0,0.0),(x0+1,0.0),(x0+1,1.0),(x0,1.0)]:
+      nodes.newNodeIDXYZ(tag,x,y,z)
+      tag+= 1
+
+elementos= preprocessor.getElementLoader
+elementos.defaultMaterial= "elast3d"
+elementos.defaultTag= 1 #Tag for the next element.
+elementos.newElement("brick",xc.ID([1,2,5,4,7,8,11,10]))
+elementos.newElement("brick",xc.ID([2,3,6,5,8,9,12,11]))
+elementos.newElement("brick",xc.ID([13,14,15,16,17,18,19,20]))
+elementos.newElement("brick",xc.ID([21,22,23,24,25,26,27,28]))
+
+total= preprocessor.getSets.getSet("total")
+setElems= total.getElements
+
+# Inside the bounding boxes of both elements but only in the second one.
+ratio1= (setElems.getElementContaining(geom.Pos3d(1.2,0.5,0.8),1e-6).tag==2)
+ratio2= (setElems.getElementContaining(geom.Pos3d(0.3,0.5,0.8),1e-6).tag==1)
+ratio3= (setElems.getElementContaining(geom.Pos3d(10.5,0.5,0.5),1e-6).tag==3)
+ratio4= (setElems.getElementContaining(geom.Pos3d(11.5,0.5,0.5),1e-6)==None)
+
+# Make the shared face vertical; only the first two elements must
+# be updated in the search tree.
+mesh= prueba.getDomain.getMesh
+mesh.getNode(8).setPos(geom.Pos3d(1.5,0,1))
+mesh.getNode(11).setPos(geom.Pos3d(1.5,1,1))
+ratio5= (setElems.getElementContaining(geom.Pos3d(1.2,0.5,0.8),1e-6).tag==1)
+ratio6= (setElems.getElementContaining(geom.Pos3d(1.7,0.5,0.8),1e-6).tag==2)
+ratio7= (setElems.getElementContaining(geom.Pos3d(12.5,0.5,0.5),1e-6).tag==4)
+
+''' 
+print "ratio1= ", ratio1
+print "ratio2= ", ratio2
+print "ratio5= ", ratio5
+print "ratio6= ", ratio6
+   '''
+
+import os
+fname= os.path.basename(__file__)
+if(ratio1 and ratio2 and ratio3 and ratio4 and ratio5 and ratio6 and ratio7):
+  print "test ",fname,": ok."
+else:
+  print "test ",fname,": ERROR."
@@ -0,0 +1,80 @@
+# -*- coding: utf-8 -*-
+# Spatial queries on node and element sets (radius, box, k-nearest,
+# batch and point location). The search trees must follow the
+# node positions after they are moved.
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+numNodes= 101
+prueba= xc.ProblemaEF()
+preprocessor=  prueba.getPreprocessor   
+nodes= preprocessor.getNodeLoader
+nodes.defaultTag= 1
+for i in range(0,numNodes):
+  n= nodes.newNodeXYZ(float(i),0,0)
+
+# Materials definition
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",2.1e6)
+
+elementos= preprocessor.getElementLoader
+elementos.defaultMaterial= "elast"
+elementos.dimElem= 3
+elementos.defaultTag= 1 #Tag for the next element.
+for i in range(1,numNodes):
+  truss= elementos.newElement("truss",xc.ID([i,i+1]));
+  truss.area= 1
+
+total= preprocessor.getSets.getSet("total")
+setNodes= total.getNodes
+setElems= total.getElements
+
+# Nodes at x= 48,49,50,51,52
+radiusTags= sorted([n.tag for n in setNodes.getNodesWithinRadius(geom.Pos3d(50.2,0,0),2.5)])
+ratio1= (radiusTags==[49,50,51,52,53])
+# Nodes at x= 10..12
+boxTags= sorted([n.tag for n in setNodes.getNodesInBox(geom.Pos3d(9.5,-1,-1),geom.Pos3d(12.5,1,1))])
+ratio2= (boxTags==[11,12,13])
+# Three nearest nodes (sorted by distance).
+kTags= [n.tag for n in setNodes.getKNearestNodes(geom.Pos3d(20.1,0,0),3)]
+ratio3= (kTags==[21,22,20])
+# Batch search.
+batchTags= [n.tag for n in setNodes.getNearestNodes([geom.Pos3d(0.2,0,0),geom.Pos3d(99.9,0,0),geom.Pos3d(33.4,1,0)])]
+ratio4= (batchTags==[1,101,34])
+# Point location.
+e= setElems.getElementContaining(geom.Pos3d(70.5,0,0),1e-6)
+ratio5= (e.tag==71)
+eTags= [e.tag for e in setElems.getElementsContaining([geom.Pos3d(0.5,0,0),geom.Pos3d(5.25,0,0)],1e-6)]
+ratio6= (eTags==[1,6])
+ratio7= (setElems.getElementContaining(geom.Pos3d(70.5,1,0),1e-6)==None)
+
+# Move the node 50 far away; the trees must be updated.
+mesh= prueba.getDomain.getMesh
+n50= mesh.getNode(50)
+n50.setPos(geom.Pos3d(500,0,0))
+ratio8= (mesh.getNearestNode(geom.Pos3d(490,0,0)).tag==50)
+ratio9= (setNodes.getNearestNode(geom.Pos3d(490,0,0)).tag==50)
+ratio10= (mesh.getNearestNode(geom.Pos3d(49.1,0,0)).tag!=50)
+
+''' 
+print "radiusTags= ", radiusTags
+print "boxTags= ", boxTags
+print "kTags= ", kTags
+print "batchTags= ", batchTags
+print "eTags= ", eTags
+   '''
+
+import os
+fname= os.path.basename(__file__)
+if(ratio1 and ratio2 and ratio3 and ratio4 and ratio5 and ratio6 and ratio7 and ratio8 and ratio9 and ratio10):
+  print "test ",fname,": ok."
+else:
+  print "test ",fname,": ERROR."
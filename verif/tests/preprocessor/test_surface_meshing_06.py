@@ -0,0 +1,91 @@
+# -*- coding: utf-8 -*-
+''' Checks that the node tags and positions and the element
+    connectivities obtained when meshing several surfaces don't
+    depend on the number of threads (and measures the meshing time).'''
+from __future__ import division
+import xc_base
+import geom
+import xc
+import time
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 30e6 # Young modulus (psi)
+nu= 0.3 # Poisson's ratio
+rho= 0.0 # Density
+numSurfI= 8 # Number of surfaces in x direction.
+numSurfJ= 6 # Number of surfaces in y direction.
+
+def meshModel(numThreads):
+  xc.setNumThreads(numThreads)
+  prueba= xc.ProblemaEF()
+  prueba.logFileName= "/tmp/borrar.log" # Ignore warning messages
+  preprocessor=  prueba.getPreprocessor
+  nodes= preprocessor.getNodeLoader
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  nodes.newSeedNode()
+  elast2d= typical_materials.defElasticIsotropicPlaneStress(preprocessor, "elast2d",E,nu,rho)
+  seedElemLoader= preprocessor.getElementLoader.seedElemLoader
+  seedElemLoader.defaultMaterial= "elast2d"
+  elem= seedElemLoader.newElement("quad4n",xc.ID([0,0,0,0]))
+
+  puntos= preprocessor.getCad.getPoints
+  for j in range(0,numSurfJ+1):
+    for i in range(0,numSurfI+1):
+      puntos.newPntIDPos3d(j*(numSurfI+1)+i+1,geom.Pos3d(i,0.5*j+0.1*i,0.0))
+  surfaces= preprocessor.getCad.getSurfaces
+  for j in range(0,numSurfJ):
+    for i in range(0,numSurfI):
+      p1= j*(numSurfI+1)+i+1
+      p4= p1+numSurfI+1
+      s= surfaces.newQuadSurfacePts(p1,p1+1,p4+1,p4)
+      s.nDivI= 4
+      s.nDivJ= 3
+  total= preprocessor.getSets.getSet("total")
+  start_time= time.time()
+  total.genMesh(xc.meshDir.I)
+  lapso= time.time()-start_time
+  nodes= dict()
+  for n in total.getNodes:
+    pos= n.getInitialPos3d
+    nodes[n.tag]= (pos.x,pos.y,pos.z)
+  elements= dict()
+  for e in total.getElements:
+    elements[e.tag]= list(e.getNodes.getExternalNodes)
+  return nodes, elements, lapso
+
+nodes1, elem1, lapso1= meshModel(1)
+nodes4, elem4, lapso4= meshModel(4)
+xc.setNumThreads(0)
+
+err= 0.0
+if(sorted(nodes1.keys())!=sorted(nodes4.keys())):
+  err+= 1.0
+else:
+  for tag in nodes1:
+    p1= nodes1[tag]; p4= nodes4[tag]
+    err+= (p1[0]-p4[0])**2+(p1[1]-p4[1])**2+(p1[2]-p4[2])**2
+if(elem1!=elem4):
+  err+= 1.0
+
+numNodesTeor= (4*numSurfI+1)*(3*numSurfJ+1)
+numElemTeor= 12*numSurfI*numSurfJ
+
+import os
+fname= os.path.basename(__file__)
+'''
+print "meshing time with 1 thread: ",lapso1," s"
+print "meshing time with 4 threads: ",lapso4," s"
+print "err= ",err
+   '''
+
+if (len(nodes1)==numNodesTeor) & (len(elem1)==numElemTeor) & (len(elem4)==numElemTeor) & (err<1e-15):
+  print "test ",fname,": ok."
+else:
+  print "test ",fname,": ERROR."
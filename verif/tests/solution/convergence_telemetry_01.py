@@ -0,0 +1,142 @@
+# -*- coding: utf-8 -*-
+''' Per-iteration telemetry of the convergence test. Bar with a
+   bilinear (Steel01) material loaded beyond the yield point in
+   several steps using Newton-Raphson; the records are kept on a
+   circular buffer smaller than the number of iterations and
+   written on a file.'''
+
+import os
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 2.1e11 # Elastic modulus.
+fy= 2.6e8 # Yield stress.
+b= 0.05 # Strain hardening ratio.
+A= 1e-4 # Bar area.
+l= 2.0 # Bar length.
+F= 1.5*fy*A # Load.
+Nstep= 20
+
+prb= xc.ProblemaEF()
+preprocessor=  prb.getPreprocessor
+nodes= preprocessor.getNodeLoader
+
+# Problem type
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+
+nodes.defaultTag= 1 #First node number.
+nodes.newNodeXY(0,0)
+nod2= nodes.newNodeXY(l,0)
+
+# Materials definition
+steel= typical_materials.defSteel01(preprocessor, "steel",E,fy,b)
+
+# Element definition.
+elementos= preprocessor.getElementLoader
+elementos.dimElem= 2 #Bidimensional space.
+elementos.defaultMaterial= "steel"
+elementos.defaultTag= 1 #Next element number.
+truss= elementos.newElement("truss",xc.ID([1,2]));
+truss.area= A
+
+coacciones= preprocessor.getConstraintLoader
+spc= coacciones.newSPConstraint(1,0,0.0)
+spc= coacciones.newSPConstraint(1,1,0.0)
+spc= coacciones.newSPConstraint(2,1,0.0)
+
+# Loads definition
+cargas= preprocessor.getLoadLoader
+casos= cargas.getLoadPatterns
+ts= casos.newTimeSeries("linear_ts","ts")
+casos.currentTimeSeries= "ts"
+lp0= casos.newLoadPattern("default","0")
+lp0.newNodalLoad(2,xc.Vector([F,0]))
+casos.addToDomain("0")
+
+# Solution procedure
+solu= prb.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("simple")
+cHandler= sm.newConstraintHandler("plain_handler")
+solMethods= solCtrl.getSoluMethodContainer
+smt= solMethods.newSoluMethod("smt","sm")
+solAlgo= smt.newSolutionAlgorithm("newton_raphson_soln_algo")
+ctest= smt.newConvergenceTest("norm_unbalance_conv_test")
+ctest.tol= 1e-6
+ctest.maxNumIter= 20
+capacity= 10
+telemetryFileName= "/tmp/convergence_telemetry_01.txt"
+telemetry= ctest.telemetry
+telemetry.enabled= True
+telemetry.capacity= capacity
+telemetry.fileName= telemetryFileName
+integ= smt.newIntegrator("load_control_integrator",xc.Vector([]))
+integ.dLambda1= 1.0/Nstep
+soe= smt.newSystemOfEqn("band_gen_lin_soe")
+solver= soe.newSolver("band_gen_lin_lapack_solver")
+analysis= solu.newAnalysis("static_analysis","smt","")
+result= analysis.analyze(Nstep)
+telemetry.fileName= "" # close the file.
+
+# Records written on the file (one per iteration).
+f= open(telemetryFileName,"r")
+lines= f.readlines()[1:]
+f.close()
+os.remove(telemetryFileName)
+numIterations= len(lines)
+
+numRecords= telemetry.numRecords
+steps= telemetry.getSteps()
+iterations= telemetry.getIterations()
+normsB= telemetry.getNormsB()
+actions= telemetry.getActions()
+failures= telemetry.getNumFailedElements()
+
+# The buffer keeps the last iterations.
+lastLine= lines[-1].split()
+ok= (numIterations>capacity) and (numRecords==capacity)
+ok= ok and (telemetry.numSteps==Nstep)
+ok= ok and (steps[numRecords-1]==Nstep) and (int(lastLine[0])==Nstep)
+ok= ok and (iterations[numRecords-1]==int(lastLine[1]))
+ok= ok and (normsB[numRecords-1]<=ctest.tol)
+for i in range(0,numRecords):
+  ok= ok and ((actions[i] & 1)==1) # tangent formed on each iteration.
+  ok= ok and (failures[i]==0)
+  if(i>0):
+    ok= ok and (steps[i]>=steps[i-1])
+
+sigma= F/A
+epsTeor= fy/E+(sigma-fy)/(b*E)
+uTeor= epsTeor*l
+u= nod2.getDisp[0]
+ratio1= abs(u-uTeor)/uTeor
+
+''' 
+print "result= ",result
+print "numIterations= ",numIterations
+print "numRecords= ",numRecords
+print "steps= ",steps
+print "iterations= ",iterations
+print "normsB= ",normsB
+print "actions= ",actions
+print "ratio1= ",ratio1
+   '''
+
+fname= os.path.basename(__file__)
+if (result==0) & (ratio1<1e-6) & ok:
+  print "test ",fname,": ok."
+else:
+  print "test ",fname,": ERROR."
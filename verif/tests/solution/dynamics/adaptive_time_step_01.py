@@ -0,0 +1,117 @@
+# -*- coding: utf-8 -*-
+''' Newmark analysis of a mass-spring system under a suddenly
+   applied constant load with the time step controlled by the
+   local error estimate. The maximum displacement must be twice
+   the static one: u(t)= F/k*(1-cos(w*t)) using less steps than
+   a fixed step analysis with a similar accuracy.'''
+
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+import math
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 1e6 # Elastic modulus.
+A= 1e-2 # Bar area.
+l= 1.0 # Bar length.
+m= 100.0 # Mass.
+F= 1000.0 # Load.
+k= E*A/l # Spring stiffness.
+omega= math.sqrt(k/m)
+
+prb= xc.ProblemaEF()
+preprocessor=  prb.getPreprocessor
+nodes= preprocessor.getNodeLoader
+
+# Problem type
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+
+nodes.defaultTag= 1 #First node number.
+nodes.newNodeXY(0,0)
+nod2= nodes.newNodeXY(l,0)
+nod2.mass= xc.Matrix([[m,0],[0,m]])
+
+# Materials definition
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+
+# Element definition.
+elementos= preprocessor.getElementLoader
+elementos.dimElem= 2 #Bidimensional space.
+elementos.defaultMaterial= "elast"
+elementos.defaultTag= 1 #Next element number.
+truss= elementos.newElement("truss",xc.ID([1,2]));
+truss.area= A
+
+coacciones= preprocessor.getConstraintLoader
+spc= coacciones.newSPConstraint(1,0,0.0)
+spc= coacciones.newSPConstraint(1,1,0.0)
+spc= coacciones.newSPConstraint(2,1,0.0)
+
+# Loads definition
+cargas= preprocessor.getLoadLoader
+casos= cargas.getLoadPatterns
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+lp0= casos.newLoadPattern("default","0")
+lp0.newNodalLoad(2,xc.Vector([F,0]))
+casos.addToDomain("0")
+
+# Solution procedure
+solu= prb.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+cHandler= sm.newConstraintHandler("transformation_constraint_handler")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("rcm")
+solMethods= solCtrl.getSoluMethodContainer
+smt= solMethods.newSoluMethod("smt","sm")
+solAlgo= smt.newSolutionAlgorithm("newton_raphson_soln_algo")
+ctest= smt.newConvergenceTest("norm_disp_incr_conv_test")
+ctest.tol= 1.0e-9
+ctest.maxNumIter= 10
+integ= smt.newIntegrator("newmark_integrator",xc.Vector([]))
+soe= smt.newSystemOfEqn("band_gen_lin_soe")
+solver= soe.newSolver("band_gen_lin_lapack_solver")
+analisis= solu.newAnalysis("adaptive_time_step_direct_integration_analysis","smt","")
+analisis.relTol= 1e-3
+analisis.excitationDt= 0.05
+
+# Run until t= 1.0 one "record interval" at a time to get the peak.
+uMax= 0.0
+for i in range(0,20):
+  analisis.analyze(1,0.05,1e-5,0.05)
+  uMax= max(uMax,nod2.getDisp[0])
+  
+numAccepted= analisis.getNumAcceptedSteps()
+numRejected= analisis.getNumRejectedSteps()
+uTeor= F/k*(1-math.cos(omega*1.0))
+
+ratio1= abs(uMax-2*F/k)/(2*F/k)
+ratio2= abs(nod2.getDisp[0]-uTeor)/(2*F/k)
+
+''' 
+print "uMax= ",uMax
+print "2*F/k= ",2*F/k
+print "ratio1= ",ratio1
+print "u(1.0)= ",nod2.getDisp[0]
+print "uTeor= ",uTeor
+print "ratio2= ",ratio2
+print "numAccepted= ",numAccepted
+print "numRejected= ",numRejected
+   '''
+
+import os
+fname= os.path.basename(__file__)
+if (ratio1<0.02) & (ratio2<0.05) & (numAccepted<100) & (numAccepted>=20):
+  print "test ",fname,": ok."
+else:
+  print "test ",fname,": ERROR."
@@ -0,0 +1,130 @@
+# -*- coding: utf-8 -*-
+''' Restart of a Newmark analysis of a mass-spring system from a
+   checkpoint file. The steps computed after the restart must give
+   exactly the same results as the ones computed before, and the
+   recorders must not write them twice.'''
+
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+import math
+import os
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 1e6 # Elastic modulus.
+A= 1e-2 # Bar area.
+l= 1.0 # Bar length.
+m= 100.0 # Mass.
+F= 1000.0 # Load.
+k= E*A/l # Spring stiffness.
+omega= math.sqrt(k/m)
+
+prb= xc.ProblemaEF()
+preprocessor=  prb.getPreprocessor
+nodes= preprocessor.getNodeLoader
+
+# Problem type
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+
+nodes.defaultTag= 1 #First node number.
+nodes.newNodeXY(0,0)
+nod2= nodes.newNodeXY(l,0)
+nod2.mass= xc.Matrix([[m,0],[0,m]])
+
+# Materials definition
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+
+# Element definition.
+elementos= preprocessor.getElementLoader
+elementos.dimElem= 2 #Bidimensional space.
+elementos.defaultMaterial= "elast"
+elementos.defaultTag= 1 #Next element number.
+truss= elementos.newElement("truss",xc.ID([1,2]));
+truss.area= A
+
+coacciones= preprocessor.getConstraintLoader
+spc= coacciones.newSPConstraint(1,0,0.0)
+spc= coacciones.newSPConstraint(1,1,0.0)
+spc= coacciones.newSPConstraint(2,1,0.0)
+
+# Loads definition
+cargas= preprocessor.getLoadLoader
+casos= cargas.getLoadPatterns
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+lp0= casos.newLoadPattern("default","0")
+lp0.newNodalLoad(2,xc.Vector([F,0]))
+casos.addToDomain("0")
+
+# Recorders (displacement of node 2 on each commit).
+txtName= "/tmp/checkpoint_restart_01.txt"
+txtHandler= xc.DataOutputFileHandler(txtName)
+txtRecorder= prb.getDomain.newRecorder("node_recorder",txtHandler)
+txtRecorder.setup(xc.ID([0]),xc.ID([2]),"disp")
+h5Name= "/tmp/checkpoint_restart_01.h5"
+store= xc.HDF5ResultsStore(h5Name)
+h5Handler= xc.DataOutputHDF5Handler(store,"disp")
+h5Recorder= prb.getDomain.newRecorder("node_recorder",h5Handler)
+h5Recorder.setup(xc.ID([0]),xc.ID([2]),"disp")
+
+# Solution procedure
+solu= prb.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+cHandler= sm.newConstraintHandler("transformation_constraint_handler")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("rcm")
+solMethods= solCtrl.getSoluMethodContainer
+smt= solMethods.newSoluMethod("smt","sm")
+solAlgo= smt.newSolutionAlgorithm("newton_raphson_soln_algo")
+ctest= smt.newConvergenceTest("norm_disp_incr_conv_test")
+ctest.tol= 1.0e-9
+ctest.maxNumIter= 10
+integ= smt.newIntegrator("newmark_integrator",xc.Vector([]))
+soe= smt.newSystemOfEqn("band_gen_lin_soe")
+solver= soe.newSolver("band_gen_lin_lapack_solver")
+analisis= solu.newAnalysis("direct_integration_analysis","smt","")
+fileName= "/tmp/checkpoint_restart_01.ckpt"
+analisis.setCheckpoint(fileName,10) # Checkpoint each 10 steps.
+
+dT= 0.01
+analisis.analyze(13,dT)
+u13= nod2.getDisp[0]
+v13= nod2.getVel[0]
+prb.getDomain.flushRecorders()
+txt13= open(txtName).read()
+# Back to step 10.
+numSteps= analisis.restart()
+ok1= (numSteps==10) and (analisis.numCommittedSteps==10)
+analisis.analyze(3,dT)
+ok2= (nod2.getDisp[0]==u13) and (nod2.getVel[0]==v13)
+prb.getDomain.flushRecorders()
+ok3= (open(txtName).read()==txt13) and (store.getNumRows("disp")==13)
+ok3= ok3 and (store.readRows("disp",12,1)(0,0)==u13)
+uTeor= F/k*(1-math.cos(omega*13*dT))
+ratio= abs(u13-uTeor)/(F/k)
+prb.getDomain.removeRecorders()
+store.close()
+os.system("rm -f "+fileName+" "+txtName+" "+h5Name) # Your garbage you clean it
+
+''' 
+print "u13= ",u13
+print "u13 after restart= ",nod2.getDisp[0]
+print "uTeor= ",uTeor
+print "ratio= ",ratio
+   '''
+
+fname= os.path.basename(__file__)
+if ok1 & ok2 & ok3 & (ratio<0.05):
+  print "test ",fname,": ok."
+else:
+  print "test ",fname,": ERROR."
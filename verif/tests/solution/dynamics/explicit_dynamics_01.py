@@ -0,0 +1,105 @@
+# -*- coding: utf-8 -*-
+''' Explicit dynamic analysis of a mass-spring system under
+   a suddenly applied constant load. The maximum displacement
+   must be twice the static one: u(t)= F/k*(1-cos(w*t)).'''
+
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+import math
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 1e6 # Elastic modulus.
+A= 1e-2 # Bar area.
+l= 1.0 # Bar length.
+m= 100.0 # Mass.
+F= 1000.0 # Load.
+k= E*A/l # Spring stiffness.
+omega= math.sqrt(k/m)
+
+prb= xc.ProblemaEF()
+preprocessor=  prb.getPreprocessor
+nodes= preprocessor.getNodeLoader
+
+# Problem type
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+
+nodes.defaultTag= 1 #First node number.
+nodes.newNodeXY(0,0)
+nod2= nodes.newNodeXY(l,0)
+nod2.mass= xc.Matrix([[m,0],[0,m]])
+
+# Materials definition
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+
+# Element definition.
+elementos= preprocessor.getElementLoader
+elementos.dimElem= 2 #Bidimensional space.
+elementos.defaultMaterial= "elast"
+elementos.defaultTag= 1 #Next element number.
+truss= elementos.newElement("truss",xc.ID([1,2]));
+truss.area= A
+
+coacciones= preprocessor.getConstraintLoader
+spc= coacciones.newSPConstraint(1,0,0.0)
+spc= coacciones.newSPConstraint(1,1,0.0)
+spc= coacciones.newSPConstraint(2,1,0.0)
+
+# Loads definition
+cargas= preprocessor.getLoadLoader
+casos= cargas.getLoadPatterns
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+lp0= casos.newLoadPattern("default","0")
+lp0.newNodalLoad(2,xc.Vector([F,0]))
+casos.addToDomain("0")
+
+# Solution
+analisis= predefined_solutions.explicit_dynamics(prb)
+dT= 0.01
+uMax= 0.0
+for i in range(0,40):
+  analisis.analyze(1,dT)
+  uMax= max(uMax,nod2.getDisp[0])
+numSubsteps1= analisis.getNumSubsteps()
+
+# Stable time step estimation (Gershgorin): 2/sqrt(2*k/m)
+dtStableTeor= 2.0/math.sqrt(2.0*k/m)
+dtStable= analisis.getStableTimeStep()
+# Subcycling.
+analisis.analyze(1,0.3)
+numSubsteps2= analisis.getNumSubsteps()
+
+# Ground motion load patterns are not supported.
+lp1= casos.newLoadPattern("uniform_excitation","1")
+casos.addToDomain("1")
+result= analisis.analyze(1,dT)
+
+ratio1= abs(uMax-2*F/k)/(2*F/k)
+ratio2= abs(dtStable-dtStableTeor)/dtStableTeor
+
+''' 
+print "uMax= ",uMax
+print "2*F/k= ",2*F/k
+print "ratio1= ",ratio1
+print "dtStable= ",dtStable
+print "ratio2= ",ratio2
+print "numSubsteps1= ",numSubsteps1
+print "numSubsteps2= ",numSubsteps2
+print "result= ",result
+   '''
+
+import os
+fname= os.path.basename(__file__)
+if (ratio1<0.01) & (ratio2<1e-10) & (numSubsteps1==1) & (numSubsteps2==3) & (result<0):
+  print "test ",fname,": ok."
+else:
+  print "test ",fname,": ERROR."
@@ -0,0 +1,111 @@
+# -*- coding: utf-8 -*-
+''' Modal superposition time history of a mass-spring system
+   under a suddenly applied constant load (u(t)= F/k*(1-cos(w*t)))
+   and under a constant ground acceleration
+   (u(t)= -m*ag/k*(1-cos(w*t))). The recurrence is exact for
+   piecewise linear excitations so the results must match the
+   closed form solution.'''
+
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+import math
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 1e6 # Elastic modulus.
+A= 1e-2 # Bar area.
+l= 1.0 # Bar length.
+m= 100.0 # Mass.
+F= 1000.0 # Load.
+ag= 2.0 # Ground acceleration.
+k= E*A/l # Spring stiffness.
+omega= math.sqrt(k/m)
+
+prb= xc.ProblemaEF()
+preprocessor=  prb.getPreprocessor
+nodes= preprocessor.getNodeLoader
+
+# Problem type
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+
+nodes.defaultTag= 1 #First node number.
+nodes.newNodeXY(0,0)
+nod2= nodes.newNodeXY(l,0)
+nod2.mass= xc.Matrix([[m,0],[0,m]])
+
+# Materials definition
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+
+# Element definition.
+elementos= preprocessor.getElementLoader
+elementos.dimElem= 2 #Bidimensional space.
+elementos.defaultMaterial= "elast"
+elementos.defaultTag= 1 #Next element number.
+truss= elementos.newElement("truss",xc.ID([1,2]));
+truss.area= A
+
+coacciones= preprocessor.getConstraintLoader
+spc= coacciones.newSPConstraint(1,0,0.0)
+spc= coacciones.newSPConstraint(1,1,0.0)
+spc= coacciones.newSPConstraint(2,1,0.0)
+
+# Eigenpairs
+analisis= predefined_solutions.frequency_analysis(prb)
+analOk= analisis.analyze(1)
+
+# Modal superposition
+mth= xc.ModalTimeHistory(analisis)
+mth.setDampingRatio(0.0)
+iDOF= mth.addRecordedDOF(2,0)
+mth.addNodalLoad(2,xc.Vector([F,0]))
+mth.setGroundMotionDirection(xc.Vector([1,0]))
+
+nSteps= 100
+dT= 0.01
+uLoad= mth.computeLoadResponse(xc.Vector([1.0]*nSteps),dT)
+err1= 0.0
+for i in range(0,nSteps):
+  t= i*dT
+  uTeor= F/k*(1-math.cos(omega*t))
+  err1= max(err1,abs(uLoad(i,iDOF)-uTeor))
+ratio1= err1/(F/k)
+
+records= xc.Matrix([[ag]*nSteps,[2*ag]*nSteps])
+responses= mth.computeGroundMotionResponses(records,dT)
+err2= 0.0
+for i in range(0,nSteps):
+  t= i*dT
+  uTeor= -m*ag/k*(1-math.cos(omega*t))
+  err2= max(err2,abs(responses[0](i,iDOF)-uTeor))
+  err2= max(err2,abs(responses[1](i,iDOF)-2*uTeor))
+ratio2= err2/(m*ag/k)
+
+# Element response at a given step.
+mth.computeLoadResponse(xc.Vector([1.0]*nSteps),dT)
+step= 31
+mth.setDomainResponse(step)
+uTeor= F/k*(1-math.cos(omega*step*dT))
+ratio3= abs(nod2.getDisp[0]-uTeor)/(F/k)
+ratio4= abs(truss.getN()-k*uTeor)/F
+
+''' 
+print "ratio1= ",ratio1
+print "ratio2= ",ratio2
+print "ratio3= ",ratio3
+print "ratio4= ",ratio4
+   '''
+
+import os
+fname= os.path.basename(__file__)
+if (ratio1<1e-9) & (ratio2<1e-9) & (ratio3<1e-9) & (ratio4<1e-9):
+  print "test ",fname,": ok."
+else:
+  print "test ",fname,": ERROR."
@@ -0,0 +1,126 @@
+# -*- coding: utf-8 -*-
+''' Runs a mass-spring system under a suddenly applied load
+   scaled by several factors using forked workers. The peak
+   displacement must be 2*scale*F/k and the run must stop
+   when the collapse criterion is reached.'''
+
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from solution import multi_record_runner
+from model import predefined_spaces
+from materials import typical_materials
+import math
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 1e6 # Elastic modulus.
+A= 1e-2 # Bar area.
+l= 1.0 # Bar length.
+m= 100.0 # Mass.
+F= 1000.0 # Load.
+k= E*A/l # Spring stiffness.
+omega= math.sqrt(k/m)
+T= 2*math.pi/omega
+
+prb= xc.ProblemaEF()
+preprocessor=  prb.getPreprocessor
+nodes= preprocessor.getNodeLoader
+
+# Problem type
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+
+nodes.defaultTag= 1 #First node number.
+nodes.newNodeXY(0,0)
+nod2= nodes.newNodeXY(l,0)
+nod2.mass= xc.Matrix([[m,0],[0,m]])
+
+# Materials definition
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+
+# Element definition.
+elementos= preprocessor.getElementLoader
+elementos.dimElem= 2 #Bidimensional space.
+elementos.defaultMaterial= "elast"
+elementos.defaultTag= 1 #Next element number.
+truss= elementos.newElement("truss",xc.ID([1,2]));
+truss.area= A
+
+coacciones= preprocessor.getConstraintLoader
+spc= coacciones.newSPConstraint(1,0,0.0)
+spc= coacciones.newSPConstraint(1,1,0.0)
+spc= coacciones.newSPConstraint(2,1,0.0)
+
+cargas= preprocessor.getLoadLoader
+casos= cargas.getLoadPatterns
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+
+# Solution procedure (built once).
+solu= prb.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+cHandler= sm.newConstraintHandler("transformation_constraint_handler")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("rcm")
+solMethods= solCtrl.getSoluMethodContainer
+smt= solMethods.newSoluMethod("smt","sm")
+solAlgo= smt.newSolutionAlgorithm("newton_raphson_soln_algo")
+ctest= smt.newConvergenceTest("norm_disp_incr_conv_test")
+ctest.tol= 1.0e-9
+ctest.maxNumIter= 10
+integ= smt.newIntegrator("newmark_integrator",xc.Vector([]))
+soe= smt.newSystemOfEqn("band_gen_lin_soe")
+solver= soe.newSolver("band_gen_lin_lapack_solver")
+analisis= solu.newAnalysis("direct_integration_analysis","smt","")
+
+def applyCase(case):
+  lp= casos.newLoadPattern("default",case.record)
+  lp.newNodalLoad(2,xc.Vector([F*case.scale,0]))
+  casos.addToDomain(case.record)
+
+def recorder(case,step):
+  return nod2.getDisp[0]
+
+uCollapse= 2.5*F/k
+def collapse(case,u):
+  return (u>uCollapse)
+
+numSteps= 100
+task= multi_record_runner.TimeHistoryTask(analisis,numSteps,T/numSteps,applyCase,recorder,collapse)
+scales= [0.5,1.0,2.0]
+cases= list()
+for s in scales:
+  cases.append(multi_record_runner.RunCase('step',s))
+runner= multi_record_runner.MultiRecordRunner(2)
+results= runner.run(cases,task)
+
+ratio1= 0.0
+for i in range(0,2):
+  uMax= max(results[i]['history'])
+  ratio1= max(ratio1,abs(uMax-2*scales[i]*F/k)/(2*scales[i]*F/k))
+collapsedOk= (not results[0]['collapsed']) and (not results[1]['collapsed']) and results[2]['collapsed']
+stepsOk= (results[0]['numSteps']==numSteps) and (results[2]['numSteps']<numSteps/2)
+# The parent model must remain untouched.
+parentOk= (abs(nod2.getDisp[0])<1e-15) and (casos.getKeys()==[])
+
+''' 
+print "results= ",results
+print "ratio1= ",ratio1
+print "collapsedOk= ",collapsedOk
+print "stepsOk= ",stepsOk
+print "parentOk= ",parentOk
+   '''
+
+import os
+fname= os.path.basename(__file__)
+if (ratio1<1e-2) & collapsedOk & stepsOk & parentOk:
+  print "test ",fname,": ok."
+else:
+  print "test ",fname,": ERROR."
@@ -0,0 +1,169 @@
+# -*- coding: utf-8 -*-
+''' Response spectrum analysis with ModalResponseSpectrum.
+Same model that in test_cqc_01.py (example A87 of the Solvia
+Verification Manual, based on the example E26.8 of the
+book «Dynamics of Structures» by Clough, R. W., and Penzien, J.). '''
+import xc_base
+import geom
+import xc
+
+from model import fix_node_3dof
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+import math
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+masaExtremo= 1e-2 # Masa en kg.
+matrizMasasNodo= xc.Matrix([[masaExtremo,0,0,0,0,0],
+                                         [0,masaExtremo,0,0,0,0],
+                                         [0,0,masaExtremo,0,0,0],
+                                         [0,0,0,0,0,0],
+                                         [0,0,0,0,0,0],
+                                         [0,0,0,0,0,0]])
+EMat= 1 # Elastic modulus.
+nuMat= 0 # Poisson's ratio.
+GMat= EMat/(2.0*(1+nuMat)) # Shear modulus.
+
+Iyy= 1 # Inercia a flexión eje y.
+Izz= 1 # Inercia a flexión eje z.
+Ir= 4/3.0 # Inercia a torsion.
+area= 1e7 # Area de la sección.
+Lx= 1
+Ly= 1
+Lz= 1
+
+
+# Problem type
+prueba= xc.ProblemaEF()
+preprocessor=  prueba.getPreprocessor
+nodes= preprocessor.getNodeLoader
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+nod0= nodes.newNodeIDXYZ(0,0,0,0)
+nod1= nodes.newNodeXYZ(0,-Ly,0)
+nod2= nodes.newNodeXYZ(0,-Ly,-Lz)
+nod3= nodes.newNodeXYZ(Lx,-Ly,-Lz)
+nod3.mass= matrizMasasNodo
+
+coacciones= preprocessor.getConstraintLoader
+nod0.fix(xc.ID([0,1,2,3,4,5]),xc.Vector([0,0,0,0,0,0]))
+
+# Materials definition
+scc= typical_materials.defElasticSection3d(preprocessor, "scc",area,EMat,GMat,Izz,Iyy,Ir)
+
+# Geometric transformation(s)
+linX= preprocessor.getTransfCooLoader.newLinearCrdTransf3d("linX")
+linX.xzVector= xc.Vector([1,0,0])
+linY= preprocessor.getTransfCooLoader.newLinearCrdTransf3d("linY")
+linY.xzVector= xc.Vector([0,1,0])
+
+# Elements definition
+elementos= preprocessor.getElementLoader
+elementos.defaultTransformation= "linX"
+elementos.defaultMaterial= "scc"
+beam3d= elementos.newElement("elastic_beam_3d",xc.ID([0,1]))
+beam3d= elementos.newElement("elastic_beam_3d",xc.ID([1,2]))
+elementos.defaultTransformation= "linY"
+beam3d= elementos.newElement("elastic_beam_3d",xc.ID([2,3]))
+
+
+# Procedimiento de solución
+solu= prueba.getSoluProc
+solCtrl= solu.getSoluControl
+
+
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+
+
+cHandler= sm.newConstraintHandler("transformation_constraint_handler")
+
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("rcm")
+
+solMethods= solCtrl.getSoluMethodContainer
+smt= solMethods.newSoluMethod("smt","sm")
+solAlgo= smt.newSolutionAlgorithm("frequency_soln_algo")
+integ= smt.newIntegrator("eigen_integrator",xc.Vector([1.0,1,1.0,1.0]))
+
+soe= smt.newSystemOfEqn("full_gen_eigen_soe")
+solver= soe.newSolver("full_gen_eigen_solver")
+
+analysis= solu.newAnalysis("modal_analysis","smt","")
+analOk= analysis.analyze(3)
+periodos= analysis.getPeriods()
+aceleraciones= [2.27,2.45,6.98]
+
+# Spectrum that gives the accelerations of the example
+# for the computed periods.
+spectrum= geom.FunctionGraph1D()
+for i in [2,1,0]:
+  spectrum.append(periodos[i],aceleraciones[i])
+
+rsa= xc.ModalResponseSpectrum(analysis)
+rsa.setDampingRatio(0.05)
+rsa.addSpectrum(spectrum,xc.Vector([1,0,0,0,0,0]))
+rsa.modalCombination= "CQC"
+rsa.analyze()
+dispCQC= rsa.getNodeDisplacement(nod3.tag)
+maxDispCQC= xc.Vector([dispCQC[0],dispCQC[1],dispCQC[2]])
+maxDispCQCTeor= xc.Vector([46.53e-3,19.18e-3,52.53e-3])
+ratio1= (maxDispCQC-maxDispCQCTeor).Norm()
+
+# SRSS (modal displacements from the Solvia manual)
+maxDispModTeor= [[36.202e-3,-11.549e-3,49.548e-3],[7.123e-3,26.38e-3,0.945e-3],[19.625e-3,-4.746e-3,-15.445e-3]]
+rsa.modalCombination= "SRSS"
+rsa.analyze()
+dispSRSS= rsa.getNodeDisplacement(nod3.tag)
+err= 0.0
+for k in range(0,3):
+  s= 0.0
+  for i in range(0,3):
+    s+= maxDispModTeor[i][k]**2
+  err= max(err,abs(dispSRSS[k]-math.sqrt(s)))
+ratio2= err
+
+# 100/30 directional combination.
+rsa.modalCombination= "CQC"
+rsa.addSpectrum(spectrum,xc.Vector([0,1,0,0,0,0]))
+rsa.analyze()
+rx= rsa.getNodeDisplacement(nod3.tag)
+rsa.clearSpectra()
+rsa.addSpectrum(spectrum,xc.Vector([0,1,0,0,0,0]))
+rsa.analyze()
+ry= rsa.getNodeDisplacement(nod3.tag)
+rsa.clearSpectra()
+rsa.addSpectrum(spectrum,xc.Vector([1,0,0,0,0,0]))
+rsa.addSpectrum(spectrum,xc.Vector([0,1,0,0,0,0]))
+rsa.directionalCombination= "percentage"
+rsa.analyze()
+r100_30= rsa.getNodeDisplacement(nod3.tag)
+err= 0.0
+for k in range(0,3):
+  err= max(err,abs(r100_30[k]-max(dispCQC[k]+0.3*ry[k],ry[k]+0.3*dispCQC[k])))
+ratio3= err
+reac= rsa.getNodeReaction(nod0.tag)
+ratio4= reac.Norm()
+
+''' 
+print "maxDispCQC= ",maxDispCQC*1e3
+print "maxDispCQCTeor= ",maxDispCQCTeor*1e3
+print "ratio1= ",ratio1
+print "dispSRSS= ",dispSRSS*1e3
+print "ratio2= ",ratio2
+print "r100_30= ",r100_30*1e3
+print "ratio3= ",ratio3
+print "reac= ",reac
+   '''
+
+import os
+fname= os.path.basename(__file__)
+if( (ratio1<1e-5) & (ratio2<1e-5) & (ratio3<1e-12) & (ratio4>0.0) ): 
+  print "test ",fname,": ok."
+else:
+  print "test ",fname,": ERROR."
@@ -0,0 +1,119 @@
+# -*- coding: utf-8 -*-
+''' Eigenvalues of a cantilever (example A47 of the SOLVIA Verification
+Manual) computed with the sparse symmetric shift-invert solver. The
+analysis is repeated to check that the factorization is reused
+when the matrix doesn't change.'''
+from __future__ import division
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+import math
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+L= 1 # Cantilever length in meters
+b= 0.05 # Cross section width in meters
+h= 0.10 # Cross section depth in meters
+A= b*h # Cross section area in m2
+I= 1/12.0*b*h**3 # Moment of inertia in m4
+theta= math.radians(30)
+E=2.0E11 # Elastic modulus in N/m2
+dens= 7800 # Steel density in kg/m3
+m= A*dens
+
+NumDiv= 10
+
+# Problem type
+prueba= xc.ProblemaEF()
+preprocessor=  prueba.getPreprocessor
+nodes= preprocessor.getNodeLoader
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+
+# Materials definition
+scc= typical_materials.defElasticSection2d(preprocessor, "scc",A,E,I)
+
+nodes.newSeedNode()
+
+# Geometric transformation(s)
+trfs= preprocessor.getTransfCooLoader
+lin= trfs.newLinearCrdTransf2d("lin")
+
+# Seed element
+seedElemLoader= preprocessor.getElementLoader.seedElemLoader
+seedElemLoader.defaultTransformation= "lin"
+seedElemLoader.defaultMaterial= "scc"
+seedElemLoader.defaultTag= 1 #Tag for next element.
+beam2d= seedElemLoader.newElement("elastic_beam_2d",xc.ID([0,0]))
+beam2d.h= h
+beam2d.rho= m
+
+puntos= preprocessor.getCad.getPoints
+pt= puntos.newPntIDPos3d(1,geom.Pos3d(0.0,0.0,0.0))
+pt= puntos.newPntIDPos3d(2,geom.Pos3d(L*math.cos(theta),L*math.sin(theta),0.0))
+lines= preprocessor.getCad.getLines
+lines.defaultTag= 1
+l= lines.newLine(1,2)
+l.nDiv= NumDiv
+
+# Constraints
+coacciones= preprocessor.getConstraintLoader
+spc= coacciones.newSPConstraint(1,0,0.0)
+spc= coacciones.newSPConstraint(1,1,0.0)
+spc= coacciones.newSPConstraint(1,2,0.0)
+
+setTotal= preprocessor.getSets.getSet("total")
+setTotal.genMesh(xc.meshDir.I)
+
+# Solution procedure
+solu= prueba.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+cHandler= sm.newConstraintHandler("transformation_constraint_handler")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("rcm")
+solMethods= solCtrl.getSoluMethodContainer
+smt= solMethods.newSoluMethod("smt","sm")
+solAlgo= smt.newSolutionAlgorithm("frequency_soln_algo")
+integ= smt.newIntegrator("eigen_integrator",xc.Vector([]))
+soe= smt.newSystemOfEqn("sym_arpack_soe")
+soe.shift= 0.0
+solver= soe.newSolver("sym_arpack_solver")
+solver.reuseFactorization= True # Matrix doesn't change between analyses.
+analysis= solu.newAnalysis("eigen_analysis","smt","")
+analOk= analysis.analyze(2)
+eig1= analysis.getEigenvalue(1)
+analOk= analysis.analyze(2)
+eig1b= analysis.getEigenvalue(1)
+numFactorizations= solver.numFactorizations
+
+omega= eig1**0.5
+T= 2*math.pi/omega
+fcalc= 1/T
+
+lambdA= 1.87510407
+fteor= lambdA**2/(2*math.pi*L**2)*math.sqrt(E*I/m)
+ratio1= (fcalc-fteor)/fteor
+ratio2= abs(eig1b-eig1)/eig1
+
+'''
+print "fteor= ",fteor
+print "fcalc= ",(fcalc)
+print "ratio1= ",ratio1
+print "ratio2= ",ratio2
+print "numFactorizations= ",numFactorizations
+''' 
+
+import os
+fname= os.path.basename(__file__)
+if (abs(ratio1)<1e-2) & (ratio2<1e-10) & (numFactorizations==1):
+  print "test ",fname,": ok."
+else:
+  print "test ",fname,": ERROR."
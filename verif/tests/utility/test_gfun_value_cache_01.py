@@ -0,0 +1,58 @@
+# -*- coding: utf-8 -*-
+# Cache of limit-state function values: when the cache is full
+# only the oldest value is removed.
+
+import xc_base
+import geom
+import xc
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+lsfTag= 1
+cache= xc.GFunValueCache(3)
+for i in range(0,5):
+  cache.store(xc.Vector([float(i),1.0]),lsfTag,10.0*i)
+
+ok= (cache.size==3)
+# The two oldest values are gone, the three newest ones remain.
+ok= ok and (not cache.exists(xc.Vector([0.0,1.0]),lsfTag))
+ok= ok and (not cache.exists(xc.Vector([1.0,1.0]),lsfTag))
+err= 0.0
+for i in range(2,5):
+  err+= abs(cache.getValue(xc.Vector([float(i),1.0]),lsfTag)-10.0*i)
+ok= ok and (cache.numHits==3)
+# Other limit-state function on the same point.
+ok= ok and (not cache.exists(xc.Vector([4.0,1.0]),lsfTag+1))
+
+# Updating a stored value doesn't remove anything.
+cache.store(xc.Vector([2.0,1.0]),lsfTag,21.0)
+ok= ok and (cache.size==3)
+err+= abs(cache.getValue(xc.Vector([2.0,1.0]),lsfTag)-21.0)
+
+# A new value removes the oldest one (2.0) only.
+cache.store(xc.Vector([5.0,1.0]),lsfTag,50.0)
+ok= ok and (cache.size==3)
+ok= ok and (not cache.exists(xc.Vector([2.0,1.0]),lsfTag))
+ok= ok and cache.exists(xc.Vector([3.0,1.0]),lsfTag)
+
+# Reducing the size removes the oldest values.
+cache.maxSize= 1
+ok= ok and (cache.size==1) and cache.exists(xc.Vector([5.0,1.0]),lsfTag)
+cache.clear()
+ok= ok and (cache.size==0) and (cache.numHits==0)
+
+'''
+print "ok= ", ok
+print "err= ", err
+'''
+
+import os
+fname= os.path.basename(__file__)
+if(ok and (err<1e-12)):
+  print "test ",fname,": ok."
+else:
+  print "test ",fname,": ERROR."
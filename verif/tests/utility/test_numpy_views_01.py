@@ -0,0 +1,60 @@
+# -*- coding: utf-8 -*-
+''' NumPy views of Vector, Matrix and ID objects (without copying
+   the data) and construction of those objects from NumPy arrays.'''
+
+import os
+import gc
+import numpy
+import xc_base
+import geom
+import xc
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+# Vector
+v= xc.Vector([1.0,2.0,3.0])
+vView= numpy.asarray(v)
+vView[1]= 5.0 # modifies the vector.
+ok1= (vView.shape==(3,)) and (v[1]==5.0)
+v2= xc.Vector(numpy.array([4.0,5.0,6.0]))
+ok2= (v2.size()==3) and (v2[2]==6.0)
+
+# Matrix (stored by columns).
+m= xc.Matrix(numpy.array([[1.0,2.0,3.0],[4.0,5.0,6.0]]))
+mView= numpy.asarray(m)
+ok3= (mView.shape==(2,3)) and (mView[1,0]==4.0) and (m.at(0,2)==3.0)
+mView[0,1]= 10.0
+ok4= (m.at(0,1)==10.0) and (m.noRows==2) and (m.noCols==3)
+
+# ID
+ids= xc.ID(numpy.array([7,8,9]))
+idView= numpy.asarray(ids)
+ok5= (len(ids)==3) and (idView[2]==9)
+
+# The view keeps the object alive: delete the owner and
+# read through the array.
+owner= xc.Vector([1.0,2.0])
+vView= numpy.asarray(owner)
+del owner
+gc.collect()
+garbage= [xc.Vector([-1.0,-1.0]) for i in range(0,100)] # reuse freed memory.
+ok6= (vView.sum()==3.0) and (vView[0]==1.0) and (vView[1]==2.0)
+
+''' 
+print "ok1= ",ok1
+print "ok2= ",ok2
+print "ok3= ",ok3
+print "ok4= ",ok4
+print "ok5= ",ok5
+print "ok6= ",ok6
+   '''
+
+fname= os.path.basename(__file__)
+if ok1 & ok2 & ok3 & ok4 & ok5 & ok6:
+  print "test ",fname,": ok."
+else:
+  print "test ",fname,": ERROR."
@@ -0,0 +1,66 @@
+# -*- coding: utf-8 -*-
+# Counter based random number generator (Philox4x32-10): known
+# answers and stratification of the latin hypercube samples.
+
+import xc_base
+import geom
+import xc
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+# Known answers (seed, stream, position, value). The Philox rounds
+# reproduce the Random123 known answer vectors.
+knownAnswers= [(1,0,0,0.77304770269144063),
+               (1,0,1,0.30388167350855216),
+               (1,5,2,0.060982665237444056),
+               (12345,7,3,0.98735301118357688)]
+err= 0.0
+for (seed,stream,pos,value) in knownAnswers:
+  rng= xc.PhiloxRandGenerator(seed)
+  err+= abs(rng.getUniformNumber(stream,pos)-value)
+
+# The numbers are a pure function of (seed, stream, position).
+rng= xc.PhiloxRandGenerator(1)
+v= xc.Vector([0.0,0.0,0.0])
+rng.fillUniformNumbers(0,v,0.0,1.0)
+for i in range(0,3):
+  err+= abs(v[i]-rng.getUniformNumber(0,i))
+
+# Latin hypercube: each column has exactly one value in each
+# of the intervals [k/n,(k+1)/n).
+numSamples= 50
+numVariables= 4
+lhs= rng.getLatinHypercubeSample(numSamples,numVariables)
+stratified= (lhs.noRows==numSamples) and (lhs.noCols==numVariables)
+for j in range(0,numVariables):
+  strata= [0]*numSamples
+  for i in range(0,numSamples):
+    p= lhs(i,j)
+    k= int(p*numSamples)
+    if((p<=0.0) or (p>=1.0)):
+      stratified= False
+    else:
+      strata[k]+= 1
+  stratified= stratified and (strata==[1]*numSamples)
+# Different variables use different permutations.
+sameColumns= True
+for i in range(0,numSamples):
+  if(int(lhs(i,0)*numSamples)!=int(lhs(i,1)*numSamples)):
+    sameColumns= False
+
+'''
+print "err= ", err
+print "stratified= ", stratified
+print "sameColumns= ", sameColumns
+'''
+
+import os
+fname= os.path.basename(__file__)
+if((err==0.0) and stratified and (not sameColumns)):
+  print "test ",fname,": ok."
+else:
+  print "test ",fname,": ERROR."
@@ -0,0 +1,74 @@
+# -*- coding: utf-8 -*-
+# Communication through shared memory channels: worker process
+# started by the local machine broker, data larger than the ring
+# and peer process that ends before connecting.
+
+import xc_base
+import geom
+import xc
+import os
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2017, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+# Worker process started by the broker: an ID with a zero
+# asks it to end and it answers with the same ID.
+broker= xc.LocalMachineBroker(xc.ProblemaEF.getObjectBroker(),1,0)
+channel= broker.getRemoteProcess()
+ok1= (channel!=None)
+if(ok1):
+  ok1= (channel.sendID(0,0,xc.ID([0]),None)==0)
+  answer= xc.ID([5])
+  ok1= ok1 and (channel.recvID(0,0,answer,None)==0) and (answer[0]==0)
+  ok1= ok1 and (broker.freeProcess(channel)==0)
+
+# Vector bigger than the rings (it is streamed in chunks).
+sz= 1000
+channel= xc.SharedMemoryChannel(64)
+pid= os.fork()
+if(pid==0): # child: sends back twice the vector.
+  c= xc.SharedMemoryChannel(channel.segmentName)
+  v= xc.Vector([0.0]*sz)
+  retval= c.setUpConnection()
+  if(retval==0):
+    retval= c.recvVector(0,0,v,None)
+  if(retval==0):
+    retval= c.sendVector(0,0,v*2.0,None)
+  os._exit(0 if (retval==0) else 1)
+channel.setPeerPID(pid)
+ok2= (channel.setUpConnection()==0)
+v= xc.Vector([float(i) for i in range(0,sz)])
+ok2= ok2 and (channel.sendVector(0,0,v,None)==0)
+w= xc.Vector([0.0]*sz)
+ok2= ok2 and (channel.recvVector(0,0,w,None)==0)
+err= (w-v*2.0).Norm()
+try:
+  (p,status)= os.waitpid(pid,0)
+except OSError: # already reaped by the channel.
+  status= 0
+ok2= ok2 and (status==0)
+
+# The peer ends without attaching: setUpConnection must
+# return an error instead of waiting forever.
+channel= xc.SharedMemoryChannel(64)
+pid= os.fork()
+if(pid==0):
+  os._exit(0)
+channel.setPeerPID(pid)
+ok3= (channel.setUpConnection()<0)
+
+'''
+print "ok1= ", ok1
+print "ok2= ", ok2
+print "err= ", err
+print "ok3= ", ok3
+'''
+
+fname= os.path.basename(__file__)
+if(ok1 and ok2 and (err<1e-12) and ok3):
+  print "test ",fname,": ok."
+else:
+  print "test ",fname,": ERROR."